@@ -0,0 +1,213 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : In-process MQTT broker stand-in with configurable RTT, loss
+*               and bandwidth, seen by the gateway code as its network client
+*****************************************************************************/
+
+#include "LoopbackBroker.h"
+
+LoopbackBroker::LoopbackBroker(unsigned long rttMs, float _loss, unsigned long bytesPerSecond){
+    rtt = rttMs * 1000;
+    loss = _loss;
+    bandwidth = bytesPerSecond;
+    open = false;
+    linkFreeAt = 0;
+    readPos = 0;
+    publishes = 0;
+    duplicates = 0;
+    dropped = 0;
+    bytesIn = 0;
+}
+
+int LoopbackBroker::connect(IPAddress ip, uint16_t port){
+    return connect("loopback", port);
+}
+
+int LoopbackBroker::connect(const char *host, uint16_t port){
+    inbound.clear();
+    outbound.clear();
+    readable.clear();
+    readPos = 0;
+    linkFreeAt = micros();
+    open = true;
+    return 1;
+}
+
+size_t LoopbackBroker::write(uint8_t b){
+    return write(&b, 1);
+}
+
+// The packet occupies the uplink for size/bandwidth, then reaches the broker
+size_t LoopbackBroker::write(const uint8_t *buf, size_t size){
+    if(!open){
+        return 0;
+    }
+    unsigned long now = micros();
+    unsigned long start = linkFreeAt > now ? linkFreeAt : now;
+    unsigned long serialization = bandwidth ? (unsigned long)((uint64_t)size * 1000000 / bandwidth) : 0;
+    linkFreeAt = start + serialization;
+
+    inbound.insert(inbound.end(), buf, buf + size);
+    bytesIn += size;
+    parse(linkFreeAt);
+    return size;
+}
+
+void LoopbackBroker::parse(unsigned long arrival){
+    while(inbound.size() >= 2){
+        uint32_t remaining = 0;
+        uint32_t multiplier = 1;
+        size_t pos = 1;
+        bool complete = false;
+        while(pos < inbound.size() && pos <= 4){
+            uint8_t b = inbound[pos++];
+            remaining += (b & 127) * multiplier;
+            multiplier *= 128;
+            if(!(b & 128)){
+                complete = true;
+                break;
+            }
+        }
+        if(!complete || inbound.size() < pos + remaining){
+            return;
+        }
+        handle(inbound[0], inbound.data() + pos, remaining, arrival);
+        inbound.erase(inbound.begin(), inbound.begin() + pos + remaining);
+    }
+}
+
+void LoopbackBroker::handle(uint8_t header, const uint8_t *body, size_t length, unsigned long arrival){
+    switch(header >> 4){
+        case 1: // CONNECT
+            respond(arrival, {0x20, 0x02, 0x00, 0x00});
+            break;
+
+        case 3: { // PUBLISH
+            uint8_t qos = (header >> 1) & 3;
+            if((float)rand() / RAND_MAX < loss){
+                dropped++;
+                break;
+            }
+            publishes++;
+            if(qos > 0){
+                size_t topicLength = (body[0] << 8) | body[1];
+                uint8_t idH = body[2 + topicLength];
+                uint8_t idL = body[3 + topicLength];
+                uint16_t id = (idH << 8) | idL;
+                if(!seenIds.insert(id).second){
+                    duplicates++;
+                }
+                respond(arrival, {0x40, 0x02, idH, idL});
+            }
+            break;
+        }
+
+        case 8: { // SUBSCRIBE
+            std::vector<uint8_t> suback = {0x90, 0x00, body[0], body[1]};
+            size_t pos = 2;
+            while(pos + 2 < length){
+                size_t topicLength = (body[pos] << 8) | body[pos + 1];
+                pos += 2 + topicLength;
+                suback.push_back(body[pos++] & 3);
+            }
+            suback[1] = suback.size() - 2;
+            respond(arrival, suback);
+            break;
+        }
+
+        case 12: // PINGREQ
+            respond(arrival, {0xD0, 0x00});
+            break;
+
+        case 14: // DISCONNECT
+            open = false;
+            break;
+
+        default:
+            break;
+    }
+}
+
+void LoopbackBroker::respond(unsigned long arrival, const std::vector<uint8_t> &bytes){
+    Response response;
+    response.due = arrival + rtt;
+    response.bytes = bytes;
+    outbound.push_back(response);
+}
+
+// Moves the answers whose time has come to the readable buffer
+void LoopbackBroker::pump(){
+    unsigned long now = micros();
+    while(!outbound.empty() && outbound.front().due <= now){
+        readable.insert(readable.end(), outbound.front().bytes.begin(), outbound.front().bytes.end());
+        outbound.pop_front();
+    }
+    if(readPos > 0 && readPos == readable.size()){
+        readable.clear();
+        readPos = 0;
+    }
+}
+
+int LoopbackBroker::available(){
+    pump();
+    return readable.size() - readPos;
+}
+
+int LoopbackBroker::read(){
+    pump();
+    if(readPos >= readable.size()){
+        return -1;
+    }
+    return readable[readPos++];
+}
+
+int LoopbackBroker::read(uint8_t *buf, size_t size){
+    pump();
+    size_t len = readable.size() - readPos;
+    if(len > size){
+        len = size;
+    }
+    memcpy(buf, readable.data() + readPos, len);
+    readPos += len;
+    return len;
+}
+
+int LoopbackBroker::peek(){
+    pump();
+    if(readPos >= readable.size()){
+        return -1;
+    }
+    return readable[readPos];
+}
+
+void LoopbackBroker::flush(){
+}
+
+void LoopbackBroker::stop(){
+    open = false;
+    inbound.clear();
+    outbound.clear();
+    readable.clear();
+    readPos = 0;
+}
+
+uint8_t LoopbackBroker::connected(){
+    return open || available() > 0;
+}
+
+LoopbackBroker::operator bool(){
+    return open;
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : In-process MQTT broker stand-in with configurable RTT, loss
+*               and bandwidth, seen by the gateway code as its network client
+*****************************************************************************/
+
+#ifndef _LOOPBACK_BROKER_
+#define _LOOPBACK_BROKER_
+
+#include <Arduino.h>
+#include <Client.h>
+#include <deque>
+#include <set>
+#include <vector>
+
+// Answers CONNECT, SUBSCRIBE, PUBLISH (QoS 0/1) and PINGREQ. Every packet the
+// client writes goes through a serial link of the given bandwidth and its
+// answer becomes readable one RTT after the packet left the link. Inbound
+// PUBLISH packets are dropped with probability "loss" (no PUBACK).
+class LoopbackBroker : public Client {
+    public:
+        LoopbackBroker(unsigned long rttMs, float loss, unsigned long bytesPerSecond);
+
+        uint32_t publishes;     // PUBLISH packets accepted
+        uint32_t duplicates;    // QoS 1 ids seen before (retransmissions)
+        uint32_t dropped;       // PUBLISH packets lost on purpose
+        uint64_t bytesIn;
+
+        int connect(IPAddress ip, uint16_t port);
+        int connect(const char *host, uint16_t port);
+        size_t write(uint8_t b);
+        size_t write(const uint8_t *buf, size_t size);
+        int available();
+        int read();
+        int read(uint8_t *buf, size_t size);
+        int peek();
+        void flush();
+        void stop();
+        uint8_t connected();
+        operator bool();
+
+    private:
+        struct Response {
+            unsigned long due;  // micros() when readable by the client
+            std::vector<uint8_t> bytes;
+        };
+
+        unsigned long rtt;      // us
+        float loss;
+        unsigned long bandwidth;
+        bool open;
+        unsigned long linkFreeAt;
+
+        std::vector<uint8_t> inbound;   // client bytes not yet parsed
+        std::deque<Response> outbound;  // answers waiting for their due time
+        std::vector<uint8_t> readable;
+        size_t readPos;
+        std::set<uint16_t> seenIds;
+
+        void parse(unsigned long arrival);
+        void handle(uint8_t header, const uint8_t *body, size_t length, unsigned long arrival);
+        void respond(unsigned long arrival, const std::vector<uint8_t> &bytes);
+        void pump();
+};
+
+#endif
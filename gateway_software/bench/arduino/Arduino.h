@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Arduino API for building gateway code on Linux (bench)
+*****************************************************************************/
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+// Subset of the Arduino String used by the gateway and the IoT Core library
+class String {
+    public:
+        String() {}
+        String(const char *s) : str(s ? s : "") {}
+        String(const std::string &s) : str(s) {}
+        String(char c) : str(1, c) {}
+        String(int value) : str(std::to_string(value)) {}
+        String(unsigned int value) : str(std::to_string(value)) {}
+        String(long value) : str(std::to_string(value)) {}
+        String(unsigned long value) : str(std::to_string(value)) {}
+        String(long long value) : str(std::to_string(value)) {}
+        String(unsigned long long value) : str(std::to_string(value)) {}
+        String(float value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+        String(double value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+
+        unsigned int length() const { return str.length(); }
+        const char *c_str() const { return str.c_str(); }
+        char operator[](unsigned int i) const { return i < str.length() ? str[i] : 0; }
+        char &operator[](unsigned int i) { return str[i]; }
+
+        int indexOf(char c, unsigned int from = 0) const {
+            size_t i = str.find(c, from);
+            return i == std::string::npos ? -1 : (int)i;
+        }
+        int indexOf(const String &s, unsigned int from = 0) const {
+            size_t i = str.find(s.str, from);
+            return i == std::string::npos ? -1 : (int)i;
+        }
+        String substring(unsigned int from) const {
+            return from >= str.length() ? String() : String(str.substr(from));
+        }
+        String substring(unsigned int from, unsigned int to) const {
+            if (from > to) { unsigned int t = from; from = to; to = t; }
+            if (from >= str.length()) return String();
+            return String(str.substr(from, to - from));
+        }
+        long toInt() const { return atol(str.c_str()); }
+        float toFloat() const { return atof(str.c_str()); }
+        bool reserve(unsigned int size) { str.reserve(size); return true; }
+
+        bool concat(const String &s) { str += s.str; return true; }
+        String &operator+=(const String &s) { str += s.str; return *this; }
+        String &operator+=(const char *s) { str += s; return *this; }
+        String &operator+=(char c) { str += c; return *this; }
+
+        bool operator==(const String &s) const { return str == s.str; }
+        bool operator==(const char *s) const { return str == s; }
+        bool operator!=(const String &s) const { return str != s.str; }
+        bool operator!=(const char *s) const { return str != s; }
+
+        friend String operator+(const String &a, const String &b) { return String(a.str + b.str); }
+        friend String operator+(const String &a, const char *b) { return String(a.str + b); }
+        friend String operator+(const char *a, const String &b) { return String(a + b.str); }
+        friend String operator+(const String &a, char b) { return String(a.str + b); }
+        friend String operator+(const String &a, int b) { return a + String(b); }
+        friend String operator+(const String &a, unsigned int b) { return a + String(b); }
+        friend String operator+(const String &a, long b) { return a + String(b); }
+        friend String operator+(const String &a, unsigned long b) { return a + String(b); }
+        friend String operator+(const String &a, float b) { return a + String(b); }
+        friend String operator+(const String &a, double b) { return a + String(b); }
+
+    private:
+        std::string str;
+
+        void fromDouble(double value, unsigned int decimals) {
+            char buf[64];
+            snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+            str = buf;
+        }
+};
+
+// Serial goes to stdout
+class HostSerial {
+    public:
+        void begin(unsigned long) {}
+        int available() { return 0; }
+        int read() { return -1; }
+        void print(const String &s) { fputs(s.c_str(), stdout); }
+        void print(const char *s) { fputs(s, stdout); }
+        void print(char c) { fputc(c, stdout); }
+        void print(int v) { printf("%d", v); }
+        void print(unsigned int v) { printf("%u", v); }
+        void print(long v) { printf("%ld", v); }
+        void print(unsigned long v) { printf("%lu", v); }
+        void print(double v) { printf("%.2f", v); }
+        template <typename T> void println(T v) { print(v); fputc('\n', stdout); }
+        void println() { fputc('\n', stdout); }
+        int printf(const char *format, ...) {
+            va_list args;
+            va_start(args, format);
+            int n = vprintf(format, args);
+            va_end(args);
+            return n;
+        }
+};
+
+extern HostSerial Serial;
+
+#endif
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Arduino Client for building gateway code on Linux (bench)
+*****************************************************************************/
+
+#ifndef _HOST_CLIENT_H_
+#define _HOST_CLIENT_H_
+
+#include <Arduino.h>
+#include <Stream.h>
+
+#include <string.h>
+
+// Octets kept in network order, operator uint32_t matches the ESP32 core
+class IPAddress {
+    public:
+        IPAddress() { memset(octets, 0, sizeof(octets)); }
+        IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+            octets[0] = a;
+            octets[1] = b;
+            octets[2] = c;
+            octets[3] = d;
+        }
+
+        operator uint32_t() const {
+            uint32_t address;
+            memcpy(&address, octets, sizeof(address));
+            return address;
+        }
+
+    private:
+        uint8_t octets[4];
+};
+
+class Client : public Stream {
+    public:
+        virtual int connect(IPAddress ip, uint16_t port) = 0;
+        virtual int connect(const char *host, uint16_t port) = 0;
+        virtual size_t write(uint8_t b) = 0;
+        virtual size_t write(const uint8_t *buf, size_t size) = 0;
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int read(uint8_t *buf, size_t size) = 0;
+        virtual int peek() = 0;
+        virtual void flush() = 0;
+        virtual void stop() = 0;
+        virtual uint8_t connected() = 0;
+        virtual operator bool() = 0;
+};
+
+#endif
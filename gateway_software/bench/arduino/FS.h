@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : File-backed Arduino FS for building gateway code on Linux (bench)
+*****************************************************************************/
+
+#ifndef _HOST_FS_H_
+#define _HOST_FS_H_
+
+#include <Arduino.h>
+#include <memory>
+#include <sys/stat.h>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+// Subset of the ESP32 File, a shared handle like the real one
+class File {
+    public:
+        File() {}
+        File(FILE *f, size_t *budget) : handle(f, fclose), budget(budget) {}
+
+        operator bool() const { return handle != NULL; }
+        void close() { handle.reset(); }
+
+        size_t size() {
+            long pos = ftell(handle.get());
+            fseek(handle.get(), 0, SEEK_END);
+            long end = ftell(handle.get());
+            fseek(handle.get(), pos, SEEK_SET);
+            return end;
+        }
+        bool seek(uint32_t pos) { return fseek(handle.get(), pos, SEEK_SET) == 0; }
+        int available() { return size() - ftell(handle.get()); }
+        int read() { return fgetc(handle.get()); }
+        int read(uint8_t *buf, size_t len) { return fread(buf, 1, len, handle.get()); }
+
+        String readStringUntil(char terminator) {
+            std::string s;
+            int c;
+            while ((c = fgetc(handle.get())) != EOF && c != terminator) {
+                s += (char)c;
+            }
+            return String(s);
+        }
+
+        // Writes stop once the FS capacity is used up, like a full partition
+        size_t write(const uint8_t *buf, size_t len) {
+            if (budget != NULL && len > *budget) {
+                len = *budget;
+            }
+            size_t written = fwrite(buf, 1, len, handle.get());
+            fflush(handle.get());
+            if (budget != NULL) {
+                *budget -= written;
+            }
+            return written;
+        }
+        size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+        size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+
+    private:
+        std::shared_ptr<FILE> handle;
+        size_t *budget = NULL;
+};
+
+// Paths are taken relative to a host directory
+class FS {
+    public:
+        FS(const String &root) : root(root) {}
+
+        bool exists(const char *path) {
+            struct stat st;
+            return stat(full(path).c_str(), &st) == 0;
+        }
+        File open(const char *path, const char *mode) {
+            FILE *f = fopen(full(path).c_str(), mode[0] == 'r' ? "rb" : mode[0] == 'a' ? "ab" : "wb");
+            return f != NULL ? File(f, limited ? &budget : NULL) : File();
+        }
+        bool remove(const char *path) { return ::remove(full(path).c_str()) == 0; }
+        bool rename(const char *from, const char *to) { return ::rename(full(from).c_str(), full(to).c_str()) == 0; }
+
+        // Bytes that may still be written, models a partition filling up
+        void setBudget(size_t bytes) { budget = bytes; limited = true; }
+        void clearBudget() { limited = false; }
+
+    private:
+        String root;
+        size_t budget = 0;
+        bool limited = false;
+
+        String full(const char *path) { return root + path; }
+};
+
+}
+
+using fs::File;
+
+#endif
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : DateTime subset of RTClib for building gateway code on Linux
+*****************************************************************************/
+
+#ifndef _HOST_RTCLIB_H_
+#define _HOST_RTCLIB_H_
+
+#include <Arduino.h>
+
+class DateTime {
+    public:
+        DateTime(uint32_t t = 0) : t(t) {
+            time_t value = t;
+            gmtime_r(&value, &tm);
+        }
+
+        uint16_t year() const { return tm.tm_year + 1900; }
+        uint8_t month() const { return tm.tm_mon + 1; }
+        uint8_t day() const { return tm.tm_mday; }
+        uint8_t hour() const { return tm.tm_hour; }
+        uint8_t minute() const { return tm.tm_min; }
+        uint8_t second() const { return tm.tm_sec; }
+        uint32_t unixtime() const { return t; }
+
+    private:
+        uint32_t t;
+        struct tm tm;
+};
+
+#endif
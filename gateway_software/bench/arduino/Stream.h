@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Arduino Stream for building gateway code on Linux (bench)
+*****************************************************************************/
+
+#ifndef _HOST_STREAM_H_
+#define _HOST_STREAM_H_
+
+#include <Arduino.h>
+
+class Stream {
+    public:
+        virtual ~Stream() {}
+
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+        virtual void flush() = 0;
+        virtual size_t write(uint8_t b) = 0;
+        virtual size_t write(const uint8_t *buf, size_t size) = 0;
+
+        void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+        unsigned long getTimeout() { return timeout; }
+
+        // Same semantics as Arduino: waits up to the timeout for each byte
+        size_t readBytes(uint8_t *buffer, size_t length) {
+            size_t count = 0;
+            while (count < length) {
+                int c = timedRead();
+                if (c < 0) {
+                    break;
+                }
+                buffer[count++] = (uint8_t)c;
+            }
+            return count;
+        }
+        size_t readBytes(char *buffer, size_t length) {
+            return readBytes((uint8_t *)buffer, length);
+        }
+
+    protected:
+        unsigned long timeout = 1000;
+
+        int timedRead() {
+            unsigned long start = millis();
+            do {
+                int c = read();
+                if (c >= 0) {
+                    return c;
+                }
+                yield();
+            } while (millis() - start < timeout);
+            return -1;
+        }
+};
+
+#endif
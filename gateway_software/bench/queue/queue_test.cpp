@@ -0,0 +1,285 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Host tests of the store-and-forward RecordQueue (append,
+*               replay, trim) over a temp directory standing in for SPIFFS
+*****************************************************************************/
+
+// Usage: queue_test
+//
+// Every test starts from an empty temp directory. The process exits with 1 if
+// any check fails, so it can gate changes to RecordQueue.
+
+#include <Arduino.h>
+#include <FS.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "RecordQueue.h"
+
+int failures = 0;
+String root;
+
+void check(bool ok, const char *name){
+    Serial.println(String(ok ? "  ok    " : "  FAIL  ") + name);
+    if(!ok){
+        failures++;
+    }
+}
+
+void wipe(fs::FS &fs){
+    fs.remove(QUEUE_DATA_PATH);
+    fs.remove(QUEUE_HEAD_PATH);
+    fs.remove(QUEUE_DATA_PATH ".tmp");
+}
+
+String payloadOf(int i){
+    return String("{\"record\":") + i + "}";
+}
+
+void testAppend(fs::FS &fs){
+    Serial.println("append");
+    wipe(fs);
+    RecordQueue queue(fs);
+    check(queue.begin(), "begin on an empty FS");
+    check(queue.isEmpty() && queue.pending() == 0 && queue.bytes() == 0, "starts empty");
+
+    bool pushed = true;
+    uint32_t size = 0;
+    for(int i = 0; i < 10; i++){
+        pushed &= queue.push("dl", payloadOf(i));
+        size += 2 + String("dl").length() + payloadOf(i).length();
+    }
+    check(pushed, "10 pushes accepted");
+    check(queue.pending() == 10, "10 pending");
+    check(queue.bytes() == size, "bytes match the lines written");
+    check(fs.exists(QUEUE_DATA_PATH), "data file created");
+
+    String subfolder, payload;
+    check(queue.peek(subfolder, payload) && subfolder == "dl" && payload == payloadOf(0), "peek returns the oldest record");
+    check(queue.pending() == 10, "peek does not consume");
+}
+
+void testReplay(fs::FS &fs){
+    Serial.println("replay");
+    wipe(fs);
+    RecordQueue queue(fs);
+    queue.begin();
+    for(int i = 0; i < 8; i++){
+        queue.push(i % 2 ? "station" : "dl", payloadOf(i));
+    }
+
+    // Look ahead of the head like a window of publishes in flight
+    uint32_t offset = queue.headOffset();
+    bool ordered = true;
+    String subfolder, payload;
+    for(int i = 0; i < 8; i++){
+        ordered &= queue.peekAt(offset, subfolder, payload);
+        ordered &= subfolder == (i % 2 ? "station" : "dl") && payload == payloadOf(i);
+    }
+    check(ordered, "peekAt walks the records in order");
+    check(!queue.peekAt(offset, subfolder, payload), "peekAt stops at the tail");
+
+    // Acks pop the prefix, the head follows
+    queue.pop();
+    queue.pop();
+    offset = queue.headOffset();
+    check(queue.peekAt(offset, subfolder, payload) && payload == payloadOf(2), "head moves past popped records");
+    uint32_t stale = 0;
+    check(!queue.peekAt(stale, subfolder, payload), "peekAt refuses offsets behind the head");
+    check(queue.pending() == 6, "6 pending after 2 pops");
+
+    // Reboot with the head never synced: popped records come back
+    RecordQueue unsynced(fs);
+    unsynced.begin();
+    check(unsynced.pending() == 8, "unsynced pops are delivered again after a reboot");
+
+    // Reboot after sync: they do not
+    queue.sync();
+    RecordQueue synced(fs);
+    synced.begin();
+    check(synced.pending() == 6, "synced head survives a reboot");
+    check(synced.peek(subfolder, payload) && payload == payloadOf(2), "replay resumes at the synced head");
+}
+
+void testTrim(fs::FS &fs){
+    Serial.println("trim");
+    wipe(fs);
+    RecordQueue queue(fs);
+    queue.begin();
+    for(int i = 0; i < QUEUE_HEAD_SYNC + 4; i++){
+        queue.push("dl", payloadOf(i));
+    }
+    for(int i = 0; i < QUEUE_HEAD_SYNC; i++){
+        queue.pop();
+    }
+    check(fs.exists(QUEUE_HEAD_PATH), "head persisted every QUEUE_HEAD_SYNC pops");
+
+    while(queue.pop());
+    check(queue.isEmpty() && queue.bytes() == 0, "drained");
+    check(!fs.exists(QUEUE_DATA_PATH) && !fs.exists(QUEUE_HEAD_PATH), "files removed once drained");
+
+    // A stale index without data is dropped on begin
+    File file = fs.open(QUEUE_HEAD_PATH, FILE_WRITE);
+    uint8_t head[4] = {0, 0, 1, 0};
+    file.write(head, 4);
+    file.close();
+    RecordQueue reboot(fs);
+    reboot.begin();
+    check(reboot.isEmpty() && !fs.exists(QUEUE_HEAD_PATH), "stale index removed");
+}
+
+void testCorrupted(fs::FS &fs){
+    Serial.println("corrupted");
+    wipe(fs);
+    File file = fs.open(QUEUE_DATA_PATH, FILE_WRITE);
+    file.print("dl\t{\"record\":0}\n");
+    file.print("garbage without a delimiter\n");
+    file.print("dl\t{\"record\":2}\n");
+    file.close();
+
+    RecordQueue queue(fs);
+    queue.begin();
+    check(queue.pending() == 3, "3 lines counted");
+    String subfolder, payload;
+    queue.peek(subfolder, payload);
+    queue.pop();
+    check(queue.peek(subfolder, payload) && subfolder == "" && payload == "", "corrupted line returned empty");
+    queue.pop();
+    check(queue.peek(subfolder, payload) && payload == payloadOf(2), "next record intact");
+
+    // Power lost in the middle of an append
+    wipe(fs);
+    file = fs.open(QUEUE_DATA_PATH, FILE_WRITE);
+    file.print("dl\t{\"record\":0}\n");
+    file.print("dl\t{\"rec");
+    file.close();
+    RecordQueue reboot(fs);
+    reboot.begin();
+    check(reboot.pending() == 1, "unterminated line not counted");
+    reboot.push("dl", payloadOf(3));
+    check(reboot.pending() == 3, "next append closes the partial line");
+    reboot.pop();
+    reboot.pop();
+    check(reboot.peek(subfolder, payload) && payload == payloadOf(3), "record after the partial line intact");
+}
+
+void testFull(fs::FS &fs, fs::FS &limited){
+    Serial.println("full");
+    wipe(fs);
+    RecordQueue queue(fs);
+    queue.begin();
+    String big(std::string(1000, 'x'));
+    int accepted = 0;
+    while(queue.push("dl", big) && accepted < 1000){
+        accepted++;
+    }
+    check(accepted == QUEUE_MAX_BYTES/1004, "push refused above QUEUE_MAX_BYTES");
+    check(queue.bytes() <= QUEUE_MAX_BYTES, "queue stays under QUEUE_MAX_BYTES");
+
+    // Partition fills up in the middle of a line
+    wipe(limited);
+    RecordQueue partial(limited);
+    partial.begin();
+    limited.setBudget(40);
+    check(partial.push("dl", payloadOf(0)), "first record fits");
+    check(!partial.push("dl", big), "truncated append reported");
+    limited.clearBudget();
+    check(partial.push("dl", payloadOf(2)), "queue usable after more space");
+
+    String subfolder, payload;
+    uint32_t offset = partial.headOffset();
+    partial.peekAt(offset, subfolder, payload);
+    bool framed = partial.peekAt(offset, subfolder, payload);
+    framed &= partial.peekAt(offset, subfolder, payload) && payload == payloadOf(2);
+    check(framed, "record after a truncated one is intact");
+}
+
+void testCompact(fs::FS &fs){
+    Serial.println("compact");
+    wipe(fs);
+    RecordQueue queue(fs);
+    queue.begin();
+    String big(std::string(1000, 'x'));
+
+    // Delivering while receiving, the limit follows what is still pending
+    int pushed = 0;
+    bool accepted = true;
+    for(int i = 0; i < 2*QUEUE_MAX_BYTES/1004 && accepted; i++){
+        accepted = queue.push("dl", big);
+        pushed += accepted;
+        if(queue.pending() > 10){
+            queue.pop();
+        }
+    }
+    check(accepted && pushed == 2*QUEUE_MAX_BYTES/1004, "push accepted past QUEUE_MAX_BYTES appended");
+    check(queue.pending() == 10 && queue.bytes() == 10*1004, "only pending bytes counted");
+
+    queue.push("dl", payloadOf(1));
+    uint32_t before = queue.bytes();
+    uint32_t offset = queue.headOffset();
+    String subfolder, payload;
+    queue.peekAt(offset, subfolder, payload);
+    uint32_t shift = queue.compact();
+    check(shift > 0 && queue.headOffset() == 0, "compact moves the head to the start");
+    check(queue.bytes() == before && queue.pending() == 11, "pending records kept");
+    offset -= shift;
+    check(queue.peekAt(offset, subfolder, payload) && payload == big, "shifted offsets still valid");
+    check(queue.compact() == 0, "nothing to compact right after");
+    for(int i = 0; i < 10; i++){
+        queue.pop();
+    }
+    check(queue.peek(subfolder, payload) && payload == payloadOf(1), "last record after the compacted ones");
+
+    RecordQueue reboot(fs);
+    reboot.begin();
+    check(reboot.pending() == 11, "compacted file survives a reboot");
+
+    // Power lost between removing the old file and renaming the copy
+    File file = fs.open(QUEUE_DATA_PATH, FILE_READ);
+    String line = file.readStringUntil('\n');
+    file.close();
+    wipe(fs);
+    file = fs.open(QUEUE_DATA_PATH ".tmp", FILE_WRITE);
+    file.print(line + "\n");
+    file.close();
+    RecordQueue recovered(fs);
+    recovered.begin();
+    check(recovered.pending() == 1 && fs.exists(QUEUE_DATA_PATH), "copy taken over after a power loss");
+}
+
+int main(){
+    char dir[] = "/tmp/queue_test.XXXXXX";
+    if(mkdtemp(dir) == NULL){
+        Serial.println("mkdtemp failed");
+        return 1;
+    }
+    root = dir;
+    fs::FS fs(root);
+    fs::FS limited(root);
+
+    testAppend(fs);
+    testReplay(fs);
+    testTrim(fs);
+    testCorrupted(fs);
+    testFull(fs, limited);
+    testCompact(fs);
+
+    wipe(fs);
+    rmdir(dir);
+
+    Serial.println(failures ? String(failures) + " check(s) failed" : String("all checks passed"));
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Host benchmark of MQTT reconnects over CloudIoTCoreTlsClient,
+*               full handshakes against resumed ones
+*****************************************************************************/
+
+// Usage: tls_bench --ca FILE [--host localhost] [--port 8883]
+//                  [--reconnects N] [--no-resume]
+//
+// Start bench/tls/tls_broker.py first and pass the ca.pem it wrote. Each
+// round is an MQTT CONNECT/CONNACK and DISCONNECT over a new TLS connection,
+// as in a gateway reconnect. A first TLS connect by IP address, with the
+// host set as server name, checks that the certificate is still verified
+// against the name. Exits non-zero when a connection fails, or with
+// resumption on, when a reconnect after the first does not resume.
+
+#include <Arduino.h>
+#include <MQTTClient.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "Google Cloud IoT Core JWT/src/CloudIoTCoreTlsClient.h"
+
+struct Round {
+    unsigned long handshakeMs;
+    unsigned long connectMs;    // TCP + TLS + CONNACK
+    bool resumed;
+};
+
+void printStats(const char *name, std::vector<unsigned long> values){
+    if(values.empty()){
+        return;
+    }
+    std::sort(values.begin(), values.end());
+    unsigned long sum = 0;
+    for(size_t i = 0; i < values.size(); i++){
+        sum += values[i];
+    }
+    Serial.printf("  %-22s n=%-4u mean %6.1f ms  p50 %4lu ms  max %4lu ms\n", name,
+                  (unsigned int)values.size(), (double)sum / values.size(),
+                  values[values.size() / 2], values.back());
+}
+
+bool resolve(const String &host, IPAddress &address){
+    struct addrinfo hints;
+    struct addrinfo *result = NULL;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if(getaddrinfo(host.c_str(), NULL, &hints, &result) != 0 || result == NULL){
+        return false;
+    }
+    uint32_t raw = ((struct sockaddr_in *)result->ai_addr)->sin_addr.s_addr;
+    const uint8_t *octets = (const uint8_t *)&raw;
+    address = IPAddress(octets[0], octets[1], octets[2], octets[3]);
+    freeaddrinfo(result);
+    return true;
+}
+
+int main(int argc, char **argv){
+    String caPath;
+    String host = "localhost";
+    int port = 8883;
+    int reconnects = 20;
+    bool resume = true;
+
+    for(int i = 1; i < argc; i++){
+        String arg = argv[i];
+        if(arg == "--ca" && i + 1 < argc) caPath = argv[++i];
+        else if(arg == "--host" && i + 1 < argc) host = argv[++i];
+        else if(arg == "--port" && i + 1 < argc) port = atoi(argv[++i]);
+        else if(arg == "--reconnects" && i + 1 < argc) reconnects = atoi(argv[++i]);
+        else if(arg == "--no-resume") resume = false;
+        else{
+            Serial.println("Usage: tls_bench --ca FILE [--host H] [--port P] [--reconnects N] [--no-resume]");
+            return 2;
+        }
+    }
+
+    std::ifstream file(caPath.c_str());
+    if(caPath.length() == 0 || !file){
+        Serial.println("Root CA file not found: " + caPath);
+        return 2;
+    }
+    std::stringstream pem;
+    pem << file.rdbuf();
+    std::string rootCa = pem.str();
+
+    signal(SIGPIPE, SIG_IGN);
+
+    CloudIoTCoreTlsClient tls;
+    tls.setCACert(rootCa.c_str());
+    tls.setSessionResumption(resume);
+
+    int failures = 0;
+    IPAddress address;
+    tls.setServerName(host.c_str());
+    if(!resolve(host, address) || !tls.connect(address, port)){
+        Serial.println("Connect by address failed");
+        failures++;
+    }
+    tls.stop();
+    tls.clearSession();
+
+    MQTTClient mqtt(512);
+    mqtt.begin(host.c_str(), port, tls);
+
+    std::vector<Round> rounds;
+    for(int i = 0; i < reconnects; i++){
+        unsigned long start = millis();
+        if(!mqtt.connect("tls-bench", "unused", "token", false)){
+            Serial.println("Connect " + String(i) + " failed");
+            failures++;
+            continue;
+        }
+        Round r;
+        r.connectMs = millis() - start;
+        r.handshakeMs = tls.lastHandshakeMs();
+        r.resumed = tls.lastResumed();
+        rounds.push_back(r);
+        mqtt.disconnect();
+    }
+
+    std::vector<unsigned long> fullHandshake, resumedHandshake, fullConnect, resumedConnect;
+    for(size_t i = 0; i < rounds.size(); i++){
+        (rounds[i].resumed ? resumedHandshake : fullHandshake).push_back(rounds[i].handshakeMs);
+        (rounds[i].resumed ? resumedConnect : fullConnect).push_back(rounds[i].connectMs);
+    }
+
+    Serial.printf("%d reconnects to %s:%d, session resumption %s\n", reconnects,
+                  host.c_str(), port, resume ? "on" : "off");
+    printStats("handshake, full", fullHandshake);
+    printStats("handshake, resumed", resumedHandshake);
+    printStats("connect, full", fullConnect);
+    printStats("connect, resumed", resumedConnect);
+    Serial.printf("  resumed %u of %u handshakes, %d failed connects\n",
+                  tls.getResumptions(), tls.getHandshakes(), failures);
+
+    if(failures > 0 || (resume && (int)tls.getResumptions() < (int)rounds.size() - 1)){
+        return 1;
+    }
+    return 0;
+}
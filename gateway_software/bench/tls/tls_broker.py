@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# TLS MQTT broker stand-in for bench/tls/tls_bench.cpp. Answers CONNECT,
+# SUBSCRIBE, PUBLISH (QoS 0/1), PINGREQ and DISCONNECT over TLS 1.2 and logs
+# whether each handshake was full or resumed.
+#
+#   python3 tls_broker.py [--port 8883] [--dir /tmp/tls_broker]
+#
+# On the first run a root CA and a localhost server certificate (P-256, like
+# the Cloud IoT Core LTS chain) are written to --dir; pass <dir>/ca.pem to the
+# bench. Sessions resume through session tickets.
+import argparse
+import os
+import socket
+import ssl
+import subprocess
+import threading
+
+
+def openssl(*args):
+    subprocess.run(["openssl"] + list(args), check=True,
+                   stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+
+def make_certs(d):
+    ca_key, ca = os.path.join(d, "ca.key"), os.path.join(d, "ca.pem")
+    key, csr = os.path.join(d, "server.key"), os.path.join(d, "server.csr")
+    cert, ext = os.path.join(d, "server.pem"), os.path.join(d, "server.ext")
+    if os.path.exists(cert):
+        return cert, key
+    os.makedirs(d, exist_ok=True)
+    openssl("req", "-x509", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:P-256",
+            "-nodes", "-subj", "/CN=Bench Root CA", "-days", "365",
+            "-keyout", ca_key, "-out", ca)
+    openssl("req", "-new", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:P-256",
+            "-nodes", "-subj", "/CN=localhost", "-keyout", key, "-out", csr)
+    with open(ext, "w") as f:
+        f.write("subjectAltName=DNS:localhost,IP:127.0.0.1\n")
+    openssl("x509", "-req", "-in", csr, "-CA", ca, "-CAkey", ca_key,
+            "-CAcreateserial", "-days", "365", "-extfile", ext, "-out", cert)
+    return cert, key
+
+
+def read_exact(conn, n):
+    data = b""
+    while len(data) < n:
+        chunk = conn.recv(n - len(data))
+        if not chunk:
+            raise ConnectionError
+        data += chunk
+    return data
+
+
+def read_packet(conn):
+    header = read_exact(conn, 1)[0]
+    length, shift = 0, 0
+    while True:
+        b = read_exact(conn, 1)[0]
+        length |= (b & 127) << shift
+        shift += 7
+        if not b & 128:
+            break
+    return header, read_exact(conn, length)
+
+
+def serve(conn, address, stats):
+    try:
+        conn.do_handshake()
+        with stats["lock"]:
+            stats["handshakes"] += 1
+            stats["resumed"] += conn.session_reused
+            print("%s:%d %s handshake (%d of %d resumed)" % (
+                address[0], address[1], "resumed" if conn.session_reused else "full",
+                stats["resumed"], stats["handshakes"]), flush=True)
+        while True:
+            header, body = read_packet(conn)
+            kind = header >> 4
+            if kind == 1:  # CONNECT
+                conn.sendall(b"\x20\x02\x00\x00")
+            elif kind == 8:  # SUBSCRIBE, grant the requested QoS
+                granted, pos = b"", 2
+                while pos < len(body):
+                    n = (body[pos] << 8) | body[pos + 1]
+                    granted += bytes([body[pos + 2 + n] & 3])
+                    pos += 3 + n
+                conn.sendall(bytes([0x90, 2 + len(granted)]) + body[:2] + granted)
+            elif kind == 3 and (header >> 1) & 3 == 1:  # PUBLISH QoS 1
+                n = (body[0] << 8) | body[1]
+                conn.sendall(b"\x40\x02" + body[2 + n:4 + n])
+            elif kind == 12:  # PINGREQ
+                conn.sendall(b"\xd0\x00")
+            elif kind == 14:  # DISCONNECT
+                break
+    except (ConnectionError, ssl.SSLError, OSError):
+        pass
+    finally:
+        conn.close()
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--port", type=int, default=8883)
+    parser.add_argument("--dir", default="/tmp/tls_broker")
+    args = parser.parse_args()
+
+    cert, key = make_certs(args.dir)
+    ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    ctx.maximum_version = ssl.TLSVersion.TLSv1_2
+    ctx.load_cert_chain(cert, key)
+
+    listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    listener.bind(("127.0.0.1", args.port))
+    listener.listen(8)
+    print("Listening on 127.0.0.1:%d, root CA %s" % (
+        args.port, os.path.join(args.dir, "ca.pem")), flush=True)
+
+    stats = {"lock": threading.Lock(), "handshakes": 0, "resumed": 0}
+    while True:
+        sock, address = listener.accept()
+        conn = ctx.wrap_socket(sock, server_side=True, do_handshake_on_connect=False)
+        threading.Thread(target=serve, args=(conn, address, stats), daemon=True).start()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,348 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Host benchmark of the gateway uplink: LoRa frames -> JSON
+*               records -> CloudIoTCoreMqtt -> loopback broker stand-in
+*****************************************************************************/
+
+// Usage: uplink_bench [--mode qos0|qos1|async] [--records N] [--rate R]
+//                     [--rtt MS] [--loss P] [--bandwidth BYTES_S]
+//                     [--window W] [--frames FILE] [--seed S]
+//
+// Frames are synthetic station/data logger frames unless --frames points to a
+// file with one frame per line in hex (as printed by the nodes). Latency is
+// measured from frame arrival to publish return (qos0/qos1) or PUBACK (async).
+
+#include <Arduino.h>
+#include <MQTTClient.h>
+#include <sys/resource.h>
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include "DataEncDec.h"
+#include "RecordFormat.h"
+#include "Google Cloud IoT Core JWT/src/CloudIoTCoreMqtt.h"
+#include "LoopbackBroker.h"
+
+// Throwaway key, only signs the JWT the stand-in never checks
+const char *bench_key =
+    "4e:2a:91:07:c3:5d:18:6b:f0:22:9e:41:7a:d8:03:b6:"
+    "55:c1:0f:8e:27:94:3a:6d:e2:71:b8:0c:49:f3:15:a7";
+
+CloudIoTCoreDevice *device;
+
+struct Record {
+    unsigned long arrival;  // micros()
+    String subfolder;
+    String payload;
+};
+
+std::deque<Record> pending;
+std::map<uint16_t, Record> inFlight;
+std::vector<unsigned long> latencies;
+uint32_t failures = 0;
+
+String getJwt(){
+    return device->createJWT(time(nullptr), 3600);
+}
+
+void messageReceived(String &topic, String &payload){
+}
+
+void messageReceivedAdvanced(MQTTClient *client, char topic[], char bytes[], int length){
+}
+
+void onPublishResult(uint16_t id, bool acked){
+    std::map<uint16_t, Record>::iterator it = inFlight.find(id);
+    if(it == inFlight.end()){
+        return;
+    }
+    if(acked){
+        latencies.push_back(micros() - it->second.arrival);
+    }
+    else{
+        failures++;
+        pending.push_front(it->second);
+    }
+    inFlight.erase(it);
+}
+
+// Frame as a node would send it, with plausible random readings. Half the
+// station frames are weather records, the rest the older average. Every
+// other datalogger frame is a statistics record, one in four is a 48
+// channel map and one in four a transient event chunk.
+std::vector<uint8_t> syntheticFrame(uint32_t n){
+    DataEncDec encoder(222);
+    encoder.reset();
+    long date = 1700000000 + n * 60;
+    if(n % 4 == 0){
+        encoder.addHeader(STATION, GATEWAY);
+        encoder.addDate(date);
+        encoder.addRecordType(RECORD_WEATHER);
+        encoder.addTemp(20 + random(1500) / 100.0);
+        encoder.addHumi(40 + random(50));
+        encoder.addIrrad(random(120000) / 100.0);
+        encoder.addWindSpeed(random(150) / 10.0);
+        encoder.addWindSpeed(15 + random(150) / 10.0);
+        encoder.addWindDegrees(random(360));
+        encoder.addRain(random(50) / 10.0);
+        encoder.addTemp(25 + random(3000) / 100.0);
+    }
+    else if(n % 2 == 0){
+        encoder.addHeader(STATION, GATEWAY);
+        encoder.addDate(date);
+        encoder.addTemp(20 + random(1500) / 100.0);
+        encoder.addHumi(40 + random(50));
+        encoder.addIrrad(random(120000) / 100.0);
+        encoder.addWindSpeed(random(150) / 10.0);
+        encoder.addWindDirection(random(8) * 45);
+        encoder.addRain(random(50) / 10.0);
+        encoder.addTemp(25 + random(3000) / 100.0);
+    }
+    else if(n % 8 == 1){
+        uint16_t codes[48];
+        for(int i = 0; i < 48; i++){
+            codes[i] = random(4096);
+        }
+        encoder.addHeader(DATALOGGER, GATEWAY);
+        encoder.addDate(date);
+        encoder.addRecordType(RECORD_CHANNELS);
+        encoder.addChannelMap(0xFFFFFFFFFFFFULL);
+        encoder.addCodes(codes, 48);
+    }
+    else if(n % 8 == 5){
+        uint16_t codes[130];
+        for(int i = 0; i < 130; i++){
+            codes[i] = random(4096);
+        }
+        encoder.addHeader(DATALOGGER, GATEWAY);
+        encoder.addDate(date);
+        encoder.addRecordType(RECORD_EVENT);
+        encoder.addChannelMap(0x010000300003ULL);
+        encoder.addCount(100);
+        encoder.addCount(200);
+        encoder.addCount(300);
+        encoder.addCount((40 << 8) | 2);
+        encoder.addCount(26 * (n % 19));
+        encoder.addCount(26);
+        encoder.addCodes(codes, 130);
+    }
+    else if(n % 4 == 3){
+        encoder.addHeader(DATALOGGER, GATEWAY);
+        encoder.addDate(date);
+        encoder.addRecordType(RECORD_STATS);
+        encoder.addCount(6000);
+        for(int i = 0; i < 10; i++){
+            encoder.addCurrent(random(100) / 10.0);
+        }
+        for(int i = 0; i < 10; i++){
+            encoder.addVoltage(random(60000) / 100.0);
+        }
+        for(int i = 0; i < 5; i++){
+            encoder.addPower(random(500000) / 100.0);
+        }
+    }
+    else{
+        encoder.addHeader(DATALOGGER, GATEWAY);
+        encoder.addDate(date);
+        encoder.addCurrent(random(100) / 10.0);
+        encoder.addCurrent(random(100) / 10.0);
+        encoder.addVoltage(random(60000) / 100.0);
+        encoder.addVoltage(random(60000) / 100.0);
+        encoder.addPower(random(500000) / 100.0);
+    }
+    uint8_t buffer[222];
+    uint8_t size = encoder.copy(buffer);
+    return std::vector<uint8_t>(buffer, buffer + size);
+}
+
+std::vector<std::vector<uint8_t> > loadFrames(const char *path){
+    std::vector<std::vector<uint8_t> > frames;
+    std::ifstream file(path);
+    std::string line;
+    while(std::getline(file, line)){
+        std::vector<uint8_t> frame;
+        int nibbles = 0;
+        uint8_t value = 0;
+        for(size_t i = 0; i < line.size(); i++){
+            char c = line[i];
+            int digit = -1;
+            if(c >= '0' && c <= '9') digit = c - '0';
+            if(c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+            if(c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+            if(digit < 0){
+                continue;
+            }
+            value = (value << 4) | digit;
+            if(++nibbles == 2){
+                frame.push_back(value);
+                nibbles = 0;
+                value = 0;
+            }
+        }
+        if(frame.size() >= 14){
+            frames.push_back(frame);
+        }
+    }
+    return frames;
+}
+
+unsigned long percentile(std::vector<unsigned long> &sorted, double p){
+    if(sorted.empty()){
+        return 0;
+    }
+    size_t i = (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[i];
+}
+
+int main(int argc, char **argv){
+    String mode = "async";
+    uint32_t records = 1000;
+    double rate = 50;
+    unsigned long rtt = 200;
+    float loss = 0;
+    unsigned long bandwidth = 0;
+    int window = 8;
+    const char *framesPath = NULL;
+    unsigned long seed = 1;
+
+    for(int i = 1; i + 1 < argc; i += 2){
+        String arg = argv[i];
+        if(arg == "--mode") mode = argv[i + 1];
+        else if(arg == "--records") records = atol(argv[i + 1]);
+        else if(arg == "--rate") rate = atof(argv[i + 1]);
+        else if(arg == "--rtt") rtt = atol(argv[i + 1]);
+        else if(arg == "--loss") loss = atof(argv[i + 1]);
+        else if(arg == "--bandwidth") bandwidth = atol(argv[i + 1]);
+        else if(arg == "--window") window = atoi(argv[i + 1]);
+        else if(arg == "--frames") framesPath = argv[i + 1];
+        else if(arg == "--seed") seed = atol(argv[i + 1]);
+    }
+    randomSeed(seed);
+
+    std::vector<std::vector<uint8_t> > recorded;
+    if(framesPath != NULL){
+        recorded = loadFrames(framesPath);
+        if(recorded.empty()){
+            printf("No frames in %s\n", framesPath);
+            return 1;
+        }
+    }
+
+    device = new CloudIoTCoreDevice("bench-project", "us-central1", "bench-registry", "bench-gateway", bench_key);
+    LoopbackBroker broker(rtt, loss, bandwidth);
+    MQTTClient client(2048);
+    client.setOptions(180, true, 1000);
+    CloudIoTCoreMqtt mqtt(&client, &broker, device);
+    mqtt.setLogConnect(false);
+    mqtt.setAsyncConnect(true);
+    mqtt.setPublishWindow(window, 10 * rtt + 1000);
+    mqtt.setPublishResultCallback(onPublishResult);
+    mqtt.startMQTT();
+
+    // Connection is set up before the clock starts
+    while(!client.connected()){
+        mqtt.loop();
+    }
+
+    DataEncDec decoder(0);
+    unsigned long formatTime = 0;
+    uint32_t generated = 0;
+    uint32_t reconnects = 0;
+    unsigned long period = (unsigned long)(1000000 / rate);
+    unsigned long start = micros();
+    unsigned long nextFrame = start;
+    unsigned long deadline = start + (unsigned long)(records / rate * 1000000) + 120000000UL;
+
+    while(latencies.size() < records && micros() < deadline){
+        unsigned long now = micros();
+        while(generated < records && nextFrame <= now){
+            std::vector<uint8_t> frame = recorded.empty() ? syntheticFrame(generated)
+                                                          : recorded[generated % recorded.size()];
+            char *received = (char *)frame.data();
+
+            unsigned long t0 = micros();
+            Record record;
+            record.arrival = nextFrame;
+            if(decoder.getFrom(received[0]) == STATION){
+                record.subfolder = "/station";
+                record.payload = stationRecord(decoder, received, frame.size());
+            }
+            else{
+                record.subfolder = "/datalogger";
+                record.payload = dataLoggerRecord(decoder, received, frame.size());
+            }
+            formatTime += micros() - t0;
+
+            pending.push_back(record);
+            generated++;
+            nextFrame += period;
+        }
+
+        bool wasConnected = client.connected();
+        mqtt.loop();
+        if(!wasConnected && client.connected()){
+            reconnects++;
+        }
+        if(!client.connected()){
+            continue;
+        }
+
+        while(!pending.empty()){
+            Record &record = pending.front();
+            if(mode == "async"){
+                uint16_t id;
+                if(!mqtt.publishTelemetryAsync(record.subfolder, record.payload, &id)){
+                    break;
+                }
+                inFlight[id] = record;
+            }
+            else{
+                bool ok = mode == "qos1" ? mqtt.publishTelemetry(record.subfolder, record.payload, 1)
+                                         : mqtt.publishTelemetry(record.subfolder, record.payload);
+                if(!ok){
+                    failures++;
+                    break;
+                }
+                latencies.push_back(micros() - record.arrival);
+            }
+            pending.pop_front();
+        }
+    }
+
+    double elapsed = (micros() - start) / 1000000.0;
+    std::vector<unsigned long> sorted = latencies;
+    std::sort(sorted.begin(), sorted.end());
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    printf("mode %s, rtt %lu ms, loss %.3f, bandwidth %lu B/s, window %d, offered %.1f rec/s\n",
+           mode.c_str(), rtt, loss, bandwidth, window, rate);
+    printf("delivered      : %u/%u records in %.2f s\n", (unsigned)latencies.size(), records, elapsed);
+    printf("sustained      : %.1f records/s\n", latencies.size() / elapsed);
+    printf("latency ms     : p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n",
+           percentile(sorted, 50) / 1000.0, percentile(sorted, 90) / 1000.0,
+           percentile(sorted, 99) / 1000.0, sorted.empty() ? 0 : sorted.back() / 1000.0);
+    printf("format us/rec  : %.1f\n", generated ? (double)formatTime / generated : 0);
+    printf("failures       : %u publish, %u reconnects\n", failures, reconnects);
+    printf("broker         : %u publishes, %u duplicates, %u dropped, %llu bytes\n",
+           broker.publishes, broker.duplicates, broker.dropped, (unsigned long long)broker.bytesIn);
+    printf("peak RSS       : %ld kB\n", usage.ru_maxrss);
+    return latencies.size() == records ? 0 : 1;
+}
@@ -27,10 +27,34 @@
 #define DATALOGGER  2
 #define ALL         3
 
+// Record types, every type but RECORD_AVERAGE sets the extended bit of the
+// header and carries its type in the byte after the date
+#define RECORD_AVERAGE  0
+#define RECORD_STATS    1
+#define RECORD_CHANNELS 2
+#define RECORD_EVENT    3
+#define RECORD_DIAG     4
+#define RECORD_WEATHER  5   // station average with gust and wind direction in degrees
+#define EXTENDED_BIT    0x04
+
+// Timing stages of the diagnostics record
+#define DIAG_JITTER   0   // sample interval minus the nominal one
+#define DIAG_READ     1   // sensor or ADC read
+#define DIAG_PROCESS  2   // minute statistics
+#define DIAG_SAVE     3   // record appended to the SD buffer
+#define DIAG_SEND     4   // frame sent until ACK or timeout
+#define DIAG_STAGES   5
+#define DIAG_BUCKETS  12
+
+// Upper bounds (us) of the timing buckets, the last one takes the rest
+const uint32_t DIAG_BOUNDS[DIAG_BUCKETS - 1] = {10, 30, 100, 300, 1000, 3000, 10000, 30000,
+                                                100000, 300000, 1000000};
+
 
 // Data Size
 #define LPP_INT_SIZE       1       // 1 byte
 #define LPP_FLOAT_SIZE     2       // 2 byte
+#define LPP_MAP_SIZE       6       // 6 byte, one bit per ADS8668 channel
 
 
 class DataEncDec {
@@ -49,33 +73,46 @@ class DataEncDec {
         uint8_t addHeader(uint8_t from, uint8_t to, uint8_t ack);
         uint8_t addHeader(uint8_t from, uint8_t to, uint8_t ack, uint8_t settings);
         uint8_t addDate(long value);
+        uint8_t addRecordType(uint8_t type);
+        uint8_t addCount(uint16_t value);
 
         uint8_t addTemp(float value);
         uint8_t addHumi(int value);
         uint8_t addIrrad(float value);
         uint8_t addWindSpeed(float value);
         uint8_t addWindDirection(int value);
+        uint8_t addWindDegrees(int value);
         uint8_t addRain(float value);
         uint8_t addVoltage(float value);
         uint8_t addCurrent(float value);
         uint8_t addPower(float value);
+        uint8_t addChannelMap(uint64_t map);
+        uint8_t addCodes(uint16_t* codes, uint8_t count);
+        uint8_t addHistogram(uint8_t id, uint32_t max, uint32_t* buckets);
 
         uint8_t getTo(char header);
         uint8_t getFrom(char header);
         uint8_t getACK(char header);
         uint8_t getSettings(char header);
+        uint8_t getRecordType(char header, char byte);
 
         long getDate(char byte_h, char byte_hm, char byte_lm, char byte_l);
+        uint16_t getCount(char byte_h, char byte_l);
 
         float getTemp(char byte_h, char byte_l);
         int getHumi(char byte);
         float getIrrad(char byte_h, char byte_l);
         float getWindSpeed(char byte);
         int getWindDirection(char byte);
+        int getWindDegrees(char byte_h, char byte_l);
         float getRain(char byte);
         float getVoltage(char byte_h, char byte_l);
         float getCurrent(char byte);
         float getPower(char byte_h, char byte_m, char byte_l);
+        uint64_t getChannelMap(char* bytes);
+        uint16_t getCode(char* packed, uint16_t index);
+        uint32_t getHistogramMax(char* histogram);
+        uint16_t getHistogramBucket(char* histogram, uint8_t index);
     
     private:
         char *buffer;
@@ -0,0 +1,147 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Gateway self-metrics: event counters and latency histograms
+*****************************************************************************/
+
+#include "GatewayMetrics.h"
+
+LatencyHistogram::LatencyHistogram(){
+    reset();
+}
+
+void LatencyHistogram::record(uint32_t ms){
+    int i = 0;
+    while(i < METRICS_BUCKETS - 1 && ms > METRICS_BOUNDS[i]){
+        i++;
+    }
+    buckets[i]++;
+    count++;
+    sum += ms;
+    if(ms > max){
+        max = ms;
+    }
+}
+
+void LatencyHistogram::reset(){
+    for(int i = 0; i < METRICS_BUCKETS; i++){
+        buckets[i] = 0;
+    }
+    count = 0;
+    sum = 0;
+    max = 0;
+}
+
+uint32_t LatencyHistogram::getCount(){
+    return count;
+}
+
+uint32_t LatencyHistogram::getMax(){
+    return max;
+}
+
+// Upper bound of the bucket holding the p-th percentile (max for the last one)
+uint32_t LatencyHistogram::percentile(uint8_t p){
+    if(count == 0){
+        return 0;
+    }
+    uint32_t target = ((uint64_t)count * p + 99) / 100;
+    uint32_t seen = 0;
+    for(int i = 0; i < METRICS_BUCKETS - 1; i++){
+        seen += buckets[i];
+        if(seen >= target){
+            return METRICS_BOUNDS[i];
+        }
+    }
+    return max;
+}
+
+String LatencyHistogram::toJson(){
+    String json = "{\"N\": " + String(count) +
+                  ",\"AVG\": " + String(count ? sum / count : 0) +
+                  ",\"P50\": " + String(percentile(50)) +
+                  ",\"P99\": " + String(percentile(99)) +
+                  ",\"MAX\": " + String(max) +
+                  ",\"BUCKETS\": [";
+    for(int i = 0; i < METRICS_BUCKETS; i++){
+        json += String(buckets[i]);
+        if(i < METRICS_BUCKETS - 1){
+            json += ",";
+        }
+    }
+    json += "]}";
+    return json;
+}
+
+GatewayMetrics::GatewayMetrics(){
+    packetsReceived = 0;
+    crcErrors = 0;
+    rejected = 0;
+    duplicates = 0;
+    acksSent = 0;
+    published = 0;
+    publishFailures = 0;
+    queued = 0;
+    deadLettered = 0;
+    deadRetried = 0;
+    dropped = 0;
+    reconnects = 0;
+    tlsResumed = 0;
+}
+
+uint32_t GatewayMetrics::heapLowWater(){
+    return ESP.getMinFreeHeap();
+}
+
+String GatewayMetrics::toJson(){
+    return "{\"METRICS\": {\"UPTIME\": " + String(millis() / 1000) +
+           ",\"RX\": " + String(packetsReceived) +
+           ",\"CRC_ERR\": " + String(crcErrors) +
+           ",\"REJECTED\": " + String(rejected) +
+           ",\"DUP\": " + String(duplicates) +
+           ",\"ACK\": " + String(acksSent) +
+           ",\"PUB\": " + String(published) +
+           ",\"PUB_FAIL\": " + String(publishFailures) +
+           ",\"QUEUED\": " + String(queued) +
+           ",\"DEAD\": " + String(deadLettered) +
+           ",\"DEAD_RETRY\": " + String(deadRetried) +
+           ",\"DROPPED\": " + String(dropped) +
+           ",\"RECONNECTS\": " + String(reconnects) +
+           ",\"TLS_RESUMED\": " + String(tlsResumed) +
+           ",\"HEAP_MIN\": " + String(heapLowWater()) +
+           ",\"ACK_MS\": " + ackLatency.toJson() +
+           ",\"PUB_MS\": " + publishLatency.toJson() +
+           ",\"PUBACK_MS\": " + pubackLatency.toJson() +
+           ",\"TLS_MS\": " + handshakeLatency.toJson() + "}}";
+}
+
+void GatewayMetrics::print(){
+    Serial.println("---- Gateway metrics ----");
+    Serial.printf("Uptime          : %lu s\n", millis() / 1000);
+    Serial.printf("Frames received : %u\n", packetsReceived);
+    Serial.printf("CRC errors      : %u\n", crcErrors);
+    Serial.printf("Rejected        : %u\n", rejected);
+    Serial.printf("Duplicates      : %u\n", duplicates);
+    Serial.printf("ACKs sent       : %u\n", acksSent);
+    Serial.printf("Published       : %u (failed %u)\n", published, publishFailures);
+    Serial.printf("Queued          : %u (dead letters %u, retried %u, dropped %u)\n",
+                  queued, deadLettered, deadRetried, dropped);
+    Serial.printf("Reconnects      : %u (TLS resumed %u)\n", reconnects, tlsResumed);
+    Serial.printf("Heap low water  : %u bytes\n", heapLowWater());
+    Serial.println("ACK latency ms     : " + ackLatency.toJson());
+    Serial.println("Publish latency ms : " + publishLatency.toJson());
+    Serial.println("PUBACK latency ms  : " + pubackLatency.toJson());
+    Serial.println("TLS handshake ms   : " + handshakeLatency.toJson());
+}
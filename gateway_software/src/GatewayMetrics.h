@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Gateway self-metrics: event counters and latency histograms
+*****************************************************************************/
+
+#include <Arduino.h>
+
+#ifndef _GATEWAY_METRICS_
+#define _GATEWAY_METRICS_
+
+#define METRICS_BUCKETS 10
+
+// Upper bounds (ms) of the histogram buckets, the last one takes the rest
+const uint32_t METRICS_BOUNDS[METRICS_BUCKETS - 1] = {10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+
+// Fixed-bucket latency histogram, record() is a few compares and increments
+class LatencyHistogram {
+    public:
+        LatencyHistogram();
+
+        void record(uint32_t ms);
+        void reset();
+        uint32_t getCount();
+        uint32_t getMax();
+        uint32_t percentile(uint8_t p);
+        String toJson();
+
+    private:
+        uint32_t buckets[METRICS_BUCKETS];
+        uint32_t count;
+        uint32_t sum;
+        uint32_t max;
+};
+
+// All fields are written only by the loop task. Each counter is a single
+// aligned 32 bit word, so reading them from elsewhere needs no lock.
+class GatewayMetrics {
+    public:
+        GatewayMetrics();
+
+        uint32_t packetsReceived;   // frames addressed to the gateway
+        uint32_t crcErrors;         // frames dropped by the radio CRC check
+        uint32_t rejected;          // frames for other devices, unknown senders or too short
+        uint32_t duplicates;        // resent frames already delivered
+        uint32_t acksSent;
+        uint32_t published;         // records accepted by the broker
+        uint32_t publishFailures;
+        uint32_t queued;            // records moved to the backlog
+        uint32_t deadLettered;      // records the broker never took, parked
+        uint32_t deadRetried;       // parked records moved back to the backlog
+        uint32_t dropped;           // records lost, dead-letter queue full
+        uint32_t reconnects;
+        uint32_t tlsResumed;        // reconnects that resumed the TLS session
+
+        LatencyHistogram ackLatency;      // frame received -> ACK transmitted
+        LatencyHistogram publishLatency;  // direct publish call
+        LatencyHistogram pubackLatency;   // replayed record -> PUBACK
+        LatencyHistogram handshakeLatency; // TLS handshake per connection
+
+        uint32_t heapLowWater();
+        String toJson();
+        void print();
+};
+
+#endif
@@ -17,6 +17,11 @@
 
 # This script pulls the latest source files from github into the jwt/crypto
 # folder. Run it from it's directory to get the latest files.
+#
+# The ecc-light-certificate files (ecc.*, ecdsa.*, nn.*, secp256r1.cpp) are
+# forked and edited in this repo (fixed-base comb, P-256 field arithmetic,
+# 64-bit digits), pulling them again would drop those changes. Set
+# PULL_ECC=1 only to diff a fresh upstream copy against the fork.
 
 # Make temp directory, cd into it.
 mkdir tmp
@@ -32,29 +37,27 @@ cd ..
 # Copy sources into jwt folder.
 cp tmp/ESP8266-Arduino-cryptolibs/sha256/sha256.cpp src/crypto/sha256.cpp
 cp tmp/ESP8266-Arduino-cryptolibs/sha256/sha256.h src/crypto/sha256.h
-cp tmp/ecc-light-certificate/ecc/curve-params/secp256r1.c src/crypto/secp256r1.cpp
-cp tmp/ecc-light-certificate/ecc/ecc.c src/crypto/ecc.cpp
-cp tmp/ecc-light-certificate/ecc/ecc.h src/crypto/ecc.h
-cp tmp/ecc-light-certificate/ecc/ecdsa.c src/crypto/ecdsa.cpp
-cp tmp/ecc-light-certificate/ecc/ecdsa.h src/crypto/ecdsa.h
-cp tmp/ecc-light-certificate/ecc/nn.c src/crypto/nn.cpp
-cp tmp/ecc-light-certificate/ecc/nn.h src/crypto/nn.h
-
-# Remove unnecessary sha library.
-sed -i '/#include "sha2.h"/d' src/crypto/ecdsa.h
-# Add some defines since we're not using make.
-sed -i '1i#define SHA256_DIGEST_LENGTH 32' src/crypto/ecdsa.h
-sed -i '1i#define THIRTYTWO_BIT_PROCESSOR' src/crypto/nn.h
-sed -i '1i#define SECP256R1' src/crypto/nn.h
+if [ "$PULL_ECC" = "1" ]; then
+  mkdir -p tmp/upstream
+  cp tmp/ecc-light-certificate/ecc/curve-params/secp256r1.c tmp/upstream/secp256r1.cpp
+  cp tmp/ecc-light-certificate/ecc/ecc.c tmp/upstream/ecc.cpp
+  cp tmp/ecc-light-certificate/ecc/ecc.h tmp/upstream/ecc.h
+  cp tmp/ecc-light-certificate/ecc/ecdsa.c tmp/upstream/ecdsa.cpp
+  cp tmp/ecc-light-certificate/ecc/ecdsa.h tmp/upstream/ecdsa.h
+  cp tmp/ecc-light-certificate/ecc/nn.c tmp/upstream/nn.cpp
+  cp tmp/ecc-light-certificate/ecc/nn.h tmp/upstream/nn.h
+  diff -ru tmp/upstream src/crypto > ecc_upstream.diff
+  echo "Upstream changes against the fork written to ecc_upstream.diff"
+fi
 
 # Change string.h to String.h
-for f in src/crypto/ecdsa.cpp src/crypto/nn.cpp src/crypto/secp256r1.cpp src/crypto/sha256.cpp
+for f in src/crypto/sha256.cpp
 do
   sed -i 's/#include <string.h>/#include <String.h>/' $f
 done
 
 # Add a do not edit comment.
-for f in src/crypto/sha256.cpp src/crypto/sha256.h src/crypto/secp256r1.cpp src/crypto/ecc.cpp src/crypto/ecc.h src/crypto/ecdsa.cpp src/crypto/ecdsa.h src/crypto/nn.cpp src/crypto/nn.h
+for f in src/crypto/sha256.cpp src/crypto/sha256.h
 do
   sed -i '1i// AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.' $f
 done
@@ -0,0 +1,151 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Pass-through network client that picks the PUBACKs out of the
+*               inbound MQTT stream
+*****************************************************************************/
+#include "CloudIoTCoreAckTap.h"
+
+#define MQTT_PUBACK_TYPE 4
+
+CloudIoTCoreAckTap::CloudIoTCoreAckTap(Client *_client) {
+  this->client = _client;
+}
+
+// Follows fixed header, remaining length and body of each inbound packet
+void CloudIoTCoreAckTap::feed(uint8_t b) {
+  switch (state) {
+    case TAP_HEADER:
+      type = b >> 4;
+      remaining = 0;
+      multiplier = 1;
+      state = TAP_LENGTH;
+      break;
+
+    case TAP_LENGTH:
+      remaining += (b & 127) * multiplier;
+      multiplier *= 128;
+      if (!(b & 128)) {
+        position = 0;
+        packetId = 0;
+        if (remaining == 0) {
+          packetDone();
+        } else {
+          state = TAP_BODY;
+        }
+      }
+      break;
+
+    case TAP_BODY:
+      if (position < 2) {
+        packetId = (packetId << 8) | b;
+      }
+      position++;
+      if (position >= remaining) {
+        packetDone();
+      }
+      break;
+  }
+}
+
+void CloudIoTCoreAckTap::packetDone() {
+  if (type == MQTT_PUBACK_TYPE && remaining == 2) {
+    if (ackCount == ACK_TAP_QUEUE) {
+      // Oldest id is lost, its publish will be retransmitted
+      ackHead = (ackHead + 1) % ACK_TAP_QUEUE;
+      ackCount--;
+    }
+    acks[(ackHead + ackCount) % ACK_TAP_QUEUE] = packetId;
+    ackCount++;
+  }
+  state = TAP_HEADER;
+}
+
+bool CloudIoTCoreAckTap::popAck(uint16_t *id) {
+  if (ackCount == 0) {
+    return false;
+  }
+  *id = acks[ackHead];
+  ackHead = (ackHead + 1) % ACK_TAP_QUEUE;
+  ackCount--;
+  return true;
+}
+
+// Framing restarts with every connection
+void CloudIoTCoreAckTap::reset() {
+  state = TAP_HEADER;
+  ackHead = 0;
+  ackCount = 0;
+}
+
+int CloudIoTCoreAckTap::connect(IPAddress ip, uint16_t port) {
+  reset();
+  return client->connect(ip, port);
+}
+
+int CloudIoTCoreAckTap::connect(const char *host, uint16_t port) {
+  reset();
+  return client->connect(host, port);
+}
+
+size_t CloudIoTCoreAckTap::write(uint8_t b) {
+  return client->write(b);
+}
+
+size_t CloudIoTCoreAckTap::write(const uint8_t *buf, size_t size) {
+  return client->write(buf, size);
+}
+
+int CloudIoTCoreAckTap::available() {
+  return client->available();
+}
+
+int CloudIoTCoreAckTap::read() {
+  int b = client->read();
+  if (b >= 0) {
+    feed(b);
+  }
+  return b;
+}
+
+int CloudIoTCoreAckTap::read(uint8_t *buf, size_t size) {
+  int len = client->read(buf, size);
+  for (int i = 0; i < len; i++) {
+    feed(buf[i]);
+  }
+  return len;
+}
+
+// Peeked bytes are fed once they are actually read
+int CloudIoTCoreAckTap::peek() {
+  return client->peek();
+}
+
+void CloudIoTCoreAckTap::flush() {
+  client->flush();
+}
+
+void CloudIoTCoreAckTap::stop() {
+  client->stop();
+  reset();
+}
+
+uint8_t CloudIoTCoreAckTap::connected() {
+  return client->connected();
+}
+
+CloudIoTCoreAckTap::operator bool() {
+  return client->connected();
+}
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Pass-through network client that picks the PUBACKs out of the
+*               inbound MQTT stream
+*****************************************************************************/
+#ifndef __CLOUDIOTCORE_ACK_TAP_H__
+#define __CLOUDIOTCORE_ACK_TAP_H__
+#include <Arduino.h>
+#include <Client.h>
+
+#define ACK_TAP_QUEUE 32 // PUBACK ids kept until the next popAck() round
+
+// lwmqtt drops PUBACKs it is not waiting for. Every byte it reads goes through
+// this client, which follows the MQTT framing and keeps the PUBACK packet ids
+// so pipelined publishes can be matched with their acknowledgements.
+class CloudIoTCoreAckTap : public Client {
+  private:
+    Client *client;
+
+    enum { TAP_HEADER, TAP_LENGTH, TAP_BODY } state = TAP_HEADER;
+    uint8_t type = 0;
+    uint32_t remaining = 0;
+    uint32_t multiplier = 1;
+    uint32_t position = 0;
+    uint16_t packetId = 0;
+
+    uint16_t acks[ACK_TAP_QUEUE];
+    uint8_t ackHead = 0;
+    uint8_t ackCount = 0;
+
+    void feed(uint8_t b);
+    void packetDone();
+
+  public:
+    CloudIoTCoreAckTap(Client *client);
+
+    bool popAck(uint16_t *id);
+    void reset();
+
+    int connect(IPAddress ip, uint16_t port);
+    int connect(const char *host, uint16_t port);
+    size_t write(uint8_t b);
+    size_t write(const uint8_t *buf, size_t size);
+    int available();
+    int read();
+    int read(uint8_t *buf, size_t size);
+    int peek();
+    void flush();
+    void stop();
+    uint8_t connected();
+    operator bool();
+};
+#endif // __CLOUDIOTCORE_ACK_TAP_H__
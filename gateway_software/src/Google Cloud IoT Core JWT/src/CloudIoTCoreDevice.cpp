@@ -11,7 +11,15 @@
  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
  * See the License for the specific language governing permissions and
  * limitations under the License.
- *****************************************************************************/
+******************************************************************************
+* CHANGES AUTHOR   : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CHANGES HISTORY  :
+*   10/19/2026 - Keeps a JwtSigner set up once per private key, createJWT no
+*     longer re-initializes the curve on every token.
+*   10/19/2026 - Private key decoded with NN_Decode (any NN_DIGIT size).
+*   10/19/2026 - Added signJWT/useJWT so a token can be minted ahead of time
+*     (e.g. by a background task) and adopted on the next connection.
+*****************************************************************************/
 
 #include "CloudIoTCoreDevice.h"
 #include "jwt.h"
@@ -50,17 +58,32 @@ int CloudIoTCoreDevice::getJwtExpSecs() {
 
 String CloudIoTCoreDevice::createJWT(long long int current_time) {
   exp_millis = millis() + (jwt_exp_secs * 1000);
-  jwt = CreateJwt(project_id, current_time, priv_key, this->jwt_exp_secs);
+  signer.sign(project_id, current_time, this->jwt_exp_secs);
+  jwt = signer.token();
   return jwt;
 }
 
 String CloudIoTCoreDevice::createJWT(long long int current_time, int exp_in_secs) {
   jwt_exp_secs = exp_in_secs;
   exp_millis = millis() + (jwt_exp_secs * 1000);
-  jwt = CreateJwt(project_id, current_time, priv_key, exp_in_secs);
+  signer.sign(project_id, current_time, exp_in_secs);
+  jwt = signer.token();
   return jwt;
 }
 
+// Signs a token without making it the current one, exp_millis is untouched
+// until the token is adopted with useJWT()
+String CloudIoTCoreDevice::signJWT(long long int current_time, int exp_in_secs) {
+  signer.sign(project_id, current_time, exp_in_secs);
+  return String(signer.token());
+}
+
+// Makes a token signed earlier the current one, expiring at exp_at (millis)
+void CloudIoTCoreDevice::useJWT(const String &token, unsigned long exp_at) {
+  jwt = token;
+  exp_millis = exp_at;
+}
+
 String CloudIoTCoreDevice::getJWT() {
   return jwt;
 }
@@ -140,24 +163,21 @@ CloudIoTCoreDevice &CloudIoTCoreDevice::setPrivateKey(const char *private_key) {
     Serial.println("Warning: expected private key to be 95, was: " +
         String(strlen(private_key)));
   }
-  priv_key[8] = 0;
-  for (int i = 7; i >= 0; i--) {
-    priv_key[i] = 0;
-    for (int byte_num = 0; byte_num < 4; byte_num++) {
-      priv_key[i] = (priv_key[i] << 8) + strtoul(private_key, NULL, 16);
-      private_key += 3;
-    }
+  // "aa:bb:..." hex bytes, most significant first
+  unsigned char key_bytes[32];
+  for (int i = 0; i < 32; i++) {
+    key_bytes[i] = strtoul(private_key, NULL, 16);
+    private_key += 3;
   }
+  NN_Decode(priv_key, NUMWORDS - 1, key_bytes, 32);
+  priv_key[NUMWORDS - 1] = 0;
+  signer.begin(priv_key);
   return *this;
 }
 
 CloudIoTCoreDevice &CloudIoTCoreDevice::setPrivateKey(const unsigned char *private_key) {
-  priv_key[8] = 0;
-  for (int i = 7; i >= 0; i--) {
-    for (int byte_num = 0; byte_num < 4; byte_num++) {
-      priv_key[i] = (priv_key[i] << 8) + *private_key;
-      ++private_key;
-    }
-  }
+  NN_Decode(priv_key, NUMWORDS - 1, (unsigned char *)private_key, 32);
+  priv_key[NUMWORDS - 1] = 0;
+  signer.begin(priv_key);
   return *this;
 }
@@ -26,7 +26,8 @@ class CloudIoTCoreDevice {
   const char *registry_id;
   const char *device_id;
 
-  NN_DIGIT priv_key[9];
+  NN_DIGIT priv_key[NUMWORDS];
+  JwtSigner signer;
   String jwt;
   int jwt_exp_secs;
   unsigned long exp_millis = 0;
@@ -52,6 +53,8 @@ class CloudIoTCoreDevice {
   unsigned long getExpMillis();
   String createJWT(long long int time);
   String createJWT(long long int time, int jwt_in_time);
+  String signJWT(long long int time, int exp_in_secs);
+  void useJWT(const String &token, unsigned long exp_at);
   String getJWT();
 
   /* HTTP methods path */
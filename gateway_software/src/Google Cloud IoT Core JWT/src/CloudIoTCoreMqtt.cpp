@@ -17,6 +17,12 @@
 *   01/13/2021 - Changed the function "onConnect" to meet the application needs.
 *     before: publishState("connected");
 *     now   : publishState("{\"LOG\": \"Gateway Connected\"}");
+*   10/19/2026 - Added a non-blocking connection state machine stepped by
+*     loop() (setAsyncConnect), reusing the backoff and jitter below.
+*   10/19/2026 - Added pipelined QoS 1 publishing (publishTelemetryAsync) with
+*     a window of unacknowledged packet ids and retransmission on timeout.
+*   10/19/2026 - connectOnce() logs the time from connect to CONNACK, the TLS
+*     client logs its own share (handshake, full or resumed).
 *****************************************************************************/
 #include "CloudIoTCoreMqtt.h"
 
@@ -35,6 +41,10 @@ CloudIoTCoreMqtt::CloudIoTCoreMqtt(
   this->mqttClient = _mqttClient;
   this->netClient = _netClient;
   this->device = _device;
+  this->ackTap = new CloudIoTCoreAckTap(_netClient);
+  for (int i = 0; i < PUBLISH_WINDOW_MAX; i++) {
+    inFlight[i].packet = NULL;
+  }
 }
 
 boolean CloudIoTCoreMqtt::loop() {
@@ -43,7 +53,105 @@ boolean CloudIoTCoreMqtt::loop() {
     Serial.println("Reconnecting before JWT expiration");
     mqttClient->disconnect();
   }
-  return this->mqttClient->loop();
+  if (asyncConnect) {
+    connectStep();
+  }
+  boolean result = this->mqttClient->loop();
+
+  if (mqttClient->connected()) {
+    processAcks();
+    retransmit();
+  } else {
+    // Clean session, nothing in flight survives the connection
+    for (uint8_t i = 0; i < PUBLISH_WINDOW_MAX; i++) {
+      if (inFlight[i].packet != NULL) {
+        releaseInFlight(i, false);
+      }
+    }
+  }
+  return result;
+}
+
+// Advances the connection one step, never waits. The only blocking part left
+// is the connect attempt itself (TLS handshake, bounded by the client timeout).
+void CloudIoTCoreMqtt::connectStep() {
+  if (state != MQTT_STATE_CONNECTED && mqttClient->connected()) {
+    // Connected through mqttConnect()/mqttConnectAsync()
+    state = MQTT_STATE_CONNECTED;
+  }
+
+  switch (state) {
+    case MQTT_STATE_WAIT_NETWORK:
+      if (networkReady == NULL || networkReady()) {
+        state = MQTT_STATE_CONNECT;
+      }
+      break;
+
+    case MQTT_STATE_CONNECT:
+      if (connectOnce()) {
+        state = MQTT_STATE_CONNECTED;
+      } else {
+        increaseBackoff();
+        lastAttempt = millis();
+        Serial.println("Retrying in " + String(this->__backoff__) + "ms");
+        state = MQTT_STATE_BACKOFF;
+      }
+      break;
+
+    case MQTT_STATE_BACKOFF:
+      if (millis() - lastAttempt >= (unsigned long)this->__backoff__) {
+        state = MQTT_STATE_WAIT_NETWORK;
+      }
+      break;
+
+    case MQTT_STATE_CONNECTED:
+      if (!mqttClient->connected()) {
+        Serial.println("MQTT connection lost");
+        state = MQTT_STATE_WAIT_NETWORK;
+      }
+      break;
+  }
+}
+
+// Single connection attempt, subscribes and notifies on success
+bool CloudIoTCoreMqtt::connectOnce() {
+  Serial.println("Connecting...");
+  unsigned long started = millis();
+  this->mqttClient->connect(
+      device->getClientId().c_str(),
+      "unused",
+      getJwt().c_str(),
+      false);
+
+  if (!mqttClient->connected()) {
+    logError();
+    logReturnCode();
+    logConfiguration(false);
+    this->mqttClient->disconnect();
+    return false;
+  }
+
+  Serial.println("\nLibrary connected in " + String(millis() - started) + " ms!");
+  this->__backoff__ = this->__minbackoff__;
+
+  // Set QoS to 1 (ack) for configuration messages
+  this->mqttClient->subscribe(device->getConfigTopic(), 1);
+  // QoS 0 (no ack) for commands
+  this->mqttClient->subscribe(device->getCommandsTopic(), 0);
+
+  onConnect();
+  return true;
+}
+
+// See https://cloud.google.com/iot/docs/how-tos/exponential-backoff
+void CloudIoTCoreMqtt::increaseBackoff() {
+  if (this->__backoff__ < this->__minbackoff__) {
+    this->__backoff__ = this->__minbackoff__;
+  }
+  this->__backoff__ = (this->__backoff__ * this->__factor__) + random(this->__jitter__);
+  if (this->__backoff__ > this->__max_backoff__) {
+    this->__backoff__ = this->__max_backoff__;
+  }
 }
 
 void CloudIoTCoreMqtt::mqttConnect(bool skip) {
@@ -64,14 +172,7 @@ void CloudIoTCoreMqtt::mqttConnect(bool skip) {
       logReturnCode();
       logConfiguration(false);
 
-      // See https://cloud.google.com/iot/docs/how-tos/exponential-backoff
-      if (this->__backoff__ < this->__minbackoff__) {
-        this->__backoff__ = this->__minbackoff__;
-      }
-      this->__backoff__ = (this->__backoff__ * this->__factor__) + random(this->__jitter__);
-      if (this->__backoff__ > this->__max_backoff__) {
-        this->__backoff__ = this->__max_backoff__;
-      }
+      increaseBackoff();
 
       // Clean up the client
       this->mqttClient->disconnect();
@@ -123,14 +224,7 @@ void CloudIoTCoreMqtt::mqttConnectAsync(bool skip) {
     logReturnCode();
     logConfiguration(false);
 
-    // See https://cloud.google.com/iot/docs/how-tos/exponential-backoff
-    if (this->__backoff__ < this->__minbackoff__) {
-      this->__backoff__ = this->__minbackoff__;
-    }
-    this->__backoff__ = (this->__backoff__ * this->__factor__) + random(this->__jitter__);
-    if (this->__backoff__ > this->__max_backoff__) {
-      this->__backoff__ = this->__max_backoff__;
-    }
+    increaseBackoff();
 
     // Clean up the client
     this->mqttClient->disconnect();
@@ -164,13 +258,13 @@ void CloudIoTCoreMqtt::mqttConnectAsync(bool skip) {
 
 void CloudIoTCoreMqtt::startMQTT() {
   this->mqttClient->begin(useLts ? CLOUD_IOT_CORE_MQTT_HOST_LTS : CLOUD_IOT_CORE_MQTT_HOST,
-    CLOUD_IOT_CORE_MQTT_PORT, *netClient);
+    CLOUD_IOT_CORE_MQTT_PORT, *ackTap);
   this->mqttClient->onMessage(messageReceived);
 }
 
 void CloudIoTCoreMqtt::startMQTTAdvanced() {
   this->mqttClient->begin(useLts ? CLOUD_IOT_CORE_MQTT_HOST_LTS : CLOUD_IOT_CORE_MQTT_HOST,
-    CLOUD_IOT_CORE_MQTT_PORT, *netClient);
+    CLOUD_IOT_CORE_MQTT_PORT, *ackTap);
   this->mqttClient->onMessageAdvanced(messageReceivedAdvanced);
 }
 
@@ -199,6 +293,126 @@ bool CloudIoTCoreMqtt::publishTelemetry(String subtopic, const char* data, int l
   return this->mqttClient->publish(String(device->getEventsTopic() + subtopic).c_str(), data, length);
 }
 
+// Writes a QoS 1 PUBLISH without waiting for its PUBACK. Returns false when
+// the window is full or the write fails; *id identifies it in the result
+// callback.
+bool CloudIoTCoreMqtt::publishTelemetryAsync(String subtopic, String data, uint16_t *id) {
+  if (!mqttClient->connected()) {
+    return false;
+  }
+
+  uint8_t slot = PUBLISH_WINDOW_MAX;
+  uint8_t used = 0;
+  for (uint8_t i = 0; i < PUBLISH_WINDOW_MAX; i++) {
+    if (inFlight[i].packet != NULL) {
+      used++;
+    } else if (slot == PUBLISH_WINDOW_MAX) {
+      slot = i;
+    }
+  }
+  if (used >= window || slot == PUBLISH_WINDOW_MAX) {
+    return false;
+  }
+
+  String topic = device->getEventsTopic() + subtopic;
+  size_t remaining = 2 + topic.length() + 2 + data.length();
+  uint8_t header[5];
+  size_t headerLength = 0;
+  header[headerLength++] = 0x32; // PUBLISH, QoS 1
+  do {
+    uint8_t b = remaining % 128;
+    remaining /= 128;
+    header[headerLength++] = remaining > 0 ? (b | 128) : b;
+  } while (remaining > 0);
+
+  size_t length = headerLength + 2 + topic.length() + 2 + data.length();
+  uint8_t *packet = (uint8_t *)malloc(length);
+  if (packet == NULL) {
+    return false;
+  }
+
+  if (nextPacketId < 0x8000) {
+    nextPacketId = 0x8000;
+  }
+  uint16_t packetId = nextPacketId++;
+
+  size_t pos = 0;
+  memcpy(packet, header, headerLength);
+  pos += headerLength;
+  packet[pos++] = topic.length() >> 8;
+  packet[pos++] = topic.length() & 0xFF;
+  memcpy(packet + pos, topic.c_str(), topic.length());
+  pos += topic.length();
+  packet[pos++] = packetId >> 8;
+  packet[pos++] = packetId & 0xFF;
+  memcpy(packet + pos, data.c_str(), data.length());
+
+  if (ackTap->write(packet, length) != length) {
+    free(packet);
+    return false;
+  }
+
+  inFlight[slot].id = packetId;
+  inFlight[slot].packet = packet;
+  inFlight[slot].length = length;
+  inFlight[slot].sentAt = millis();
+  inFlight[slot].retries = 0;
+  if (id != NULL) {
+    *id = packetId;
+  }
+  return true;
+}
+
+uint8_t CloudIoTCoreMqtt::publishWindowFree() {
+  uint8_t used = 0;
+  for (uint8_t i = 0; i < PUBLISH_WINDOW_MAX; i++) {
+    if (inFlight[i].packet != NULL) {
+      used++;
+    }
+  }
+  return used >= window ? 0 : window - used;
+}
+
+// Matches the PUBACKs seen by the tap with the publishes in flight
+void CloudIoTCoreMqtt::processAcks() {
+  uint16_t id;
+  while (ackTap->popAck(&id)) {
+    for (uint8_t i = 0; i < PUBLISH_WINDOW_MAX; i++) {
+      if (inFlight[i].packet != NULL && inFlight[i].id == id) {
+        releaseInFlight(i, true);
+        break;
+      }
+    }
+  }
+}
+
+// Sends timed out publishes again with the DUP flag, gives up after maxRetries
+void CloudIoTCoreMqtt::retransmit() {
+  for (uint8_t i = 0; i < PUBLISH_WINDOW_MAX; i++) {
+    if (inFlight[i].packet == NULL || millis() - inFlight[i].sentAt < ackTimeout) {
+      continue;
+    }
+    if (inFlight[i].retries >= maxRetries) {
+      Serial.println("No PUBACK for packet " + String(inFlight[i].id));
+      releaseInFlight(i, false);
+      continue;
+    }
+    inFlight[i].packet[0] |= 0x08; // DUP
+    ackTap->write(inFlight[i].packet, inFlight[i].length);
+    inFlight[i].sentAt = millis();
+    inFlight[i].retries++;
+  }
+}
+
+void CloudIoTCoreMqtt::releaseInFlight(uint8_t slot, bool acked) {
+  uint16_t id = inFlight[slot].id;
+  free(inFlight[slot].packet);
+  inFlight[slot].packet = NULL;
+  if (publishResult != NULL) {
+    publishResult(id, acked);
+  }
+}
+
 // Helper that just sends default sensor
 bool CloudIoTCoreMqtt::publishState(String data) {
   return this->mqttClient->publish(device->getStateTopic(), data);
@@ -308,3 +522,32 @@ void CloudIoTCoreMqtt::setLogConnect(boolean enabled) {
 void CloudIoTCoreMqtt::setUseLts(boolean enabled) {
   this->useLts = enabled;
 }
+
+void CloudIoTCoreMqtt::setAsyncConnect(boolean enabled) {
+  this->asyncConnect = enabled;
+}
+
+// Optional check (e.g. WiFi up and clock synced) run before each attempt
+void CloudIoTCoreMqtt::setNetworkCheck(bool (*check)()) {
+  this->networkReady = check;
+}
+
+CloudIoTCoreMqttState CloudIoTCoreMqtt::getState() {
+  return this->state;
+}
+
+// Number of QoS 1 publishes allowed in flight and how long to wait for each ack
+void CloudIoTCoreMqtt::setPublishWindow(uint8_t size, unsigned long timeout) {
+  if (size < 1) {
+    size = 1;
+  }
+  if (size > PUBLISH_WINDOW_MAX) {
+    size = PUBLISH_WINDOW_MAX;
+  }
+  this->window = size;
+  this->ackTimeout = timeout;
+}
+
+void CloudIoTCoreMqtt::setPublishResultCallback(void (*callback)(uint16_t id, bool acked)) {
+  this->publishResult = callback;
+}
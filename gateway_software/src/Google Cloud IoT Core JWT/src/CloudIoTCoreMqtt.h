@@ -19,6 +19,26 @@
 #include "CloudIoTCoreDevice.h"
 #include <Client.h>
 #include <MQTTClient.h>
+#include "CloudIoTCoreAckTap.h"
+
+#define PUBLISH_WINDOW_MAX 16 // upper bound for setPublishWindow()
+
+// QoS 1 publish written by publishTelemetryAsync() and not acknowledged yet
+struct CloudIoTCoreInFlight {
+  uint16_t id;
+  uint8_t *packet;        // encoded PUBLISH, kept for retransmission
+  size_t length;
+  unsigned long sentAt;
+  uint8_t retries;
+};
+
+// Connection states stepped by loop() when async connect is enabled
+enum CloudIoTCoreMqttState {
+  MQTT_STATE_WAIT_NETWORK,  // waiting for the network check to pass
+  MQTT_STATE_CONNECT,       // next step makes a single connection attempt
+  MQTT_STATE_BACKOFF,       // waiting out __backoff__ after a failed attempt
+  MQTT_STATE_CONNECTED
+};
 
 class CloudIoTCoreMqtt {
   private:
@@ -29,11 +49,31 @@ class CloudIoTCoreMqtt {
     static const int __jitter__ = 500; // max random jitter, ms
     boolean logConnect = true;
     boolean useLts = false;
+    boolean asyncConnect = false;
+    CloudIoTCoreMqttState state = MQTT_STATE_WAIT_NETWORK;
+    unsigned long lastAttempt = 0; // millis() of the last failed attempt
+    bool (*networkReady)() = NULL;
+
+    CloudIoTCoreAckTap *ackTap;
+    CloudIoTCoreInFlight inFlight[PUBLISH_WINDOW_MAX];
+    uint8_t window = 4;
+    unsigned long ackTimeout = 10000; // ms before a PUBLISH is sent again
+    uint8_t maxRetries = 3;
+    uint16_t nextPacketId = 0x8000; // lwmqtt counts up from 1, stay clear of it
+    void (*publishResult)(uint16_t id, bool acked) = NULL;
 
     MQTTClient *mqttClient;
     Client *netClient;
     CloudIoTCoreDevice *device;
 
+    void connectStep();
+    bool connectOnce();
+    void increaseBackoff();
+
+    void processAcks();
+    void retransmit();
+    void releaseInFlight(uint8_t slot, bool acked);
+
   public:
     CloudIoTCoreMqtt(MQTTClient *mqttClient, Client *netClient, CloudIoTCoreDevice *device);
 
@@ -49,6 +89,8 @@ class CloudIoTCoreMqtt {
     bool publishTelemetry(String subtopic, String data);
     bool publishTelemetry(String subtopic, String data, int qos);
     bool publishTelemetry(String subtopic, const char* data, int length);
+    bool publishTelemetryAsync(String subtopic, String data, uint16_t *id);
+    uint8_t publishWindowFree();
     bool publishState(String data);
     bool publishState(const char* data, int length);
 
@@ -59,5 +101,10 @@ class CloudIoTCoreMqtt {
     void onConnect();
     void setLogConnect(boolean enabled);
     void setUseLts(boolean enabled);
+    void setAsyncConnect(boolean enabled);
+    void setNetworkCheck(bool (*check)());
+    CloudIoTCoreMqttState getState();
+    void setPublishWindow(uint8_t size, unsigned long timeout);
+    void setPublishResultCallback(void (*callback)(uint16_t id, bool acked));
 };
 #endif // __CLOUDIOTCORE_MQTT_H__
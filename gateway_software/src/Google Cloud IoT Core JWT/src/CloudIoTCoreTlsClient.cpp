@@ -0,0 +1,446 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : mbedTLS network client that resumes the TLS session across
+*               reconnects and times the handshakes
+*****************************************************************************/
+#include "CloudIoTCoreTlsClient.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/tcp.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+
+#include "mbedtls/error.h"
+
+static const char *drbg_personalization = "cloudiotcore-tls";
+
+CloudIoTCoreTlsClient::CloudIoTCoreTlsClient() {
+  mbedtls_net_init(&net);
+  mbedtls_ssl_init(&ssl);
+  mbedtls_ssl_config_init(&conf);
+  mbedtls_x509_crt_init(&ca);
+  mbedtls_entropy_init(&entropy);
+  mbedtls_ctr_drbg_init(&drbg);
+  mbedtls_ssl_session_init(&session);
+}
+
+CloudIoTCoreTlsClient::~CloudIoTCoreTlsClient() {
+  stop();
+  mbedtls_ssl_session_free(&session);
+  mbedtls_ssl_free(&ssl);
+  mbedtls_ssl_config_free(&conf);
+  mbedtls_x509_crt_free(&ca);
+  mbedtls_ctr_drbg_free(&drbg);
+  mbedtls_entropy_free(&entropy);
+}
+
+void CloudIoTCoreTlsClient::setCACert(const char *rootCA) {
+  caCert = rootCA;
+}
+
+// Name sent as SNI and checked against the certificate when connecting to a
+// bare address, e.g. an IP resolved elsewhere
+void CloudIoTCoreTlsClient::setServerName(const char *name) {
+  serverName = name != NULL ? name : "";
+}
+
+void CloudIoTCoreTlsClient::setSessionResumption(bool enabled) {
+  resumption = enabled;
+  if (!enabled) {
+    clearSession();
+  }
+}
+
+void CloudIoTCoreTlsClient::setConnectTimeout(unsigned long ms) {
+  connectTimeout = ms;
+}
+
+void CloudIoTCoreTlsClient::clearSession() {
+  mbedtls_ssl_session_free(&session);
+  mbedtls_ssl_session_init(&session);
+  haveSession = false;
+}
+
+unsigned long CloudIoTCoreTlsClient::lastTcpMs() {
+  return tcpMs;
+}
+
+unsigned long CloudIoTCoreTlsClient::lastHandshakeMs() {
+  return handshakeMs;
+}
+
+bool CloudIoTCoreTlsClient::lastResumed() {
+  return resumed;
+}
+
+uint32_t CloudIoTCoreTlsClient::getHandshakes() {
+  return handshakes;
+}
+
+uint32_t CloudIoTCoreTlsClient::getResumptions() {
+  return resumptions;
+}
+
+void CloudIoTCoreTlsClient::fail(const char *what, int ret) {
+  char text[96];
+  mbedtls_strerror(ret, text, sizeof(text));
+  Serial.printf("TLS %s failed: -0x%04x %s\n", what, (unsigned int)-ret, text);
+}
+
+// Only a full handshake carries a certificate chain to verify
+int CloudIoTCoreTlsClient::onVerify(void *ctx, mbedtls_x509_crt *crt, int depth, uint32_t *flags) {
+  ((CloudIoTCoreTlsClient *)ctx)->chainChecked = true;
+  return 0;
+}
+
+// RNG, root certificate and config are built on the first connect and kept
+bool CloudIoTCoreTlsClient::setup() {
+  if (configured) {
+    return true;
+  }
+  if (caCert == NULL) {
+    Serial.println("TLS: no root certificate set");
+    return false;
+  }
+
+  int ret = mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy,
+      (const unsigned char *)drbg_personalization, strlen(drbg_personalization));
+  if (ret != 0) {
+    fail("RNG seed", ret);
+    return false;
+  }
+  ret = mbedtls_x509_crt_parse(&ca, (const unsigned char *)caCert, strlen(caCert) + 1);
+  if (ret != 0) {
+    fail("root certificate", ret);
+    return false;
+  }
+  ret = mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT,
+      MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+  if (ret != 0) {
+    fail("config", ret);
+    return false;
+  }
+  mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+  mbedtls_ssl_conf_ca_chain(&conf, &ca, NULL);
+  mbedtls_ssl_conf_verify(&conf, onVerify, this);
+  mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &drbg);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+  mbedtls_ssl_conf_session_tickets(&conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+  ret = mbedtls_ssl_setup(&ssl, &conf);
+  if (ret != 0) {
+    fail("setup", ret);
+    return false;
+  }
+
+  configured = true;
+  return true;
+}
+
+// select() on the socket, true when it is ready before the timeout
+bool CloudIoTCoreTlsClient::waitSocket(bool forWrite, unsigned long timeout) {
+  fd_set set;
+  struct timeval tv;
+  FD_ZERO(&set);
+  FD_SET(net.fd, &set);
+  tv.tv_sec = timeout / 1000;
+  tv.tv_usec = (timeout % 1000) * 1000;
+  return select(net.fd + 1, forWrite ? NULL : &set, forWrite ? &set : NULL, NULL, &tv) > 0;
+}
+
+// Non-blocking connect bounded by connectTimeout, 0 on success
+int CloudIoTCoreTlsClient::connectSocket(const struct sockaddr_in *address) {
+  net.fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (net.fd < 0) {
+    return -1;
+  }
+  mbedtls_net_set_nonblock(&net);
+
+  if (::connect(net.fd, (const struct sockaddr *)address, sizeof(*address)) < 0 &&
+      errno != EINPROGRESS) {
+    return -1;
+  }
+  if (!waitSocket(true, connectTimeout)) {
+    return -1;
+  }
+  int error = 0;
+  socklen_t length = sizeof(error);
+  if (getsockopt(net.fd, SOL_SOCKET, SO_ERROR, &error, &length) < 0 || error != 0) {
+    return -1;
+  }
+
+  // MQTT packets are small, do not hold them back for coalescing
+  int one = 1;
+  setsockopt(net.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  return 0;
+}
+
+// Offers the cached session, then keeps the one this handshake ended with.
+// The handshake was resumed when the broker sent no certificate chain.
+// name is the SNI and certificate name (NULL checks the chain only), peer
+// keys the cached session.
+int CloudIoTCoreTlsClient::handshake(const char *name, const String &peer) {
+  bool offered = false;
+  int ret;
+
+  mbedtls_ssl_set_hostname(&ssl, name);
+  mbedtls_ssl_set_bio(&ssl, &net, mbedtls_net_send, mbedtls_net_recv, NULL);
+  if (resumption && haveSession && sessionHost == peer) {
+    offered = mbedtls_ssl_set_session(&ssl, &session) == 0;
+  }
+
+  chainChecked = false;
+  unsigned long start = millis();
+  while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
+    if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+      break;
+    }
+    unsigned long elapsed = millis() - start;
+    if (elapsed >= connectTimeout) {
+      ret = MBEDTLS_ERR_SSL_TIMEOUT;
+      break;
+    }
+    waitSocket(ret == MBEDTLS_ERR_SSL_WANT_WRITE, connectTimeout - elapsed);
+  }
+  handshakeMs = millis() - start;
+  resumed = false;
+
+  if (ret != 0) {
+    // A session the broker chokes on is not offered again
+    if (offered) {
+      clearSession();
+    }
+    return ret;
+  }
+
+  handshakes++;
+  resumed = offered && !chainChecked;
+  if (resumption) {
+    mbedtls_ssl_session fresh;
+    mbedtls_ssl_session_init(&fresh);
+    if (mbedtls_ssl_get_session(&ssl, &fresh) == 0) {
+      mbedtls_ssl_session_free(&session);
+      session = fresh;  // takes over the ticket and peer certificate
+      haveSession = true;
+      sessionHost = peer;
+    } else {
+      mbedtls_ssl_session_free(&fresh);
+    }
+  }
+  if (resumed) {
+    resumptions++;
+  }
+  return 0;
+}
+
+// Connects to the address as given. The certificate is checked against the
+// name from setServerName(), without one only the chain is verified.
+int CloudIoTCoreTlsClient::connect(IPAddress ip, uint16_t port) {
+  char peer[16];
+  uint32_t raw = (uint32_t)ip;
+  const uint8_t *octets = (const uint8_t *)&raw;
+  snprintf(peer, sizeof(peer), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+
+  stop();
+  if (!setup()) {
+    return 0;
+  }
+
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = raw;
+  const char *name = serverName.length() > 0 ? serverName.c_str() : NULL;
+  return connectAddress(&address, port, name, name != NULL ? serverName : String(peer));
+}
+
+int CloudIoTCoreTlsClient::connect(const char *host, uint16_t port) {
+  stop();
+  if (!setup()) {
+    return 0;
+  }
+
+  struct sockaddr_in address;
+  if (haveAddress && cachedHost == host) {
+    address = cachedAddress;
+  } else {
+    struct addrinfo hints;
+    struct addrinfo *result = NULL;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host, NULL, &hints, &result) != 0 || result == NULL) {
+      Serial.println("TLS: could not resolve " + String(host));
+      return 0;
+    }
+    memcpy(&address, result->ai_addr, sizeof(address));
+    freeaddrinfo(result);
+  }
+
+  if (!connectAddress(&address, port, host, String(host))) {
+    haveAddress = false;
+    return 0;
+  }
+  cachedHost = host;
+  cachedAddress = address;
+  haveAddress = true;
+  return 1;
+}
+
+// TCP connect and handshake, 1 on success
+int CloudIoTCoreTlsClient::connectAddress(struct sockaddr_in *address, uint16_t port,
+                                          const char *name, const String &peer) {
+  address->sin_port = htons(port);
+
+  unsigned long start = millis();
+  if (connectSocket(address) != 0) {
+    Serial.println("TLS: TCP connect to " + peer + " failed");
+    stop();
+    return 0;
+  }
+  tcpMs = millis() - start;
+
+  int ret = handshake(name, peer);
+  if (ret != 0) {
+    fail("handshake", ret);
+    stop();
+    return 0;
+  }
+  Serial.println("TLS handshake " + String(handshakeMs) + " ms" +
+                 (resumed ? " (resumed)" : " (full)") +
+                 ", TCP " + String(tcpMs) + " ms");
+
+  open = true;
+  return 1;
+}
+
+size_t CloudIoTCoreTlsClient::write(uint8_t b) {
+  return write(&b, 1);
+}
+
+// Blocks until everything is written or the connect timeout passes
+size_t CloudIoTCoreTlsClient::write(const uint8_t *buf, size_t size) {
+  if (!open) {
+    return 0;
+  }
+  size_t written = 0;
+  unsigned long start = millis();
+  while (written < size) {
+    int ret = mbedtls_ssl_write(&ssl, buf + written, size - written);
+    if (ret > 0) {
+      written += ret;
+      continue;
+    }
+    if ((ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) ||
+        millis() - start >= connectTimeout) {
+      fail("write", ret);
+      stop();
+      break;
+    }
+    waitSocket(ret == MBEDTLS_ERR_SSL_WANT_WRITE, 10);
+  }
+  return written;
+}
+
+// Processes the next record without blocking, as WiFiClientSecure does
+int CloudIoTCoreTlsClient::available() {
+  if (!open) {
+    return 0;
+  }
+  int pending = (int)mbedtls_ssl_get_bytes_avail(&ssl);
+  if (pending == 0) {
+    int ret = mbedtls_ssl_read(&ssl, NULL, 0);
+    if (ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+      if (ret != MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+        fail("read", ret);
+      }
+      stop();
+      return 0;
+    }
+    pending = (int)mbedtls_ssl_get_bytes_avail(&ssl);
+  }
+  return pending + (peeked >= 0 ? 1 : 0);
+}
+
+int CloudIoTCoreTlsClient::read() {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+
+// Returns what is there without waiting, -1 when nothing is
+int CloudIoTCoreTlsClient::read(uint8_t *buf, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  int count = 0;
+  if (peeked >= 0) {
+    buf[0] = (uint8_t)peeked;
+    peeked = -1;
+    buf++;
+    size--;
+    count = 1;
+  }
+  if (!open || size == 0) {
+    return count > 0 ? count : -1;
+  }
+
+  int ret = mbedtls_ssl_read(&ssl, buf, size);
+  if (ret > 0) {
+    return count + ret;
+  }
+  if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+    if (ret != 0 && ret != MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+      fail("read", ret);
+    }
+    stop();
+  }
+  return count > 0 ? count : -1;
+}
+
+int CloudIoTCoreTlsClient::peek() {
+  if (peeked < 0) {
+    peeked = read();
+  }
+  return peeked;
+}
+
+void CloudIoTCoreTlsClient::flush() {
+}
+
+// Closes the socket, the cached session and address survive for the next
+// connect
+void CloudIoTCoreTlsClient::stop() {
+  if (open) {
+    mbedtls_ssl_close_notify(&ssl);
+  }
+  mbedtls_net_free(&net);
+  if (configured) {
+    mbedtls_ssl_session_reset(&ssl);
+  }
+  open = false;
+  peeked = -1;
+}
+
+uint8_t CloudIoTCoreTlsClient::connected() {
+  return open;
+}
+
+CloudIoTCoreTlsClient::operator bool() {
+  return open;
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : mbedTLS network client that resumes the TLS session across
+*               reconnects and times the handshakes
+*****************************************************************************/
+#ifndef __CLOUDIOTCORE_TLS_CLIENT_H__
+#define __CLOUDIOTCORE_TLS_CLIENT_H__
+#include <Arduino.h>
+#include <Client.h>
+#include <netinet/in.h>
+
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
+
+#define TLS_CLIENT_TIMEOUT 10000 // ms for TCP connect plus handshake
+
+// Drop-in for WiFiClientSecure on the MQTT link. The session from the last
+// handshake (session ticket or session id, whichever the broker issues) is
+// offered again on the next connect, so a reconnect after a Wi-Fi drop or a
+// JWT refresh skips the certificate chain validation and the ECDHE exchange.
+// The broker address is cached too, the lookup only repeats after a failure.
+// Uses the BSD socket API, which lwIP provides on the ESP32, so the same code
+// runs on the host against bench/tls/tls_broker.py.
+class CloudIoTCoreTlsClient : public Client {
+  private:
+    mbedtls_net_context net;
+    bool open = false;
+    int peeked = -1;
+
+    const char *caCert = NULL;
+    String serverName;
+    bool configured = false;
+    bool resumption = true;
+    unsigned long connectTimeout = TLS_CLIENT_TIMEOUT;
+
+    mbedtls_ssl_context ssl;
+    mbedtls_ssl_config conf;
+    mbedtls_x509_crt ca;
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context drbg;
+
+    mbedtls_ssl_session session;
+    bool haveSession = false;
+    String sessionHost;
+
+    String cachedHost;
+    struct sockaddr_in cachedAddress;
+    bool haveAddress = false;
+
+    unsigned long tcpMs = 0;
+    unsigned long handshakeMs = 0;
+    bool resumed = false;
+    bool chainChecked = false;
+    uint32_t handshakes = 0;
+    uint32_t resumptions = 0;
+
+    static int onVerify(void *ctx, mbedtls_x509_crt *crt, int depth, uint32_t *flags);
+    bool setup();
+    int connectSocket(const struct sockaddr_in *address);
+    bool waitSocket(bool forWrite, unsigned long timeout);
+    int handshake(const char *name, const String &peer);
+    int connectAddress(struct sockaddr_in *address, uint16_t port, const char *name, const String &peer);
+    void fail(const char *what, int ret);
+
+  public:
+    CloudIoTCoreTlsClient();
+    ~CloudIoTCoreTlsClient();
+
+    void setCACert(const char *rootCA);
+    void setServerName(const char *name);  // certificate name for connect(IPAddress)
+    void setSessionResumption(bool enabled);
+    void setConnectTimeout(unsigned long ms);
+    void clearSession();
+
+    unsigned long lastTcpMs();        // TCP connect of the last attempt
+    unsigned long lastHandshakeMs();  // TLS handshake of the last attempt
+    bool lastResumed();               // last handshake resumed the session
+    uint32_t getHandshakes();
+    uint32_t getResumptions();
+
+    int connect(IPAddress ip, uint16_t port);
+    int connect(const char *host, uint16_t port);
+    size_t write(uint8_t b);
+    size_t write(const uint8_t *buf, size_t size);
+    int available();
+    int read();
+    int read(uint8_t *buf, size_t size);
+    int peek();
+    void flush();
+    void stop();
+    uint8_t connected();
+    operator bool();
+};
+#endif // __CLOUDIOTCORE_TLS_CLIENT_H__
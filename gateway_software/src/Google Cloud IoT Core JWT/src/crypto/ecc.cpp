@@ -1,4 +1,4 @@
-// AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.
+// Forked from ecc-light-certificate, edited in this repo. See CONTRIBUTING.md.
 /**
  * \addtogroup ecc
  *
@@ -26,15 +26,25 @@
  * Enable repeated point doubling.
  */
 #define REPEAT_DOUBLE
+/**
+ * Use the fixed-base comb table in flash for k*G (secp256r1_comb.h).
+ * Other digit sizes keep the sliding window table built in RAM.
+ */
+#if defined(SECP256R1) && (NN_DIGIT_BITS == 32 || NN_DIGIT_BITS == 64)
+#define FIXED_BASE_COMB
+#include "secp256r1_comb.h"
+#endif
 
 /*
  * parameters for ECC operations
  */
 static curve_params_t param;
+#ifndef FIXED_BASE_COMB
 /*
  * precomputed array for base point
  */
 static point_t pBaseArray[NUM_POINTS];
+#endif
 /*
  * masks for sliding window method
  */
@@ -206,8 +216,10 @@ ecc_init()
  /* get parameters */
  get_curve_param(&param);
 
+ #ifndef FIXED_BASE_COMB
  /* precompute array for base point */
  ecc_win_precompute(&(param.G), pBaseArray);
+ #endif
 
 }
 /*---------------------------------------------------------------------------*/
@@ -254,6 +266,12 @@ ecc_add(point_t * P0, point_t * P1, point_t * P2)
 }
 /*---------------------------------------------------------------------------*/
 void
+ecc_add_mix(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2)
+{
+  c_add_mix(P0, Z0, P1, Z1, P2);
+}
+/*---------------------------------------------------------------------------*/
+void
 ecc_dbl_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1)
 {
   NN_DIGIT n0[NUMWORDS];
@@ -653,11 +671,60 @@ ecc_win_mul(point_t * P0, NN_DIGIT * n, point_t * pointArray)
 }
 
 /*---------------------------------------------------------------------------*/
+#ifdef FIXED_BASE_COMB
+/*
+ * P0 = n*basepoint with the Lim-Lee comb. Bit t of block j in each of the
+ * COMB_TEETH rows forms the index into table j, so all tables share the
+ * COMB_BLOCK-1 doublings.
+ */
+void
+ecc_win_mul_base(point_t * P0, NN_DIGIT * n)
+{
+  int8_t t, j, i;
+  uint16_t bit;
+  NN_DIGIT u;
+  NN_DIGIT Z0[NUMWORDS];
+  NN_DIGIT Z1[NUMWORDS];
+
+  p_clear(P0);
+  NN_AssignZero(Z0, NUMWORDS);
+
+  for(t = COMB_BLOCK - 1; t >= 0; t--) {
+    if(t != COMB_BLOCK - 1) {
+      ecc_dbl_proj(P0, Z0, P0, Z0);
+    }
+
+    for(j = 0; j < COMB_TABLES; j++) {
+      u = 0;
+      for(i = 0; i < COMB_TEETH; i++) {
+        bit = i*COMB_SPACING + j*COMB_BLOCK + t;
+        u |= ((n[bit / NN_DIGIT_BITS] >> (bit % NN_DIGIT_BITS)) & 1) << i;
+      }
+
+      if(u) {
+        c_add_mix(P0, Z0, P0, Z0, (point_t *)&(comb_table[j][u-1]));
+      }
+    }
+  }
+
+  /* Convert back to affine coordinate */
+  if(NN_Zero(Z0, NUMWORDS)) {
+    p_clear(P0);
+  } else if(!Z_is_one(Z0)) {
+    NN_ModInv(Z1, Z0, param.p, NUMWORDS);
+    NN_ModMultOpt(Z0, Z1, Z1, param.p, param.omega, NUMWORDS);
+    NN_ModMultOpt(P0->x, P0->x, Z0, param.p, param.omega, NUMWORDS);
+    NN_ModMultOpt(Z0, Z0, Z1, param.p, param.omega, NUMWORDS);
+    NN_ModMultOpt(P0->y, P0->y, Z0, param.p, param.omega, NUMWORDS);
+  }
+}
+#else
 void
 ecc_win_mul_base(point_t * P0, NN_DIGIT * n)
 {
   ecc_win_mul(P0, n, pBaseArray);
 }
+#endif
 /*---------------------------------------------------------------------------*/
 point_t *
 ecc_get_base_p()
@@ -667,7 +734,7 @@ ecc_get_base_p()
 /*---------------------------------------------------------------------------*/
 void ecc_gen_pub_key(NN_DIGIT *priv_key, point_t * pub)
 {
-	ecc_win_mul(pub, priv_key, pBaseArray);
+	ecc_win_mul_base(pub, priv_key);
 }
 /*---------------------------------------------------------------------------*/
 void ecc_gen_private_key(NN_DIGIT *PrivateKey)
@@ -1,4 +1,4 @@
-// AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.
+// Forked from ecc-light-certificate, edited in this repo. See CONTRIBUTING.md.
 /**
  * \defgroup ecc Elliptic Curve Point Arithmetic
  *
@@ -37,7 +37,7 @@
  *              if W_BITS is 8, BASIC_MASK must be 0xff
  */
 //#define BASIC_MASK 0x0f
-#define BASIC_MASK ((1 << W_BITS) - 1)
+#define BASIC_MASK (((NN_DIGIT)1 << W_BITS) - 1)
 
 /**
  * Number of windows in one digit, NUM_MASKS = NN_DIGIT_BITS/W_BITS
@@ -122,6 +122,13 @@ void ecc_add(point_t * P0, point_t * P1, point_t * P2);
  */
 void ecc_add_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2, NN_DIGIT * Z2);
 
+/**
+ * \brief             Mixed point addition, (P0,Z0) = (P1,Z1) + P2
+ *                    with P2 in affine coordinates.
+ *                    P0 and P1 can be same pointer.
+ */
+void ecc_add_mix(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2);
+
 /**
  * \brief             Point doubleing, (P0,Z0) = 2*(P1,Z1)
  *                    using projective coordinates system.
@@ -1,4 +1,4 @@
-// AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.
+// Forked from ecc-light-certificate, edited in this repo. See CONTRIBUTING.md.
 /**
  * \addtogroup ecdsa
  *
@@ -20,35 +20,38 @@
 #define FALSE 0
 
 //enable shamir trick
-//#define SHAMIR_TRICK
+#define SHAMIR_TRICK
 
 #ifdef SHAMIR_TRICK
-/* The size of sliding window, S_W_BITS <= 8 */
-#define S_W_BITS 2
-
 /*
- * basic mask used to generate mask array
- * For example: if S_W_BITS is 2, BASIC_MASK must be 0x03;
- *              if S_W_BITS is 4, BASIC_MASK must be 0x0f;
- *              if S_W_BITS is 8, BASIC_MASK must be 0xff;
+ * u1*G + u2*Q is computed with interleaved width-w NAF: both scalars are
+ * recoded to signed odd digits and share one chain of doublings. A
+ * negative digit adds the table point with its y negated, so the tables
+ * only hold the odd multiples 1P, 3P, ..., (2^(w-1)-1)P.
  */
-#define S_BASIC_MASK ((1 << S_W_BITS) - 1)
+/* wNAF width for the base point, the table is built once */
+#define S_W_G 6
+/* wNAF width for the public key, the table is rebuilt by ecdsa_init */
+#define S_W_Q 5
 
-/* number of windows in one digit, NUM_MASKS = NN_DIGIT_BITS/W_BITS */
-#define S_NUM_MASKS (NN_DIGIT_BITS/S_W_BITS)
+#define S_G_POINTS (1 << (S_W_G - 2))
+#define S_Q_POINTS (1 << (S_W_Q - 2))
 
-/* number of points for precomputed points, NN_POINTS = 2^W_BITS - 1 */
-#define S_NUM_POINTS ((1 << (2*S_W_BITS)) - 1)
+#if S_Q_POINTS != ECDSA_KEY_POINTS
+#error "ECDSA_KEY_POINTS must match the public key wNAF width"
+#endif
 
-#define S_MAX ((1 << S_W_BITS) - 1)
+/* a k-bit scalar has at most k+1 wNAF digits */
+#define S_NAF_LEN (KEYDIGITS*NN_DIGIT_BITS + 1)
 
 #endif /* SHAMIR_TRICK */
 
 
 
 #ifdef SHAMIR_TRICK
-static point_t pqBaseArray[S_NUM_POINTS];
-static NN_DIGIT s_mask[S_NUM_MASKS];
+static point_t gNafArray[S_G_POINTS];
+static point_t qNafArray[S_Q_POINTS];
+static char g_naf_ready = FALSE;
 static curve_params_t* param;
 #else /* defined(SLIDING_WIN) */
 /* precomputed array of public key(used in verification) for
@@ -62,115 +65,154 @@ static NN_DIGIT order[NUMWORDS];
 
 /*---------------------------------------------------------------------------*/
 #ifdef SHAMIR_TRICK
-static point_t * baseP;
 /**
- * \brief             Shamir trick init.
+ * \brief             Odd multiples [0] = P, [1] = 3P, ... in affine form.
  */
 static void
-shamir_init(point_t * pKey, point_t * pointArray)
+naf_precompute(point_t * P, point_t * pointArray, uint8_t points)
 {
-  uint16_t i;
-  uint16_t j;
-
-  baseP = ecc_get_base_p();
-
-  /* max = 2^w-1
-   * [0] = Q
-   * [1] = 2Q
-   * ...
-   * [max-1] = max*Q
-   */
-  NN_Assign(pointArray[0].x, pKey->x, NUMWORDS);
-  NN_Assign(pointArray[0].y, pKey->y, NUMWORDS);
-
-  for(i=1; i<S_MAX; i++) {
-    ecc_add(&(pointArray[i]), &(pointArray[i-1]), pKey);
-  }
+  uint8_t i;
+  point_t P2;
 
-  /*
-   * [max] = P
-   * [max+1] = P+Q
-   * ...
-   * [max+max] = P+max*Q
-   * [max+max+1] = 2P
-   * [max+max+2] = 2P+Q
-   * ...
-   * [max+2*max+1] = 2P+max*Q
-   * ...
-   */
-  for(i = 0; i < S_MAX; i++) {
-    for(j = 0; j<S_MAX+1; j++) {
-      if(i == 0 && j==0) {
-        NN_Assign(pointArray[S_MAX].x, baseP->x, NUMWORDS);
-	      NN_Assign(pointArray[S_MAX].y, baseP->y, NUMWORDS);
-      } else if(j==0) {
-        ecc_add(&(pointArray[S_MAX+(S_MAX+1)*i]),
-                &(pointArray[S_MAX+(S_MAX+1)*(i-1)]),
-                baseP);
-      }else{
-        ecc_add(&(pointArray[S_MAX+(S_MAX+1)*i+j]),
-                &(pointArray[S_MAX+(S_MAX+1)*i]),
-                &(pointArray[j-1]));
+  ecc_add(&P2, P, P);
+
+  NN_Assign(pointArray[0].x, P->x, NUMWORDS);
+  NN_Assign(pointArray[0].y, P->y, NUMWORDS);
+
+  for(i = 1; i < points; i++) {
+    ecc_add(&(pointArray[i]), &(pointArray[i-1]), &P2);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Width-w NAF recoding of k, least significant digit
+ *                    first. Returns the number of digits.
+ */
+static int16_t
+naf_recode(int8_t * naf, NN_DIGIT * k, uint8_t w)
+{
+  int16_t i = 0;
+  int16_t len = 0;
+  int8_t digit;
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT d[NUMWORDS];
+
+  NN_Assign(t, k, NUMWORDS);
+  NN_AssignZero(d, NUMWORDS);
+
+  while(!NN_Zero(t, NUMWORDS)) {
+    if(t[0] & 1) {
+      /* digit = t mods 2^w */
+      digit = (int8_t)(t[0] & ((1 << w) - 1));
+      if(digit >= (1 << (w - 1))) {
+        digit -= (1 << w);
       }
+      if(digit > 0) {
+        d[0] = digit;
+        NN_Sub(t, t, d, NUMWORDS);
+      } else {
+        d[0] = -digit;
+        NN_Add(t, t, d, NUMWORDS);
+      }
+      naf[i] = digit;
+      len = i + 1;
+    } else {
+      naf[i] = 0;
     }
+    NN_RShift(t, t, 1, NUMWORDS);
+    i++;
   }
 
-  for(i = 0; i < S_NUM_MASKS; i++) {
-    s_mask[i] = S_BASIC_MASK << (S_W_BITS*i);
+  return len;
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             (P0,Z0) += digit * P for an odd wNAF digit.
+ */
+static void
+naf_add(point_t * P0, NN_DIGIT * Z0, point_t * pointArray, int8_t digit)
+{
+  point_t neg;
+
+  if(digit > 0) {
+    ecc_add_mix(P0, Z0, P0, Z0, &(pointArray[(digit - 1) >> 1]));
+  } else {
+    NN_Assign(neg.x, pointArray[(-digit - 1) >> 1].x, NUMWORDS);
+    NN_Sub(neg.y, param->p, pointArray[(-digit - 1) >> 1].y, NUMWORDS);
+    ecc_add_mix(P0, Z0, P0, Z0, &neg);
   }
 }
 /*---------------------------------------------------------------------------*/
 /**
- * \brief             Shamir trick
+ * \brief             Runs of zero digits are folded into one repeated
+ *                    doubling.
+ */
+static void
+naf_dbl(point_t * P0, NN_DIGIT * Z0, uint16_t m)
+{
+  while(m > 0) {
+    uint8_t step = m > 255 ? 255 : m;
+
+    ecc_m_dbl_projective(P0, Z0, step);
+    m -= step;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Shamir trick, P0 = u1*G + u2*Q
  *
  */
 static void
-shamir(point_t * P0, NN_DIGIT * u1, NN_DIGIT * u2)
+shamir(point_t * P0, NN_DIGIT * u1, NN_DIGIT * u2, point_t * qTable)
 {
   int16_t i, tmp, tmp2;
-  int8_t j, k;
-  NN_DIGIT windex;
+  uint16_t dbl = 0;
+  int8_t naf1[S_NAF_LEN];
+  int8_t naf2[S_NAF_LEN];
   NN_DIGIT Z0[NUMWORDS];
   NN_DIGIT Z1[NUMWORDS];
 
-  /* clear point */
-  NN_AssignZero(P0->x, NUMWORDS);
-  NN_AssignZero(P0->y, NUMWORDS);
-
-  /* convert to Jprojective coordinate */
-  NN_AssignZero(Z0, NUMWORDS);
-  NN_AssignZero(Z1, NUMWORDS);
-  Z1[0] = 0x01;
-
-  tmp = NN_Digits(u1, NUMWORDS);
-  tmp2 = NN_Digits(u2, NUMWORDS);
+  memset(naf1, 0, sizeof(naf1));
+  memset(naf2, 0, sizeof(naf2));
+  tmp = naf_recode(naf1, u1, S_W_G);
+  tmp2 = naf_recode(naf2, u2, S_W_Q);
   if(tmp2 > tmp) {
     tmp = tmp2;
   }
 
+  /* start from the point at infinity */
+  NN_AssignZero(P0->x, NUMWORDS);
+  NN_AssignZero(P0->y, NUMWORDS);
+  NN_AssignZero(Z0, NUMWORDS);
+
   for(i = tmp - 1; i >= 0; i--) {
-    for(j = NN_DIGIT_BITS/S_W_BITS - 1; j >= 0; j--) {
-      for(k = 0; k < S_W_BITS; k++) {
-        ecc_dbl_proj(P0, Z0, P0, Z0);
-      }
+    if(naf1[i] == 0 && naf2[i] == 0) {
+      dbl++;
+      continue;
+    }
 
-      if(j != 0) {
-        windex = ((s_mask[j] & u1[i]) >> ((j-1)*S_W_BITS)) |
-                 ((s_mask[j] & u2[i]) >> (j*S_W_BITS));
-      } else {
-        windex = ((s_mask[j] & u1[i]) << S_W_BITS) |
-                 (s_mask[j] & u2[i]);
-      }
-      if(windex) {
-        ecc_add_proj(P0, Z0, P0, Z0, &(pqBaseArray[windex-1]), Z1);
-      }
+    if(!NN_Zero(Z0, NUMWORDS)) {
+      naf_dbl(P0, Z0, dbl);
     }
+    dbl = 1;
 
+    if(naf1[i]) {
+      naf_add(P0, Z0, gNafArray, naf1[i]);
+    }
+    if(naf2[i]) {
+      naf_add(P0, Z0, qTable, naf2[i]);
+    }
+  }
+  /* the last nonzero digit still owes dbl-1 doublings */
+  if(!NN_Zero(Z0, NUMWORDS) && dbl > 1) {
+    naf_dbl(P0, Z0, dbl - 1);
   }
-
 
   /* convert back to affine coordinate */
-  if(NN_One(Z0, NUMWORDS) == FALSE) {
+  if(NN_Zero(Z0, NUMWORDS)) {
+    NN_AssignZero(P0->x, NUMWORDS);
+    NN_AssignZero(P0->y, NUMWORDS);
+  } else if(NN_One(Z0, NUMWORDS) == FALSE) {
     NN_ModInv(Z1, Z0, param->p, NUMWORDS);
     NN_ModMultOpt(Z0, Z1, Z1, param->p, param->omega, NUMWORDS);
     NN_ModMultOpt(P0->x, P0->x, Z0, param->p, param->omega, NUMWORDS);
@@ -185,8 +227,7 @@ void
 ecdsa_init(point_t * pb_key)
 {
 #ifdef SHAMIR_TRICK
-  param = ecc_get_param();
-  shamir_init(pb_key, pqBaseArray);
+  ecdsa_key_init(pb_key, qNafArray);
 #else /* defined(SLIDING_WIN) */
   /* precompute the array of public key for sliding window method */
   ecc_win_precompute(pb_key, qBaseArray);
@@ -195,6 +236,29 @@ ecdsa_init(point_t * pb_key)
   ecc_get_order(order);
 }
 
+/*---------------------------------------------------------------------------*/
+#ifdef SHAMIR_TRICK
+void
+ecdsa_key_init(point_t * pb_key, point_t * key_table)
+{
+  param = ecc_get_param();
+  if(!g_naf_ready) {
+    naf_precompute(ecc_get_base_p(), gNafArray, S_G_POINTS);
+    g_naf_ready = TRUE;
+  }
+  naf_precompute(pb_key, key_table, S_Q_POINTS);
+  /* we need to know param->r */
+  ecc_get_order(order);
+}
+#endif /* SHAMIR_TRICK */
+
+/*---------------------------------------------------------------------------*/
+void
+ecdsa_sign_init()
+{
+  ecc_get_order(order);
+}
+
 /*---------------------------------------------------------------------------*/
 void
 ecdsa_sign(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, NN_DIGIT *d)
@@ -253,8 +317,8 @@ ecdsa_sign(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, NN
 
 }
 /*---------------------------------------------------------------------------*/
-uint8_t
-ecdsa_verify(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, point_t *Q)
+static uint8_t
+verify_table(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, point_t *qTable)
 {
   NN_DIGIT sha256tmp[SHA256_DIGEST_LENGTH/NN_DIGIT_LEN];
   NN_DIGIT w[NUMWORDS];
@@ -306,10 +370,10 @@ ecdsa_verify(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s,
 
   /* u1P+u2Q */
 #ifdef SHAMIR_TRICK
-  shamir(&final, u1, u2);
+  shamir(&final, u1, u2, qTable);
 #else
   ecc_win_mul_base(&u1P, u1);
-  ecc_win_mul(&u2Q, u2, qBaseArray);
+  ecc_win_mul(&u2Q, u2, qTable);
   ecc_add(&final, &u1P, &u2Q);
 #endif
 
@@ -331,6 +395,24 @@ ecdsa_verify(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s,
     return 2;
   }
 }
+/*---------------------------------------------------------------------------*/
+uint8_t
+ecdsa_verify(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, point_t *Q)
+{
+#ifdef SHAMIR_TRICK
+  return verify_table(sha256sum, r, s, qNafArray);
+#else
+  return verify_table(sha256sum, r, s, qBaseArray);
+#endif
+}
+/*---------------------------------------------------------------------------*/
+#ifdef SHAMIR_TRICK
+uint8_t
+ecdsa_verify_key(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, point_t *key_table)
+{
+  return verify_table(sha256sum, r, s, key_table);
+}
+#endif /* SHAMIR_TRICK */
 
 /**
  * @}
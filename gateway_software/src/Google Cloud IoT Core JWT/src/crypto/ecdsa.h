@@ -1,4 +1,4 @@
-// AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.
+// Forked from ecc-light-certificate, edited in this repo. See CONTRIBUTING.md.
 #define SHA256_DIGEST_LENGTH 32
 /**
  * \defgroup ecdsa Elliptic Curve Digital Signature Algorithm
@@ -30,6 +30,35 @@
  */
 void ecdsa_init(point_t * pb_key);
 
+/**
+ * Points of a public key table, the odd multiples 1Q, 3Q, ..., 15Q of the
+ * width-5 wNAF used by the Shamir trick.
+ */
+#define ECDSA_KEY_POINTS 8
+
+/**
+ * \brief             Precompute the table of a public key into caller
+ *                    storage, so several keys can be verified against
+ *                    independently. Needs SHAMIR_TRICK.
+ *
+ * \param pb_key      A pointer to the public key.
+ * \param key_table   ECDSA_KEY_POINTS points, passed to ecdsa_verify_key.
+ */
+void ecdsa_key_init(point_t * pb_key, point_t * key_table);
+
+/**
+ * \brief             Verify a message against a table from ecdsa_key_init.
+ * \return            1 if the signature is verified.
+ * \sa  ecdsa_key_init
+ */
+uint8_t ecdsa_verify_key(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, point_t * key_table);
+
+/**
+ * \brief             Initialize the ECDSA for signing only. Loads the curve
+ *                    order without precomputing a public key table.
+ */
+void ecdsa_sign_init();
+
 /**
  * \brief             Sign a message using the private key.
  *
@@ -47,7 +76,9 @@ void ecdsa_sign(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *
  * \param s           Signature of the message.
  * \param pb_key      The public key that is used to verify the signature.
  *                    EDSA should be initialized by using this public key prior
- *                    to verify.
+ *                    to verify. The check uses the table of the last
+ *                    ecdsa_init() call, not pb_key; use ecdsa_key_init and
+ *                    ecdsa_verify_key to hold more than one key.
  * \return            1 if the signature is verified.
  * \sa  ecdsa_init
  */
@@ -1,4 +1,4 @@
-// AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.
+// Forked from ecc-light-certificate, edited in this repo. See CONTRIBUTING.md.
 /**
  * \defgroup x86 X86 specific implementation (might work on other systems as well)
  * \ingroup nn
@@ -428,6 +428,9 @@ NN_ModInv(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_UINT digits)
 void
 NN_ModMultOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT digits)
 {
+#ifdef SECP256R1_FAST_FIELD
+  secp256r1_mod_mult(a, b, c, digits);
+#else
   NN_DIGIT t1[2*MAX_NN_DIGITS];
   NN_DIGIT t2[2*MAX_NN_DIGITS];
   NN_DIGIT *pt1;
@@ -467,6 +470,7 @@ NN_ModMultOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_DIGIT * d, NN_DIGIT *
   }
 
   NN_Assign(a, t1, digits);
+#endif /* SECP256R1_FAST_FIELD */
 
 }
 /*---------------------------------------------------------------------------*/
@@ -533,6 +537,9 @@ NN_ModDivOpt(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_DIGIT *d, NN_UINT digits)
 void
 NN_ModSqrOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT digits)
 {
+#ifdef SECP256R1_FAST_FIELD
+  secp256r1_mod_sqr(a, b, digits);
+#else
   NN_DIGIT t1[2*MAX_NN_DIGITS];
   NN_DIGIT t2[2*MAX_NN_DIGITS];
   NN_DIGIT *pt1;
@@ -569,6 +576,7 @@ NN_ModSqrOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT
     NN_Sub(t1, t1, d, digits);
   }
   NN_Assign (a, t1, digits);
+#endif /* SECP256R1_FAST_FIELD */
 
 }
 /*--------------------------- OTHER OPERATIONS -------------------------------*/
@@ -1,4 +1,4 @@
-// AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.
+// Forked from ecc-light-certificate, edited in this repo. See CONTRIBUTING.md.
 // Also know as prime256v1 aka NIST P-256
 #include "ecc.h"
 
@@ -418,16 +418,16 @@ void get_curve_param(curve_params_t *para)
   para->E.a_minus3 = TRUE;
   para->E.a_zero = FALSE;
 
-  // b = 7
+  // b
   memset(para->E.b, 0, NUMWORDS * NN_DIGIT_LEN);
-  para->G.x[7] = 0x5AC635D8;
-  para->G.x[6] = 0xAA3A93E7;
-  para->G.x[5] = 0xB3EBBD55;
-  para->G.x[4] = 0x769886BC;
-  para->G.x[3] = 0x651D06B0;
-  para->G.x[2] = 0xCC53B0F6;
-  para->G.x[1] = 0x3BCE3C3E;
-  para->G.x[0] = 0x27D2604B;
+  para->E.b[7] = 0x5AC635D8;
+  para->E.b[6] = 0xAA3A93E7;
+  para->E.b[5] = 0xB3EBBD55;
+  para->E.b[4] = 0x769886BC;
+  para->E.b[3] = 0x651D06B0;
+  para->E.b[2] = 0xCC53B0F6;
+  para->E.b[1] = 0x3BCE3C3E;
+  para->E.b[0] = 0x27D2604B;
 
   // base point
   memset(para->G.x, 0, NUMWORDS * NN_DIGIT_LEN);
@@ -461,7 +461,60 @@ void get_curve_param(curve_params_t *para)
   para->r[1] = 0xF3B9CAC2;
   para->r[0] = 0xFC632551;
 
-#endif /* THIRTYTWO_BIT_PROCESSOR */
+  /* THIRTYTWO_BIT_PROCESSOR */
+#elif defined(SIXTYFOUR_BIT_PROCESSOR)
+  // init parameters
+
+  memset(para->p, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->p[3] = 0xFFFFFFFF00000001ull;
+  para->p[2] = 0x0000000000000000ull;
+  para->p[1] = 0x00000000FFFFFFFFull;
+  para->p[0] = 0xFFFFFFFFFFFFFFFFull;
+
+  memset(para->omega, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->omega[3] = 0x00000000FFFFFFFEull;
+  para->omega[2] = 0xFFFFFFFFFFFFFFFFull;
+  para->omega[1] = 0xFFFFFFFF00000000ull;
+  para->omega[0] = 0x0000000000000001ull;
+  // curve that will be used
+  // a = -3
+  memset(para->E.a, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->E.a[3] = 0xFFFFFFFF00000001ull;
+  para->E.a[2] = 0x0000000000000000ull;
+  para->E.a[1] = 0x00000000FFFFFFFFull;
+  para->E.a[0] = 0xFFFFFFFFFFFFFFFCull;
+
+  para->E.a_minus3 = TRUE;
+  para->E.a_zero = FALSE;
+
+  // b
+  memset(para->E.b, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->E.b[3] = 0x5AC635D8AA3A93E7ull;
+  para->E.b[2] = 0xB3EBBD55769886BCull;
+  para->E.b[1] = 0x651D06B0CC53B0F6ull;
+  para->E.b[0] = 0x3BCE3C3E27D2604Bull;
+
+  // base point
+  memset(para->G.x, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->G.x[3] = 0x6B17D1F2E12C4247ull;
+  para->G.x[2] = 0xF8BCE6E563A440F2ull;
+  para->G.x[1] = 0x77037D812DEB33A0ull;
+  para->G.x[0] = 0xF4A13945D898C296ull;
+
+  memset(para->G.y, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->G.y[3] = 0x4FE342E2FE1A7F9Bull;
+  para->G.y[2] = 0x8EE7EB4A7C0F9E16ull;
+  para->G.y[1] = 0x2BCE33576B315ECEull;
+  para->G.y[0] = 0xCBB6406837BF51F5ull;
+
+  // prime divide the number of points
+  memset(para->r, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->r[3] = 0xFFFFFFFF00000000ull;
+  para->r[2] = 0xFFFFFFFFFFFFFFFFull;
+  para->r[1] = 0xBCE6FAADA7179E84ull;
+  para->r[0] = 0xF3B9CAC2FC632551ull;
+
+#endif /* SIXTYFOUR_BIT_PROCESSOR */
 }
 
 NN_UINT omega_mul(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *omega, NN_UINT digits)
@@ -472,9 +525,278 @@ NN_UINT omega_mul(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *omega, NN_UINT digits)
   int omega_digit_length = 14;
 #elif defined(THIRTYTWO_BIT_PROCESSOR)
   int omega_digit_length = 7;
+#elif defined(SIXTYFOUR_BIT_PROCESSOR)
+  int omega_digit_length = 4;
 #endif
 
   NN_Mult(a, b, omega,
           digits > omega_digit_length ? digits : omega_digit_length);
   return digits + omega_digit_length;
 }
+
+#ifdef SECP256R1_FAST_FIELD
+/*---------------------------------------------------------------------------*/
+/*
+ * Dedicated field arithmetic for p = 2^256 - 2^224 + 2^192 + 2^96 - 1 with
+ * 32- or 64-bit digits: an unrolled product-scanning multiply/square into
+ * 2*KEYDIGITS digits and the NIST fast reduction (FIPS 186-4, D.2.3) on top
+ * of it.
+ */
+
+/* Adds b[i]*c[j] into the three digit column accumulator (over:acc) */
+#define MULADD(i, j) \
+  do { NN_DOUBLE_DIGIT t = (NN_DOUBLE_DIGIT)b[i] * c[j]; acc += t; over += (acc < t); } while(0)
+/* Adds b[i]^2, or 2*b[i]*b[j], for squaring */
+#define SQRADD(i) \
+  do { NN_DOUBLE_DIGIT t = (NN_DOUBLE_DIGIT)b[i] * b[i]; acc += t; over += (acc < t); } while(0)
+#define SQRADD2(i, j) \
+  do { NN_DOUBLE_DIGIT t = (NN_DOUBLE_DIGIT)b[i] * b[j]; acc += t; over += (acc < t); \
+       acc += t; over += (acc < t); } while(0)
+/* Stores the low digit of the column and shifts the accumulator down */
+#define COLUMN(k) \
+  do { r[k] = (NN_DIGIT)acc; acc = (acc >> NN_DIGIT_BITS) | ((NN_DOUBLE_DIGIT)over << NN_DIGIT_BITS); \
+       over = 0; } while(0)
+
+#if NN_DIGIT_BITS == 32
+
+static const uint32_t p256[8] = {
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+  0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+/*
+ * Adds k*2^256 mod p = k*(2^224 - 2^192 - 2^96 + 1) to r, returns the new
+ * carry out of the 256 bits (signed).
+ */
+static int64_t
+p256_fold(uint32_t *r, int64_t k)
+{
+  int64_t acc;
+
+  acc = (int64_t)r[0] + k;         r[0] = (uint32_t)acc; acc >>= 32;
+  acc += r[1];                     r[1] = (uint32_t)acc; acc >>= 32;
+  acc += r[2];                     r[2] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)r[3] - k;        r[3] = (uint32_t)acc; acc >>= 32;
+  acc += r[4];                     r[4] = (uint32_t)acc; acc >>= 32;
+  acc += r[5];                     r[5] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)r[6] - k;        r[6] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)r[7] + k;        r[7] = (uint32_t)acc; acc >>= 32;
+
+  return acc;
+}
+
+/*
+ * a = c mod p for the 512 bit c. The s1..s9 terms of the NIST reduction are
+ * summed per word with a signed carry, the carry left above 2^256 is folded
+ * back twice and a final subtraction of p is selected with a mask.
+ */
+static void
+p256_reduce(NN_DIGIT *a, const uint32_t *c, NN_UINT digits)
+{
+  uint32_t r[8];
+  uint32_t t[8];
+  int64_t acc;
+  uint64_t diff;
+  uint32_t borrow, mask;
+  int8_t i;
+
+  acc = (int64_t)c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14];
+  r[0] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15];
+  r[1] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)c[2] + c[10] + c[11] - c[13] - c[14] - c[15];
+  r[2] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)c[3] + 2*(int64_t)c[11] + 2*(int64_t)c[12] + c[13] - c[15] - c[8] - c[9];
+  r[3] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)c[4] + 2*(int64_t)c[12] + 2*(int64_t)c[13] + c[14] - c[9] - c[10];
+  r[4] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)c[5] + 2*(int64_t)c[13] + 2*(int64_t)c[14] + c[15] - c[10] - c[11];
+  r[5] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)c[6] + 3*(int64_t)c[14] + 2*(int64_t)c[15] + c[13] - c[8] - c[9];
+  r[6] = (uint32_t)acc; acc >>= 32;
+  acc += (int64_t)c[7] + 3*(int64_t)c[15] + c[8] - c[10] - c[11] - c[12] - c[13];
+  r[7] = (uint32_t)acc; acc >>= 32;
+
+  /* the carry is a few units either way: the first fold leaves -1, 0 or 1,
+   * the second one cannot carry again */
+  acc = p256_fold(r, acc);
+  p256_fold(r, acc);
+
+  /* r < 2^256 < 2p, subtract p once unless it borrows */
+  borrow = 0;
+  for(i = 0; i < 8; i++) {
+    diff = (uint64_t)r[i] - p256[i] - borrow;
+    t[i] = (uint32_t)diff;
+    borrow = (uint32_t)(diff >> 32) & 1;
+  }
+  mask = borrow - 1;
+  for(i = 0; i < 8; i++) {
+    a[i] = (r[i] & ~mask) | (t[i] & mask);
+  }
+  for(i = 8; i < digits; i++) {
+    a[i] = 0;
+  }
+}
+
+#else /* NN_DIGIT_BITS == 64 */
+
+typedef __int128 p256_acc_t;
+
+static const uint64_t p256[4] = {
+  0xFFFFFFFFFFFFFFFFull, 0x00000000FFFFFFFFull,
+  0x0000000000000000ull, 0xFFFFFFFF00000001ull
+};
+
+#define LO(x) ((x) & 0xFFFFFFFFull)
+#define HI(x) ((x) >> 32)
+
+/* Same as the 32-bit fold, 2^256 mod p in 64-bit lanes is
+ * (2^32 - 1) << 192, -2^32 << 64 and 1 */
+static p256_acc_t
+p256_fold(uint64_t *r, p256_acc_t k)
+{
+  p256_acc_t acc;
+
+  acc = (p256_acc_t)r[0] + k;                r[0] = (uint64_t)acc; acc >>= 64;
+  acc += (p256_acc_t)r[1] - (k << 32);       r[1] = (uint64_t)acc; acc >>= 64;
+  acc += r[2];                               r[2] = (uint64_t)acc; acc >>= 64;
+  acc += (p256_acc_t)r[3] + (k << 32) - k;   r[3] = (uint64_t)acc; acc >>= 64;
+
+  return acc;
+}
+
+/*
+ * a = c mod p for the 512 bit c in 64-bit digits. The s1..s9 terms are the
+ * ones of the 32-bit version with every pair of 32-bit words packed into a
+ * 64-bit lane, so the carry chain is 4 lanes instead of 8 words.
+ */
+static void
+p256_reduce(NN_DIGIT *a, const uint64_t *c, NN_UINT digits)
+{
+  uint64_t r[4];
+  uint64_t t[4];
+  p256_acc_t acc;
+  p256_acc_t diff;
+  uint64_t borrow, mask;
+  int8_t i;
+
+  /* s1 + 2s2 + 2s3 + s4 + s5 - s6 - s7 - s8 - s9, lane by lane */
+  acc = (p256_acc_t)c[0] + c[4] + ((LO(c[5]) << 32) | HI(c[4]))
+      - ((LO(c[6]) << 32) | HI(c[5])) - c[6] - ((LO(c[7]) << 32) | HI(c[6])) - c[7];
+  r[0] = (uint64_t)acc; acc >>= 64;
+  acc += (p256_acc_t)c[1] + 2*(p256_acc_t)(HI(c[5]) << 32) + 2*(p256_acc_t)(LO(c[6]) << 32)
+      + LO(c[5]) + ((HI(c[6]) << 32) | HI(c[5]))
+      - HI(c[6]) - c[7] - ((LO(c[4]) << 32) | HI(c[7])) - (HI(c[4]) << 32);
+  r[1] = (uint64_t)acc; acc >>= 64;
+  acc += (p256_acc_t)c[2] + 2*(p256_acc_t)c[6] + 2*(p256_acc_t)((LO(c[7]) << 32) | HI(c[6]))
+      + c[7] - ((LO(c[5]) << 32) | HI(c[4])) - c[5];
+  r[2] = (uint64_t)acc; acc >>= 64;
+  acc += (p256_acc_t)c[3] + 2*(p256_acc_t)c[7] + 2*(p256_acc_t)HI(c[7]) + c[7]
+      + ((LO(c[4]) << 32) | HI(c[6])) - ((LO(c[5]) << 32) | LO(c[4]))
+      - ((HI(c[5]) << 32) | HI(c[4])) - (LO(c[6]) << 32) - (HI(c[6]) << 32);
+  r[3] = (uint64_t)acc; acc >>= 64;
+
+  acc = p256_fold(r, acc);
+  p256_fold(r, acc);
+
+  /* r < 2^256 < 2p, subtract p once unless it borrows */
+  borrow = 0;
+  for(i = 0; i < 4; i++) {
+    diff = (p256_acc_t)r[i] - p256[i] - borrow;
+    t[i] = (uint64_t)diff;
+    borrow = (uint64_t)(diff >> 64) & 1;
+  }
+  mask = borrow - 1;
+  for(i = 0; i < 4; i++) {
+    a[i] = (r[i] & ~mask) | (t[i] & mask);
+  }
+  for(i = 4; i < digits; i++) {
+    a[i] = 0;
+  }
+}
+
+#undef LO
+#undef HI
+#endif /* NN_DIGIT_BITS */
+
+/*---------------------------------------------------------------------------*/
+void
+secp256r1_mod_mult(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_UINT digits)
+{
+  NN_DIGIT r[2*KEYDIGITS];
+  NN_DOUBLE_DIGIT acc = 0;
+  NN_DIGIT over = 0;
+
+#if NN_DIGIT_BITS == 32
+  MULADD(0, 0); COLUMN(0);
+  MULADD(0, 1); MULADD(1, 0); COLUMN(1);
+  MULADD(0, 2); MULADD(1, 1); MULADD(2, 0); COLUMN(2);
+  MULADD(0, 3); MULADD(1, 2); MULADD(2, 1); MULADD(3, 0); COLUMN(3);
+  MULADD(0, 4); MULADD(1, 3); MULADD(2, 2); MULADD(3, 1); MULADD(4, 0); COLUMN(4);
+  MULADD(0, 5); MULADD(1, 4); MULADD(2, 3); MULADD(3, 2); MULADD(4, 1); MULADD(5, 0); COLUMN(5);
+  MULADD(0, 6); MULADD(1, 5); MULADD(2, 4); MULADD(3, 3); MULADD(4, 2); MULADD(5, 1); MULADD(6, 0); COLUMN(6);
+  MULADD(0, 7); MULADD(1, 6); MULADD(2, 5); MULADD(3, 4); MULADD(4, 3); MULADD(5, 2); MULADD(6, 1); MULADD(7, 0); COLUMN(7);
+  MULADD(1, 7); MULADD(2, 6); MULADD(3, 5); MULADD(4, 4); MULADD(5, 3); MULADD(6, 2); MULADD(7, 1); COLUMN(8);
+  MULADD(2, 7); MULADD(3, 6); MULADD(4, 5); MULADD(5, 4); MULADD(6, 3); MULADD(7, 2); COLUMN(9);
+  MULADD(3, 7); MULADD(4, 6); MULADD(5, 5); MULADD(6, 4); MULADD(7, 3); COLUMN(10);
+  MULADD(4, 7); MULADD(5, 6); MULADD(6, 5); MULADD(7, 4); COLUMN(11);
+  MULADD(5, 7); MULADD(6, 6); MULADD(7, 5); COLUMN(12);
+  MULADD(6, 7); MULADD(7, 6); COLUMN(13);
+  MULADD(7, 7); COLUMN(14);
+#else
+  MULADD(0, 0); COLUMN(0);
+  MULADD(0, 1); MULADD(1, 0); COLUMN(1);
+  MULADD(0, 2); MULADD(1, 1); MULADD(2, 0); COLUMN(2);
+  MULADD(0, 3); MULADD(1, 2); MULADD(2, 1); MULADD(3, 0); COLUMN(3);
+  MULADD(1, 3); MULADD(2, 2); MULADD(3, 1); COLUMN(4);
+  MULADD(2, 3); MULADD(3, 2); COLUMN(5);
+  MULADD(3, 3); COLUMN(6);
+#endif
+  r[2*KEYDIGITS-1] = (NN_DIGIT)acc;
+
+  p256_reduce(a, r, digits);
+}
+
+/*---------------------------------------------------------------------------*/
+void
+secp256r1_mod_sqr(NN_DIGIT *a, NN_DIGIT *b, NN_UINT digits)
+{
+  NN_DIGIT r[2*KEYDIGITS];
+  NN_DOUBLE_DIGIT acc = 0;
+  NN_DIGIT over = 0;
+
+#if NN_DIGIT_BITS == 32
+  SQRADD(0); COLUMN(0);
+  SQRADD2(0, 1); COLUMN(1);
+  SQRADD2(0, 2); SQRADD(1); COLUMN(2);
+  SQRADD2(0, 3); SQRADD2(1, 2); COLUMN(3);
+  SQRADD2(0, 4); SQRADD2(1, 3); SQRADD(2); COLUMN(4);
+  SQRADD2(0, 5); SQRADD2(1, 4); SQRADD2(2, 3); COLUMN(5);
+  SQRADD2(0, 6); SQRADD2(1, 5); SQRADD2(2, 4); SQRADD(3); COLUMN(6);
+  SQRADD2(0, 7); SQRADD2(1, 6); SQRADD2(2, 5); SQRADD2(3, 4); COLUMN(7);
+  SQRADD2(1, 7); SQRADD2(2, 6); SQRADD2(3, 5); SQRADD(4); COLUMN(8);
+  SQRADD2(2, 7); SQRADD2(3, 6); SQRADD2(4, 5); COLUMN(9);
+  SQRADD2(3, 7); SQRADD2(4, 6); SQRADD(5); COLUMN(10);
+  SQRADD2(4, 7); SQRADD2(5, 6); COLUMN(11);
+  SQRADD2(5, 7); SQRADD(6); COLUMN(12);
+  SQRADD2(6, 7); COLUMN(13);
+  SQRADD(7); COLUMN(14);
+#else
+  SQRADD(0); COLUMN(0);
+  SQRADD2(0, 1); COLUMN(1);
+  SQRADD2(0, 2); SQRADD(1); COLUMN(2);
+  SQRADD2(0, 3); SQRADD2(1, 2); COLUMN(3);
+  SQRADD2(1, 3); SQRADD(2); COLUMN(4);
+  SQRADD2(2, 3); COLUMN(5);
+  SQRADD(3); COLUMN(6);
+#endif
+  r[2*KEYDIGITS-1] = (NN_DIGIT)acc;
+
+  p256_reduce(a, r, digits);
+}
+
+#undef MULADD
+#undef SQRADD
+#undef SQRADD2
+#undef COLUMN
+#endif /* SECP256R1_FAST_FIELD */
@@ -0,0 +1,2079 @@
+// AUTOGENERATED by gen_comb_table.py --teeth 8 --tables 4, DO NOT EDIT.
+/**
+ * \file
+ * Fixed-base comb table for the secp256r1 generator (affine points), kept
+ * in flash. See gen_comb_table.py for the layout.
+ */
+
+#ifndef __SECP256R1_COMB_H__
+#define __SECP256R1_COMB_H__
+
+#include "ecc.h"
+
+#define COMB_TEETH   8
+#define COMB_TABLES  4
+#define COMB_SPACING 32
+#define COMB_BLOCK   8
+#define COMB_POINTS  ((1 << COMB_TEETH) - 1)
+
+/* 64 bit chunks written as NN_DIGITs, least significant digit first */
+#if NN_DIGIT_BITS == 32
+#define COMB_D(hi, lo) lo, hi
+#elif NN_DIGIT_BITS == 64
+#define COMB_D(hi, lo) (((NN_DIGIT)(hi) << 32) | (lo))
+#endif
+
+static const point_t comb_table[COMB_TABLES][COMB_POINTS] = {
+  { /* table 0 */
+    {{COMB_D(0xF4A13945, 0xD898C296), COMB_D(0x77037D81, 0x2DEB33A0), COMB_D(0xF8BCE6E5, 0x63A440F2), COMB_D(0x6B17D1F2, 0xE12C4247), 0},
+     {COMB_D(0xCBB64068, 0x37BF51F5), COMB_D(0x2BCE3357, 0x6B315ECE), COMB_D(0x8EE7EB4A, 0x7C0F9E16), COMB_D(0x4FE342E2, 0xFE1A7F9B), 0}},
+    {{COMB_D(0x3A5A9E22, 0x185A5943), COMB_D(0x1AB91936, 0x5C65DFB6), COMB_D(0x21656B32, 0x262C71DA), COMB_D(0x7FE36B40, 0xAF22AF89), 0},
+     {COMB_D(0xD50D152C, 0x699CA101), COMB_D(0x74B3D586, 0x7B8AF212), COMB_D(0x9F09F404, 0x07DCA6F1), COMB_D(0xE697D458, 0x25B63624), 0}},
+    {{COMB_D(0x16FC51FF, 0x8101E6E4), COMB_D(0x830895E4, 0xFCCC3AC2), COMB_D(0x608548C2, 0x4AA7358F), COMB_D(0xE3579822, 0x0CEDC02A), 0},
+     {COMB_D(0xAAD2B998, 0x52C392C3), COMB_D(0xF0570BED, 0xC523E6EF), COMB_D(0xF3E4B396, 0x768A3299), COMB_D(0x700F948E, 0x1F433A2D), 0}},
+    {{COMB_D(0x90E75CB4, 0x8E14DB63), COMB_D(0x29493BAA, 0xAD651F7E), COMB_D(0x8492592E, 0x326E25DE), COMB_D(0x0FA822BC, 0x2811AAA5), 0},
+     {COMB_D(0xE4112454, 0x5F462EE7), COMB_D(0x34B1A650, 0x50FE82F5), COMB_D(0x6F4AD4BC, 0xB3DF188B), COMB_D(0xBFF44AE8, 0xF5DBA80D), 0}},
+    {{COMB_D(0x93391CE2, 0x097992AF), COMB_D(0xE96C98FD, 0x0D35F1FA), COMB_D(0xB257C0DE, 0x95E02789), COMB_D(0x300A4BBC, 0x89D6726F), 0},
+     {COMB_D(0xAA54A291, 0xC08127A0), COMB_D(0x5BB1EEAD, 0xA9D806A5), COMB_D(0x7F1DDB25, 0xFF1E3C6F), COMB_D(0x72AAC7E0, 0xD09B4644), 0}},
+    {{COMB_D(0xD6E260F8, 0xEE4039A0), COMB_D(0xE0D3EB33, 0x6C224571), COMB_D(0xA9CAD33B, 0x680A7DAA), COMB_D(0x14CB5692, 0x606A4A62), 0},
+     {COMB_D(0xFE93D315, 0x9D83BC01), COMB_D(0x5205EF8D, 0x8039927C), COMB_D(0x878487ED, 0x997A9A3B), COMB_D(0x53098CFA, 0x3E1E4663), 0}},
+    {{COMB_D(0x30368CB6, 0xD945111E), COMB_D(0x585A137E, 0xF5C4AD42), COMB_D(0xC22C48C5, 0xFFEA17C1), COMB_D(0xA5AB9E10, 0x958F1608), 0},
+     {COMB_D(0xC34A47B8, 0x785B4ED9), COMB_D(0x46ED771C, 0x49A10F77), COMB_D(0x629E17EB, 0xAD0648F4), COMB_D(0xD3EBC611, 0x8B1AA09A), 0}},
+    {{COMB_D(0xA84AA939, 0x7512218E), COMB_D(0xE9A521B0, 0x74CA0141), COMB_D(0x57880B3A, 0x18A2E902), COMB_D(0x4A5B5066, 0x12A677A6), 0},
+     {COMB_D(0x0BEADA7A, 0x4C4F3840), COMB_D(0x626DB154, 0x19E26D9D), COMB_D(0xC42604FB, 0xE1627D40), COMB_D(0xEB13461C, 0xEAC089F1), 0}},
+    {{COMB_D(0xC761C1FE, 0xCC049786), COMB_D(0x48F9C187, 0x5E98C12D), COMB_D(0x00D1A0A5, 0xFD208DFB), COMB_D(0x418D68DE, 0xA0642197), 0},
+     {COMB_D(0x481EEF55, 0x51B50759), COMB_D(0x17429C50, 0xC16CAAD0), COMB_D(0x43563962, 0x2EF8D320), COMB_D(0x5D7B26F6, 0xA5BA6DD4), 0}},
+    {{COMB_D(0xF9FAED09, 0x27A43281), COMB_D(0x5E52C414, 0x4103ECBC), COMB_D(0xC342967A, 0xA815C857), COMB_D(0x0781B829, 0x1C6A220A), 0},
+     {COMB_D(0x5A8343CE, 0xEAC55F80), COMB_D(0x88F80EEE, 0xE54A05E3), COMB_D(0x97B2A14F, 0x12916434), COMB_D(0x690CDE8D, 0xF0151593), 0}},
+    {{COMB_D(0xC52C00CA, 0xE38E3820), COMB_D(0x82D789A6, 0xDD561BEC), COMB_D(0x54A0FE52, 0x74647EBE), COMB_D(0x57F62EEC, 0xA7B5D4FB), 0},
+     {COMB_D(0xAA60759D, 0x48F81460), COMB_D(0x0D300594, 0xEC356DCE), COMB_D(0x60E9C067, 0xEFEA8F48), COMB_D(0x5E5FF8BF, 0x89BFE2AD), 0}},
+    {{COMB_D(0x5920D7B0, 0xFA3289D5), COMB_D(0x54D5DAD9, 0x28994439), COMB_D(0x27035D26, 0x27CAA747), COMB_D(0x91C821D4, 0x88E9843C), 0},
+     {COMB_D(0xE130DEAD, 0x9AA8A566), COMB_D(0x7B7DF6EA, 0x0408EBAD), COMB_D(0x919ADC37, 0x34938DAC), COMB_D(0xDB7AECC7, 0x8F879F44), 0}},
+    {{COMB_D(0xBC499EE7, 0xC6FAE6D7), COMB_D(0xEDDF9C6C, 0x7E1C792E), COMB_D(0xC9C6F541, 0x5BF70C35), COMB_D(0x06F0AFDB, 0x90422D81), 0},
+     {COMB_D(0x214F0AD0, 0x4DBC747A), COMB_D(0x41A7CF1A, 0xAF7AE617), COMB_D(0x7BAB8955, 0xDDE64646), COMB_D(0x77F9E8F7, 0x3F9804C4), 0}},
+    {{COMB_D(0x5D01A765, 0xC96900D8), COMB_D(0xF0698FF7, 0x5E4EC965), COMB_D(0x92052D44, 0xBCDF6567), COMB_D(0xBC07BB82, 0xD6536C02), 0},
+     {COMB_D(0x5FE58CCF, 0x83762C71), COMB_D(0x635F210E, 0xC2E7BA73), COMB_D(0xA17BF29F, 0xC7B19A1E), COMB_D(0xEB165F9C, 0x1D90902A), 0}},
+    {{COMB_D(0xAF972B45, 0xF2159928), COMB_D(0xD86848C8, 0x4760C41E), COMB_D(0x269843F1, 0x6B47957B), COMB_D(0xE018AAA2, 0x2086A46C), 0},
+     {COMB_D(0x21A03322, 0x99698420), COMB_D(0xD36D88B3, 0x4FED7BB9), COMB_D(0xF2FE8863, 0xBA0DBC83), COMB_D(0x383F4DB0, 0x7F10EE50), 0}},
+    {{COMB_D(0x57C84FC9, 0xD789BD85), COMB_D(0xFC35FF7D, 0xC297EAC3), COMB_D(0xFB982FD5, 0x88C6766E), COMB_D(0x447D739B, 0xEEDB5E67), 0},
+     {COMB_D(0x0C7E33C9, 0x72E25B32), COMB_D(0x3D349B95, 0xA7FAE500), COMB_D(0xE12E9D95, 0x3A4AAFF7), COMB_D(0x2D4825AB, 0x834131EE), 0}},
+    {{COMB_D(0x13949C93, 0x2A1D367F), COMB_D(0xEF7FBD2B, 0x1A0A11B7), COMB_D(0xDDC6068B, 0xB91DFC60), COMB_D(0xEF951932, 0x8A9C72FF), 0},
+     {COMB_D(0x196035A7, 0x7376D8A8), COMB_D(0x23183B08, 0x95CA1740), COMB_D(0xC1EE9807, 0x022C219C), COMB_D(0x611E9FC3, 0x7DBB2C9B), 0}},
+    {{COMB_D(0x9DDA03E1, 0x0AF44892), COMB_D(0xDD78A219, 0xFFA77F1E), COMB_D(0x67AA472A, 0x8AEE6CBA), COMB_D(0xE42C3142, 0xA822A856), 0},
+     {COMB_D(0xBEE346FE, 0xF20DB957), COMB_D(0xBD464186, 0xD00F7365), COMB_D(0x21774E51, 0x032C4F8E), COMB_D(0x8AD034D0, 0xC011817A), 0}},
+    {{COMB_D(0x1F969276, 0xD94B1A05), COMB_D(0xCA9B1154, 0xADF9E430), COMB_D(0x8930DE36, 0x4B3CF7FB), COMB_D(0x4EE298BB, 0xB9A7112B), 0},
+     {COMB_D(0xC7551F59, 0xCABA1C4A), COMB_D(0x79A86B84, 0xFB972962), COMB_D(0xE47C8AC6, 0xB38A628C), COMB_D(0x2CBBF338, 0x463A6A4C), 0}},
+    {{COMB_D(0xCAE2B192, 0x0B57F4BC), COMB_D(0x2936DF5E, 0xC6C9BC36), COMB_D(0x7DEA6482, 0xE11238BF), COMB_D(0x55066379, 0x7B51F5D8), 0},
+     {COMB_D(0x44FFE216, 0x348A964C), COMB_D(0x9FB3D576, 0xDBDEFBE1), COMB_D(0x0AFA4001, 0x8D9D50E5), COMB_D(0x15716484, 0x8AECB851), 0}},
+    {{COMB_D(0xE48ECAFF, 0xFC5CDE01), COMB_D(0x7CCD84E7, 0x0D715F26), COMB_D(0xA2E8F483, 0xF43E4391), COMB_D(0xEB5D7745, 0xB21141EA), 0},
+     {COMB_D(0xCAC917E2, 0x731A3479), COMB_D(0x85F22CFE, 0x2844B645), COMB_D(0x0990E6A1, 0x58006CEE), COMB_D(0xEAFD72EB, 0xDBECC17B), 0}},
+    {{COMB_D(0x9F95A5AB, 0xA7DDE09F), COMB_D(0xC1E70873, 0x221AA522), COMB_D(0x3774353A, 0x724A8B0A), COMB_D(0xB942B33F, 0xF0FE9DFE), 0},
+     {COMB_D(0xE9601AC3, 0x34FC7653), COMB_D(0xAE3E0880, 0xC2BEAA26), COMB_D(0xD6C52E03, 0x4FAB6AE5), COMB_D(0x0B909273, 0xA61E51EF), 0}},
+    {{COMB_D(0x91BA25B5, 0x1A780592), COMB_D(0xEE59A574, 0x1500D337), COMB_D(0xE36F1C44, 0x9288E474), COMB_D(0xD3E89ACC, 0xD85F6D65), 0},
+     {COMB_D(0x0F5590EC, 0xD8871D87), COMB_D(0x565C81CA, 0x92E2F47A), COMB_D(0x55942307, 0x841FB007), COMB_D(0xA4F12B40, 0xA5DC1163), 0}},
+    {{COMB_D(0x298AD9C1, 0x471BD072), COMB_D(0xB286A3B3, 0xF6D4B375), COMB_D(0xB6CBD28C, 0xDA5F8ABD), COMB_D(0x529DC0B0, 0x700BA968), 0},
+     {COMB_D(0x44672963, 0xAA8C414A), COMB_D(0x99685E9C, 0xBC3089DA), COMB_D(0x9AB4C983, 0x1E39FCE6), COMB_D(0x9B5426C7, 0xC49BC6A7), 0}},
+    {{COMB_D(0x1FE36FFC, 0xAB0C3E88), COMB_D(0xC2B3B386, 0xBA8303D2), COMB_D(0x72AABF6E, 0xADC757CA), COMB_D(0x1240B6FD, 0x5EEC7013), 0},
+     {COMB_D(0x106308A8, 0x1A9310A3), COMB_D(0xB9F4AB88, 0x2C136832), COMB_D(0x48A48000, 0xF43CC68F), COMB_D(0xE54F16A7, 0x214B70D9), 0}},
+    {{COMB_D(0xD9D5E5C8, 0x0FEE06C8), COMB_D(0x8BF29817, 0x41D13F39), COMB_D(0x7F25BF81, 0xFDAA2B5F), COMB_D(0x0A70F85C, 0x5EC68BBF), 0},
+     {COMB_D(0xF2CFC922, 0xD5E4D954), COMB_D(0x5D404051, 0x83421B3D), COMB_D(0x383E025C, 0x20A2E32F), COMB_D(0x63228D59, 0x848EF239), 0}},
+    {{COMB_D(0xBAF7D307, 0x52FFCEF3), COMB_D(0x46B57E18, 0x9EEC8A3E), COMB_D(0x77A91D71, 0xF7EA3BDB), COMB_D(0x771F4575, 0x2BC76AF7), 0},
+     {COMB_D(0xD918B424, 0xFCE5C8B5), COMB_D(0xEF6A2851, 0x53DF5F8F), COMB_D(0xC375B434, 0x2615A6D0), COMB_D(0x32E41149, 0x42161A6E), 0}},
+    {{COMB_D(0xFA268BC1, 0x5543F33F), COMB_D(0x057848F6, 0x79A1E862), COMB_D(0x2ACC9E80, 0xE778C5D5), COMB_D(0x81CF6721, 0x1F24FB5C), 0},
+     {COMB_D(0x87656E35, 0x0F94BCE2), COMB_D(0x9650C9C8, 0x9851BB7E), COMB_D(0x0D41954D, 0x92E85C53), COMB_D(0xEF55045A, 0x45B0A71A), 0}},
+    {{COMB_D(0xEA5D651D, 0x9EF0F09E), COMB_D(0x2FE6A994, 0xCAD74DC7), COMB_D(0xA6C44B75, 0x8003A37E), COMB_D(0xDB525471, 0x8579357A), 0},
+     {COMB_D(0x8732A3E3, 0x2ED0F0B1), COMB_D(0xBE207A55, 0xB0BB5647), COMB_D(0x4335FDE2, 0x32D4ECEB), COMB_D(0x91B67E63, 0x72C4AD3E), 0}},
+    {{COMB_D(0xCDEDCB0D, 0xAB018C7E), COMB_D(0xF29E7E82, 0xAD8CEE06), COMB_D(0x7CE355B7, 0xC417B614), COMB_D(0xCD20145A, 0xF8BFF7EB), 0},
+     {COMB_D(0xAEC6A202, 0xE5457EB3), COMB_D(0xEF934B95, 0x75459F98), COMB_D(0x10475DF1, 0xC00F55DE), COMB_D(0xD4619F15, 0xCB510C09), 0}},
+    {{COMB_D(0x7FF55FC4, 0x152B9A0E), COMB_D(0x3F68C71C, 0x8473875D), COMB_D(0xE52B3F50, 0x57862556), COMB_D(0xE3DDB10A, 0x97B14C6E), 0},
+     {COMB_D(0x36758574, 0x68DBA9F2), COMB_D(0xD1D4F5DD, 0xD269DE87), COMB_D(0x57392917, 0x41C3DEF2), COMB_D(0xD3B0F1BF, 0x72836177), 0}},
+    {{COMB_D(0xAEE9C75D, 0xF7F82F2A), COMB_D(0x9E4C3587, 0x4AFDF43A), COMB_D(0xF5622DF4, 0x37371326), COMB_D(0x8A535F56, 0x6EC73617), 0},
+     {COMB_D(0xC5F9A0AC, 0x223094B7), COMB_D(0xCDE53386, 0x4C8C7669), COMB_D(0x37E02819, 0x085A92BF), COMB_D(0x0455C084, 0x68B08BD7), 0}},
+    {{COMB_D(0x9BF49908, 0x374E4457), COMB_D(0x40BF984B, 0x5EECB703), COMB_D(0x9B6F997E, 0x68F1F6F1), COMB_D(0x47B54B04, 0x9D565A0C), 0},
+     {COMB_D(0x241301C3, 0x69900111), COMB_D(0x4E2A6EA3, 0x776F48BB), COMB_D(0x77368E75, 0x0FEB1CC1), COMB_D(0xE7AFEA29, 0x15A4A7DF), 0}},
+    {{COMB_D(0x0C0A6E2C, 0x9477B5D9), COMB_D(0xF9A4BF62, 0x876DC444), COMB_D(0x5050A949, 0xB6CDC279), COMB_D(0x06BADA7A, 0xB77F8276), 0},
+     {COMB_D(0xC8B4AED1, 0xEA48DAC9), COMB_D(0xDEBD8A4B, 0x7EA1070F), COMB_D(0x427D4910, 0x1366EB70), COMB_D(0x5B476DFD, 0x0E6CB18A), 0}},
+    {{COMB_D(0x03220FB8, 0xD961D446), COMB_D(0x176324E4, 0x0626C5D7), COMB_D(0xD43B2EBC, 0x722425CC), COMB_D(0x29D6274E, 0x86DBC8F8), 0},
+     {COMB_D(0x58185A44, 0xC08D73DB), COMB_D(0x9C8C1CBF, 0xE1239EA5), COMB_D(0x2B1CFE87, 0xBAC64731), COMB_D(0x6C16B472, 0xA5816948), 0}},
+    {{COMB_D(0xE2753CB1, 0x23A81FFB), COMB_D(0x22278FA5, 0xB82A9F20), COMB_D(0x4B032745, 0xF09C4BE2), COMB_D(0x5F68C836, 0x059FFD23), 0},
+     {COMB_D(0xBF3AE369, 0x1DBF8F8D), COMB_D(0xB2B1552C, 0xF9FB8D66), COMB_D(0x0C84BFB3, 0x34925367), COMB_D(0x0639E57E, 0x9E109AF7), 0}},
+    {{COMB_D(0xD8218845, 0xC60C4684), COMB_D(0x66A66447, 0x0859A19E), COMB_D(0x9E18931E, 0x3ED6DFCA), COMB_D(0x3B5B03E6, 0x6FEA0609), 0},
+     {COMB_D(0xD8BC19B5, 0xA9D7EDBB), COMB_D(0x95FFD112, 0x64477877), COMB_D(0x2CD1CA07, 0xF35C8263), COMB_D(0x76F1E0C8, 0x38E14DDC), 0}},
+    {{COMB_D(0xA3D21037, 0x611D1A41), COMB_D(0x62B730A1, 0x4B11663F), COMB_D(0x9EBD9FA2, 0xEDF0F22E), COMB_D(0x2C1A2336, 0xCB79EA5A), 0},
+     {COMB_D(0x294B5675, 0xAC53B363), COMB_D(0x2C2988BE, 0x729CB7FE), COMB_D(0x146454FF, 0xB587C2E9), COMB_D(0x2E1C4770, 0x1DFC32E7), 0}},
+    {{COMB_D(0x8722658C, 0x67429E4D), COMB_D(0xBE9522AA, 0x0561F51E), COMB_D(0x3D622057, 0xD9D59F46), COMB_D(0x76E96B46, 0x89EF69A2), 0},
+     {COMB_D(0x16AA0650, 0xB797FAED), COMB_D(0x75B78E22, 0x15FF8993), COMB_D(0x1575C0CB, 0x27F9FB88), COMB_D(0xCF218959, 0xF705E319), 0}},
+    {{COMB_D(0x7C5C3E44, 0x278C340A), COMB_D(0x4D546068, 0x12D66F3B), COMB_D(0x29A751B1, 0xAE23C5D8), COMB_D(0x3E29864E, 0x8A2EC908), 0},
+     {COMB_D(0x142D2A66, 0x26DBB850), COMB_D(0xAD1744C4, 0x765BD780), COMB_D(0x1F150E68, 0xE322D1ED), COMB_D(0x239B90EA, 0x3DC31E7E), 0}},
+    {{COMB_D(0xCF15DC9C, 0x87617F0E), COMB_D(0x85B40DEE, 0x6858D44B), COMB_D(0xA96C9E4B, 0x121421DE), COMB_D(0x191EB33A, 0x05D45C5A), 0},
+     {COMB_D(0xC9C16E10, 0x199CF43B), COMB_D(0xF245C57B, 0x28EE6E02), COMB_D(0xF3EB80DD, 0x45E9654F), COMB_D(0x8A9365FF, 0x592282A1), 0}},
+    {{COMB_D(0x78C41652, 0x7A53322A), COMB_D(0x305DDE67, 0x09776F8E), COMB_D(0xDBCAB759, 0xF8862ED4), COMB_D(0x820F4DD9, 0x49F72FF7), 0},
+     {COMB_D(0x6CC544A6, 0x2B5DEBD4), COMB_D(0x75BE5D93, 0x7B4E8CC4), COMB_D(0x1B481B1B, 0x215C14D3), COMB_D(0x140406EC, 0x783A05EC), 0}},
+    {{COMB_D(0x44F65F50, 0x7E0E3190), COMB_D(0x1370D12F, 0xEA3F501A), COMB_D(0xB8635F9A, 0x8C6615B0), COMB_D(0xFF29DC0F, 0xB3CD1C0F), 0},
+     {COMB_D(0x07F8A15D, 0x738114F6), COMB_D(0x14DEF0AB, 0xEECC62E3), COMB_D(0x24DD6595, 0x09B8E6B6), COMB_D(0xC43831F3, 0x3439A422), 0}},
+    {{COMB_D(0x42293CDF, 0x93501899), COMB_D(0xE7F0390C, 0x1CC1E2E5), COMB_D(0xE1EF732A, 0xCBF28253), COMB_D(0xE21F15F3, 0x1F2B6B79), 0},
+     {COMB_D(0xCFC0F97C, 0xD622619A), COMB_D(0xC056B494, 0x726B5A08), COMB_D(0x38C94CB1, 0x4D24EE97), COMB_D(0x4A3FC23C, 0xBC052D44), 0}},
+    {{COMB_D(0xA30935F7, 0x60D54267), COMB_D(0x5C5093BA, 0x652F6CD5), COMB_D(0x8720D196, 0x0B854DA9), COMB_D(0xF361D706, 0x2C10D86C), 0},
+     {COMB_D(0xD11A3D27, 0x723B99E4), COMB_D(0x8A18CE4B, 0x2F7D40C8), COMB_D(0x44BDB2FA, 0xC3D3516D), COMB_D(0x2C990DBB, 0x6B183CFB), 0}},
+    {{COMB_D(0xED303F4C, 0x96480CA6), COMB_D(0xE2DBE559, 0xCE200B86), COMB_D(0x87704E32, 0x4CEB95A3), COMB_D(0x5991DAA2, 0x21CD1C8D), 0},
+     {COMB_D(0x20A4BDAD, 0x75C04EE0), COMB_D(0x9FE5ED7D, 0xD3AB3659), COMB_D(0x0EFB4BEA, 0x1DD427E8), COMB_D(0xDE5D5896, 0x8CE1431A), 0}},
+    {{COMB_D(0xAF31D989, 0xA52342B3), COMB_D(0x918E1FB4, 0xC03EB194), COMB_D(0x303E35F0, 0x6B6CB7B9), COMB_D(0x33FEF524, 0xE062A8C2), 0},
+     {COMB_D(0x692A4FBE, 0x512E5BC0), COMB_D(0x067CFB0D, 0xF5162C74), COMB_D(0x519AD6FF, 0x20859BD2), COMB_D(0x0A5B4CAA, 0xD84DBD4E), 0}},
+    {{COMB_D(0x4193640B, 0xFBB7F12D), COMB_D(0xEF8BF285, 0xDFD6C3F3), COMB_D(0x23FE7442, 0x010729AC), COMB_D(0xFF25F55A, 0x2C214CD9), 0},
+     {COMB_D(0xD77BF411, 0xF30F0FC8), COMB_D(0x1A08EBC7, 0x2AB82B74), COMB_D(0x00C15BA7, 0x74A58D77), COMB_D(0x94F114D3, 0x8A405100), 0}},
+    {{COMB_D(0x1FD07AB7, 0xD0A62B2C), COMB_D(0x31C6F056, 0x9F776819), COMB_D(0xE0443B93, 0x8EDC0D13), COMB_D(0x1B9D594E, 0x63AE46A6), 0},
+     {COMB_D(0x5AB358FC, 0xC14453E5), COMB_D(0xFB52863B, 0x9A58AB51), COMB_D(0x473AB211, 0x01683CEF), COMB_D(0xED16BA54, 0xED96C8E1), 0}},
+    {{COMB_D(0x2641769D, 0x29BA369A), COMB_D(0xE498612F, 0xCD922263), COMB_D(0x861B8E4C, 0x1898EAD9), COMB_D(0xC3948BD4, 0x95BAF610), 0},
+     {COMB_D(0xB529A79B, 0x3FF24345), COMB_D(0xA2B8624A, 0xBE0A3DA8), COMB_D(0x2F5B7F80, 0x94743717), COMB_D(0xBE92ADA7, 0x218A7B61), 0}},
+    {{COMB_D(0xEF977470, 0xFD943A71), COMB_D(0x2DBFBC52, 0xEF2D93E1), COMB_D(0xFBE20B47, 0x62B812A7), COMB_D(0xA1547557, 0x3EF44B43), 0},
+     {COMB_D(0xF18068CB, 0x89BC18D0), COMB_D(0xD0702163, 0xB7E40A72), COMB_D(0xB5115AD4, 0x92EFAF4F), COMB_D(0x384D5627, 0x8C4B8A43), 0}},
+    {{COMB_D(0x80D58211, 0xC0B0755E), COMB_D(0xCA274A6D, 0xB4CACF23), COMB_D(0xAE21F1B4, 0xECF21B69), COMB_D(0x8D84F419, 0x03B2B318), 0},
+     {COMB_D(0xC518F894, 0x9F10418F), COMB_D(0xC73B5FDF, 0xD91762A0), COMB_D(0xC98ECBF6, 0xEC26C110), COMB_D(0x15BCD7D0, 0x6953FD62), 0}},
+    {{COMB_D(0xC877DB08, 0x061457FE), COMB_D(0x60EB5C88, 0xC6471595), COMB_D(0x03CE1E41, 0x808EC0ED), COMB_D(0x4A014325, 0xE27F462A), 0},
+     {COMB_D(0x7961A1CD, 0xA4FBA4FC), COMB_D(0x206D4BEB, 0x662743C7), COMB_D(0x47F12714, 0x41CDA791), COMB_D(0xB069F7E0, 0x2F381BB9), 0}},
+    {{COMB_D(0x6E6F4859, 0xCB87DEA8), COMB_D(0x4787EC66, 0x39546374), COMB_D(0x1CBF27B3, 0x6121B977), COMB_D(0xCA7EE915, 0x44E182AB), 0},
+     {COMB_D(0x40BD566D, 0x7F985B5B), COMB_D(0x4225339A, 0x6D5FDB9A), COMB_D(0x4CD02584, 0x2FC8C2A3), COMB_D(0x0D4C0016, 0x70F14A3D), 0}},
+    {{COMB_D(0x9A89A4CC, 0x9B6D8676), COMB_D(0xCBE46247, 0xAD3055B9), COMB_D(0x8A8C8B10, 0x6B4F6A92), COMB_D(0xD96633A7, 0x570E8F0F), 0},
+     {COMB_D(0xD1FDA6E8, 0xE8B04CC1), COMB_D(0x215D4CE6, 0x40BA4A72), COMB_D(0xD7533270, 0xF64C3358), COMB_D(0x4D144DEA, 0x9825B9FD), 0}},
+    {{COMB_D(0xA3BAAF1D, 0x66FDC380), COMB_D(0x1B08F73D, 0x4CD0C836), COMB_D(0x563F9FBA, 0x9D67FF49), COMB_D(0x1577ACA8, 0x5AF864EC), 0},
+     {COMB_D(0xE61A8C7E, 0x0C0B7B43), COMB_D(0xCDBE96B5, 0xA8E5EC0A), COMB_D(0xE3061205, 0x8E1D9252), COMB_D(0x78286CC9, 0x138E5EF8), 0}},
+    {{COMB_D(0x0F8364C4, 0x253BCBF0), COMB_D(0xF26390C7, 0x03BB9180), COMB_D(0x4EBCCDA4, 0xAD1E3BB3), COMB_D(0xB08C91A3, 0x85A5D1EB), 0},
+     {COMB_D(0x60DC9158, 0xB643475C), COMB_D(0x39BD97D6, 0x2BA0101B), COMB_D(0x6FD29D96, 0xC502FBE0), COMB_D(0xB8FE20C1, 0x3158A73C), 0}},
+    {{COMB_D(0xFC0DDF3B, 0xE0106368), COMB_D(0xD3C72BA5, 0x93F52B68), COMB_D(0x7C6BDF85, 0xA8787924), COMB_D(0x9645C64A, 0x532189D3), 0},
+     {COMB_D(0x58D3CC9B, 0x824E2771), COMB_D(0x9B7E75E1, 0x6E82DC91), COMB_D(0xBF4EC9F6, 0xE0ED1CC0), COMB_D(0xFFB683E6, 0x3260F488), 0}},
+    {{COMB_D(0x8821C701, 0xA4F0C81B), COMB_D(0xEAA11D49, 0x881D4342), COMB_D(0x346FAB79, 0x79A87EEF), COMB_D(0xA9C3643E, 0x39848086), 0},
+     {COMB_D(0xE040A053, 0xF6C6E053), COMB_D(0x0D287400, 0xE1F9D4BA), COMB_D(0xA48CF15D, 0xBD4AA53C), COMB_D(0x76CDF40C, 0x11E94CEF), 0}},
+    {{COMB_D(0x3F023041, 0x7EF30E41), COMB_D(0x9184493F, 0x4CE753C8), COMB_D(0x5A228849, 0x2A7516CA), COMB_D(0x97C0AF3A, 0x660402F4), 0},
+     {COMB_D(0xD0DB8CE7, 0x8A23E934), COMB_D(0x4F22360C, 0xE707A0B2), COMB_D(0xB487DBB9, 0x2032D181), COMB_D(0xC6D1B0F9, 0xCB5623FD), 0}},
+    {{COMB_D(0x8746F483, 0x2BC5C755), COMB_D(0x3DC6F57F, 0x775A0FE2), COMB_D(0x87BCCBE9, 0x0F21C2C9), COMB_D(0xDB93A6B1, 0xEAE51818), 0},
+     {COMB_D(0xF5754A37, 0xA87AA88A), COMB_D(0x2791BF54, 0x73972E83), COMB_D(0x65FE92B6, 0xDEAC962D), COMB_D(0x7675343A, 0x5DB3C2A5), 0}},
+    {{COMB_D(0x5C2CE444, 0x1C77336E), COMB_D(0x6FD6234A, 0xD14B1A55), COMB_D(0x1E25C808, 0x10C24E9E), COMB_D(0x7E941CEF, 0xD88C3194), 0},
+     {COMB_D(0xBFA7A9BA, 0xE4B9453F), COMB_D(0x6256B1BF, 0xDB055169), COMB_D(0x835E6CD4, 0xD4956F06), COMB_D(0x7D3BCF9D, 0x2948048D), 0}},
+    {{COMB_D(0x82480753, 0x18064104), COMB_D(0xF3C2F9C4, 0x0891878C), COMB_D(0x1D6CBEF1, 0x29AF296D), COMB_D(0xA57DDAA3, 0x55B9ED41), 0},
+     {COMB_D(0x4F47C7F1, 0x903A1CDF), COMB_D(0x45057FCF, 0x197DB90D), COMB_D(0xC125BB25, 0xCA13FA12), COMB_D(0x5BCFD6F3, 0xD7F746DF), 0}},
+    {{COMB_D(0x6CF20FFB, 0x313728BE), COMB_D(0x96439591, 0xA3C6B94A), COMB_D(0x2736FF83, 0x44315FC5), COMB_D(0xA6D39677, 0xA7849276), 0},
+     {COMB_D(0xF2BAB833, 0xC357F5F4), COMB_D(0x824A920C, 0x2284059B), COMB_D(0x66B8BABD, 0x2D27ECDF), COMB_D(0x674F8474, 0x9B0B8816), 0}},
+    {{COMB_D(0x2DF48C04, 0x677C8A3E), COMB_D(0x74E02F08, 0x0203A56B), COMB_D(0x31855F7D, 0xB8C7FEDB), COMB_D(0x4E769E76, 0x72C9DDAD), 0},
+     {COMB_D(0xA4C36165, 0xB824BBB0), COMB_D(0xFB9AE16F, 0x3B9122A5), COMB_D(0x1EC00572, 0x06947281), COMB_D(0x42B99082, 0xDE830663), 0}},
+    {{COMB_D(0x40B11C79, 0xBB162B85), COMB_D(0x426E2F71, 0x5A890653), COMB_D(0xE9E180A6, 0x7586E3C3), COMB_D(0x507B542A, 0x65DBB34A), 0},
+     {COMB_D(0x225F912A, 0xE489B8AD), COMB_D(0x33520333, 0x301369C1), COMB_D(0xCA383CE7, 0xD338ECDE), COMB_D(0x5EB5701E, 0xD11A51D6), 0}},
+    {{COMB_D(0x490E66BC, 0xFBCBC0C3), COMB_D(0xE8D7B164, 0x15065B98), COMB_D(0xF2F80E3E, 0x3E1A841C), COMB_D(0x62D4A49F, 0x7696FCF5), 0},
+     {COMB_D(0x86EDDEE7, 0xF521F731), COMB_D(0x90337684, 0x77305B14), COMB_D(0x56193ECB, 0xF36FA83E), COMB_D(0xD18B33EB, 0xD347D332), 0}},
+    {{COMB_D(0x6EF95150, 0xDDA868B9), COMB_D(0xD1F89E79, 0x9C0CE131), COMB_D(0x7FDC1CA0, 0x08A1C478), COMB_D(0x78878EF6, 0x1C6CE04D), 0},
+     {COMB_D(0x9C62B912, 0x1FE0D976), COMB_D(0x6ACE570E, 0xBDE08D4F), COMB_D(0xDE53142C, 0x12309DEF), COMB_D(0xB6CB3F5D, 0x7B72C321), 0}},
+    {{COMB_D(0x7F991ED2, 0xC31A3573), COMB_D(0x5B82DD5B, 0xD54FB496), COMB_D(0x595C5220, 0x812FFCAE), COMB_D(0x0C88BC4D, 0x716B1287), 0},
+     {COMB_D(0x3A57BF63, 0x5F48ACA8), COMB_D(0x7C8181F4, 0xDF2564F3), COMB_D(0x18D1B5B3, 0x9C04E6AA), COMB_D(0xDD5DDEA3, 0xF3901DC6), 0}},
+    {{COMB_D(0x8B030FEA, 0xFB696D7B), COMB_D(0x9D11BDCA, 0x400CFA69), COMB_D(0x3BCFB88D, 0x8FA8A597), COMB_D(0xAA59E783, 0xFF476EF0), 0},
+     {COMB_D(0xFBAD3413, 0x88F5A016), COMB_D(0x2A4147FA, 0x5C0ABA02), COMB_D(0xDA2C96D0, 0xD831450E), COMB_D(0x30A12AAD, 0x30E77DD1), 0}},
+    {{COMB_D(0xDFA412E5, 0x30076ED0), COMB_D(0x90E7EFC3, 0xECE43EFE), COMB_D(0x7D021B57, 0xE9C9C2A2), COMB_D(0xE3DDF1B7, 0xB498993D), 0},
+     {COMB_D(0x5B955C48, 0x846B4D7E), COMB_D(0x959131AD, 0xAE7C855E), COMB_D(0x8490E467, 0x77227A7B), COMB_D(0x283833A8, 0xA60CE85F), 0}},
+    {{COMB_D(0xFB5A3D22, 0x2FB3062C), COMB_D(0x5682157E, 0xB65437EC), COMB_D(0x7657711B, 0x76FD0872), COMB_D(0xCE6D933A, 0x4AD70BCC), 0},
+     {COMB_D(0xA9CEBBA1, 0xFC3E65C1), COMB_D(0x0FDA9930, 0xD4111C9D), COMB_D(0xD1EDB57B, 0x9A834DD3), COMB_D(0xA8839960, 0x5D2C8BB7), 0}},
+    {{COMB_D(0x88BC6C8D, 0x8C4150CC), COMB_D(0x73758B21, 0xAD6C3923), COMB_D(0xD43A7503, 0x29928820), COMB_D(0x790ECF86, 0x95EA9FEB), 0},
+     {COMB_D(0x59A580F7, 0x1BFB5292), COMB_D(0x0F7A900F, 0x9F51DE15), COMB_D(0xF444C49A, 0x9D6239F6), COMB_D(0xE340D641, 0xD87DECF6), 0}},
+    {{COMB_D(0x1EBB28AC, 0x1026B033), COMB_D(0xFF199A09, 0x3A50D3AC), COMB_D(0xA2C053E4, 0xE869A58E), COMB_D(0xB05E35AA, 0x414DD6BE), 0},
+     {COMB_D(0xFBCB4C4A, 0x6754449F), COMB_D(0xC25C0899, 0xF8427D60), COMB_D(0xD7E45688, 0xC5AE69DE), COMB_D(0x47270F9C, 0x6646039A), 0}},
+    {{COMB_D(0x0DFAB50A, 0xE872889A), COMB_D(0xFAB939D7, 0x703913A8), COMB_D(0x4EBC7144, 0x16B20242), COMB_D(0x22BC5020, 0xD2F8BAE8), 0},
+     {COMB_D(0xABEAAAE6, 0x9D713946), COMB_D(0x3C2CD39E, 0x3EF21012), COMB_D(0xAC67692C, 0xAEF98A9B), COMB_D(0x616222E4, 0x78E64C2E), 0}},
+    {{COMB_D(0xFFCDCC28, 0xB6A8A95D), COMB_D(0x61948CC6, 0xF068C865), COMB_D(0x02790B8C, 0x48A3FBB6), COMB_D(0xFAA43BED, 0x93239BC6), 0},
+     {COMB_D(0x97747046, 0x77A8FE3D), COMB_D(0x5F83CA7A, 0x3E4708BD), COMB_D(0x1388E9E2, 0x43482E7D), COMB_D(0xD21A75F1, 0x026921CA), 0}},
+    {{COMB_D(0x7549F1B1, 0xA15BBAE6), COMB_D(0xA9C4EBBC, 0x8BA6BBCF), COMB_D(0xF3DEB351, 0x3AB26D77), COMB_D(0xFD3BCF2D, 0x7F94BBB6), 0},
+     {COMB_D(0xFA8344D7, 0x46FE3DDC), COMB_D(0xBAD3E545, 0xD2F4FDAB), COMB_D(0xBA4CCB8E, 0xF8DE5D37), COMB_D(0xADA514FE, 0xD97112DB), 0}},
+    {{COMB_D(0x017FA5E2, 0x8BCF4DBF), COMB_D(0xABCAEADA, 0x80217643), COMB_D(0xEFB61274, 0x4BBF5A9F), COMB_D(0xF28DC88B, 0x5144598E), 0},
+     {COMB_D(0x2FD4905E, 0xB384A585), COMB_D(0x30987256, 0x73DF56D7), COMB_D(0xE1913CA6, 0x671DD081), COMB_D(0x1A242940, 0x8249B59B), 0}},
+    {{COMB_D(0xDA398393, 0x1F70723F), COMB_D(0x6CFE750A, 0xB21AC825), COMB_D(0x92C6A768, 0xF4EB6E64), COMB_D(0x4290DB0B, 0x47C9E925), 0},
+     {COMB_D(0xF9D2FB88, 0x413464C5), COMB_D(0x64AA8AD3, 0xC8971F1A), COMB_D(0x263BEAD1, 0xF2EBCD3C), COMB_D(0xB5D01E33, 0x3374C163), 0}},
+    {{COMB_D(0xE96A79FB, 0x3E72AD0C), COMB_D(0x43A0A28C, 0x42BA792F), COMB_D(0xEFE0A423, 0x083E49F3), COMB_D(0x68F344AF, 0x6B317466), 0},
+     {COMB_D(0xCDFE17DB, 0x3FB24D4A), COMB_D(0x668BFC22, 0x71F5C626), COMB_D(0x604ED93C, 0x24D67FF3), COMB_D(0x31B9C405, 0xF8540A20), 0}},
+    {{COMB_D(0xD36B4789, 0xA2582E7F), COMB_D(0x0D1A1014, 0x4EC39C28), COMB_D(0x663C62C3, 0xEDBAD7A0), COMB_D(0x4052BF4B, 0x6F461DB9), 0},
+     {COMB_D(0x235A27C3, 0x188D25EB), COMB_D(0xE724F339, 0x99BFCC5B), COMB_D(0x862BE6BD, 0x71D70CC8), COMB_D(0xFECF4D51, 0x90B0FC61), 0}},
+    {{COMB_D(0x63FEC45F, 0x15A27295), COMB_D(0xA41A773E, 0x74D2B111), COMB_D(0x9341BC09, 0x12DDE90D), COMB_D(0x5583DAFA, 0xAA83C35C), 0},
+     {COMB_D(0xBC93AE0B, 0x05F406F4), COMB_D(0xCF73A836, 0xC427F2EC), COMB_D(0x0AF26BE5, 0x2C6E92A6), COMB_D(0xE096722B, 0x49B67CD6), 0}},
+    {{COMB_D(0xF4B1AD53, 0x00AEF6E0), COMB_D(0x51D353E9, 0x92448EC8), COMB_D(0xBDA23624, 0x4F5F7050), COMB_D(0x38641E4C, 0x5172DDF2), 0},
+     {COMB_D(0xD076B5AE, 0x0DAFE306), COMB_D(0xBAF02E13, 0x042F9B7F), COMB_D(0xEFB76553, 0x7BB9888D), COMB_D(0x28AC3017, 0xEEE3A756), 0}},
+    {{COMB_D(0x74346C10, 0xA1D4CFAC), COMB_D(0xAFDF5CC0, 0x8526A7A4), COMB_D(0x123202A8, 0xF62BFF7A), COMB_D(0x1EDDBAE2, 0xC802E41A), 0},
+     {COMB_D(0x8FA0AF2D, 0xD603F844), COMB_D(0x36E06B7E, 0x4C701917), COMB_D(0x0C45F452, 0x73DB33A0), COMB_D(0x43104D86, 0x560EBCFC), 0}},
+    {{COMB_D(0x9615B511, 0x0D1D78E5), COMB_D(0x66B0DE32, 0x25C4744B), COMB_D(0x0A4A46FB, 0x6AAF363A), COMB_D(0xB48E26B4, 0x84F7A21C), 0},
+     {COMB_D(0x06EBB0F6, 0x21A01B2D), COMB_D(0xC004E404, 0x8B7B0F98), COMB_D(0x64131BCD, 0xFED6F668), COMB_D(0xFAC01540, 0x4D4D3DAB), 0}},
+    {{COMB_D(0xFF8D09C0, 0x72600E54), COMB_D(0x1960EDAF, 0x10203D11), COMB_D(0x429DD48F, 0x377756FC), COMB_D(0x4FA4A1EA, 0x884D880E), 0},
+     {COMB_D(0x7FA9EAF1, 0x8D24AD69), COMB_D(0x4B9A578C, 0xAE16E60F), COMB_D(0x7E8849F3, 0x35364B6A), COMB_D(0x3A6681DB, 0x426F03FE), 0}},
+    {{COMB_D(0x62427D34, 0x8FA9F0A4), COMB_D(0xEF92AAC0, 0xA7621AA3), COMB_D(0x9A3BFB57, 0x6BC20D7F), COMB_D(0xE00F53AF, 0x57ADD1CF), 0},
+     {COMB_D(0xAA091420, 0x9A8E182B), COMB_D(0x6DBADF70, 0x65870ACD), COMB_D(0x1873E2CB, 0x9E7FA3D9), COMB_D(0x15B8C5B7, 0xAE5822E9), 0}},
+    {{COMB_D(0x6B53BF21, 0x593D097F), COMB_D(0xBF667BEA, 0x84D5959A), COMB_D(0xD1609F4F, 0xEEB4BEAC), COMB_D(0x69A5B074, 0xCAC8251D), 0},
+     {COMB_D(0x612D6531, 0x5318ECB3), COMB_D(0x66A6AEBC, 0xD420D3E0), COMB_D(0x6840955E, 0x685D7231), COMB_D(0x454F241C, 0x1DAA4128), 0}},
+    {{COMB_D(0x8D3E6D40, 0xA5D67E8A), COMB_D(0xE139639F, 0xA18B743B), COMB_D(0x63749EA0, 0x948E7DC2), COMB_D(0xABD4C85F, 0x526BDE8F), 0},
+     {COMB_D(0x731DA794, 0x2D812DFE), COMB_D(0x9A9C0DDD, 0x67ED8673), COMB_D(0x63FEBA54, 0xA83F2506), COMB_D(0x475BAED2, 0xF64A622E), 0}},
+    {{COMB_D(0x1AA70AD1, 0xB40AAB96), COMB_D(0xF7ACCAED, 0xF911EC64), COMB_D(0x637899CE, 0x70FA959C), COMB_D(0xE9BC4FE4, 0x109A2589), 0},
+     {COMB_D(0x7BCCE0D0, 0x1BF979E4), COMB_D(0x2941C273, 0xBB65D9BE), COMB_D(0x4997CC24, 0xBAE3365E), COMB_D(0x20EFCFBB, 0x8B08213E), 0}},
+    {{COMB_D(0xDDE6C1B0, 0xBDD6FA57), COMB_D(0x64DA38DC, 0x6877584C), COMB_D(0x5EFD04D6, 0x88A2EA3B), COMB_D(0x5E12F389, 0x8DE94787), 0},
+     {COMB_D(0x822DC6F3, 0x4C229E61), COMB_D(0x0220A965, 0x32C58CE1), COMB_D(0xBFF58F54, 0x12104D90), COMB_D(0xCC9C71A8, 0x6F430C30), 0}},
+    {{COMB_D(0x69A3F7AF, 0x146A91DD), COMB_D(0x66FB0376, 0x77603291), COMB_D(0xF8BA5650, 0x34331450), COMB_D(0x4D88F26E, 0x5D12FC47), 0},
+     {COMB_D(0x52E87A6F, 0xDE1D8482), COMB_D(0x71FC3D27, 0xD84F6DC4), COMB_D(0x80660EB4, 0x1C1BFC10), COMB_D(0x2F4241DD, 0x39AD0A51), 0}},
+    {{COMB_D(0xCEA18FED, 0x5DA65E89), COMB_D(0x89D02E3A, 0xB6030005), COMB_D(0x593303DB, 0x16B45EAB), COMB_D(0xF5D40404, 0x40B36824), 0},
+     {COMB_D(0x8E62C398, 0xB6E6CA16), COMB_D(0xB6680F4A, 0xA0F8DB73), COMB_D(0xE2CB53AB, 0x3735F704), COMB_D(0x90EAF4B0, 0x005E4955), 0}},
+    {{COMB_D(0x4EA9BF09, 0xD030702A), COMB_D(0xE8E44EA4, 0xCE4824BB), COMB_D(0x0AAA6A0A, 0x821E5B58), COMB_D(0x2090FA8E, 0x117DA962), 0},
+     {COMB_D(0x1B68C306, 0x80902901), COMB_D(0xAF0A7E97, 0x0B4E7472), COMB_D(0xEBB4408C, 0x0393F96B), COMB_D(0x984BD632, 0xEC32F258), 0}},
+    {{COMB_D(0x807D9AF8, 0x1159F10E), COMB_D(0xE05EFF00, 0xB42511BC), COMB_D(0x2EE9F026, 0x61B05022), COMB_D(0x3D45853A, 0x29FB81A6), 0},
+     {COMB_D(0xA6B9C16E, 0xF75BC3A9), COMB_D(0x82111A06, 0x515A90E0), COMB_D(0x87211449, 0xEDFC125E), COMB_D(0x4E4DE334, 0xA80A8311), 0}},
+    {{COMB_D(0x270A098D, 0x637D797D), COMB_D(0x60FF39ED, 0xFF736545), COMB_D(0xEB3DF8BF, 0x9D6B4A9B), COMB_D(0x0AC9835F, 0x0E6155FA), 0},
+     {COMB_D(0x50C04B69, 0x640BC0E9), COMB_D(0xFA24F733, 0x3FE89B08), COMB_D(0xD8AC7B19, 0x5C6872B2), COMB_D(0xD6882B26, 0x3D00D534), 0}},
+    {{COMB_D(0xE0052323, 0x0236A83D), COMB_D(0x1FB825A3, 0xCD9A2912), COMB_D(0x69479CBC, 0x3F92D724), COMB_D(0x389EFF26, 0x38EC3DDD), 0},
+     {COMB_D(0xE9FFEA6C, 0x1EB367C1), COMB_D(0x113A50C5, 0x91F3A0DE), COMB_D(0xCFD0310C, 0xB7B0AF9E), COMB_D(0x5E1B21C9, 0x31EA1AC9), 0}},
+    {{COMB_D(0xDA6E2F06, 0x48ACEFF5), COMB_D(0x78DDC159, 0xEA0DFE34), COMB_D(0xB5F5FB47, 0x14DB328C), COMB_D(0x9419ACF5, 0xE6F3BA6A), 0},
+     {COMB_D(0xB19CD157, 0xC66C1B27), COMB_D(0x473BE3D3, 0xF91BDB7B), COMB_D(0x08A1F515, 0xEE3174A1), COMB_D(0x565A9071, 0x1B427E86), 0}},
+    {{COMB_D(0x71DB5C74, 0x863DEF2F), COMB_D(0x46FC6CC6, 0x86DB595A), COMB_D(0x41A41F2A, 0xB0578F7C), COMB_D(0x3AF24209, 0x00C9BC26), 0},
+     {COMB_D(0x134233FD, 0xB3C9AB1A), COMB_D(0x7870F3A9, 0xB6070F59), COMB_D(0x39B1F3B2, 0xDF2AF343), COMB_D(0x6013DA0E, 0x4AB472AB), 0}},
+    {{COMB_D(0xA4AB1856, 0xF319CA96), COMB_D(0xFAD93FE2, 0xF8F15FAC), COMB_D(0x9A143FF7, 0xA833145E), COMB_D(0xB7F41BBE, 0xF19E3798), 0},
+     {COMB_D(0xE71B2D47, 0x88FBA40D), COMB_D(0xFBE87B9F, 0xFD3B7782), COMB_D(0x51BED9BE, 0xDEF04692), COMB_D(0x9D86B0CC, 0x0A92FE70), 0}},
+    {{COMB_D(0xE4269DBE, 0x901D3434), COMB_D(0x93B1C84F, 0xFE90A0F6), COMB_D(0x9E0AB0CF, 0xC4383C70), COMB_D(0x94A875B9, 0x9EF8F7F3), 0},
+     {COMB_D(0x7C54E527, 0x7BD07E21), COMB_D(0x4426E751, 0x24C1F8A1), COMB_D(0x88D04FF3, 0xA59E4156), COMB_D(0xCA552076, 0x2E3F9185), 0}},
+    {{COMB_D(0xC6C3BAAE, 0x3F32BEF2), COMB_D(0x130EE8F7, 0xCCBF8EB6), COMB_D(0x09EC2B46, 0x8E7E89C3), COMB_D(0x3FBFBD74, 0xBC2625F9), 0},
+     {COMB_D(0x88502A08, 0xB27173D1), COMB_D(0xBB3271FF, 0x3CF0D529), COMB_D(0x1409DF32, 0xEB6FC065), COMB_D(0x21531773, 0x75196790), 0}},
+    {{COMB_D(0x93EB1D71, 0x0DA1427C), COMB_D(0xB5F1A270, 0x410E3F28), COMB_D(0x7E9D484B, 0xA9325717), COMB_D(0xF883C4AB, 0x576B2B28), 0},
+     {COMB_D(0x8471E075, 0x15B0CC94), COMB_D(0xAEE70132, 0x560FAB54), COMB_D(0xB461EFE8, 0xDD9DEC7A), COMB_D(0x6086F208, 0x488AB1D0), 0}},
+    {{COMB_D(0x8A9B3774, 0xD41345EB), COMB_D(0xE42D2EA2, 0x4320BEC3), COMB_D(0xEBB176E7, 0xD72435FF), COMB_D(0x3841166E, 0xCA2C0E18), 0},
+     {COMB_D(0x9C27A301, 0xD372BE35), COMB_D(0x7518195C, 0xE329D0DF), COMB_D(0x203C98CB, 0xCA99FE01), COMB_D(0x84D9C1A6, 0x89F4CED9), 0}},
+    {{COMB_D(0xA7F47395, 0xB789034E), COMB_D(0x5378515C, 0xE3ACD77C), COMB_D(0x29D692E0, 0xA20BCD3F), COMB_D(0xBFD07180, 0x59E44B71), 0},
+     {COMB_D(0x92CD3E15, 0x6733F199), COMB_D(0x43428C81, 0x99F9141A), COMB_D(0x47E891EC, 0x07E9C6E8), COMB_D(0x47103963, 0x75DEAF04), 0}},
+    {{COMB_D(0xE2403426, 0x07888C81), COMB_D(0x03547365, 0x87490006), COMB_D(0x48369A11, 0x1FCA7F34), COMB_D(0x383707D0, 0x6E2F531D), 0},
+     {COMB_D(0xDC6A8214, 0x9F7D10DC), COMB_D(0xCA0B8578, 0xC9D5EF32), COMB_D(0x8A4A5B65, 0xCDB6F94D), COMB_D(0x287FF192, 0x9B236F7A), 0}},
+    {{COMB_D(0x886878CA, 0x48C1555E), COMB_D(0x5FB1FBC9, 0xAF70DB2D), COMB_D(0xDFFFF48F, 0xB15FDA95), COMB_D(0xFD98525D, 0x8FB2FA61), 0},
+     {COMB_D(0x9A481E75, 0x57F0C9A8), COMB_D(0x9BAB3B2A, 0x27069783), COMB_D(0x9569DFFB, 0xA223C95E), COMB_D(0x93840D78, 0x0F6B2D61), 0}},
+    {{COMB_D(0xEAAAA5D8, 0x23BAEB04), COMB_D(0xB7ADCA0C, 0x3A4708FA), COMB_D(0x1394CBDC, 0x17B23442), COMB_D(0xB241AA94, 0x1D926D0F), 0},
+     {COMB_D(0xDA7549F5, 0x1DE2521D), COMB_D(0xEE7534C9, 0xE4B48A02), COMB_D(0x1DDE0DEE, 0x46BA6568), COMB_D(0x85AA7EED, 0x21B920E4), 0}},
+    {{COMB_D(0x348857EA, 0xBAF91228), COMB_D(0x892D0A81, 0x4ECB2AF2), COMB_D(0x06136E7F, 0x91E8B82B), COMB_D(0x0869EC0D, 0x495431AD), 0},
+     {COMB_D(0x54FA49C4, 0x2E051CDF), COMB_D(0xCB47ADCA, 0x823C9B51), COMB_D(0x70A00076, 0x265EB81A), COMB_D(0x5572895C, 0x9B7675A0), 0}},
+    {{COMB_D(0x9D1ADF60, 0x96C14E8F), COMB_D(0x06597793, 0x2C06A25A), COMB_D(0xB2DCBD1F, 0x58D5A91A), COMB_D(0x1283033B, 0xDE733F89), 0},
+     {COMB_D(0xB4020E0E, 0x9BBD6A2D), COMB_D(0xE8B07157, 0x7D383846), COMB_D(0x84AF4665, 0xA635C7BE), COMB_D(0x549C0EAA, 0x34DD7D5F), 0}},
+    {{COMB_D(0xF29FB08F, 0xE86E02AB), COMB_D(0xA8266DC1, 0x0D5C06CA), COMB_D(0x25D5E27D, 0x2F48F49F), COMB_D(0xA2EBF469, 0xE6F31BB3), 0},
+     {COMB_D(0x86AE97D9, 0x0382A8EB), COMB_D(0xCB92F44B, 0x363F04F7), COMB_D(0x391B9654, 0x002D76F6), COMB_D(0x27BEBD8C, 0x4432235D), 0}},
+    {{COMB_D(0x7B3068D0, 0x3765581E), COMB_D(0x561D30F5, 0x1DC2D82E), COMB_D(0x8A404541, 0xB1F23D69), COMB_D(0x6A25FB20, 0x1B4084CE), 0},
+     {COMB_D(0x50180E1B, 0x60206329), COMB_D(0x1E15941A, 0x5CF443D5), COMB_D(0xF5763393, 0xD06A4007), COMB_D(0x5A0AEBFC, 0x19CFB424), 0}},
+    {{COMB_D(0xA2D545DA, 0xE529A049), COMB_D(0xA581A768, 0xC73A541A), COMB_D(0xAFE88B1E, 0xE0950A67), COMB_D(0x62778F74, 0x52B8FCCA), 0},
+     {COMB_D(0x44BB1BFA, 0x0B8483FC), COMB_D(0x5D727F5A, 0x6E882C24), COMB_D(0x4E4CBE60, 0x553A776C), COMB_D(0xE155B2F8, 0x1AE91088), 0}},
+    {{COMB_D(0x5D84A3A3, 0x1B207A93), COMB_D(0xFBAE3D63, 0xB71B2F04), COMB_D(0xAA9CEBC1, 0x6013B8BA), COMB_D(0xFC9AA3CF, 0xD1C608D1), 0},
+     {COMB_D(0x1E3F596C, 0xCF8CD72D), COMB_D(0x26152558, 0xDA16B20C), COMB_D(0x6DB0B1CD, 0x85AC096C), COMB_D(0x34AB0E43, 0x2BB637DA), 0}},
+    {{COMB_D(0xA9F4F5C1, 0x12C953E4), COMB_D(0xFE518080, 0x2A6A470A), COMB_D(0x5455FBCB, 0x0B17775B), COMB_D(0x4F117894, 0xC1752BB7), 0},
+     {COMB_D(0x5B5E49DE, 0x544A3BE7), COMB_D(0x0DDE356F, 0x22C3EC1C), COMB_D(0xE26AE66A, 0x01DA56C9), COMB_D(0xAB3B6155, 0x35FFD9DC), 0}},
+    {{COMB_D(0x21AD037B, 0xC94F4326), COMB_D(0xDD3C9AAD, 0x01F60A81), COMB_D(0x4F11EE65, 0xA3106421), COMB_D(0x4751FE00, 0xADBACC80), 0},
+     {COMB_D(0xE4683589, 0xD3C2917E), COMB_D(0xFA8BD144, 0x71D43F65), COMB_D(0x200697F3, 0x11A422F6), COMB_D(0xE83D7D4F, 0x1FA0772B), 0}},
+    {{COMB_D(0xCA907BFF, 0x59B21469), COMB_D(0xECFDA9FD, 0xC44627DE), COMB_D(0x8B32C8BB, 0x5AF99278), COMB_D(0x2298506C, 0x51C0A6FC), 0},
+     {COMB_D(0x2227244E, 0x9D7BFC5F), COMB_D(0xD903A0C9, 0xBC8DCDBC), COMB_D(0x8916ACEC, 0xA5809F67), COMB_D(0xFEF3434A, 0x4C45BBD7), 0}},
+    {{COMB_D(0x12749619, 0xC5332D4D), COMB_D(0x78346549, 0x076108B7), COMB_D(0x44F0646E, 0x52F84FDE), COMB_D(0xACA1B2FA, 0x9B855F0E), 0},
+     {COMB_D(0x9F40EDD1, 0xBB5ACC3E), COMB_D(0x341DD551, 0x5CB0077A), COMB_D(0x4162BF6F, 0x7731C386), COMB_D(0x30FC315C, 0x7D37F6E4), 0}},
+    {{COMB_D(0x07C6577E, 0xBE224934), COMB_D(0x0BD79C64, 0x133B52F5), COMB_D(0x6D440B9B, 0x26EA9A30), COMB_D(0xDC9823E4, 0x8AF95AF2), 0},
+     {COMB_D(0xF3DCB38A, 0x951A08EB), COMB_D(0xCAEDC3A2, 0xCD6F6B4F), COMB_D(0xB648EFDB, 0x55572EFD), COMB_D(0xB2656A22, 0x043C56DD), 0}},
+    {{COMB_D(0x24C2E7A2, 0x7CAB3106), COMB_D(0xE70143A5, 0x45DDCBCC), COMB_D(0x121738AA, 0xE23C4D47), COMB_D(0xD3559359, 0xC9729043), 0},
+     {COMB_D(0xD0ABCEDD, 0x5F6E4215), COMB_D(0xF09EF638, 0xD8C94522), COMB_D(0x7BDDE51F, 0xFBF9AB22), COMB_D(0x7AA22698, 0x95EDB586), 0}},
+    {{COMB_D(0xC7E05F58, 0x530E8727), COMB_D(0xD41592D9, 0x88A132F3), COMB_D(0x7CB9B486, 0x4835F583), COMB_D(0x0D5CABA2, 0x8F603959), 0},
+     {COMB_D(0xB97C361D, 0x7D850A76), COMB_D(0x75D0638A, 0x0751FEDF), COMB_D(0xAD213D44, 0xEB862FBE), COMB_D(0xCB814263, 0x597D997B), 0}},
+    {{COMB_D(0x5E2A21F5, 0x85FBA82B), COMB_D(0xE2B23452, 0xEE80D718), COMB_D(0x61CD936D, 0x8F8D3AD4), COMB_D(0x537E0FAA, 0xAEA80A6B), 0},
+     {COMB_D(0xE8A1913B, 0x65C03360), COMB_D(0xAD915586, 0xE9A48461), COMB_D(0x197C7BE0, 0xC9E7C92D), COMB_D(0x98FF32E1, 0x0476E6DB), 0}},
+    {{COMB_D(0x56131598, 0xF8D734CA), COMB_D(0xA90C803B, 0x32AB6115), COMB_D(0xF20B6904, 0x294F6172), COMB_D(0x9C4C8C6B, 0x29BB4956), 0},
+     {COMB_D(0x72523CBC, 0xA3443E3C), COMB_D(0x403FC2D5, 0x1AAF4A8F), COMB_D(0x264BCAA0, 0xF99A6339), COMB_D(0xF837CA9F, 0x6437CEC7), 0}},
+    {{COMB_D(0x3BB78084, 0x15685448), COMB_D(0x0FC3A28F, 0x1186BDE2), COMB_D(0xD41F0CFA, 0xCF4EEBDF), COMB_D(0x8384F799, 0xAE3A0DDC), 0},
+     {COMB_D(0xF4EE653F, 0x10B4F451), COMB_D(0xC2F5D30F, 0x833D3476), COMB_D(0x6C3BCEB3, 0x38E0E1CE), COMB_D(0x76570D52, 0xAA489E30), 0}},
+    {{COMB_D(0xB7AEAB38, 0xA38218CF), COMB_D(0x2B07AEB1, 0xA9E0D3C4), COMB_D(0xF0D16BE2, 0x47A4C94D), COMB_D(0x5AF88695, 0x91FD763C), 0},
+     {COMB_D(0x053AB914, 0x2A9DA273), COMB_D(0x10D130AB, 0x61EBE016), COMB_D(0x5099B9C8, 0xD34E284A), COMB_D(0xB21A4103, 0x6ED4DE65), 0}},
+    {{COMB_D(0x940F3648, 0xF8E85A02), COMB_D(0x014FF0A9, 0x555E9CA4), COMB_D(0x656E0598, 0x2EBFF5CE), COMB_D(0x7104DED9, 0x7CD3977C), 0},
+     {COMB_D(0x9A4C0512, 0x6385DFE7), COMB_D(0x0627BE3C, 0x0830E76D), COMB_D(0xF8C14705, 0xB14A50BF), COMB_D(0x3B4A1D7F, 0x8C3FAA7E), 0}},
+    {{COMB_D(0x84B1E14B, 0xE6A868A0), COMB_D(0x7B98A2BB, 0x47BC1E4F), COMB_D(0x0E6DF4E4, 0xCC803733), COMB_D(0xB751A536, 0x7958E14D), 0},
+     {COMB_D(0xF925771B, 0x5B9871B7), COMB_D(0xEFFA615A, 0xE16ED05E), COMB_D(0x3141411A, 0xC695DDD6), COMB_D(0x91EB562A, 0x61468D10), 0}},
+    {{COMB_D(0x6A703F10, 0xE895DF07), COMB_D(0xFD75F3FA, 0x01876BD8), COMB_D(0xEB5B06E7, 0x0CE08FFE), COMB_D(0x68F6B854, 0x2783DFEE), 0},
+     {COMB_D(0x90C76F8A, 0x78712655), COMB_D(0xCF5293D2, 0xF310BF7F), COMB_D(0xFBC8044D, 0xFDA45028), COMB_D(0xCBE1FEBA, 0x92E40CE6), 0}},
+    {{COMB_D(0xFD4C1473, 0xC0C1CE9F), COMB_D(0x27F187B9, 0x7EDA11D3), COMB_D(0x024CD871, 0xD9845057), COMB_D(0xCF6B116F, 0xA174D4D3), 0},
+     {COMB_D(0xD300B23F, 0xD279352F), COMB_D(0x364BC658, 0x23F12526), COMB_D(0xC7908819, 0x2AB7B709), COMB_D(0xC2DE1FA1, 0xB6BFC532), 0}},
+    {{COMB_D(0xE998CEEA, 0x4396E4C1), COMB_D(0xFC82EF0B, 0x6ACEA274), COMB_D(0x230F729F, 0x2250E927), COMB_D(0xD0B2F94D, 0x2F420109), 0},
+     {COMB_D(0x4305ADDD, 0xB38D4966), COMB_D(0x10B838F8, 0x624C3B45), COMB_D(0x7DB26366, 0x58954E7A), COMB_D(0x97145982, 0x8B0719E5), 0}},
+    {{COMB_D(0x64549B3D, 0xD93F535C), COMB_D(0x93978B4D, 0xA76E5BF3), COMB_D(0xE2B1F3EE, 0x5A01C10E), COMB_D(0x76F210AF, 0xA9D19EA8), 0},
+     {COMB_D(0xF04ACA7A, 0xC4264D57), COMB_D(0x9F989031, 0x483487BA), COMB_D(0x84132D01, 0xE6280F91), COMB_D(0xF34B31CE, 0xB3A040CF), 0}},
+    {{COMB_D(0x75CEC1FF, 0xEEE8CB7E), COMB_D(0x566BF7FA, 0xF8735FB1), COMB_D(0xC360C19A, 0x5975D2FD), COMB_D(0x93B3CE8D, 0xF075EC6C), 0},
+     {COMB_D(0x718B6E47, 0x815D65CE), COMB_D(0x17EC17C1, 0xD1C39345), COMB_D(0x4A1D862F, 0x6DAC86B0), COMB_D(0x268C55B1, 0xE6DFAB8E), 0}},
+    {{COMB_D(0xB535FD34, 0xCFFCAF2D), COMB_D(0x9C8838DF, 0xA23B8B1B), COMB_D(0xB2FB47FD, 0xE178F644), COMB_D(0x201173F5, 0xF5D8BE2C), 0},
+     {COMB_D(0x485E1C8D, 0x9968EEEE), COMB_D(0x165D69EA, 0xF856B514), COMB_D(0x17B6206C, 0x756B5779), COMB_D(0x8DAC7611, 0xAFE2AE9A), 0}},
+    {{COMB_D(0x0C55F223, 0xDBDF389D), COMB_D(0x76030246, 0x61EDA89E), COMB_D(0x18975AE2, 0xA1150650), COMB_D(0x77AAEBAB, 0xC911375C), 0},
+     {COMB_D(0xEDAE9AD1, 0x2FE056E6), COMB_D(0x8AA8F740, 0x2DDE44E4), COMB_D(0x9D288103, 0xE2873522), COMB_D(0xF34AACA7, 0xFB60CD48), 0}},
+    {{COMB_D(0xBC7BCC73, 0x08BDF594), COMB_D(0x8FEC77F2, 0xA9178A0B), COMB_D(0x7BB27826, 0x949EDFB7), COMB_D(0x77B0D0C5, 0xF137D62F), 0},
+     {COMB_D(0x5ADD7B4B, 0x88F8A9EA), COMB_D(0x133EDFBD, 0x966CDA49), COMB_D(0x0189CA26, 0xEAB66F18), COMB_D(0x40C07B47, 0x55F452B1), 0}},
+    {{COMB_D(0x4BD6B726, 0x23369FC9), COMB_D(0x57F2929E, 0x53D0B876), COMB_D(0xC2D5CBA4, 0xF2340687), COMB_D(0x96161000, 0x4A866ABA), 0},
+     {COMB_D(0x49997BCD, 0x2E407A5E), COMB_D(0x69AB197D, 0x92DDCB24), COMB_D(0x2CF1F243, 0x8FE5131C), COMB_D(0x7ACB9FAD, 0xCEE75E44), 0}},
+    {{COMB_D(0xFB5F7E26, 0xB34983B1), COMB_D(0x7E38E207, 0xD3FBB145), COMB_D(0xF608EE91, 0xAF71ED7F), COMB_D(0x6D78F612, 0x686E5AEA), 0},
+     {COMB_D(0x2F9D2E63, 0x607E751E), COMB_D(0x8607CB37, 0x2748BA3B), COMB_D(0x006F6D32, 0xF4FE56A9), COMB_D(0x2980BD5A, 0x6D242B89), 0}},
+    {{COMB_D(0x254E8394, 0x23D2D4C0), COMB_D(0xF57F0C91, 0x7AEA685B), COMB_D(0xA60D880F, 0x6F75AAEA), COMB_D(0x24EB9ACC, 0xA333BF5B), 0},
+     {COMB_D(0xE3DE4CCB, 0x1CDA5DEA), COMB_D(0xFEEF9341, 0xC51A6B4F), COMB_D(0x743125F8, 0x8BAC4C4D), COMB_D(0x69F891C5, 0xACD079CC), 0}},
+    {{COMB_D(0x6384AB74, 0x3DBA87E7), COMB_D(0xE8F20516, 0xB78A63AC), COMB_D(0xC6D198DE, 0x03FA5C24), COMB_D(0x7AFB3D4F, 0xB50C2893), 0},
+     {COMB_D(0xE4D418B9, 0x3A4CF320), COMB_D(0xAAC22A0E, 0x4FAA9ACC), COMB_D(0x08A7CC67, 0x552C1F31), COMB_D(0x36009A3A, 0xD6668BEB), 0}},
+    {{COMB_D(0x09A16E3B, 0xB34D794F), COMB_D(0x8C3F4A31, 0x4E743813), COMB_D(0xE8A7B747, 0x651C9834), COMB_D(0x4667EBB9, 0xD2C76536), 0},
+     {COMB_D(0x1F6884FA, 0xB8A887AB), COMB_D(0xD021BC8D, 0xA08DF843), COMB_D(0xFC2D4609, 0x55F59432), COMB_D(0x2D5C1AC7, 0x38D06677), 0}},
+    {{COMB_D(0x1D348841, 0xFAECB3E4), COMB_D(0xE2E6D3B5, 0x0406E1CE), COMB_D(0x504B9726, 0x87679B85), COMB_D(0x25279D03, 0x78812B43), 0},
+     {COMB_D(0x7E329009, 0x56676779), COMB_D(0xF0184A5B, 0xB002BCF5), COMB_D(0x49E88336, 0xD630DA82), COMB_D(0x92D01B0B, 0xF08564A7), 0}},
+    {{COMB_D(0x9460F46A, 0x36CFA9E8), COMB_D(0x6800B8A8, 0x84A462F7), COMB_D(0x9F5D99A2, 0xC06A6673), COMB_D(0x1AB172C7, 0xB101B4F6), 0},
+     {COMB_D(0xF699C703, 0x5321C59C), COMB_D(0x0B9ACA14, 0xED13BC1F), COMB_D(0x91C6EEBB, 0xDFAA5EAA), COMB_D(0x885AE502, 0x4F346816), 0}},
+    {{COMB_D(0xDBDEB29D, 0xC9757170), COMB_D(0x55B5A898, 0xCBF1B409), COMB_D(0x01B3DFD4, 0xA4C0CBD2), COMB_D(0x38611618, 0xD97E4324), 0},
+     {COMB_D(0xF3EA3774, 0x57BEE79E), COMB_D(0x60941F4E, 0xBC20E2C6), COMB_D(0x21D8F508, 0x53C47B89), COMB_D(0x7E7D03D3, 0xB8F41362), 0}},
+    {{COMB_D(0xCC38452E, 0xF202481A), COMB_D(0x50D19D86, 0xABC96FED), COMB_D(0x83FB2D63, 0xC62CD055), COMB_D(0xBD6058B0, 0x7B81568E), 0},
+     {COMB_D(0x628271F1, 0x70737BB6), COMB_D(0xC51419ED, 0x83F257D4), COMB_D(0x9EE514E4, 0x09EF7DD9), COMB_D(0xF78E1FBE, 0xF8467E37), 0}},
+    {{COMB_D(0x045EF431, 0x339FE5CE), COMB_D(0xEF414A60, 0xD24C26D1), COMB_D(0xC4151215, 0x661F3BBE), COMB_D(0xCA270C0B, 0xA31D0A51), 0},
+     {COMB_D(0x0BDDC41D, 0x89D02271), COMB_D(0x5DA2412A, 0x55B9AE92), COMB_D(0xE2A468E2, 0x1B6552CC), COMB_D(0x0920500E, 0x29CBEEE5), 0}},
+    {{COMB_D(0x8272EF36, 0x92873D50), COMB_D(0xE6325D26, 0x79CC84D1), COMB_D(0xD634F48D, 0x38675522), COMB_D(0x1D96882C, 0xE4D5882C), 0},
+     {COMB_D(0x7F0B5356, 0x5C7604C9), COMB_D(0x3C33B393, 0xD43110A3), COMB_D(0x4BCB6430, 0x96DE3985), COMB_D(0x35C125A1, 0x9F50539E), 0}},
+    {{COMB_D(0xBAD5F61F, 0x8C720A67), COMB_D(0x2C3C19BC, 0x16BFC3DD), COMB_D(0x997D4265, 0x65D64E56), COMB_D(0xAB25034F, 0x49504379), 0},
+     {COMB_D(0x1F6297F6, 0x1410392E), COMB_D(0xBEF8D14A, 0x12E86D68), COMB_D(0xD6405555, 0x1DFBD10B), COMB_D(0x53CAD2BD, 0x0D44FBAA), 0}},
+    {{COMB_D(0x60D14D0E, 0x0D25CA56), COMB_D(0x31CCE9A5, 0xBCF946FF), COMB_D(0x7F2E2C69, 0xBEF23766), COMB_D(0x4E3C677A, 0x0D8E4B51), 0},
+     {COMB_D(0xA7C52ECA, 0x6BB0D0CE), COMB_D(0x1A2389C8, 0xD0391CA8), COMB_D(0x41165173, 0x7E8B1D46), COMB_D(0x71094B90, 0xA70684B1), 0}},
+    {{COMB_D(0x76F6C646, 0x66554187), COMB_D(0xDE2A1E0E, 0xD3BAC858), COMB_D(0xA81F6685, 0xCA976E8B), COMB_D(0x48A9D631, 0xF60C851C), 0},
+     {COMB_D(0x95A81B38, 0x336936E6), COMB_D(0x588C234F, 0xF7934CBD), COMB_D(0x5603885C, 0x68DB8031), COMB_D(0x9C777837, 0x5C1A48C7), 0}},
+    {{COMB_D(0xFC9C7AFB, 0x8709B816), COMB_D(0xF0190802, 0xD4AB7632), COMB_D(0x609275B0, 0x4C80BD1E), COMB_D(0x791851E2, 0x3680A202), 0},
+     {COMB_D(0x0B4FD3FB, 0x5899EF09), COMB_D(0x53B13F9C, 0xACB207B3), COMB_D(0x3C993D16, 0x7C507F60), COMB_D(0xF1EF5083, 0x8D9E3B7C), 0}},
+    {{COMB_D(0xF426FE06, 0x0AD2FE5C), COMB_D(0xB8746069, 0x9022C4CB), COMB_D(0xA1F27672, 0x403EFCE0), COMB_D(0xC34B4A30, 0x53E2CC9A), 0},
+     {COMB_D(0x7E49B3AB, 0xD0E57D9F), COMB_D(0x9906218B, 0x13463806), COMB_D(0x91A140B9, 0x8BFF74A6), COMB_D(0x52DE5611, 0xE37C6EA3), 0}},
+    {{COMB_D(0xAD1E58C9, 0xE28B1B92), COMB_D(0xBFC3EAD0, 0x77A11D29), COMB_D(0x9F5D367A, 0xBA1DE923), COMB_D(0xC1EE712F, 0xAFB30E89), 0},
+     {COMB_D(0x04886F34, 0x75876AC6), COMB_D(0xB1D36D27, 0x54B5C1C3), COMB_D(0xB36B5FD0, 0x18CBA903), COMB_D(0x9B4A54BC, 0x696A7139), 0}},
+    {{COMB_D(0xDB84065D, 0x519E0427), COMB_D(0xD69DDA22, 0xB863AF57), COMB_D(0x71BB07B4, 0x6AD4BC18), COMB_D(0x41CDAD11, 0xC29564F8), 0},
+     {COMB_D(0x7272B74C, 0x503CC09B), COMB_D(0x72E4D2B6, 0x46BA501D), COMB_D(0xF477717D, 0x5033CCA7), COMB_D(0xFEEEC42C, 0xF3DF9D57), 0}},
+    {{COMB_D(0x435B40EE, 0x57186AC4), COMB_D(0xA16130EA, 0x97B24F3D), COMB_D(0xF2B8C361, 0x453C442E), COMB_D(0x532DE1CF, 0x647E46E4), 0},
+     {COMB_D(0xFAF3C94F, 0x64CCD9EF), COMB_D(0x4E7192EC, 0x182EB339), COMB_D(0x45CBEDA8, 0xF2DFEA04), COMB_D(0xCB652C2D, 0x539889DC), 0}},
+    {{COMB_D(0x8E6576BB, 0xD34C847E), COMB_D(0xCCAEB5EE, 0xD5DE9A09), COMB_D(0x604CA87D, 0xBF91842D), COMB_D(0x363B9C74, 0x7DE9E9ED), 0},
+     {COMB_D(0x20E28AF4, 0x84919F51), COMB_D(0x8EA65E9C, 0x7279A592), COMB_D(0x1DF4B333, 0xADEC5331), COMB_D(0x1B42A7C7, 0x0B1573DF), 0}},
+    {{COMB_D(0xE9EE350D, 0x55EF6C3C), COMB_D(0xF84A8CAD, 0x058A3BA9), COMB_D(0x5316A4FB, 0xE079D281), COMB_D(0xC9BF6F15, 0x11A280E5), 0},
+     {COMB_D(0x77414A7A, 0x860E512E), COMB_D(0xB5722BCF, 0xD9430464), COMB_D(0x631D68D7, 0xFCD817BA), COMB_D(0xCB8DE2D9, 0x20F282F6), 0}},
+    {{COMB_D(0xE3CC6151, 0x86AF53CA), COMB_D(0x3CBBE8D7, 0x609C485F), COMB_D(0xED635088, 0x2024DE09), COMB_D(0x3B9B4F1C, 0x3ED70F65), 0},
+     {COMB_D(0x9C0B92E3, 0x4E292129), COMB_D(0x4ADD5ADC, 0x137DF53D), COMB_D(0x74BAD233, 0xECDB4D15), COMB_D(0x90610274, 0x1A3D8634), 0}},
+    {{COMB_D(0x12022915, 0x2374F412), COMB_D(0xC1C05129, 0x162247D9), COMB_D(0x4A49989B, 0x04B21320), COMB_D(0xDA65930F, 0xCB478149), 0},
+     {COMB_D(0xED96215F, 0x69FB4789), COMB_D(0x3CFCE1CF, 0xAD7FCCB6), COMB_D(0xE454254F, 0x00687BBD), COMB_D(0x5D96FDDD, 0xB30413B9), 0}},
+    {{COMB_D(0x20F89C80, 0x5DEE2192), COMB_D(0x6919A925, 0x5CFB0642), COMB_D(0x94A30525, 0xE8E3E133), COMB_D(0x66209C61, 0x68585ED2), 0},
+     {COMB_D(0x0C904364, 0x6DE12C85), COMB_D(0xDAC80D74, 0xF0248824), COMB_D(0x7B7FA943, 0xF320F71F), COMB_D(0x0A244A2A, 0xD5882C26), 0}},
+    {{COMB_D(0xEEE44B35, 0x702476B5), COMB_D(0x7ED031A0, 0xE45C2258), COMB_D(0xB422D1E7, 0xBD6F8514), COMB_D(0xE51F547C, 0x5972A107), 0},
+     {COMB_D(0xA25BCD6F, 0xC9CF343D), COMB_D(0x8CA922EE, 0x097C184E), COMB_D(0xA62F98B3, 0xA9FE9A06), COMB_D(0x1C309A2B, 0x25BB1387), 0}},
+    {{COMB_D(0xA352A845, 0xC6EE75B0), COMB_D(0x0D667013, 0x4AFAFBAB), COMB_D(0xF2C9F8CC, 0x824A9C3F), COMB_D(0x1123CED9, 0x6671EA61), 0},
+     {COMB_D(0xE2064C2B, 0xC4C0426B), COMB_D(0xAE8A4AC7, 0x5DDA8F0C), COMB_D(0x4789D01E, 0x8B03F8D0), COMB_D(0x6D8A6838, 0x2FD8BEC7), 0}},
+    {{COMB_D(0x9295DBEB, 0x1967C459), COMB_D(0xB0014883, 0x3472C98E), COMB_D(0xC5049777, 0x08011828), COMB_D(0x20B87B8A, 0xA2C4E503), 0},
+     {COMB_D(0x3063175D, 0xE057C277), COMB_D(0x1BD53933, 0x8FE582DD), COMB_D(0x0D11ADEF, 0x5F69A044), COMB_D(0xF5C6FA49, 0x919776BE), 0}},
+    {{COMB_D(0x27326510, 0xE418DAAD), COMB_D(0x31C73944, 0x625C8DDA), COMB_D(0x32B46D0D, 0x43030723), COMB_D(0x39A10292, 0xCFD15D0C), 0},
+     {COMB_D(0x1EF74176, 0x99961DEA), COMB_D(0xA0BA92F0, 0x175F71EE), COMB_D(0x33F788B2, 0x08F50113), COMB_D(0xFB83754A, 0x71A8271D), 0}},
+    {{COMB_D(0x60FFEE0C, 0x16898779), COMB_D(0x07F24F18, 0xF624C894), COMB_D(0xA3B4C6E6, 0x0ADC727D), COMB_D(0xBE61FBAE, 0x68229401), 0},
+     {COMB_D(0xE7C012BF, 0x634FE770), COMB_D(0x1B4108E0, 0xBC5336ED), COMB_D(0x68A1116B, 0x34E57C7E), COMB_D(0x39012BA1, 0xCD615837), 0}},
+    {{COMB_D(0x2C8CA159, 0xBD26C6AE), COMB_D(0x843D7F20, 0xCCCFC5A6), COMB_D(0x03349CE1, 0x81FBACAD), COMB_D(0xEB34EF6F, 0x656B250F), 0},
+     {COMB_D(0x66E79036, 0x0C299BCE), COMB_D(0xF50639F6, 0x4FF14D30), COMB_D(0x9B887542, 0x1E49DD7A), COMB_D(0xA64BFF59, 0xF0B88704), 0}},
+    {{COMB_D(0x00A5A2C3, 0xB7F335BB), COMB_D(0x0DFAF15D, 0x48AF3A1A), COMB_D(0x3C0A7831, 0xAAE1AE3A), COMB_D(0x4832590D, 0x8CDCA788), 0},
+     {COMB_D(0x9937352D, 0xECF2985C), COMB_D(0x069199D7, 0x18129BFB), COMB_D(0xD747E700, 0xD9875FCC), COMB_D(0x0707E099, 0xBFEC3698), 0}},
+    {{COMB_D(0xB1A8E69A, 0x03541F94), COMB_D(0xCE50F2C0, 0x3DFED107), COMB_D(0xE235CB04, 0xEDD8D48C), COMB_D(0x06DE6B81, 0xD14FF204), 0},
+     {COMB_D(0x5CA05CA3, 0xC4600A5E), COMB_D(0x00AA7AA4, 0xDD87634B), COMB_D(0xC00F85A4, 0x4817FB86), COMB_D(0xDAD5C91C, 0xC3977369), 0}},
+    {{COMB_D(0x8C944E76, 0x0FD59E11), COMB_D(0x3876CBA1, 0x102FAD5F), COMB_D(0xA454C3FA, 0xD83FAA56), COMB_D(0x1ED7D1B9, 0x332010B9), 0},
+     {COMB_D(0xA1011A27, 0x0024B889), COMB_D(0x05E4D0DC, 0xAC0CD344), COMB_D(0x52B520F0, 0xEB6A2A24), COMB_D(0x3A2B03F0, 0x3217257A), 0}},
+    {{COMB_D(0x0B25C598, 0xB315365B), COMB_D(0x4F9FBBF4, 0xA33802F1), COMB_D(0xF17BBAF7, 0xDF1000B7), COMB_D(0xD7F06111, 0x92ED176A), 0},
+     {COMB_D(0xE6D03F9E, 0xE9AED821), COMB_D(0x6479A7FB, 0xC3C2C608), COMB_D(0x4D4AD114, 0x833FE7D0), COMB_D(0x0633F165, 0x5DC730B9), 0}},
+    {{COMB_D(0xF20FC2AF, 0xDF1D043D), COMB_D(0xF330240D, 0xB58D5A62), COMB_D(0xFC7D229C, 0xA0058C3B), COMB_D(0x15FEE545, 0xC78DD9F6), 0},
+     {COMB_D(0x501E8288, 0x5BC98CDA), COMB_D(0x41EF80E5, 0xD046AC04), COMB_D(0x557D9F49, 0x461210FB), COMB_D(0x4AB5B6B2, 0xB8753F81), 0}},
+    {{COMB_D(0x9CDA05E2, 0x8618EDF1), COMB_D(0xD9BBBDF1, 0xDBF91167), COMB_D(0x210E5999, 0x5B3F7F24), COMB_D(0x5556C6A3, 0x3290E994), 0},
+     {COMB_D(0xDFA4617F, 0xFD9D9264), COMB_D(0x35F67E2C, 0xA4034316), COMB_D(0xE732B3C2, 0xA6F5D2C1), COMB_D(0x6384A08E, 0xB6D666F1), 0}},
+    {{COMB_D(0xB2D37DA4, 0x2DC58892), COMB_D(0xED936A9C, 0x03BDEB8D), COMB_D(0x13CA866A, 0x1F8ED30F), COMB_D(0xCEEDB9C0, 0xE07DE033), 0},
+     {COMB_D(0x88F742D4, 0x3E5135B4), COMB_D(0xF329DAA7, 0x0EC7D64C), COMB_D(0x0D463E11, 0x9A484A31), COMB_D(0x978E9348, 0x70CDDDCF), 0}},
+    {{COMB_D(0xC5D60AB4, 0x8939CA0B), COMB_D(0x95ADEBE4, 0x9378F406), COMB_D(0x097B65A7, 0x9718F642), COMB_D(0x93CB902B, 0x8EA4A221), 0},
+     {COMB_D(0xF072428C, 0x7B6D5FDB), COMB_D(0x7C4E4DBB, 0xE51424D6), COMB_D(0xEEEA7C18, 0x2DB584DF), COMB_D(0xD3B0DC0A, 0xE8141B67), 0}},
+    {{COMB_D(0xC42BB0BD, 0x8E33832B), COMB_D(0x3B6D0EF3, 0x82B2725C), COMB_D(0x85918AF4, 0x8CFC624B), COMB_D(0xDF895BD3, 0x8EE47C9B), 0},
+     {COMB_D(0x8BB5D0BB, 0xC15185F0), COMB_D(0x819D351A, 0x585C96B0), COMB_D(0x6A83828D, 0x154BE8DD), COMB_D(0x299C4DA5, 0xC36963D6), 0}},
+    {{COMB_D(0xEA4C1463, 0x289149A5), COMB_D(0xF3FCCCF2, 0xAC879905), COMB_D(0x2185DC73, 0xE13A9610), COMB_D(0xCD651AA7, 0xF3CF0208), 0},
+     {COMB_D(0xA481D874, 0x46927D66), COMB_D(0x6A9A3C39, 0x28198BBA), COMB_D(0xFC590FAA, 0x3F54042D), COMB_D(0x10DD490F, 0xB0EE6067), 0}},
+    {{COMB_D(0x9BAF4D7A, 0xAAC4170A), COMB_D(0x6DA147F0, 0x0D75821E), COMB_D(0x58E0A73C, 0x3879D7D8), COMB_D(0x86699898, 0xA60BCD77), 0},
+     {COMB_D(0xAE7CD4DA, 0x598A46EB), COMB_D(0x428DEDE8, 0x0187F877), COMB_D(0x32CA235D, 0x2AF12355), COMB_D(0xC0D84AEC, 0xA4B075F4), 0}},
+    {{COMB_D(0x48CED071, 0xD35D8953), COMB_D(0x867C3459, 0x7E1EEDBE), COMB_D(0x36DC5AD7, 0x1A074661), COMB_D(0x939EE1B7, 0x9E6861CB), 0},
+     {COMB_D(0x0E5E70EB, 0x5B609C5B), COMB_D(0xA8796969, 0x28282282), COMB_D(0xC617BAC6, 0x7BA8BB79), COMB_D(0x194A24F2, 0x152DAE15), 0}},
+    {{COMB_D(0x39F582C5, 0xDED33571), COMB_D(0x2B9A8ED7, 0x91F4FB95), COMB_D(0x0442464E, 0x82A3EF27), COMB_D(0xA7E35647, 0x87B3FAC1), 0},
+     {COMB_D(0x005BAD87, 0xA367DEA6), COMB_D(0x0F3CDD60, 0x019DA0DD), COMB_D(0x306F746A, 0xA59305FF), COMB_D(0x971F1ED8, 0xB2909721), 0}},
+    {{COMB_D(0x4511C44C, 0xB852CDD7), COMB_D(0xEB6BF1DD, 0x975B995D), COMB_D(0x2601F683, 0x572ADD8D), COMB_D(0x21121447, 0xD054B296), 0},
+     {COMB_D(0xF4F62401, 0x42CF0265), COMB_D(0x6467317B, 0xE3A79A2A), COMB_D(0xF04ED2D1, 0xAF927B35), COMB_D(0x8E96E1CF, 0x6534B5A1), 0}},
+    {{COMB_D(0x58ADB933, 0xAF4247B2), COMB_D(0x48CEBF9B, 0x0537352E), COMB_D(0x8DF30A42, 0x966FF1FA), COMB_D(0x239E0726, 0xE788E9C4), 0},
+     {COMB_D(0x5C6958A2, 0xD79B48B0), COMB_D(0x22272E55, 0x4E914E8E), COMB_D(0x191CBB75, 0x7E106A1F), COMB_D(0x4F8A6029, 0x5F71C539), 0}},
+    {{COMB_D(0x25B336A3, 0xF7158BEA), COMB_D(0x2C80A110, 0x27774720), COMB_D(0x14D2F6A4, 0x0A0B4413), COMB_D(0x13A5BEE3, 0x43D8D04A), 0},
+     {COMB_D(0x93B68C5F, 0xE4A44502), COMB_D(0x5DA5D14C, 0x364957B2), COMB_D(0x75168F8A, 0x26D8258C), COMB_D(0xB455E8A4, 0xEB43C098), 0}},
+    {{COMB_D(0x640614A3, 0xB1EBE50C), COMB_D(0x3F805476, 0x76ACAA65), COMB_D(0x69530604, 0x8B4D91FF), COMB_D(0x903BB9EA, 0x519859D3), 0},
+     {COMB_D(0x93A59E69, 0x9F5FAC7F), COMB_D(0x1DF54929, 0x390D8900), COMB_D(0x823DBA18, 0x8CE5FA33), COMB_D(0x5574F271, 0x2350281B), 0}},
+    {{COMB_D(0xF111B200, 0x0309488A), COMB_D(0x6DBA1852, 0xED2E78BE), COMB_D(0xA848D319, 0xC5F6A056), COMB_D(0xF1AE1709, 0x8C4B59C2), 0},
+     {COMB_D(0x757D507B, 0x881BD57F), COMB_D(0xD7DB6879, 0xED484551), COMB_D(0x0CE00C9C, 0x8529CC2B), COMB_D(0xFB339802, 0xEBD18AC3), 0}},
+    {{COMB_D(0x250C5AF3, 0x1FC78E0C), COMB_D(0x84EEB8E9, 0x04F7FDA9), COMB_D(0xA5A17E06, 0x9FFE80E6), COMB_D(0xDE96F184, 0x703285CF), 0},
+     {COMB_D(0xCCEABB01, 0x3FE41E6F), COMB_D(0x2F674547, 0x8724D28E), COMB_D(0x7BABF7E2, 0xB8BD6D72), COMB_D(0x0D6B8AB0, 0xFCBEF7CB), 0}},
+    {{COMB_D(0x9BE634CC, 0x19ABCAF5), COMB_D(0xC0EEBAC0, 0x02919487), COMB_D(0x9F1BFEDD, 0x3BD130B6), COMB_D(0x24DAB3A1, 0x22D625C1), 0},
+     {COMB_D(0x46AB327C, 0xB4206E3A), COMB_D(0x232D3373, 0x555042A3), COMB_D(0x8DDAE1B5, 0x0EB9EA81), COMB_D(0xBE1CF505, 0xCB9F9E6D), 0}},
+    {{COMB_D(0xE854E0A5, 0xCBCDAFE6), COMB_D(0xF1E98103, 0x43534D5A), COMB_D(0xA7273058, 0x340F393C), COMB_D(0x7329508C, 0x8CFD2794), 0},
+     {COMB_D(0xE715886A, 0x538E99CD), COMB_D(0x494D5A8F, 0x651E2938), COMB_D(0xE8E08261, 0x694B2061), COMB_D(0x0971A6FF, 0xC40BE3CA), 0}},
+    {{COMB_D(0x56643934, 0x455D0D81), COMB_D(0x10C24D59, 0x73F8FCEF), COMB_D(0xA612C437, 0xBB38A630), COMB_D(0x4EF9A80E, 0x92F1445E), 0},
+     {COMB_D(0xA9A648E2, 0x1EE44719), COMB_D(0x2F62FECA, 0x0D1DC166), COMB_D(0x69C3D990, 0x97178BA3), COMB_D(0xEC8A3AD8, 0x9FF67325), 0}},
+    {{COMB_D(0x7CE0D6AC, 0x90828F9A), COMB_D(0xB2BD1A02, 0x5C9531CE), COMB_D(0x5C1B4412, 0xBB10AB9D), COMB_D(0x387518CD, 0xAEEE4C0E), 0},
+     {COMB_D(0x87DE57CE, 0x98F368AA), COMB_D(0x21F57922, 0xBB92BE7A), COMB_D(0x65D54499, 0xF1744809), COMB_D(0x777B407C, 0xD9E3102D), 0}},
+    {{COMB_D(0x09D92A8E, 0xE746EAA6), COMB_D(0xFE861385, 0x5C0B2593), COMB_D(0x2696F3FF, 0x658B8EAF), COMB_D(0x896FCF1C, 0x1A3C51E1), 0},
+     {COMB_D(0x8D8E617E, 0xFC538F16), COMB_D(0x1CD3C38F, 0x610922E6), COMB_D(0x84C50345, 0xD6EAC1C9), COMB_D(0x61FF42C1, 0xA4205D21), 0}},
+    {{COMB_D(0x7B741B5D, 0x8230A9A6), COMB_D(0xF579DEB9, 0x8BF29BB9), COMB_D(0x39671277, 0x98FFD997), COMB_D(0x6DE16859, 0xF4FCB1E1), 0},
+     {COMB_D(0xC6B7A38D, 0xEA723B7F), COMB_D(0x77D3E0F2, 0xF4FB138F), COMB_D(0x9B478F3A, 0xA150FA04), COMB_D(0x5B961787, 0x69B0BEED), 0}},
+    {{COMB_D(0x66D0EECB, 0x1D842031), COMB_D(0xAFA9C66E, 0xA5AEDBC6), COMB_D(0x67515B87, 0xFAAD16D1), COMB_D(0xD827C8B4, 0x15840989), 0},
+     {COMB_D(0x5E1B7BB1, 0xC8A420ED), COMB_D(0x8EA03CAB, 0xDC28E5BD), COMB_D(0xFC4D874F, 0xD45188D7), COMB_D(0x2F661C17, 0xC22ECF90), 0}},
+    {{COMB_D(0xDCEAFEB7, 0x328FB9EF), COMB_D(0x3478E062, 0x311CB1F3), COMB_D(0xB7FBE79E, 0x03E042EA), COMB_D(0xFB0249AA, 0x28A8A8FB), 0},
+     {COMB_D(0x50B4BB44, 0xB8EE1B8B), COMB_D(0x0E540E9F, 0x3D152813), COMB_D(0x48E514E1, 0x09AA13A2), COMB_D(0x172F4633, 0x9C5FBC3E), 0}},
+    {{COMB_D(0xDD8D54F8, 0xA37CFBFE), COMB_D(0x7B03CDFE, 0xF8FFB4A9), COMB_D(0xCA347052, 0x24070DF5), COMB_D(0x0B659251, 0x99BF4616), 0},
+     {COMB_D(0xCE2E30D8, 0xEE44254B), COMB_D(0xA45C28FD, 0x415BA4F1), COMB_D(0xCC31D2BF, 0x5E8366AA), COMB_D(0x8E249AEB, 0x59B2F313), 0}},
+    {{COMB_D(0x8874151D, 0x56F93781), COMB_D(0x3B208CDA, 0x22891225), COMB_D(0x9F9F4B01, 0x53F5B5AF), COMB_D(0x60AAA403, 0x457C10BC), 0},
+     {COMB_D(0x52A2BDA0, 0x0300CD5E), COMB_D(0xE4503BB0, 0xA7436841), COMB_D(0xE34045FE, 0x7C7158C1), COMB_D(0xDCA8E0D7, 0x15AC62A9), 0}},
+    {{COMB_D(0xA423DC88, 0x9361CF42), COMB_D(0x25953391, 0xCA111DD0), COMB_D(0xCD1BF722, 0x4509733E), COMB_D(0x62A8F8A7, 0x5E552EAE), 0},
+     {COMB_D(0xA6A1A79C, 0x4DFB5704), COMB_D(0x215F2DE4, 0xA2ABC546), COMB_D(0xEE3EDE74, 0x4DCCA7D6), COMB_D(0xBBD935CD, 0x493ED75F), 0}},
+    {{COMB_D(0x228B7867, 0xAD8FBF6A), COMB_D(0x2B4DCCBA, 0x49F109D0), COMB_D(0x2EDEDDA5, 0x6CEA145C), COMB_D(0x33AE4C04, 0x052D7980), 0},
+     {COMB_D(0x487E1051, 0xDF1203AF), COMB_D(0x343ED3D8, 0x30C418F9), COMB_D(0x715AD94E, 0x0495EA86), COMB_D(0xC78A5AC5, 0xE945824B), 0}},
+    {{COMB_D(0x3680071A, 0x8C935E5F), COMB_D(0x7D764E91, 0xF58543C1), COMB_D(0x4DB687F0, 0xEE52DF5E), COMB_D(0x7EAD1E20, 0xFECF1D1D), 0},
+     {COMB_D(0x453CB994, 0x5FE9A684), COMB_D(0x1CA6C43F, 0xB65BB00A), COMB_D(0x99039A8A, 0xD51630D5), COMB_D(0x0CA741ED, 0x97C7D645), 0}},
+    {{COMB_D(0x614E1441, 0xF45BE76B), COMB_D(0xA5EF3EC0, 0x177D8E3D), COMB_D(0xE3662065, 0x45E70812), COMB_D(0x05D525AC, 0xA25EBC68), 0},
+     {COMB_D(0x11C3041B, 0x916E827A), COMB_D(0x7D5AB00A, 0x868BC04C), COMB_D(0x129F80B1, 0x1E80EA45), COMB_D(0x663C8854, 0x82AB5457), 0}},
+    {{COMB_D(0x0EA0EF30, 0xC4268106), COMB_D(0x9037B2F3, 0x9827ED70), COMB_D(0xC3DB4E2F, 0x583F6310), COMB_D(0x10A3F54B, 0x2AB10678), 0},
+     {COMB_D(0x7097DD2B, 0x706E16C5), COMB_D(0xD4770A89, 0xAF165242), COMB_D(0x9514515E, 0x370E1411), COMB_D(0xAD237305, 0x0DA518EF), 0}},
+    {{COMB_D(0x1F5BA028, 0x1C86789A), COMB_D(0x53C33FAB, 0xA557050D), COMB_D(0x41D49663, 0x401788B3), COMB_D(0x37FBF41E, 0xA1636F3B), 0},
+     {COMB_D(0x07763B95, 0x0F7B0609), COMB_D(0xBF50BC02, 0xACAA8D51), COMB_D(0xC2A5C173, 0x6E61B1C6), COMB_D(0xA9116C70, 0xF46A6605), 0}},
+    {{COMB_D(0x5999001A, 0x336F30C4), COMB_D(0x4D8B3C3B, 0x504B641A), COMB_D(0x3A1A5507, 0x31696B82), COMB_D(0x605A5FD0, 0xE650FE2B), 0},
+     {COMB_D(0xE45BCF34, 0x4624AD94), COMB_D(0x360522E1, 0x42FF1BCF), COMB_D(0x0EC6913B, 0x0583B20B), COMB_D(0x87004DDC, 0xA3E4A361), 0}},
+    {{COMB_D(0x94B476BC, 0xB029D3D7), COMB_D(0x355100CB, 0x8883A492), COMB_D(0x1C540464, 0x82E9A1DB), COMB_D(0xE35DF7EB, 0xDB0836B1), 0},
+     {COMB_D(0x2DB5A7F5, 0x6BA5DDB7), COMB_D(0x921BC05B, 0x72EF8A86), COMB_D(0xD697F63E, 0x8DDCD14F), COMB_D(0x0646FE17, 0x19352CE1), 0}},
+    {{COMB_D(0x63DFC0B7, 0x18AC6F86), COMB_D(0xE2FB9537, 0xD0531DE8), COMB_D(0x481EAF13, 0xD0136AE3), COMB_D(0xE01AF14A, 0x8E4BD2F7), 0},
+     {COMB_D(0x49EE4F9F, 0x88F974EC), COMB_D(0xD764A4C6, 0x92AEF323), COMB_D(0x443CB43F, 0x1E03AFA9), COMB_D(0xC0C7BF9E, 0x736E1021), 0}},
+    {{COMB_D(0x72F792D1, 0x9BB57932), COMB_D(0x1BED9845, 0x0514514C), COMB_D(0xA4EB06A6, 0x44C50CB7), COMB_D(0x8254B868, 0x4EFDCEDD), 0},
+     {COMB_D(0x47BB74D9, 0xC9DADADE), COMB_D(0x2D48E4EC, 0xB3D95615), COMB_D(0xADFC9CF1, 0xC15AA29F), COMB_D(0x0CBA2046, 0x78462B89), 0}},
+    {{COMB_D(0x9B0D9ABB, 0x479F4BFE), COMB_D(0x3E790D21, 0x5E3C4768), COMB_D(0xA3AD44CD, 0x375C643C), COMB_D(0x9DFBBB65, 0x6AC0DC43), 0},
+     {COMB_D(0xDA6FFB79, 0x55C762EC), COMB_D(0x12294F31, 0xDE78A5E1), COMB_D(0x0AE22C68, 0x4D704863), COMB_D(0x61114035, 0x6C18C02E), 0}},
+    {{COMB_D(0x2360D888, 0xD96DD1ED), COMB_D(0x1B99CC55, 0x0A936C6B), COMB_D(0x4372A3F5, 0x8609F93F), COMB_D(0x0AFC214A, 0x4DC993C4), 0},
+     {COMB_D(0xBA08D6C7, 0xA6BF396F), COMB_D(0xA6D44568, 0xAF2235E2), COMB_D(0xE3E1C378, 0xBDEC43ED), COMB_D(0x00B80A92, 0xD9CA7E1D), 0}},
+    {{COMB_D(0x06750A2A, 0xC7AB8183), COMB_D(0x042DD3D6, 0x97F4EB7B), COMB_D(0x4CC4D792, 0x3D0EFA7A), COMB_D(0xFF36E487, 0xD9793753), 0},
+     {COMB_D(0x104DFF63, 0x4E06E132), COMB_D(0x9773AE26, 0x6D1706FE), COMB_D(0x97299181, 0x3FFEBB01), COMB_D(0x59006DC6, 0xDFC694FF), 0}},
+    {{COMB_D(0x2FFBCF19, 0xDC0B1061), COMB_D(0x846730AD, 0x139AD48C), COMB_D(0xCBBD5F20, 0x12CA3C26), COMB_D(0xEBC3D35E, 0x8855A59A), 0},
+     {COMB_D(0x18644A97, 0x5B93E742), COMB_D(0x0DA658F5, 0xF8F4BE3A), COMB_D(0x4B3C3785, 0x3FE32589), COMB_D(0x5290BEC1, 0x61CE3030), 0}},
+    {{COMB_D(0xE6FAD49D, 0x3DF40F6F), COMB_D(0x885DD6DF, 0xCCA526F5), COMB_D(0xC0B00E7C, 0x4A1807A1), COMB_D(0x3FECD70B, 0x3404D5A1), 0},
+     {COMB_D(0xE77BFE48, 0x6782D8D7), COMB_D(0x54AB18C9, 0x7155EC7D), COMB_D(0x77CDB71F, 0xB3202407), COMB_D(0x8441556C, 0x67BA5604), 0}},
+    {{COMB_D(0x38694E01, 0xE9D78DD4), COMB_D(0xF84FBBFB, 0xB58C2F9B), COMB_D(0x3BD303D3, 0xA234C73F), COMB_D(0x82396BE5, 0xFF16883F), 0},
+     {COMB_D(0x56ECF3FD, 0xE886DF4E), COMB_D(0xCAD118BD, 0x817255A6), COMB_D(0xBA6926BA, 0x1AA338DB), COMB_D(0x2A677961, 0xAA1981FF), 0}},
+    {{COMB_D(0x75A1590C, 0x05F4CC58), COMB_D(0x43F076BC, 0xA69F58C8), COMB_D(0x8ADA939B, 0x79786C3A), COMB_D(0x3A758D61, 0x95A50C0A), 0},
+     {COMB_D(0x22348461, 0xBA2155EF), COMB_D(0x5985F593, 0xEBFE41AD), COMB_D(0xADFFAD55, 0x91FB5CF7), COMB_D(0xB8891ADC, 0xE54E241C), 0}},
+    {{COMB_D(0x18115178, 0x24FC05CD), COMB_D(0x2C73FD44, 0x092D97BE), COMB_D(0x5B5A8CBA, 0x2BEBB106), COMB_D(0x017CC283, 0xEE17D82A), 0},
+     {COMB_D(0x19974730, 0x42EE8FDB), COMB_D(0xF16121E8, 0x89433E44), COMB_D(0x760EAAD5, 0xA2FF19E7), COMB_D(0xD71A2864, 0xA1EC8CAA), 0}},
+    {{COMB_D(0x26F1CAF3, 0x7F42A1BF), COMB_D(0xCABD266E, 0x82F27586), COMB_D(0x0971375B, 0x6AF484F4), COMB_D(0xABF356CC, 0x0A43E6FA), 0},
+     {COMB_D(0xC7B50396, 0x91C5E0F8), COMB_D(0xBAF618FE, 0x3A8EFAC5), COMB_D(0xCB21FE99, 0x15A2316F), COMB_D(0x1565CA3B, 0x0F2635D3), 0}},
+    {{COMB_D(0x01BABF6D, 0x79FB664D), COMB_D(0xA14B4AB5, 0xB9659AA1), COMB_D(0x6FE4C1BD, 0xB64DAA60), COMB_D(0xEA4B209D, 0x938EDB85), 0},
+     {COMB_D(0xE322AF73, 0x3290B2F4), COMB_D(0x4BACDED7, 0x292AF72E), COMB_D(0xF01824E4, 0xB1E09D85), COMB_D(0x485C0038, 0xCAA001B1), 0}},
+    {{COMB_D(0x954E5FA8, 0x7C092020), COMB_D(0x06591EC9, 0x99A7318D), COMB_D(0xC3506151, 0x6FC3EA5B), COMB_D(0xCFB13598, 0xDA3E40C7), 0},
+     {COMB_D(0xB447CC06, 0x826F6EB1), COMB_D(0xB9176BE6, 0xCC4B15BB), COMB_D(0x0204E321, 0xC61599EC), COMB_D(0x66512CBD, 0x4E9FCE6B), 0}},
+    {{COMB_D(0xF59CA041, 0x6891EA5A), COMB_D(0xAC0D2CC0, 0x5A12F3C8), COMB_D(0x2F827232, 0xEFADECB4), COMB_D(0x743A048F, 0xC3A86505), 0},
+     {COMB_D(0xD0154838, 0xF9AA9765), COMB_D(0xA548E7EC, 0x11FEDB76), COMB_D(0x10A67ED6, 0x61E77C87), COMB_D(0xA4394D9E, 0x5E165BE4), 0}},
+    {{COMB_D(0x2798852B, 0x012DDF9F), COMB_D(0xD5539BE9, 0xBF4FCB96), COMB_D(0x198A79B9, 0xB08C6B69), COMB_D(0xE23BD3CB, 0xA37060D9), 0},
+     {COMB_D(0xCC7F52C9, 0x68A6A401), COMB_D(0xDF697F4B, 0x57091704), COMB_D(0xC429B0B8, 0x7514ABBE), COMB_D(0x9DFD8B3F, 0x3212CA5B), 0}},
+    {{COMB_D(0x4C82A438, 0x84A74D26), COMB_D(0x94FC7759, 0xDC49FEEE), COMB_D(0xA604D0CA, 0x73AF33A7), COMB_D(0xA2028CC5, 0x99993F69), 0},
+     {COMB_D(0x06D21477, 0x733D26C8), COMB_D(0x97EA2867, 0x3704942E), COMB_D(0x26FD5FB5, 0xF123FE2D), COMB_D(0x19D166CC, 0x62C4C70E), 0}},
+    {{COMB_D(0x4AF25CE1, 0xABBFE286), COMB_D(0xA53341C7, 0xFCDEED1A), COMB_D(0xCB1D3464, 0xCD20E76D), COMB_D(0x56DECF3E, 0x4AB23D35), 0},
+     {COMB_D(0xDD832027, 0xE524AAFB), COMB_D(0xEE102BE5, 0x05A43863), COMB_D(0xF9A6BFFA, 0xD463F935), COMB_D(0xC49EAE38, 0x44F43B95), 0}},
+    {{COMB_D(0x59E60BD8, 0x8B894F9B), COMB_D(0x77C0A893, 0xB510A245), COMB_D(0xF6133DED, 0xAC45E9F3), COMB_D(0x7F88FC4E, 0x7E0A7BBA), 0},
+     {COMB_D(0x8C615DAA, 0x751BB0FD), COMB_D(0x64BA7615, 0x5623E6E8), COMB_D(0xF6BF0161, 0x4BD8DEAC), COMB_D(0x68C635F0, 0x3997B513), 0}},
+    {{COMB_D(0x8D15F49D, 0xE7753698), COMB_D(0xB1D6F20C, 0x166245DD), COMB_D(0x998AC40B, 0x92EEA7B3), COMB_D(0xE5C81E0B, 0x0C3C0922), 0},
+     {COMB_D(0xF65CA633, 0x85A9E76A), COMB_D(0x2779B4B3, 0x88A56ACD), COMB_D(0x405BA189, 0xEEFB0C07), COMB_D(0x6591E281, 0xA7D62D55), 0}},
+    {{COMB_D(0x48C896D1, 0x6BD408B4), COMB_D(0x47CE08A1, 0x9C6BAF95), COMB_D(0x4F4DDCE9, 0xA887EEBC), COMB_D(0x0447F868, 0xAE7398D9), 0},
+     {COMB_D(0xB70895FE, 0x9CBAA537), COMB_D(0xDC935601, 0xE15EFF33), COMB_D(0x035C1D08, 0xA2A7C433), COMB_D(0x5F37CCEF, 0xF0FB4CAC), 0}},
+    {{COMB_D(0xF5A4AA87, 0xA47C229B), COMB_D(0x19DC19B9, 0x1136EE1B), COMB_D(0x1D5DED4C, 0x51E08C26), COMB_D(0x41AB4614, 0x4F85D804), 0},
+     {COMB_D(0xF02DD1D4, 0x738106CA), COMB_D(0x20CC8FF4, 0x2AB68AFF), COMB_D(0xC1C053E7, 0x3C3CE367), COMB_D(0x48517644, 0x33F9E08D), 0}},
+    {{COMB_D(0x1E3081AB, 0xB7F6BE1F), COMB_D(0xD7768C94, 0x0D8A6FB0), COMB_D(0x70E00C75, 0x31905283), COMB_D(0xA176C395, 0xAE64D738), 0},
+     {COMB_D(0x9E5850BC, 0x1FA3578C), COMB_D(0x087565CE, 0x611FE506), COMB_D(0x51AB984B, 0x9FEEEA5C), COMB_D(0x9EBDEC88, 0x947B45F1), 0}},
+    {{COMB_D(0x587C5DA0, 0xB792FBEC), COMB_D(0x5986356B, 0xEE9E8ACB), COMB_D(0xFAA63B4D, 0x24E55C73), COMB_D(0xCEFB8440, 0x4C985649), 0},
+     {COMB_D(0x1C20FE34, 0x540926DF), COMB_D(0x6204487E, 0x79C38DE9), COMB_D(0x7B5348A9, 0x5881270E), COMB_D(0xA40C8BAF, 0x0767A863), 0}},
+    {{COMB_D(0x4F0EC8F0, 0xDC53717D), COMB_D(0x42FC6006, 0xEBB3B85E), COMB_D(0x95F962D2, 0x067977FF), COMB_D(0x6194BDD5, 0xD50AE583), 0},
+     {COMB_D(0x76C2178C, 0x2C4FA8AA), COMB_D(0x35277D4F, 0x3ABF1768), COMB_D(0x4A22DB58, 0xE5E8D851), COMB_D(0xAF64998D, 0xBF903362), 0}},
+    {{COMB_D(0xC3C2B412, 0x7FBEF628), COMB_D(0xA69C7756, 0x0008ABB4), COMB_D(0x3F52438E, 0xDD3A1376), COMB_D(0x3A6F4C49, 0x7688A086), 0},
+     {COMB_D(0x8DCA1641, 0x126F5476), COMB_D(0x7DE645CE, 0x5E790B59), COMB_D(0x5B51A327, 0x45125197), COMB_D(0x796ABA23, 0xF79973FB), 0}},
+    {{COMB_D(0x06129252, 0xB78A0575), COMB_D(0x6CB9019D, 0x031E9F63), COMB_D(0x03928544, 0x01F22992), COMB_D(0xDA7FA95F, 0x6ECA6194), 0},
+     {COMB_D(0x5ABF16BB, 0x6346268C), COMB_D(0xAC24E560, 0x8EC5DCA6), COMB_D(0x72889D45, 0xBC92BC35), COMB_D(0x2C2EFEDB, 0xBBD19859), 0}},
+    {{COMB_D(0x89EB1B96, 0xD347FECA), COMB_D(0xC8C78F4F, 0xCDA31E4A), COMB_D(0x9948CC8C, 0x9B5EBEE5), COMB_D(0x56952543, 0x6F69B457), 0},
+     {COMB_D(0x6A3B3EF7, 0xDAA7367A), COMB_D(0x2BECF2D4, 0x3EAE86CD), COMB_D(0x663509A6, 0x8A9BCB17), COMB_D(0xC670543E, 0xBBBBC36E), 0}},
+    {{COMB_D(0x7B292496, 0x28BC89E8), COMB_D(0xB1AC125E, 0x376DE4AD), COMB_D(0x4736603B, 0xF591522E), COMB_D(0x9C2C6267, 0x7C775B6B), 0},
+     {COMB_D(0xCA91DE65, 0x8E2A143B), COMB_D(0x2A626E93, 0xDC7AB49B), COMB_D(0x86320365, 0xE7FBC78F), COMB_D(0x9DDCADC5, 0x6DF16F90), 0}},
+    {{COMB_D(0x4131BFD0, 0x9099B9C9), COMB_D(0x3BF11E70, 0xEB850DDA), COMB_D(0x422705C3, 0xB34F5321), COMB_D(0x21BA3C52, 0x082E4D79), 0},
+     {COMB_D(0x76A27C83, 0xE427EBE9), COMB_D(0x2E1D8CD4, 0x5EEB87B8), COMB_D(0xECFAA6E5, 0x72955119), COMB_D(0xA2D7916C, 0x077CBC91), 0}},
+    {{COMB_D(0x8CBE4D6E, 0x3581C6CD), COMB_D(0x5F07093E, 0xFD43F5EC), COMB_D(0x2FFF27F8, 0xB1571512), COMB_D(0x3D5929B3, 0x976D2D4B), 0},
+     {COMB_D(0x171DC0C2, 0x00B64B81), COMB_D(0x36F4B114, 0xF03FCD1E), COMB_D(0x11451B78, 0x97A014F4), COMB_D(0x277FA77B, 0xB73F2090), 0}},
+    {{COMB_D(0x6FCDE854, 0xAF5CAB24), COMB_D(0xD4E8AA74, 0x467A04B7), COMB_D(0x14D14D59, 0x7BCF3D2C), COMB_D(0xC56D84F7, 0xA0ABCAAE), 0},
+     {COMB_D(0x937608B1, 0xE9EC1DD7), COMB_D(0xDF5054EB, 0x867114F6), COMB_D(0x6B013BC5, 0x6DDF93A6), COMB_D(0x5BFF4F05, 0xDD3E48FC), 0}},
+    {{COMB_D(0xA6874DA5, 0xE8EB9FA6), COMB_D(0x8717F1D9, 0x5D53D5D9), COMB_D(0x7255DC15, 0xE775420A), COMB_D(0x71CD2638, 0xD119777E), 0},
+     {COMB_D(0xED636262, 0xACA9FC16), COMB_D(0x5171C1F7, 0x6937763B), COMB_D(0x1BF18C1D, 0x037EC77B), COMB_D(0x63B482DE, 0xBF3B8213), 0}},
+    {{COMB_D(0x0BC91E66, 0x7D6DE321), COMB_D(0xFAE8DD8F, 0x7469772E), COMB_D(0x61EAA825, 0x4EF060B6), COMB_D(0xF46BAD95, 0xDDB31399), 0},
+     {COMB_D(0x92708587, 0xC21213C9), COMB_D(0x11D287D0, 0x7D09EB1C), COMB_D(0xA79815D8, 0x6EA52F68), COMB_D(0xB54BB792, 0xEDDB10A7), 0}},
+    {{COMB_D(0x2D7C4576, 0x636D0AE6), COMB_D(0x4B387E0B, 0x7FCBEEEC), COMB_D(0xA3F9A9D0, 0x103707CB), COMB_D(0xD20DA011, 0x1398A20C), 0},
+     {COMB_D(0xFD1FAC78, 0x77BB0455), COMB_D(0x5CC544D7, 0x8AFBE9CE), COMB_D(0x15846D91, 0x78BACA74), COMB_D(0x30271D42, 0x4901DD7D), 0}},
+    {{COMB_D(0xEE0AF6DF, 0x4B037401), COMB_D(0x55CD3618, 0xF4B85D2D), COMB_D(0x4EA35646, 0x493FB0DC), COMB_D(0xADFCEAF6, 0x81BD0405), 0},
+     {COMB_D(0x342DF99F, 0x5B1DDF0D), COMB_D(0x2FE483A7, 0x605D3BB9), COMB_D(0xDAADD46A, 0x639E33D9), COMB_D(0x9B4DAAB1, 0x91623D28), 0}},
+    {{COMB_D(0xE7980BD9, 0x03C5178A), COMB_D(0x4A5ED035, 0x72F35B9C), COMB_D(0x5C0945C0, 0x32ED344C), COMB_D(0xDCD9F5EB, 0x92A40B28), 0},
+     {COMB_D(0x58D2FB9B, 0x51E6C89A), COMB_D(0x3F2BBAF8, 0x75DDBBBA), COMB_D(0x4AB9791C, 0xFFB0A284), COMB_D(0xE12EC09A, 0x7BAD9A46), 0}},
+    {{COMB_D(0x048DF69B, 0x0B89D4BD), COMB_D(0x222888EF, 0xB70FBA85), COMB_D(0x44A0C5F6, 0xCCE017F6), COMB_D(0xEBC469D8, 0xC264855C), 0},
+     {COMB_D(0xB6420B9D, 0xD7CB56BB), COMB_D(0x24F72349, 0xEA5F6AEC), COMB_D(0xE35956D8, 0x86EFE6A9), COMB_D(0xBAE5FB78, 0x4B12634F), 0}},
+    {{COMB_D(0x1BCB36A5, 0x7BCA0BC1), COMB_D(0xDADF6DCE, 0xC6AD55F1), COMB_D(0x9DE1E8E7, 0x6080E0F8), COMB_D(0x681D6BE2, 0xB2567AC5), 0},
+     {COMB_D(0xDEB1EDD4, 0x763F4FCB), COMB_D(0x2A6A766E, 0xE58790F1), COMB_D(0x263F2166, 0xCF14E1B0), COMB_D(0x1DFCAB92, 0xC48087F3), 0}},
+    {{COMB_D(0xC0C38D52, 0x778189C5), COMB_D(0x68F81BC5, 0xA201226F), COMB_D(0x890E8BA3, 0x35E974BA), COMB_D(0xB6634418, 0x9B23A1D3), 0},
+     {COMB_D(0x7CDE9E81, 0xDA3B7AF3), COMB_D(0xD7E854A2, 0x6CA457E4), COMB_D(0x6D2992BC, 0x8E7A3D5E), COMB_D(0xC85B3262, 0xD1DA4558), 0}},
+    {{COMB_D(0x32FB658A, 0xEE5DF4EB), COMB_D(0x9C82E929, 0x75A1AEA2), COMB_D(0x5079DA88, 0x90638F38), COMB_D(0xAC9D5B23, 0x5A2CC1F6), 0},
+     {COMB_D(0x4C315413, 0xA4B6436B), COMB_D(0x183B4444, 0xE22C0B32), COMB_D(0xFFD20056, 0x81769921), COMB_D(0x6CBB0B44, 0x8DBB9503), 0}},
+    {{COMB_D(0x61F97D99, 0xDE1300A9), COMB_D(0x41841225, 0x83953873), COMB_D(0x9F249E32, 0xDB0C465C), COMB_D(0xEFA5CEED, 0xDC2447BE), 0},
+     {COMB_D(0x9AB30D9A, 0x6C191D51), COMB_D(0xDBF4DDED, 0x9005B6A4), COMB_D(0x90BD6B03, 0x00E670FE), COMB_D(0x2B961781, 0xC8EFD72E), 0}},
+    {{COMB_D(0x02AC3618, 0x96409EB3), COMB_D(0xA9040E46, 0x4AC5731B), COMB_D(0x00744FB8, 0x80E8987A), COMB_D(0x37B726D8, 0xC571FB67), 0},
+     {COMB_D(0x2AD96A5A, 0x7D57D0F1), COMB_D(0xDC59D323, 0x0A8EF52A), COMB_D(0xA9E01754, 0x751B6BEB), COMB_D(0xBF0DF92F, 0x49E1C809), 0}},
+    {{COMB_D(0xE86E9A3D, 0x39F81C9E), COMB_D(0xB47A9004, 0x7783946A), COMB_D(0x72BA430F, 0x541CB355), COMB_D(0x5B8EE3FA, 0xAC3FDF37), 0},
+     {COMB_D(0xDF371FDA, 0x635AE687), COMB_D(0x75429F37, 0xD30BC7D3), COMB_D(0xC0D58D9B, 0x0A90FB23), COMB_D(0x59575436, 0xAC1D5E95), 0}},
+    {{COMB_D(0xB5D21D64, 0x0C6CE683), COMB_D(0xEAA6F725, 0x08076B0A), COMB_D(0x081D887C, 0x8646FBEC), COMB_D(0x9CBA423E, 0x5AF13FF5), 0},
+     {COMB_D(0x9BB2FC49, 0xF54FC3C0), COMB_D(0x79F37273, 0x26C5C719), COMB_D(0x05AF002F, 0x15CDF0AE), COMB_D(0x7562190A, 0x2AA017E0), 0}},
+    {{COMB_D(0x64777EFC, 0x05A0AF19), COMB_D(0xC3CDA2ED, 0x6292AC20), COMB_D(0xF25592E5, 0x640D9419), COMB_D(0x5308B91D, 0xB4BB2E1F), 0},
+     {COMB_D(0xBC5D3721, 0xBF1444CE), COMB_D(0xE4B6BD8C, 0xED42874A), COMB_D(0x2D50B9AF, 0xABAE0290), COMB_D(0x6B64BF26, 0x47C018AB), 0}},
+    {{COMB_D(0x580E9C32, 0xB376CE56), COMB_D(0x7D700EE2, 0x9FD6E193), COMB_D(0x12BD427A, 0x1EEC566B), COMB_D(0xE9F73A45, 0x61EA45A6), 0},
+     {COMB_D(0x55617AA8, 0x08490971), COMB_D(0x4A5AA3AB, 0xDBCA1AD2), COMB_D(0x58BEB1A6, 0x8384B6AC), COMB_D(0x76323EE2, 0x07E4444C), 0}},
+    {{COMB_D(0xE88F54D3, 0x0C4A3B64), COMB_D(0xF7615B0D, 0xCE1C832D), COMB_D(0x2F67ADB0, 0x973D58FE), COMB_D(0xB2871E1C, 0xC3CEF173), 0},
+     {COMB_D(0xED83D2A2, 0x7A97569E), COMB_D(0xD11912B4, 0xAB59D53A), COMB_D(0x10764C79, 0xA435918D), COMB_D(0xCA537A69, 0xEF2764C3), 0}},
+    {{COMB_D(0x94D56BC8, 0x90125DEE), COMB_D(0xB531F3B8, 0xE778A787), COMB_D(0x3BD55133, 0xAF58F361), COMB_D(0xFE17E49F, 0xE15C70E5), 0},
+     {COMB_D(0xDD93B546, 0xC6F1D920), COMB_D(0x0C5FF33B, 0x36CCB9F9), COMB_D(0x43ACA5E6, 0x28F1575F), COMB_D(0xA55B4F60, 0x5C274AD0), 0}},
+    {{COMB_D(0x5A6FDA9D, 0x06589232), COMB_D(0x967F03D6, 0x560E6363), COMB_D(0x8913E989, 0x6176FE56), COMB_D(0xACB44D40, 0x543DB0EF), 0},
+     {COMB_D(0xAB0E252A, 0x8E895B40), COMB_D(0xAB32C974, 0xD42959E6), COMB_D(0xBC3F7E15, 0x44A05AD1), COMB_D(0x65271BA1, 0x6511572E), 0}},
+    {{COMB_D(0xFCF99E08, 0xBCD91C45), COMB_D(0xEF84F18B, 0xACA75397), COMB_D(0x15464F30, 0x6E525D1F), COMB_D(0x0D216A15, 0x425D091F), 0},
+     {COMB_D(0x1F87DCAF, 0x0AC21D69), COMB_D(0xAAB24306, 0x67416519), COMB_D(0x1768A8B8, 0x7F5D18F8), COMB_D(0xCE3E7C99, 0xC40A8C75), 0}},
+    {{COMB_D(0x4F31F586, 0x37B6D3EE), COMB_D(0x4F6A0343, 0x74AC2BE8), COMB_D(0x6CB479F4, 0xC47589CC), COMB_D(0x34F06E15, 0xC8DEA1B6), 0},
+     {COMB_D(0xE091B4DD, 0x053E171B), COMB_D(0x6989FD6D, 0x240FDD1F), COMB_D(0xDE25A063, 0x9FF2123F), COMB_D(0x0E04BCC9, 0x513A6DA1), 0}},
+    {{COMB_D(0x64981B01, 0xE9343616), COMB_D(0x90502CBC, 0xCB86E631), COMB_D(0x44E595EC, 0x86A5DEFC), COMB_D(0x5684A676, 0xC5F1C69E), 0},
+     {COMB_D(0xE4B9D8CF, 0xC2D85A87), COMB_D(0xA9CD9009, 0x5CCD436B), COMB_D(0x33195343, 0x3D913783), COMB_D(0x949349C5, 0x0AC25661), 0}},
+    {{COMB_D(0x2BE3F5F5, 0x564EFA22), COMB_D(0xC5F4CEF5, 0x1EE27DEB), COMB_D(0x3B239E56, 0x0E25BD0D), COMB_D(0xDAF3F4F1, 0x9BF10706), 0},
+     {COMB_D(0x788294B5, 0x5B919A7D), COMB_D(0x1BC79C9E, 0xBF83CB15), COMB_D(0xE0642403, 0x1E312DCB), COMB_D(0x7FFA38DF, 0x051194CD), 0}},
+  },
+  { /* table 1 */
+    {{COMB_D(0x2DB2E35F, 0x12D0441B), COMB_D(0x190D0B71, 0x0D6A564C), COMB_D(0x87FFD152, 0x8603ED61), COMB_D(0x34A2D4A3, 0xB0091659), 0},
+     {COMB_D(0xB424E784, 0x5E93B146), COMB_D(0xE7D766B9, 0xDEDDD81D), COMB_D(0x2BCA7104, 0x6E777FC0), COMB_D(0xBEAAED6A, 0x53A1E3C2), 0}},
+    {{COMB_D(0x258FCA6C, 0x4D9AEFBD), COMB_D(0x1EFE47B2, 0x73B95775), COMB_D(0x32CA9F0D, 0x41BC43DC), COMB_D(0x0FBC341C, 0x8C669D76), 0},
+     {COMB_D(0xED3B6EA9, 0xD3E71CA0), COMB_D(0x950B069E, 0x200A9FF1), COMB_D(0xE4014B1D, 0x4957D3D3), COMB_D(0xBD802263, 0x2F360E3F), 0}},
+    {{COMB_D(0x52998A00, 0x1E183285), COMB_D(0xF777510C, 0x9B4C8091), COMB_D(0xBA4814ED, 0x11CECF16), COMB_D(0xE14BC3B7, 0x480CE7BD), 0},
+     {COMB_D(0x8E8C5116, 0xFD04F189), COMB_D(0xB752A056, 0x63311475), COMB_D(0x8EB87C3B, 0x1703155A), COMB_D(0xDC0FB4C9, 0x6044FE64), 0}},
+    {{COMB_D(0x60AAFAD1, 0x70AAE231), COMB_D(0x5194B852, 0x79F96B7C), COMB_D(0x85F24823, 0x9267756F), COMB_D(0x1D35C969, 0x9761E3F2), 0},
+     {COMB_D(0x5867063A, 0xCCD6AC71), COMB_D(0xEDF58AA4, 0x729A66F1), COMB_D(0x1D660AB6, 0x22EBF810), COMB_D(0xC7226CB6, 0x2DF60823), 0}},
+    {{COMB_D(0xF101F143, 0xB56DC180), COMB_D(0x1A3EE7D0, 0x10D97908), COMB_D(0xD26119F9, 0x3D143ECA), COMB_D(0x40172BFD, 0x4C0C61DD), 0},
+     {COMB_D(0x1A85714C, 0x85D3EB7E), COMB_D(0x7D215994, 0x6D88FCCC), COMB_D(0x9FD0A41C, 0x38B437C9), COMB_D(0xD41A64D9, 0x82A43B85), 0}},
+    {{COMB_D(0x287CA5FA, 0xA3715B6D), COMB_D(0xCEBD9143, 0xB3684CA4), COMB_D(0x7CD2CDCD, 0x0FD820CA), COMB_D(0x68CCB748, 0x42686EB2), 0},
+     {COMB_D(0xACEDC96A, 0x7D764F49), COMB_D(0x45378010, 0xCDC9A531), COMB_D(0x4C213EE4, 0xE7611C90), COMB_D(0x0C18CA1E, 0x85F035C5), 0}},
+    {{COMB_D(0x2851FBFE, 0x92347746), COMB_D(0xF10F7C6C, 0x8E4998B4), COMB_D(0x6D626143, 0x7F3D8A46), COMB_D(0x05C522BF, 0x5A157C92), 0},
+     {COMB_D(0xBCA69291, 0xA56FCFDD), COMB_D(0xD417CD74, 0x967707CF), COMB_D(0xEED61F5B, 0xAF8133EA), COMB_D(0xE64FE7CE, 0xFFE9C48D), 0}},
+    {{COMB_D(0xC739A5EA, 0x3ECCA7E0), COMB_D(0xA7D2C98F, 0x6743333E), COMB_D(0x0FEF6335, 0x224D9428), COMB_D(0x7EF2EE3C, 0x5C792A0C), 0},
+     {COMB_D(0x302B22DD, 0x552AC094), COMB_D(0x81B21450, 0xDFBD3D20), COMB_D(0xA4F67F51, 0xD5E609DB), COMB_D(0xAFB68627, 0x30ACC011), 0}},
+    {{COMB_D(0xEE13CF7F, 0xBCFD228D), COMB_D(0x72776C47, 0xF0C3C32B), COMB_D(0xE235FB9B, 0xFC818B96), COMB_D(0xF209B078, 0xD546CBE7), 0},
+     {COMB_D(0x7FF23D88, 0x74010A60), COMB_D(0xC1C6EC5A, 0x4C2FC9D9), COMB_D(0xF5668DE9, 0xDE4F3995), COMB_D(0x9C40A04A, 0xC590B687), 0}},
+    {{COMB_D(0x7B6FB5A5, 0x94AB3B41), COMB_D(0xDA665D9A, 0x48647506), COMB_D(0xBC849981, 0x3060BF77), COMB_D(0x93725988, 0xCDE80D6F), 0},
+     {COMB_D(0x3E102962, 0x75DD5E00), COMB_D(0x83405437, 0x65ED5619), COMB_D(0xF9C262C2, 0xFE1810A2), COMB_D(0xC41454F3, 0x100E2708), 0}},
+    {{COMB_D(0x5B249CC0, 0x203026D5), COMB_D(0xC67EDF6A, 0x14D23F38), COMB_D(0xFF1F9BCE, 0xF9800ECF), COMB_D(0x84EB3F24, 0x2E195DBA), 0},
+     {COMB_D(0x4AEEB956, 0xB0C2A8F6), COMB_D(0xE1395700, 0x77E3B377), COMB_D(0x5D89F43D, 0x8994CC3E), COMB_D(0x73119E6E, 0x5C703AB5), 0}},
+    {{COMB_D(0x3DEB26DB, 0xCA7A713C), COMB_D(0xE5746E5B, 0xE26DF19A), COMB_D(0x26172B96, 0x830FB5E5), COMB_D(0xCEC15AB1, 0x94FB9621), 0},
+     {COMB_D(0xFC6FE536, 0xA3B451DB), COMB_D(0x7C9CAFEA, 0x3F57454D), COMB_D(0x98F55904, 0xCFFB3C13), COMB_D(0x7ADD2692, 0x25EF660C), 0}},
+    {{COMB_D(0x45037D0D, 0xC6E9C730), COMB_D(0x2FAB6DD4, 0x171A0F4F), COMB_D(0xA70D00E2, 0xED43A473), COMB_D(0x0B9301FF, 0x666F5DDA), 0},
+     {COMB_D(0x8B3B0191, 0x812D6DFA), COMB_D(0x6E2A48B6, 0xB20EDCD9), COMB_D(0x786EE725, 0x61503623), COMB_D(0x4BEFDFF9, 0xBCF76A44), 0}},
+    {{COMB_D(0x1729F090, 0x2D6E4578), COMB_D(0x76BCF747, 0xE08CD641), COMB_D(0xE5611F32, 0x620079CA), COMB_D(0xB16419CD, 0x343BBAB8), 0},
+     {COMB_D(0xFD106F44, 0x7F726CB5), COMB_D(0x8FAC99CD, 0x8A91C698), COMB_D(0x9226368E, 0x060E1EA6), COMB_D(0x41C6523C, 0x10905B2F), 0}},
+    {{COMB_D(0xDFADC3E8, 0xF8C439FA), COMB_D(0xE0527518, 0x83AEE1BC), COMB_D(0x81476368, 0x7D1F1467), COMB_D(0xB2AFFE49, 0xEA4B8F97), 0},
+     {COMB_D(0xDEDD7CC9, 0x7A69E33B), COMB_D(0xDE4CDA01, 0x8651AB82), COMB_D(0x55526970, 0x258FDA49), COMB_D(0xB9161A95, 0xBB456DA9), 0}},
+    {{COMB_D(0x741145C1, 0x44CD3397), COMB_D(0xDC34C106, 0x19515EB5), COMB_D(0x89386CF2, 0xB5156DED), COMB_D(0x73BAFF04, 0x19EDA723), 0},
+     {COMB_D(0x41EF2A13, 0x9ADCB8E4), COMB_D(0x779EF92C, 0xF8261349), COMB_D(0x6A00D1E8, 0xC18F825E), COMB_D(0x1E97DE63, 0x4977AC5F), 0}},
+    {{COMB_D(0xA694A736, 0x583AFC44), COMB_D(0xFA485FBC, 0xD8C8B234), COMB_D(0xCBBF4F0F, 0x11B4ECFB), COMB_D(0xFA244421, 0x726762DD), 0},
+     {COMB_D(0xB7F46B02, 0x03B20B2F), COMB_D(0x593A0362, 0xB8BF60B3), COMB_D(0xC9230462, 0x8A615F89), COMB_D(0x969022EB, 0x4EFD89A5), 0}},
+    {{COMB_D(0x099313BD, 0x3B8E31AE), COMB_D(0x30B22C2C, 0xBC7DF8B6), COMB_D(0xA20BF846, 0x203114CB), COMB_D(0x2566D2FE, 0xF4C52BFD), 0},
+     {COMB_D(0x597ACFDD, 0x831C927A), COMB_D(0x9360E5C9, 0xF98B5B48), COMB_D(0x05A4BC97, 0xC83173D7), COMB_D(0x2937258D, 0xAA5F4B65), 0}},
+    {{COMB_D(0xA7692C9F, 0x1F355194), COMB_D(0x33228252, 0x8B08D7C1), COMB_D(0xCEFD1E47, 0xD3051672), COMB_D(0x7F3E32D9, 0xCD09D3AE), 0},
+     {COMB_D(0xECFDA19A, 0x54118953), COMB_D(0xBA13C10E, 0x654E98A3), COMB_D(0xBCBE4AF1, 0x1D2B4B22), COMB_D(0x0046B748, 0x8A5F055E), 0}},
+    {{COMB_D(0x1AA6FF00, 0x9AB91E78), COMB_D(0x001949C8, 0x1D084D6E), COMB_D(0x9F77C9B1, 0xF47A6A4B), COMB_D(0x55137B96, 0x816F2DD1), 0},
+     {COMB_D(0xF59B62CD, 0x82C95BAB), COMB_D(0xF0E6093D, 0x3D656390), COMB_D(0xC70C2E27, 0x40191656), COMB_D(0x640E0F7C, 0xE85912E9), 0}},
+    {{COMB_D(0xB6CCEB66, 0xB4CA6257), COMB_D(0x6E1CF50A, 0x3E2EB560), COMB_D(0xB834190C, 0x35189158), COMB_D(0x56B9F262, 0x885FF47F), 0},
+     {COMB_D(0xC5A96EB5, 0x5D4C4606), COMB_D(0x04FFCA7B, 0x3EA9D880), COMB_D(0x8A408C75, 0x9971BED2), COMB_D(0x4E3270F7, 0x76AB3860), 0}},
+    {{COMB_D(0x0BBEF77E, 0x041D6E45), COMB_D(0x382CBB00, 0x9C2A816B), COMB_D(0xFD567E57, 0x4844DD12), COMB_D(0x8EA4EFDE, 0x25799B04), 0},
+     {COMB_D(0x1B0E9E8E, 0x823C4936), COMB_D(0x6E889FB3, 0xD2967EDF), COMB_D(0x1B48011A, 0x75D96022), COMB_D(0xAC8C6083, 0xBA4B0323), 0}},
+    {{COMB_D(0x8666B1B0, 0xF8A4554C), COMB_D(0xB5902765, 0xAFC2553F), COMB_D(0x6F00F1EB, 0x0916F54C), COMB_D(0x23706E78, 0x899237AE), 0},
+     {COMB_D(0x138F584C, 0x23220F93), COMB_D(0x2781DAC6, 0x77F72A6A), COMB_D(0x7A1E7A4F, 0x29E8AC38), COMB_D(0x49CB1625, 0x1AB340F0), 0}},
+    {{COMB_D(0xDCC05FB9, 0xFCAB93F7), COMB_D(0x9753B98E, 0x87142DA0), COMB_D(0xDE8A87A5, 0x92FFEDC8), COMB_D(0x312FEBC8, 0xF50EEB80), 0},
+     {COMB_D(0x10F1FD11, 0x7C3A8CAB), COMB_D(0xB368B7E8, 0x35F1DFD2), COMB_D(0xA7BB0BE3, 0xBCD9269B), COMB_D(0x4EFE1619, 0x4820D2F7), 0}},
+    {{COMB_D(0xB035C88E, 0x5887DE99), COMB_D(0x482AEBF6, 0x4A81E70B), COMB_D(0xED317520, 0xE05CAF8F), COMB_D(0x34DEC569, 0xD8995739), 0},
+     {COMB_D(0xFBEC404D, 0x32337A90), COMB_D(0xD34EF8C8, 0x033B266A), COMB_D(0xBC1373A3, 0x6DC3AF7F), COMB_D(0xDAD06F83, 0x3DF3A2C5), 0}},
+    {{COMB_D(0xA5172178, 0xD450F8CE), COMB_D(0xF4F3582A, 0xC6746D56), COMB_D(0xC0FD379A, 0x4C3D113E), COMB_D(0x5F27DA5B, 0x247ABC8E), 0},
+     {COMB_D(0xBA848A70, 0xCFDE4DDC), COMB_D(0x36E672BD, 0xF8600545), COMB_D(0xB4C33AF8, 0x9D235B4B), COMB_D(0x88D80A31, 0xA1AD7275), 0}},
+    {{COMB_D(0x0BC5711A, 0x1D1D9F73), COMB_D(0x8146AC94, 0x2C457CBF), COMB_D(0x8C1B7822, 0x7A637FEE), COMB_D(0x1FECC0FC, 0x30BCC79F), 0},
+     {COMB_D(0x02A5AC20, 0xB1D7B9E5), COMB_D(0x6E9977EC, 0x6642FF6B), COMB_D(0x99DD50E4, 0x103A3661), COMB_D(0xAADC1595, 0x207CA390), 0}},
+    {{COMB_D(0x2856047B, 0x0230EEA5), COMB_D(0xE69E5E9E, 0x48FEDF51), COMB_D(0x10C69375, 0x98A7B293), COMB_D(0x8EB466DF, 0xE9507FBB), 0},
+     {COMB_D(0xEE636099, 0x52B67E72), COMB_D(0x18F34F03, 0x44869856), COMB_D(0x822A7986, 0x0E2CB97B), COMB_D(0x51D1D184, 0x65BE8A99), 0}},
+    {{COMB_D(0x17029CEA, 0x12DAA3F5), COMB_D(0x100FBA54, 0x1DEA090D), COMB_D(0x2C856F22, 0x2AC2F085), COMB_D(0x1F9DD4AA, 0xFE14FC40), 0},
+     {COMB_D(0x2C81BC33, 0x24EF65D8), COMB_D(0x9624C1D4, 0x4C85BB8D), COMB_D(0xDB9BE09B, 0x821F658E), COMB_D(0x835029A4, 0x677F3EE2), 0}},
+    {{COMB_D(0x2E5082E0, 0xD8788441), COMB_D(0xAC22124C, 0x9DD8BD99), COMB_D(0xA332E159, 0x1D863C85), COMB_D(0x0D816806, 0x8E28CCD0), 0},
+     {COMB_D(0xD9F7B50C, 0xC86591BE), COMB_D(0xAB40AE09, 0x7476C0A8), COMB_D(0x7D28D38D, 0x851CCA4F), COMB_D(0x30C97744, 0x566214A1), 0}},
+    {{COMB_D(0x6CCC34E5, 0xCCE4AD87), COMB_D(0xB7EA028E, 0xA1CD0B28), COMB_D(0x1DAF20D8, 0xF48A1D9A), COMB_D(0x60A04B50, 0xC442BCAC), 0},
+     {COMB_D(0xCA32B3E7, 0xD4CAE309), COMB_D(0x91AF5347, 0x34401CB9), COMB_D(0xEF3A293E, 0x7E2E4CB9), COMB_D(0x2FFC7B75, 0x47C504B2), 0}},
+    {{COMB_D(0xA52F2C36, 0x93C4A205), COMB_D(0xDE1ADF89, 0xF510A848), COMB_D(0xE4665570, 0x75B929FC), COMB_D(0xB6E06C51, 0x6305BBC4), 0},
+     {COMB_D(0x537F4D86, 0x5DB36D05), COMB_D(0x63F99419, 0xA82A9F87), COMB_D(0xC5E1F126, 0xE79ED73B), COMB_D(0xBDB4277C, 0x21B323F5), 0}},
+    {{COMB_D(0x017A1EE5, 0xE1BE1172), COMB_D(0xA0DC95C4, 0x7720C2EF), COMB_D(0x6F9DC44F, 0x56119EBC), COMB_D(0x359F5972, 0x14D8062E), 0},
+     {COMB_D(0x64355FD8, 0x5D822787), COMB_D(0x9476A424, 0xD56B4742), COMB_D(0xE221A6E0, 0x0D32848D), COMB_D(0xCBBE6EEA, 0xA3DA70D2), 0}},
+    {{COMB_D(0xC2B220B0, 0x6CC817D9), COMB_D(0x590D3914, 0x115FCA02), COMB_D(0x92223ADF, 0x218AE02D), COMB_D(0xFD1C0BDB, 0x7E5BBDCF), 0},
+     {COMB_D(0x46F14AFE, 0x83B0A453), COMB_D(0x205FCCCB, 0xF85BDF41), COMB_D(0x865581A3, 0x111301E3), COMB_D(0x66A0DBCF, 0xE9D22727), 0}},
+    {{COMB_D(0x03E56F49, 0x5DCF55CB), COMB_D(0x99990F2A, 0x09C0DB7E), COMB_D(0xA3586F28, 0x060E55FB), COMB_D(0x2E4598CC, 0x638D43FC), 0},
+     {COMB_D(0xF24F195C, 0xC00A4B55), COMB_D(0xE707C359, 0xB762082F), COMB_D(0x6B4D317D, 0x18EABA72), COMB_D(0xE940E52C, 0xC63669AF), 0}},
+    {{COMB_D(0xF006B46D, 0x64D483C4), COMB_D(0x5AF92901, 0x18895BC3), COMB_D(0x068E127A, 0x606A62C4), COMB_D(0xECD9CC49, 0x7F852ABC), 0},
+     {COMB_D(0xD36884ED, 0x79B3AB70), COMB_D(0xA7918644, 0xBF00A037), COMB_D(0xA6FC50D7, 0x1D9CBE75), COMB_D(0xB012FB62, 0x23DE13B2), 0}},
+    {{COMB_D(0xEE347915, 0x86451B6B), COMB_D(0xEBCBE2CF, 0x205DADF2), COMB_D(0x42E26FB3, 0x688B409C), COMB_D(0x4B9FC0D3, 0x37371A3B), 0},
+     {COMB_D(0x53D3F9CA, 0x16ED433F), COMB_D(0x74F7A8B5, 0xE630BA81), COMB_D(0xE00B15DD, 0xF7800906), COMB_D(0xCC31EA0A, 0x9AEA13BB), 0}},
+    {{COMB_D(0x34F28484, 0xE0570647), COMB_D(0x6E8E0ED3, 0x19A44B4E), COMB_D(0xBC8CFFF2, 0xD0939902), COMB_D(0x97671A4C, 0x2FD03A0C), 0},
+     {COMB_D(0x1411F959, 0x8C4F7669), COMB_D(0x25174373, 0xF024790B), COMB_D(0x98C531AA, 0xEA69986F), COMB_D(0x341E4638, 0x8D983B98), 0}},
+    {{COMB_D(0x20E3E86E, 0x46A9799C), COMB_D(0x7DF8202C, 0xC84F7B1C), COMB_D(0x83FA0D1D, 0x59D4F780), COMB_D(0xDD900283, 0x429B6090), 0},
+     {COMB_D(0x17936786, 0xD9C358C7), COMB_D(0xBD0BAAE4, 0x1F8772E1), COMB_D(0x49D25130, 0x9C29F4C4), COMB_D(0x87CFD40F, 0xF1A80172), 0}},
+    {{COMB_D(0x53572930, 0x61872CD5), COMB_D(0xA7379933, 0xA2E7DEFC), COMB_D(0x8FA57E63, 0x92EF1EC6), COMB_D(0xEF68408C, 0x487A5DC4), 0},
+     {COMB_D(0x42DACC1D, 0x60CEC092), COMB_D(0x6AE5D7F1, 0x7757A0DF), COMB_D(0xDE2B3ED1, 0x300CED42), COMB_D(0x9B39822F, 0x5BF352C7), 0}},
+    {{COMB_D(0x0F3FAD9F, 0x94289399), COMB_D(0xF39B2002, 0x15FB75FD), COMB_D(0x696A5501, 0x17E0F9FF), COMB_D(0x26EAEFB4, 0x301333B1), 0},
+     {COMB_D(0x4A91A1CA, 0x4E332ECC), COMB_D(0xC066AB6E, 0x00E09598), COMB_D(0x2BB6F78E, 0x9042E50E), COMB_D(0xAA427D6A, 0x77DF73F6), 0}},
+    {{COMB_D(0xC56051B9, 0xC5053F6C), COMB_D(0xFD167DCB, 0xE1538E09), COMB_D(0xAAD666C0, 0x850D6BFB), COMB_D(0x12380AD5, 0xE33D80C5), 0},
+     {COMB_D(0x8E2AED04, 0x65EE59D3), COMB_D(0x5B1BB863, 0x4854B918), COMB_D(0x79F28D17, 0xDAAF696D), COMB_D(0x7674B90C, 0x3887BCEE), 0}},
+    {{COMB_D(0x99F094F7, 0xFEF04D7A), COMB_D(0xD4F4326E, 0xFA3836E6), COMB_D(0x97F129DD, 0x259EFA73), COMB_D(0xD4C67688, 0x0A737C9C), 0},
+     {COMB_D(0xDB385E44, 0x8336FE6B), COMB_D(0xAAB23692, 0x588AEA6A), COMB_D(0xE0B8AC37, 0x2D1FA777), COMB_D(0x59A1E233, 0x70D72378), 0}},
+    {{COMB_D(0x161B6955, 0xF9DFCCCA), COMB_D(0x9E928C3C, 0x02594072), COMB_D(0x85038E7C, 0x11567460), COMB_D(0xABD544F5, 0x44436AC5), 0},
+     {COMB_D(0xE225F6D8, 0xF0C744A7), COMB_D(0xE9118F31, 0xC2919712), COMB_D(0xEB50A526, 0xF19EE5C4), COMB_D(0xD69FA687, 0x948339A1), 0}},
+    {{COMB_D(0x9FCF3792, 0xDA8270DB), COMB_D(0x496FACCE, 0xFBF3187A), COMB_D(0xD8A7A237, 0xFEADB4AD), COMB_D(0xB9397ECD, 0x361F2DCF), 0},
+     {COMB_D(0xE25B4E1E, 0xB27BE300), COMB_D(0x807ED020, 0xF17A241E), COMB_D(0x2499CC39, 0xB208CAB7), COMB_D(0xD6E8E56D, 0x3AA6ED06), 0}},
+    {{COMB_D(0x2D179ED2, 0xF32C61FF), COMB_D(0x642821B1, 0x68D21E5D), COMB_D(0xBF561E47, 0xC865D858), COMB_D(0xE9B933A0, 0x2B026D94), 0},
+     {COMB_D(0xF531C2DD, 0xBED137B2), COMB_D(0x36C068EE, 0x672771CB), COMB_D(0xD2B6C433, 0x101D2659), COMB_D(0x73B90B3A, 0xEF9B9689), 0}},
+    {{COMB_D(0xEF799CDD, 0x6CFD8D5D), COMB_D(0xBC72EDA8, 0x757483CD), COMB_D(0xA85B6B17, 0x3D17B634), COMB_D(0xA6F2FCB2, 0x357DAF4B), 0},
+     {COMB_D(0xD1025DED, 0xFB1CBA5F), COMB_D(0xFC0D2945, 0x3EBBBC03), COMB_D(0x871AE2C1, 0x2F55BC1A), COMB_D(0x875AA563, 0x7A38D75F), 0}},
+    {{COMB_D(0x1990813B, 0xD132E0BC), COMB_D(0xB69957F2, 0x506F5109), COMB_D(0xE2C64C56, 0x6B4C3A25), COMB_D(0x1BC23F97, 0xF293209E), 0},
+     {COMB_D(0x91F09DBC, 0xBE302978), COMB_D(0x07FBC4C0, 0x59559392), COMB_D(0xF28EC46B, 0x215A1BBB), COMB_D(0xA8C34CA8, 0x8A48D681), 0}},
+    {{COMB_D(0xEE4D68FE, 0xA56401DB), COMB_D(0x041E314C, 0x0C2A0D4F), COMB_D(0xCF6F3C12, 0xB658FE2F), COMB_D(0xB9BE72AA, 0x09D5D7D6), 0},
+     {COMB_D(0x3CA9E1C3, 0xD567116E), COMB_D(0x67B2071C, 0xEA7CF061), COMB_D(0x24E1E32A, 0xA7A22BED), COMB_D(0xA2D26E1A, 0xC541C894), 0}},
+    {{COMB_D(0x63ED1EF2, 0xD9C04A20), COMB_D(0xA792E116, 0xD692612B), COMB_D(0x3567667E, 0xD612A9C9), COMB_D(0xA19A6519, 0xF1AFF5D3), 0},
+     {COMB_D(0xAB3CF2D4, 0xFEC5DF80), COMB_D(0x9FAD5518, 0x4A96E823), COMB_D(0xAC722361, 0xE88FAEA6), COMB_D(0x2645CD4E, 0x2E4B4E64), 0}},
+    {{COMB_D(0x9F8C1C45, 0xE21D4E60), COMB_D(0x9EF209B0, 0x993F8721), COMB_D(0x287D6E20, 0xB361DDE4), COMB_D(0xEBA9EFBE, 0x1DA0D7BC), 0},
+     {COMB_D(0x43008183, 0x0B083738), COMB_D(0x973F5E81, 0x3545D22F), COMB_D(0x0F8EBCD8, 0xD310103C), COMB_D(0xF53A41E8, 0x950F47AE), 0}},
+    {{COMB_D(0xF460DC39, 0x71E372C9), COMB_D(0xF6F94285, 0x41D72EFC), COMB_D(0x2C571DB3, 0x34D319B0), COMB_D(0xDDBD24C0, 0x14411920), 0},
+     {COMB_D(0x2AAB11BB, 0x9399B2C1), COMB_D(0xECDE8D35, 0x8D177EB5), COMB_D(0x0B9EAB3E, 0xA951E574), COMB_D(0xF768B518, 0x83F31E8F), 0}},
+    {{COMB_D(0x87E4EB89, 0xDED38583), COMB_D(0xA100B732, 0x0724FFD5), COMB_D(0x0D3014D7, 0x8FE147DD), COMB_D(0x729FE6C0, 0x3DE2917F), 0},
+     {COMB_D(0xABDEFC6A, 0x1960F7C5), COMB_D(0x065248F4, 0xADFB9947), COMB_D(0xCCC4A0B3, 0x1F61E14B), COMB_D(0x1259B1E4, 0xD1F1AED0), 0}},
+    {{COMB_D(0x1922CD5B, 0xE7B00461), COMB_D(0xA593EB8D, 0xCDA07D05), COMB_D(0x5DB1237B, 0x6A86467D), COMB_D(0xE2841E4E, 0xDB8F534C), 0},
+     {COMB_D(0x78E66F53, 0x33B8B2DF), COMB_D(0x5BC3B8D5, 0xCCBCB210), COMB_D(0x8230F8EF, 0xBA65601B), COMB_D(0x5B32A226, 0x19424A4E), 0}},
+    {{COMB_D(0x03264277, 0x7756B0A0), COMB_D(0xFFCDAAC8, 0x515B125B), COMB_D(0x80AA6CA7, 0x1FF1901E), COMB_D(0xF087DDE2, 0xE127FA34), 0},
+     {COMB_D(0x0E596D6A, 0x9BD6A476), COMB_D(0x90B1370C, 0x4EFFC2AE), COMB_D(0x70FBAE5D, 0xECA7456E), COMB_D(0xCE12CB95, 0x0845C9AD), 0}},
+    {{COMB_D(0x91D759B6, 0xC8C3D0C1), COMB_D(0xC39437F3, 0x88AF78F0), COMB_D(0x4BAB043E, 0xA95F41CB), COMB_D(0x37F1E065, 0x2B213D4E), 0},
+     {COMB_D(0x838D9E4F, 0x6B4263CF), COMB_D(0x5D41FE4D, 0xACC824C1), COMB_D(0x9CB825CC, 0x7C92A566), COMB_D(0xBB77E5F6, 0xF5750779), 0}},
+    {{COMB_D(0x398FE8E9, 0xD459C8B6), COMB_D(0xB0FB59D7, 0x9513C65A), COMB_D(0x18A7C192, 0xD298D984), COMB_D(0x8EDAB073, 0x95805DE1), 0},
+     {COMB_D(0xFCBD1352, 0xDDC577C7), COMB_D(0xE9CBAC9E, 0x8E1D6960), COMB_D(0x31E4E611, 0x6BB62AE4), COMB_D(0x2CEA0686, 0xB497B28B), 0}},
+    {{COMB_D(0x59AB040F, 0x3963CD11), COMB_D(0xB88DDC28, 0xE9504EF1), COMB_D(0xC97DB306, 0x92118902), COMB_D(0x99B5FDCC, 0xD15E3C32), 0},
+     {COMB_D(0xF125A87F, 0x536AD853), COMB_D(0xA29C7C75, 0x3097552C), COMB_D(0x8C7643F2, 0x3C9FDE7B), COMB_D(0xE8440DAB, 0xA88B82A1), 0}},
+    {{COMB_D(0x52686C7F, 0x274C7E3D), COMB_D(0x5FC96B8E, 0x61592C21), COMB_D(0xEC1F8867, 0x34D1709C), COMB_D(0x5019EA22, 0xAEB3337F), 0},
+     {COMB_D(0x596819E8, 0xEDECCB91), COMB_D(0x6A31C8BC, 0xBC700188), COMB_D(0x09B175D8, 0x7EF99E19), COMB_D(0x06CC8D6D, 0x21AE17EC), 0}},
+    {{COMB_D(0x86DCEE0A, 0x8655D247), COMB_D(0x938A8223, 0x7DC6030C), COMB_D(0xB30BA408, 0x33A5DAD8), COMB_D(0x4752B76A, 0xD9552BF6), 0},
+     {COMB_D(0x0AA23B92, 0xD63AAA48), COMB_D(0x31786D94, 0x259D58E2), COMB_D(0xC07C0375, 0x483830F4), COMB_D(0xA4919C55, 0x5DDAFB33), 0}},
+    {{COMB_D(0xFA7B10DE, 0xD3FC0C47), COMB_D(0x873B8146, 0x08F66545), COMB_D(0x76AE4FBF, 0x61E3D994), COMB_D(0x54C0C9AF, 0x52D9D7C8), 0},
+     {COMB_D(0x50872BE4, 0x08A2EA52), COMB_D(0xF0E02D93, 0xCCC5D7FD), COMB_D(0x5FA4A8FA, 0x03BBAB5D), COMB_D(0xDC57256D, 0xE9E3F1BF), 0}},
+    {{COMB_D(0x0DDE164D, 0x0112BB60), COMB_D(0x678DC31C, 0x77EC3791), COMB_D(0x54500C6A, 0x113AB607), COMB_D(0x9611C881, 0xA0D29771), 0},
+     {COMB_D(0x31F86953, 0xAB1CCA9A), COMB_D(0x0123E1CC, 0x1DDCC0FE), COMB_D(0xC1B479B7, 0x77057E9A), COMB_D(0x7B62A421, 0x745DFF86), 0}},
+    {{COMB_D(0x905A129B, 0xB9B2C78F), COMB_D(0xE4DDE56B, 0x19DD134E), COMB_D(0x58D22CE4, 0x5627BCCB), COMB_D(0xA67191F7, 0x9C98E4FE), 0},
+     {COMB_D(0x406F1FFB, 0x783EAA05), COMB_D(0x02CC5673, 0xD1709B13), COMB_D(0xDECA0873, 0xE713D362), COMB_D(0x34D515D8, 0xDC67AAE0), 0}},
+    {{COMB_D(0x55D4E37A, 0x2FD20BAE), COMB_D(0x26035672, 0xD5B4A811), COMB_D(0x027BBA12, 0x176D343A), COMB_D(0x285250ED, 0xC3BCFCD9), 0},
+     {COMB_D(0xF9DE455A, 0x54E0AB97), COMB_D(0x6E9B1A2C, 0xF1EFF323), COMB_D(0x3F7284AD, 0x1046C171), COMB_D(0x7866C086, 0xF4AD7EA8), 0}},
+    {{COMB_D(0xB04CE849, 0x5A802A05), COMB_D(0x45D6F910, 0xD9160477), COMB_D(0x9E9AD7CB, 0x47EA78B2), COMB_D(0x19D42C33, 0x9F4CE9AC), 0},
+     {COMB_D(0x546DA3AF, 0x7EF968E9), COMB_D(0xC64A272B, 0xE811138C), COMB_D(0x6044750B, 0x7536B7D4), COMB_D(0xAE8D674D, 0xF71C30D7), 0}},
+    {{COMB_D(0xCD8BED43, 0xCBC49018), COMB_D(0x63E0D85E, 0x80D10829), COMB_D(0xFAB32A44, 0xC6356B55), COMB_D(0xE225B68C, 0x414419D9), 0},
+     {COMB_D(0xA14C82E9, 0xEC4509C1), COMB_D(0xC3E0CD63, 0x47A832EA), COMB_D(0xB6E244DD, 0x55AACA19), COMB_D(0x3120F486, 0x3E521CD7), 0}},
+    {{COMB_D(0x44C6B642, 0xA6BF8907), COMB_D(0x9C81171A, 0x0E2109CB), COMB_D(0xEA8BBFDD, 0x70F82AEC), COMB_D(0x86909C7D, 0xF6A991BE), 0},
+     {COMB_D(0x9C480ABC, 0x9653EDDC), COMB_D(0x2BF79CA4, 0xBFEDFEB6), COMB_D(0xB3DCC1DA, 0xE3FAC022), COMB_D(0xA818641E, 0xFE08E675), 0}},
+    {{COMB_D(0x144411DF, 0xDE9652DF), COMB_D(0x7A0FB266, 0xD974D20D), COMB_D(0x85E033B8, 0xCDCBE49F), COMB_D(0x3DA1B370, 0x5B829FC3), 0},
+     {COMB_D(0xABA7A297, 0x023621EB), COMB_D(0x12476B10, 0xBF7CD241), COMB_D(0xEFBC8D29, 0x5AB1D25D), COMB_D(0x2223E928, 0x3F2A226E), 0}},
+    {{COMB_D(0x358BE601, 0x32A032BE), COMB_D(0x9C9AF33E, 0x178B7838), COMB_D(0x84F792F7, 0x1BB4FED7), COMB_D(0x78A72A3B, 0xF0116C42), 0},
+     {COMB_D(0x450858C0, 0x6CE95B07), COMB_D(0xDAA039C5, 0xAB32507A), COMB_D(0x1A9884A8, 0x52E19EDF), COMB_D(0xAD2FD1EA, 0x8D3576BC), 0}},
+    {{COMB_D(0xBD4A28CE, 0x9BFBEF43), COMB_D(0xCE15AEF9, 0x4373A8F4), COMB_D(0xB0220E7D, 0x875A7D08), COMB_D(0x2CC2D578, 0x67515AA4), 0},
+     {COMB_D(0xD1E7CD5C, 0x97F9E047), COMB_D(0x5F889E8B, 0x1340B6C7), COMB_D(0x32C2A35D, 0xAC09997E), COMB_D(0x8C76C837, 0xA55933BC), 0}},
+    {{COMB_D(0x745933F5, 0x844F1CD7), COMB_D(0x4340791A, 0xF2D34B9A), COMB_D(0x8E8DAE86, 0x85BE3272), COMB_D(0x2AA558A1, 0xB272E1AD), 0},
+     {COMB_D(0x3C68E97C, 0xDB68997F), COMB_D(0x6AEFFADE, 0x604FC1A7), COMB_D(0xC6CA8643, 0x8A9E8242), COMB_D(0x53EC9549, 0xAC3B8D1E), 0}},
+    {{COMB_D(0x8F8BDDBF, 0x569BF2E9), COMB_D(0x39A1FCE8, 0xD9486C45), COMB_D(0x6BC62C6C, 0xF5943A68), COMB_D(0xD15D6786, 0xCCA758BD), 0},
+     {COMB_D(0x8FC9D86E, 0x45123D97), COMB_D(0xE6521DB0, 0x64E3777F), COMB_D(0xCDD757BB, 0xC75257A3), COMB_D(0x78282FFB, 0x4001BC4F), 0}},
+    {{COMB_D(0xF42A4B1E, 0xC6C98CF6), COMB_D(0xB4283EE2, 0x30064AED), COMB_D(0x913D7642, 0x1A8F8A18), COMB_D(0x8A2A8D7F, 0xF84EFB7D), 0},
+     {COMB_D(0x5CBC1C6B, 0x37D1FC0B), COMB_D(0xC30B006C, 0xA5439715), COMB_D(0x775AAD24, 0x8CCD52BE), COMB_D(0x5EA9615D, 0x76DA9B10), 0}},
+    {{COMB_D(0x29AD0FCF, 0xB8C267C2), COMB_D(0xF85B3EFA, 0x129630FE), COMB_D(0xB093D4C9, 0x34568B04), COMB_D(0x57765E14, 0xBFAFE37B), 0},
+     {COMB_D(0xB4B0CCE6, 0xAD80E1D0), COMB_D(0x614914D0, 0x706EC0D9), COMB_D(0x9C0CAD7D, 0x32404EEA), COMB_D(0x9B4AE580, 0xF90EDDB1), 0}},
+    {{COMB_D(0x2A4CA20B, 0x2D66DA2F), COMB_D(0x37BC32FE, 0x9C22769B), COMB_D(0xE6E3B2CB, 0xD196E950), COMB_D(0x5BB44B85, 0x49F623D6), 0},
+     {COMB_D(0xFF1D9A61, 0xD0B3A85E), COMB_D(0xF8B7274D, 0x88DE7090), COMB_D(0x3DBE95C6, 0xDAC3B92C), COMB_D(0xCB481904, 0x62342421), 0}},
+    {{COMB_D(0xE5442279, 0xD10B11AB), COMB_D(0x704E9C77, 0x407CB8C8), COMB_D(0x50616A1B, 0xA4A84A88), COMB_D(0xA93854BD, 0x0F12215C), 0},
+     {COMB_D(0xF74FF31A, 0x0A7E6B4C), COMB_D(0x8D5A78D9, 0xE9BC85F5), COMB_D(0xC0C510B5, 0x1C545585), COMB_D(0x03024D0A, 0xA5D35670), 0}},
+    {{COMB_D(0xACC5FDC8, 0xD6E96ADD), COMB_D(0xAA3F2D8B, 0x4BAD7E42), COMB_D(0xA4EE0B48, 0x174141E3), COMB_D(0x708A4E48, 0x1FE9DD4F), 0},
+     {COMB_D(0x2B07A0B9, 0x053ABC0F), COMB_D(0xC579C8F7, 0x38F825FF), COMB_D(0x74AAE2B1, 0xDF60A5AC), COMB_D(0xEB67D49E, 0xD87BCF71), 0}},
+    {{COMB_D(0x35CAFD9F, 0x2D039E88), COMB_D(0xEDB25F2C, 0xDA5888CC), COMB_D(0xD24ADB79, 0x0E4F76AD), COMB_D(0x98907BBB, 0xE47ED775), 0},
+     {COMB_D(0x406EF3AA, 0xEEA5BDA4), COMB_D(0xD960717D, 0x29D60285), COMB_D(0x1D3AFE4B, 0x3DF12277), COMB_D(0x244984E3, 0x1E16609A), 0}},
+    {{COMB_D(0xD436C92F, 0x616449DD), COMB_D(0xA764E448, 0x7ED272EC), COMB_D(0xC9E131D8, 0x4386C7AB), COMB_D(0xE8C8805F, 0x9640B5B8), 0},
+     {COMB_D(0xD8A0275F, 0x495244DA), COMB_D(0xA4C4B541, 0x61CB1706), COMB_D(0x2380B28B, 0xA9DE650B), COMB_D(0x0FB6B4A5, 0x5776D5F3), 0}},
+    {{COMB_D(0x4CF9C482, 0x8F51F5F5), COMB_D(0xBADBE77C, 0x92DF4025), COMB_D(0xBB24F057, 0xFEB96089), COMB_D(0x4F47AD82, 0x837E1624), 0},
+     {COMB_D(0x66CBCC2D, 0x48552F5E), COMB_D(0xA5FB162F, 0xC35402ED), COMB_D(0xDEA9C8BC, 0x6EF28E15), COMB_D(0xB9F0F797, 0xAB4323F8), 0}},
+    {{COMB_D(0xC24CC9A1, 0xBB47D352), COMB_D(0xE2359E97, 0xF74BCC90), COMB_D(0xB5CC0F7E, 0x683A9D43), COMB_D(0x7C7222F9, 0xA8762BA5), 0},
+     {COMB_D(0x86A0E5A0, 0x8D63458D), COMB_D(0x29D09ECE, 0x53F900A1), COMB_D(0xBD205B89, 0x164700A0), COMB_D(0xD41CBA04, 0x26AB4101), 0}},
+    {{COMB_D(0xBD8BCB12, 0x00805AC8), COMB_D(0xB5098B26, 0xEC97A855), COMB_D(0x33ADC4A6, 0x72A30C6C), COMB_D(0x8CBC8B71, 0x9439B755), 0},
+     {COMB_D(0x12FF1272, 0x59404F47), COMB_D(0xB6BC0B9C, 0x0B09496F), COMB_D(0x40950D2C, 0xD3575BAE), COMB_D(0x5843B894, 0xB022765F), 0}},
+    {{COMB_D(0xA92317E5, 0x6592DC46), COMB_D(0x4830489F, 0xA06792EA), COMB_D(0x7E9E0C9C, 0x57D1A44C), COMB_D(0xD79A7807, 0xE4CDC938), 0},
+     {COMB_D(0x9BAEAE18, 0x242A575E), COMB_D(0xAEA87582, 0xBAB886EB), COMB_D(0xD1D66CCD, 0x9826BE94), COMB_D(0x501C0A28, 0xEBB62993), 0}},
+    {{COMB_D(0x045DA7C2, 0x8BEF5B1F), COMB_D(0xDD8D6703, 0x46036BE4), COMB_D(0xE167C2B7, 0xF8594E0B), COMB_D(0xC8463349, 0xECA2CC8A), 0},
+     {COMB_D(0x7FCEF7AA, 0xABC7D1D3), COMB_D(0xA877F16E, 0x0B94067A), COMB_D(0x709B7D9A, 0x2B39E891), COMB_D(0x69D82FCD, 0x2449F52A), 0}},
+    {{COMB_D(0xFBA42525, 0x2A5CBCFC), COMB_D(0x018F46C1, 0xA52FA9C0), COMB_D(0xD33381F7, 0xF0157871), COMB_D(0x7F36FC8D, 0x64FD52F7), 0},
+     {COMB_D(0x774637B4, 0xFEF91C44), COMB_D(0x6E731C51, 0x1F93A1EB), COMB_D(0x71FD8A5A, 0x632A4D2E), COMB_D(0x06B3CA05, 0x9E57B49D), 0}},
+    {{COMB_D(0x45D8B2BC, 0x384443B3), COMB_D(0xBCE356C4, 0xC8A58EA8), COMB_D(0xC0B9BEA1, 0xA233DA28), COMB_D(0x6AA2D2DE, 0x0E51135B), 0},
+     {COMB_D(0x9B3207E4, 0x1D210657), COMB_D(0x13858F30, 0x23F327E8), COMB_D(0x962D1BE2, 0xDDBE6AF9), COMB_D(0x4A0EDABA, 0x2D5015A3), 0}},
+    {{COMB_D(0xC0D879DC, 0x01C753F1), COMB_D(0x32D710C0, 0xE1844840), COMB_D(0x675C1E19, 0xE813A245), COMB_D(0xFB202112, 0x8A74733D), 0},
+     {COMB_D(0x11C7FE6F, 0xE0AF8B95), COMB_D(0xDA681BC6, 0x42FC5194), COMB_D(0x1F168DDE, 0x65F60DCC), COMB_D(0xBBDDF1D3, 0x4F787207), 0}},
+    {{COMB_D(0xF629A1BE, 0xCE8703D0), COMB_D(0x23F122B2, 0xC6131687), COMB_D(0x7F511E8E, 0xD6B8FA3C), COMB_D(0x9820849E, 0x0A5F1798), 0},
+     {COMB_D(0xA6045F5A, 0x838B9593), COMB_D(0xA85583A5, 0xC78C73AF), COMB_D(0xEE853CAF, 0xBA5FC1CF), COMB_D(0x16891BBE, 0xE3562F2B), 0}},
+    {{COMB_D(0x78FAE083, 0xC3A97E88), COMB_D(0x88CC5DE6, 0x94768998), COMB_D(0x868344C2, 0x72795A6A), COMB_D(0xBC94BC15, 0x543C67CD), 0},
+     {COMB_D(0x7CCFA37E, 0x407C5AE8), COMB_D(0xE1486B75, 0x8B095A4E), COMB_D(0x472CE540, 0x81160FAB), COMB_D(0xD1F018FF, 0x98A93ABF), 0}},
+    {{COMB_D(0x9C7B94A5, 0x9C57BF00), COMB_D(0x821B9710, 0x1EA259EF), COMB_D(0x69280EF5, 0x742958FF), COMB_D(0xB8849947, 0x2FE4B58E), 0},
+     {COMB_D(0x65AE84B9, 0xF62A208A), COMB_D(0xB969EACE, 0x1F08305B), COMB_D(0x208EDB54, 0x9F636134), COMB_D(0xD9E6355F, 0x70EC9E80), 0}},
+    {{COMB_D(0x734C3D14, 0xF2C54803), COMB_D(0x6D435B64, 0x43480030), COMB_D(0x64E79D10, 0x84389750), COMB_D(0x6BAD5EE2, 0xC560A336), 0},
+     {COMB_D(0x687DE42A, 0x54D88D12), COMB_D(0x6D86984F, 0xB440A7E3), COMB_D(0x2E034CD3, 0x7639424E), COMB_D(0x66DFB6C8, 0x5A5D62E9), 0}},
+    {{COMB_D(0x098BF20A, 0x7BB50385), COMB_D(0x9B09E5C0, 0x6D720696), COMB_D(0xA0CE0DAE, 0xCF754483), COMB_D(0xE87EF2E9, 0x6622DE62), 0},
+     {COMB_D(0x9A9A3546, 0x8B651EAB), COMB_D(0x69BE6E1C, 0x9A4475E6), COMB_D(0xC017664C, 0x8325D977), COMB_D(0x7C5C289F, 0xE37F1102), 0}},
+    {{COMB_D(0xF8920739, 0xEE558AD7), COMB_D(0x48139959, 0x79BDB840), COMB_D(0xFF71B1E4, 0xC67DAFE6), COMB_D(0x2BDB698F, 0xE0802335), 0},
+     {COMB_D(0x0A5F7169, 0x0C76CDDD), COMB_D(0x33549177, 0xA866E510), COMB_D(0x256A1FF3, 0x0FD0DF43), COMB_D(0x48B4C6C4, 0xF5F69E0C), 0}},
+    {{COMB_D(0xD6AD607F, 0xD5028489), COMB_D(0x5621D9A6, 0xBFCA32FE), COMB_D(0x33AB8D72, 0x604F18CC), COMB_D(0x064A33F9, 0xE38E6F2A), 0},
+     {COMB_D(0xF32143EC, 0x5959BE31), COMB_D(0x4B999D2B, 0x5AB60AE8), COMB_D(0x97B5A8ED, 0x0704C644), COMB_D(0xB9939A06, 0xDE6B24D2), 0}},
+    {{COMB_D(0x8E84C041, 0xBE5A504A), COMB_D(0x6177016F, 0xD2FCB37F), COMB_D(0x47DFF9CC, 0x5CD57C70), COMB_D(0xF5B414AA, 0x401A12AD), 0},
+     {COMB_D(0x930BC910, 0xE1D472D1), COMB_D(0x450E1394, 0x5D3F2F28), COMB_D(0x2EA6BF15, 0x17190D86), COMB_D(0x2C2A2DCF, 0xBD644B3B), 0}},
+    {{COMB_D(0xE134E7C3, 0x09B65BE5), COMB_D(0x2F586705, 0x55900D8E), COMB_D(0x71595A98, 0x9819141E), COMB_D(0x03926BF2, 0x653C3DE9), 0},
+     {COMB_D(0xAE609CD5, 0x7782E913), COMB_D(0xC2D878AA, 0x14F33053), COMB_D(0xEB4115B6, 0x44B7C0D8), COMB_D(0x56CC25F0, 0x61385C30), 0}},
+    {{COMB_D(0x1544FEA5, 0x55D1E700), COMB_D(0x64378CD9, 0x1CFF13AC), COMB_D(0xC5454009, 0xB7D61F45), COMB_D(0xBCB85DB1, 0x5DC50A2D), 0},
+     {COMB_D(0x5BD47785, 0x54AFA77E), COMB_D(0x22793A6C, 0x7B9CCA27), COMB_D(0x8AE62D1D, 0x851F8878), COMB_D(0x7C5FFCD0, 0xF0AD3112), 0}},
+    {{COMB_D(0x0C2FCF4B, 0x227C7C23), COMB_D(0xEC1B187B, 0xA2E866AC), COMB_D(0xD0746E9E, 0x1567879A), COMB_D(0x1AFC709A, 0xB2DD5FE5), 0},
+     {COMB_D(0xC416E6A6, 0x8311CB96), COMB_D(0x2D4F1B40, 0x19BEFABB), COMB_D(0xD4B868A9, 0xD0A30414), COMB_D(0xF17A69C2, 0x32E17893), 0}},
+    {{COMB_D(0x6581CF7F, 0xB9F15D44), COMB_D(0x8B69A6B4, 0xFAD6BDF3), COMB_D(0xB05CB107, 0xF30343C7), COMB_D(0x502E10F2, 0x5BD8E410), 0},
+     {COMB_D(0x58A221C0, 0x3D4A1E5E), COMB_D(0x8424877B, 0x923D1254), COMB_D(0x7DF11868, 0x7FF9EAA4), COMB_D(0x02E97D58, 0x579B30BC), 0}},
+    {{COMB_D(0x3D9C8AEF, 0xD64F2B3B), COMB_D(0x0DC25D35, 0x9BB4C9DE), COMB_D(0x2B4E3D7F, 0x4461C5E0), COMB_D(0x8FEFD20C, 0x2386668D), 0},
+     {COMB_D(0x76169911, 0x1113DB1D), COMB_D(0xD9ADA473, 0xE50A9809), COMB_D(0x19EB57A1, 0xCA493545), COMB_D(0xFEA7B4C2, 0xF6867794), 0}},
+    {{COMB_D(0x2F7202AA, 0x63C685AE), COMB_D(0x23F76E0B, 0x4762E519), COMB_D(0x0703E3B2, 0x6897F014), COMB_D(0x5614D5FE, 0xDC66A1A3), 0},
+     {COMB_D(0xBD1048CF, 0x8E7E0F90), COMB_D(0x4150F4A2, 0x569D70F4), COMB_D(0x783BC127, 0xB324D4A8), COMB_D(0xF342CE3A, 0x0262704D), 0}},
+    {{COMB_D(0xE88F62CD, 0x97B240D3), COMB_D(0xC42B7A30, 0xC0F609AD), COMB_D(0x6B26D83D, 0x6917080D), COMB_D(0x0719528E, 0xC4777D6A), 0},
+     {COMB_D(0x2CACCA5C, 0xF83C04AE), COMB_D(0x0DDACAA8, 0xFFC50129), COMB_D(0x5A742926, 0xD2D866A7), COMB_D(0xCCBF057F, 0x7C83A24D), 0}},
+    {{COMB_D(0x500B3D65, 0x77AD9AD3), COMB_D(0xC4A32332, 0x4502BC98), COMB_D(0xAF4BFDE1, 0x62F9F836), COMB_D(0x4927BF1B, 0x66E4D389), 0},
+     {COMB_D(0xAA95F112, 0x34C1EF73), COMB_D(0xCA3DEC54, 0xB0A64619), COMB_D(0x8494A472, 0x9B4B34D2), COMB_D(0xA7BF20E2, 0x7E4DF069), 0}},
+    {{COMB_D(0xB369DC44, 0x54453F38), COMB_D(0xAA2EA7C9, 0x38687B9A), COMB_D(0x2421517F, 0xC5882331), COMB_D(0x9E183AF6, 0x4223B3FC), 0},
+     {COMB_D(0xB612FFB9, 0xF6087D2C), COMB_D(0xDC5D61B6, 0x6576FE84), COMB_D(0x3D8B0A1B, 0xFDCB1F8F), COMB_D(0x6A671A90, 0x84B6C24F), 0}},
+    {{COMB_D(0x3DB9443A, 0xB21A52C7), COMB_D(0x8918ACCB, 0x996F0EF9), COMB_D(0x7FE5DAE8, 0x89A36A7D), COMB_D(0xCEE32ED4, 0xBB5759DA), 0},
+     {COMB_D(0x7AD0D431, 0x7014FA57), COMB_D(0xE8472C61, 0xABEC20C7), COMB_D(0xB6CEAFA2, 0xAAEAD31A), COMB_D(0xC75D3618, 0x69D5C2E0), 0}},
+    {{COMB_D(0xE6FEFE9C, 0x5B8B7015), COMB_D(0x23B6A72D, 0xD443FD4A), COMB_D(0x1B6377E0, 0xA2FE5EA0), COMB_D(0xB450A669, 0xEC69E810), 0},
+     {COMB_D(0xE217F297, 0x9DF3EFA3), COMB_D(0xFDDFE3E4, 0x531A7F13), COMB_D(0xEDBE8CF6, 0x024BBBA9), COMB_D(0x17C18259, 0x88B8AD5A), 0}},
+    {{COMB_D(0x68C14991, 0xA3F3F0B8), COMB_D(0xDA4C1688, 0x5DF9D133), COMB_D(0x4A24D480, 0x90EC3769), COMB_D(0xFCB1CEEB, 0x4785826E), 0},
+     {COMB_D(0xA7583253, 0xF2F69EAB), COMB_D(0x729BF19B, 0xB3791897), COMB_D(0x0CB37723, 0xEC2A7451), COMB_D(0xD2A3FE6E, 0xC7F27A78), 0}},
+    {{COMB_D(0x1853B4A4, 0xC5C00CA1), COMB_D(0x574F1666, 0xFD27A456), COMB_D(0xAE30B556, 0x29163D09), COMB_D(0x62E8DB9B, 0x109C1E8E), 0},
+     {COMB_D(0x4EE521C8, 0x86FA8788), COMB_D(0x1B1395D2, 0x19999537), COMB_D(0x33BF3E17, 0xB568E7A9), COMB_D(0xEEF1030A, 0xE7AD33EB), 0}},
+    {{COMB_D(0x8553B2AB, 0xF74CE0A3), COMB_D(0xB62F93F9, 0x51A3AB3C), COMB_D(0xF95D6B29, 0x30A21397), COMB_D(0xB2D392E4, 0x5080011D), 0},
+     {COMB_D(0x424C76D8, 0x4EFDEC74), COMB_D(0x666F9C2C, 0xFC0C6458), COMB_D(0xFF913B58, 0x4F43604B), COMB_D(0x5A6C4D2B, 0x69AC4A2A), 0}},
+    {{COMB_D(0x22497011, 0xAD89372A), COMB_D(0x69CBFBAA, 0xE6F07DDB), COMB_D(0x3FA3457C, 0xA98C3C55), COMB_D(0xDA23964D, 0x8263727D), 0},
+     {COMB_D(0x6C7FFD93, 0x282D792F), COMB_D(0x254A818B, 0xD98C9D3A), COMB_D(0x234B6576, 0x7C17B211), COMB_D(0x8F7BF075, 0xA3215475), 0}},
+    {{COMB_D(0x44C72CF2, 0xF1DBFAC9), COMB_D(0x1EE4A95B, 0xF61937F6), COMB_D(0xEA5636BF, 0x959ADA62), COMB_D(0x0FBEC2BD, 0x57BD7E8F), 0},
+     {COMB_D(0x9D447916, 0xF7CB99C6), COMB_D(0xA5B80187, 0xC4CC7910), COMB_D(0x31970625, 0x7D33C23E), COMB_D(0x82A39871, 0x0A087AAB), 0}},
+    {{COMB_D(0x625E6334, 0x919A19A6), COMB_D(0x01228722, 0xCB5799B4), COMB_D(0x0E5E0A8E, 0xE910BEC5), COMB_D(0x67F8EC82, 0x28E8FF47), 0},
+     {COMB_D(0xF0AD70AF, 0x6EA90B60), COMB_D(0x0DED112D, 0x04EC1ACA), COMB_D(0xD5204E15, 0xB511006C), COMB_D(0x00CCA570, 0x27BB518A), 0}},
+    {{COMB_D(0xD5473AF7, 0x24661266), COMB_D(0xFB4CB812, 0x77170ED2), COMB_D(0x8FDDB14C, 0x60D8CB08), COMB_D(0x815474E1, 0x6FE45AE8), 0},
+     {COMB_D(0x8E1634DF, 0xF91A2FC2), COMB_D(0x2FFE696C, 0x9CAB47B9), COMB_D(0x039579A8, 0x1E3DA52E), COMB_D(0x74749329, 0xC27E0672), 0}},
+    {{COMB_D(0x59669A6B, 0x3C36FE61), COMB_D(0x3F9B757C, 0x2BCDC318), COMB_D(0xCDFBE258, 0x9BB4B15C), COMB_D(0xC1D737E8, 0x382D70AB), 0},
+     {COMB_D(0x7BA6D19A, 0x3388EC9E), COMB_D(0xF8A0ED61, 0xD35AC5DE), COMB_D(0x87A5DA61, 0xFD5068A2), COMB_D(0x2D6CF3A9, 0xF44D8B74), 0}},
+    {{COMB_D(0xE59380B8, 0x8E1B3B5B), COMB_D(0x348B86A2, 0x50D758B9), COMB_D(0x1DC4FED2, 0xD759617D), COMB_D(0x211BF35F, 0x99AEB7E4), 0},
+     {COMB_D(0x582AF3E9, 0xEA7F7187), COMB_D(0x189E7A8D, 0xF3361C66), COMB_D(0xF4CAD9E0, 0xDB4252D1), COMB_D(0xB0CDDEEB, 0x0C5D98D0), 0}},
+    {{COMB_D(0x3144874C, 0x780FD90F), COMB_D(0xA747E77B, 0x31D4B154), COMB_D(0xB58F9C14, 0x9A9A82FE), COMB_D(0xF8A5C5BC, 0x4589F834), 0},
+     {COMB_D(0xCE2CDE60, 0x30DD091C), COMB_D(0x4E0C2228, 0x171CAF1E), COMB_D(0x11DF563B, 0x8082A421), COMB_D(0x9DBBF6A9, 0xF9141759), 0}},
+    {{COMB_D(0xF28A51D9, 0xBE8AE106), COMB_D(0x14412641, 0xC83DB385), COMB_D(0x2003D33E, 0x58357BC6), COMB_D(0xC625FE84, 0xE1CF948B), 0},
+     {COMB_D(0x182A1FFE, 0x5AA2BBA6), COMB_D(0xB2406949, 0xC99A15BB), COMB_D(0x93516BA1, 0x23FC3E75), COMB_D(0xA7BFF8DB, 0x0A818545), 0}},
+    {{COMB_D(0xD8D79FA4, 0x0C84AF1C), COMB_D(0x082B106C, 0x16FCD590), COMB_D(0x16D5829F, 0x37EE90F2), COMB_D(0xEECB89C6, 0x38683CCD), 0},
+     {COMB_D(0x60688682, 0xD9EE37CF), COMB_D(0x99AB9D35, 0xEFB7D692), COMB_D(0xA1D65A37, 0xABFB8C95), COMB_D(0x74631006, 0x472C3280), 0}},
+    {{COMB_D(0xC98D942E, 0xBFD6C50A), COMB_D(0xD1E93A8F, 0x94D548E5), COMB_D(0xB7FBBC5C, 0xFD4DD228), COMB_D(0x92D8CAA2, 0x2168BA38), 0},
+     {COMB_D(0xC92B0292, 0x5C80E673), COMB_D(0xB5C18FFA, 0xC54A0358), COMB_D(0xFFC7D36F, 0x7457CB08), COMB_D(0x38BC4C72, 0xA22E2FF3), 0}},
+    {{COMB_D(0x5612E592, 0x487A1C30), COMB_D(0xEE3CD7CF, 0x9AD01A52), COMB_D(0xC5057CF0, 0xF38B96A7), COMB_D(0xA7FDE668, 0xCB8A7FEE), 0},
+     {COMB_D(0xAFBA7735, 0x6ED9D0FB), COMB_D(0x22EFE340, 0xCF4B988B), COMB_D(0x936CA5AB, 0x5D943D7F), COMB_D(0x12EDC29C, 0xAF9D3E5C), 0}},
+    {{COMB_D(0xC08004F8, 0x2605DD68), COMB_D(0x45F1E194, 0x42A7E794), COMB_D(0x0F131C93, 0x26754608), COMB_D(0x116DFE67, 0xB10A80A1), 0},
+     {COMB_D(0x424123FC, 0xF3B2AEFB), COMB_D(0xE730DF24, 0x435E0AFF), COMB_D(0x1A72EF30, 0xF8211089), COMB_D(0x2ED9EF56, 0x4545E7A7), 0}},
+    {{COMB_D(0x75043EC2, 0xC01DD288), COMB_D(0xA444A82B, 0x67A334C7), COMB_D(0x2F352532, 0xF58B8ED2), COMB_D(0x64B6A8EA, 0xAB358E2E), 0},
+     {COMB_D(0x13D330B9, 0xCA0FF970), COMB_D(0x645312C8, 0xEFC268DD), COMB_D(0xC18CE357, 0xD8B559CE), COMB_D(0x6DC68E42, 0xE6F1D698), 0}},
+    {{COMB_D(0xE3B3A47C, 0x0E8377B7), COMB_D(0x9DBB94CB, 0xEB7ADF94), COMB_D(0x5C92A12F, 0x6AC80257), COMB_D(0xDB166869, 0xE2B9D5EE), 0},
+     {COMB_D(0xC297E2BF, 0x527CD0E0), COMB_D(0x67CE0ED2, 0x0AAFE0A4), COMB_D(0xE7F0D77C, 0xDC34CD7A), COMB_D(0x8CE0A664, 0x128D27C1), 0}},
+    {{COMB_D(0x46184A49, 0xA338E0AB), COMB_D(0x85539036, 0xE831B40C), COMB_D(0x7D06D468, 0x5B2134F4), COMB_D(0x356CF4A9, 0x971B952A), 0},
+     {COMB_D(0xF786C601, 0xEBB82461), COMB_D(0x6B7E05FA, 0xC43508B5), COMB_D(0xA44B6C42, 0x0E1C9833), COMB_D(0xBF639612, 0x5DF976A9), 0}},
+    {{COMB_D(0x195501B6, 0xF28FEF83), COMB_D(0x7C0A2B39, 0x714E9AE6), COMB_D(0x0D86DF4E, 0x43330B1E), COMB_D(0xC5068748, 0xC7DE0F2F), 0},
+     {COMB_D(0x58CE7D1B, 0x35DE8BE1), COMB_D(0x109DA094, 0x80279BD0), COMB_D(0xFBE74154, 0xF542CFC0), COMB_D(0xFFFB08C1, 0x5BB6D992), 0}},
+    {{COMB_D(0xD78AFEC4, 0x94691C6E), COMB_D(0xB45ED4C3, 0x7852006E), COMB_D(0x4C1DCE74, 0xB78E09EF), COMB_D(0x1E104DB1, 0x383D471B), 0},
+     {COMB_D(0x46F2D286, 0x9EC454E9), COMB_D(0x610B9783, 0x173144AB), COMB_D(0x8D1A2BC0, 0xB33E3E75), COMB_D(0x87BF7756, 0x5583CFA2), 0}},
+    {{COMB_D(0x5FB14A63, 0x6770F759), COMB_D(0x048BE232, 0xDB463EF8), COMB_D(0xC95A2349, 0x3AFAFA57), COMB_D(0x045D8B12, 0xF9F8479B), 0},
+     {COMB_D(0x6F422158, 0xFB717E23), COMB_D(0x1DB81D8A, 0x4240EF6D), COMB_D(0xA16CB84D, 0xCD7C4C86), COMB_D(0x97922A67, 0xC321DA8B), 0}},
+    {{COMB_D(0xCEC9B4D7, 0x8E6D8483), COMB_D(0x82F2D7A8, 0x46967F0D), COMB_D(0x2958F49F, 0x1B6EE945), COMB_D(0x9C39CB60, 0xA33D563D), 0},
+     {COMB_D(0x94B3356F, 0x6B2C50FB), COMB_D(0xBBADE52F, 0x3DBE4368), COMB_D(0x03D196B7, 0xBCA16546), COMB_D(0xF097BF1E, 0xE493E510), 0}},
+    {{COMB_D(0x30F509DC, 0x7913C4E8), COMB_D(0xCAB4DBE4, 0x84EEA76F), COMB_D(0xFE31C638, 0xFB276B79), COMB_D(0xD99B1ED8, 0x98C2BA31), 0},
+     {COMB_D(0x7E8F3813, 0xB6FCFDB6), COMB_D(0x4BF719B8, 0xF7FC20BF), COMB_D(0xD996E86F, 0xCBD15BF9), COMB_D(0x91A4C2C9, 0x360767B7), 0}},
+    {{COMB_D(0xD4540A44, 0xF0D50B2A), COMB_D(0x9E5D3A50, 0x02C58092), COMB_D(0xFA4316A4, 0x50B22567), COMB_D(0xC518241F, 0x486D2C3B), 0},
+     {COMB_D(0x38F52C69, 0x4E23E2C9), COMB_D(0x225DBABF, 0x5C237752), COMB_D(0x249B00BD, 0x1B53B728), COMB_D(0x6CB9C279, 0xE92CB5CB), 0}},
+    {{COMB_D(0x11030399, 0x3ADF2BA3), COMB_D(0x9FA88DB9, 0x6746B108), COMB_D(0x00D3B523, 0xBA7E4CC6), COMB_D(0x55736AB4, 0x45DC9238), 0},
+     {COMB_D(0x5D7F3A49, 0x8E2867B3), COMB_D(0xBE3BBCBF, 0x90E6D536), COMB_D(0x6835CAC8, 0xA9576361), COMB_D(0xEB4C8225, 0x38E4EDA0), 0}},
+    {{COMB_D(0xD24F3C20, 0xE815891D), COMB_D(0x8EB58896, 0xAD635571), COMB_D(0xC22D47EA, 0x896AEC02), COMB_D(0xA93DBF7C, 0x7F6B4B1A), 0},
+     {COMB_D(0xBF2E00A2, 0xCF86B707), COMB_D(0x2200120D, 0xC75174E6), COMB_D(0x1D6407F0, 0xAAB6500E), COMB_D(0x6C9F0D8B, 0x44B3B1FC), 0}},
+    {{COMB_D(0x0CEC1E2B, 0x9A9BCC84), COMB_D(0xBF5A5B44, 0x7F292A20), COMB_D(0x08D4B001, 0x81EC29CF), COMB_D(0x15D8B420, 0x83F04BFB), 0},
+     {COMB_D(0x190DE246, 0x0989BDCC), COMB_D(0xC6D30CB9, 0xC69BAEBB), COMB_D(0xFBAB05C2, 0xF09036A2), COMB_D(0x7FD3744A, 0x818C97F9), 0}},
+    {{COMB_D(0x5CD92E08, 0xF0D341AF), COMB_D(0x78F94D14, 0x85E7A894), COMB_D(0x32633CED, 0xF1578338), COMB_D(0xF38E1C59, 0x31353457), 0},
+     {COMB_D(0x3FC68D25, 0xAC6AA2B0), COMB_D(0xF8B4B94B, 0x8174A0BB), COMB_D(0x93A208C9, 0x30DEBF00), COMB_D(0x56CA1A94, 0x631C8094), 0}},
+    {{COMB_D(0x5E5AF845, 0x621EA600), COMB_D(0xABF3B640, 0x091AE884), COMB_D(0x67C17AE4, 0xD324A191), COMB_D(0xF22CC483, 0xAB05BC2E), 0},
+     {COMB_D(0x3BBE8575, 0x6C612685), COMB_D(0x7CDDDD74, 0xFD92D111), COMB_D(0x50AA26A1, 0x3B18CC13), COMB_D(0x59D70571, 0x85C144A9), 0}},
+    {{COMB_D(0x0EB11E78, 0xE080D5D4), COMB_D(0x0C1DBD27, 0x2C8BB38F), COMB_D(0xF443092B, 0x9F1468DF), COMB_D(0x52404C95, 0x3058AC2B), 0},
+     {COMB_D(0x25A09B27, 0x7B26A28E), COMB_D(0xEA795720, 0xE1601974), COMB_D(0x8546C19E, 0x0C69B606), COMB_D(0x73E127C6, 0xDCB37853), 0}},
+    {{COMB_D(0xAE3D66BA, 0x50FFD1DD), COMB_D(0x9FDAF941, 0x7927E5F9), COMB_D(0xD2FD97BE, 0x20A59B6C), COMB_D(0x1988FB76, 0xFABE3EA1), 0},
+     {COMB_D(0x5AAB44AC, 0xAB020F3C), COMB_D(0xF713AABA, 0xE0605F57), COMB_D(0x29536C0D, 0x8C1060D3), COMB_D(0x8D97D654, 0xDC6636D3), 0}},
+    {{COMB_D(0x82477A87, 0x0A8D8DCB), COMB_D(0x1EC6E2C8, 0xE3DA2396), COMB_D(0x17BB8D7C, 0x6E3537CD), COMB_D(0xC9053545, 0x72B5D2C2), 0},
+     {COMB_D(0x1682FEA4, 0xB177EF48), COMB_D(0x5D19ADCD, 0x31D192AF), COMB_D(0x0F677396, 0x8A1D1A1B), COMB_D(0x78DBEBDC, 0x30ABF73E), 0}},
+    {{COMB_D(0x1CFA476E, 0x209A42D5), COMB_D(0xAB574B1F, 0xF8A75289), COMB_D(0xB850CD27, 0x0DB4785A), COMB_D(0xDD7F0911, 0x0615AD3A), 0},
+     {COMB_D(0x396A40F6, 0xE4F9C706), COMB_D(0x281EA0B0, 0xBC790D72), COMB_D(0x06D969D5, 0x8EB89757), COMB_D(0x1A0535E3, 0x7B38D710), 0}},
+    {{COMB_D(0x437E4037, 0xEC480550), COMB_D(0x8E66C782, 0x18A772B1), COMB_D(0xA3C91D7A, 0xF7E16C1A), COMB_D(0xE88DFF65, 0x0C53C118), 0},
+     {COMB_D(0x916B9D4F, 0xDB6DF434), COMB_D(0x014ED319, 0x49143221), COMB_D(0x8FC3CD5A, 0x67EE3128), COMB_D(0x288BAF55, 0x1BAD62A2), 0}},
+    {{COMB_D(0xCCCD780A, 0x8A35E855), COMB_D(0xA8C45EE4, 0xF2A08EE1), COMB_D(0x88F8F934, 0x2045CC78), COMB_D(0x6C9905FA, 0xA2BEF6BB), 0},
+     {COMB_D(0x080C2057, 0xDC470B2D), COMB_D(0x1794722A, 0x3B7B1736), COMB_D(0x21F07489, 0x97BEA2EF), COMB_D(0xA28E3457, 0x9CACCF5E), 0}},
+    {{COMB_D(0xD39C065A, 0x47EDE10C), COMB_D(0xE078D79E, 0xE4A87019), COMB_D(0x2E801AA2, 0x5BC680C2), COMB_D(0x97A43999, 0xDBBA0075), 0},
+     {COMB_D(0x9516FF30, 0x53D4634A), COMB_D(0x858B9D5D, 0x8924D37E), COMB_D(0x1BF332FC, 0xD9BDD82E), COMB_D(0x65CE18F4, 0xF3DC8C55), 0}},
+    {{COMB_D(0x8A38B5A5, 0xD6BF3827), COMB_D(0x79E1A594, 0x1F481AC9), COMB_D(0xE4EB1D71, 0xFC889302), COMB_D(0xDE3031B5, 0x8537DD7D), 0},
+     {COMB_D(0xA8C24220, 0xB0C2D624), COMB_D(0x97C1C261, 0x0AACB764), COMB_D(0x52DF8BDE, 0x0098F736), COMB_D(0xCCD3DFFA, 0xA2C7842E), 0}},
+    {{COMB_D(0x2C516D49, 0x73680126), COMB_D(0xB2A9233A, 0xF95E823E), COMB_D(0xF46FDED1, 0x1BDF79F8), COMB_D(0x7F33CBF7, 0x6EFDF29B), 0},
+     {COMB_D(0xF916745C, 0xEF5348EB), COMB_D(0x47D4DDC4, 0x591FD75A), COMB_D(0xF63CB83B, 0x58B599C0), COMB_D(0xDF6B5DA3, 0x30969049), 0}},
+    {{COMB_D(0x8934C82C, 0x690F2D6F), COMB_D(0xF3DF2D3B, 0x83853A59), COMB_D(0x42E7CAED, 0x3AA518B1), COMB_D(0x8722279D, 0x94763448), 0},
+     {COMB_D(0xA75A1AB9, 0x0808BE6D), COMB_D(0x82D2B0ED, 0xF69BAB0B), COMB_D(0x52B2362E, 0xBB0523E1), COMB_D(0xD650DF58, 0x7BCF4DC6), 0}},
+    {{COMB_D(0x2CC02C64, 0x655C3399), COMB_D(0x3B572C64, 0x12C76DBB), COMB_D(0x8C92ECF3, 0xB971E2A4), COMB_D(0x76C1D21F, 0x37E38E4C), 0},
+     {COMB_D(0xE44732B1, 0xC048988A), COMB_D(0x260A9A2D, 0xE0B60B97), COMB_D(0xBF639D90, 0x417CB58B), COMB_D(0x35730851, 0x3C1561C1), 0}},
+    {{COMB_D(0xD781F974, 0x001DA360), COMB_D(0xFEEDF931, 0x1DF4D223), COMB_D(0x88348A3C, 0x291E9EC8), COMB_D(0x75383AA6, 0xAAA55E53), 0},
+     {COMB_D(0x7F02FFD8, 0x48C25138), COMB_D(0x63C5AFBB, 0x601642B9), COMB_D(0xD53A5AF7, 0x288B8A53), COMB_D(0x66D06313, 0xD881069C), 0}},
+    {{COMB_D(0x44C8246B, 0x3076F0CF), COMB_D(0xD7B6CAA9, 0xC886A059), COMB_D(0xEC0BB059, 0x74BF4D5E), COMB_D(0x7824BA76, 0x6DA5E4C1), 0},
+     {COMB_D(0xACF4735F, 0x274CDF30), COMB_D(0xC39A1E92, 0x1946667D), COMB_D(0x8EA2F740, 0x56E9D895), COMB_D(0xB48B9197, 0x16DCD506), 0}},
+    {{COMB_D(0x8998F2BD, 0xA13381F3), COMB_D(0xFDA76885, 0xCE9924B1), COMB_D(0x4FF827F6, 0x6A45ED4E), COMB_D(0xD1897551, 0xFEAE4603), 0},
+     {COMB_D(0x29B83192, 0x6AC078FE), COMB_D(0xBF8980C7, 0xBF049702), COMB_D(0xCAA575BC, 0x0BF349F8), COMB_D(0x83B40979, 0x38A7A855), 0}},
+    {{COMB_D(0x283D60DE, 0xC6C47A75), COMB_D(0xED53A3D8, 0xAD04FC83), COMB_D(0x1AA7A552, 0x74A66A77), COMB_D(0x7E2639B5, 0xE1049D31), 0},
+     {COMB_D(0x8AC77FD1, 0x215F2315), COMB_D(0xF7D55A54, 0xFE5C639F), COMB_D(0xDB8D396C, 0xF2AE4D84), COMB_D(0x1A32E8C1, 0xC2DC43F9), 0}},
+    {{COMB_D(0x722853CD, 0xF70766CE), COMB_D(0xC53593B7, 0x77DFC064), COMB_D(0xC0BDF2F3, 0x5F63AD97), COMB_D(0xE6E3AB62, 0x966585F5), 0},
+     {COMB_D(0xC8CE6B05, 0xEC0B712D), COMB_D(0x78F5CAAF, 0x77BC547C), COMB_D(0x5059137F, 0x9423C0AD), COMB_D(0x7A9FCD87, 0x0EAAA67E), 0}},
+    {{COMB_D(0x5343EBCB, 0x1CC90E46), COMB_D(0x4CBE69B8, 0x85EA85F6), COMB_D(0x75952D25, 0x230967D6), COMB_D(0xBBE79F6B, 0x7B681B02), 0},
+     {COMB_D(0x3DB78884, 0x42B30866), COMB_D(0xCAB0BA61, 0xC59769D0), COMB_D(0x6F74EC54, 0x659A1F84), COMB_D(0x7086A8DF, 0x43556D68), 0}},
+    {{COMB_D(0x974BFD19, 0x02838071), COMB_D(0x82ED3987, 0x28826739), COMB_D(0xB85B4B50, 0x58958FAD), COMB_D(0x98184A30, 0xBA863C7A), 0},
+     {COMB_D(0x22539368, 0x113DB2BE), COMB_D(0xA749454A, 0x642516A6), COMB_D(0x4CF32D82, 0x0F3625A0), COMB_D(0xF7C8E7CC, 0xF1B77DD9), 0}},
+    {{COMB_D(0x949CE240, 0x9E170B48), COMB_D(0x71DEF13B, 0xBA4D2535), COMB_D(0xA0617915, 0x6B8AA785), COMB_D(0xD90FF1F9, 0x5715A6A1), 0},
+     {COMB_D(0xA6930A99, 0x112D2635), COMB_D(0xAF61E132, 0x6CCF8B95), COMB_D(0xD4F235C4, 0x98685198), COMB_D(0xDEA78DD7, 0x59B4A428), 0}},
+    {{COMB_D(0x08773879, 0x7C3CC489), COMB_D(0xBCB7BB5A, 0x58B495AA), COMB_D(0x6C73236E, 0x83E7E982), COMB_D(0xC9EE8E96, 0x7A38FFDB), 0},
+     {COMB_D(0x39A183F5, 0x7A6F391E), COMB_D(0x38EA3087, 0xE14B9508), COMB_D(0xE19FBFEB, 0xC743ECC6), COMB_D(0x0478597D, 0x4323C4F8), 0}},
+    {{COMB_D(0x67CCBF46, 0xDE3B6A1E), COMB_D(0x52309E89, 0x8917495C), COMB_D(0xE631A66F, 0xD188430E), COMB_D(0xB499A5BD, 0x3013A110), 0},
+     {COMB_D(0x913793E7, 0xF8FD78E5), COMB_D(0x990951A1, 0x87074F8C), COMB_D(0x62A2495D, 0x09ED36AF), COMB_D(0xC7A44885, 0xFEB8FAD5), 0}},
+    {{COMB_D(0xE8E55FD1, 0x174ABDAA), COMB_D(0xFBD473E7, 0xD306B13B), COMB_D(0xDF9E4E98, 0xD901492D), COMB_D(0xEE95F777, 0xD9F3231F), 0},
+     {COMB_D(0x04A84B23, 0x31C91645), COMB_D(0xFA29C6D0, 0xEA98A9FF), COMB_D(0xBE76D914, 0x3A3D6331), COMB_D(0xAA1C1AF9, 0x88D3B6A7), 0}},
+    {{COMB_D(0xB0283E9D, 0xAAC4546B), COMB_D(0x50587526, 0x23739B82), COMB_D(0x1BEAB267, 0xF6732842), COMB_D(0x435D90FD, 0x4447094D), 0},
+     {COMB_D(0xC31567F7, 0x3282821B), COMB_D(0xB5E8CBED, 0x6D5A719C), COMB_D(0x12D47372, 0x5BF56FE2), COMB_D(0xF9A42E3A, 0xBD3F404A), 0}},
+    {{COMB_D(0xB968D370, 0xA0111FE6), COMB_D(0x2AC6768D, 0xAA3424C0), COMB_D(0xC59F9160, 0xFE80A045), COMB_D(0xBCD3216A, 0x558FE38C), 0},
+     {COMB_D(0x56840D9C, 0xB222EF22), COMB_D(0x6C4B82B0, 0xED114C06), COMB_D(0x10F1F170, 0xED81CF70), COMB_D(0xE50C8147, 0xDE1D0DB6), 0}},
+    {{COMB_D(0xD80EFC34, 0x662A7E64), COMB_D(0xB14C4E84, 0xC25643BD), COMB_D(0x18EED7D0, 0x0FC3F199), COMB_D(0x50A22854, 0x2CBC3908), 0},
+     {COMB_D(0xE42A53B7, 0x84C18A96), COMB_D(0x864958B6, 0xCF0AE60B), COMB_D(0x3D0D7C20, 0x45FAA6A0), COMB_D(0x043218B9, 0x5DEF3C8E), 0}},
+    {{COMB_D(0xD9A7D2D6, 0x4053376E), COMB_D(0xCA82CDE0, 0x17DCAD8C), COMB_D(0x83403B9F, 0xE2783F00), COMB_D(0xFF201FA1, 0x108E64F2), 0},
+     {COMB_D(0xBA85B6C8, 0x4EF05DF6), COMB_D(0x75376870, 0x0B15BB31), COMB_D(0x4EB12EBA, 0x3545553B), COMB_D(0xE70B7558, 0xEB52A343), 0}},
+    {{COMB_D(0x75056441, 0x7E86475E), COMB_D(0xAB028D7F, 0x98335794), COMB_D(0xD0B17C5A, 0xD0AF752C), COMB_D(0x1341F648, 0xA97AB8FD), 0},
+     {COMB_D(0x555EC9F7, 0x7144F59F), COMB_D(0x5274E1E8, 0x9B1956C6), COMB_D(0x45AD3070, 0x7E0E3512), COMB_D(0x4EB574FB, 0x9E39DFBD), 0}},
+    {{COMB_D(0x6A7F150B, 0xD75A42C4), COMB_D(0x4BDBFC68, 0xE1F6B78D), COMB_D(0x3C5C7569, 0x0142AA0D), COMB_D(0xAC3EF973, 0xDD1A4F9C), 0},
+     {COMB_D(0x49F04F46, 0x444271FB), COMB_D(0xC0AA5122, 0xFE0C3202), COMB_D(0xF0C61AF2, 0x59DD8D02), COMB_D(0x10CC34C2, 0x34A8F6A1), 0}},
+    {{COMB_D(0xCD097698, 0x770921D2), COMB_D(0xC942233D, 0x754D82A0), COMB_D(0x846562E3, 0xFB4E9EF1), COMB_D(0xDC9F81F4, 0x344896D0), 0},
+     {COMB_D(0xA6274ADA, 0xD5BBEA19), COMB_D(0xB3F2965E, 0x391AEAC1), COMB_D(0xEDA93401, 0xB329A11C), COMB_D(0x8CCA4ABA, 0xBD75282A), 0}},
+    {{COMB_D(0x4B46292C, 0xB05EF885), COMB_D(0x27EE0FAD, 0x341EDA68), COMB_D(0xFF3EF391, 0x1B9CAD85), COMB_D(0x35414922, 0xE81F7EF7), 0},
+     {COMB_D(0x39C8A205, 0x86C70E60), COMB_D(0x9D393967, 0x2A549411), COMB_D(0x40EDA7CD, 0xE7192209), COMB_D(0xBF943821, 0xD6A2CDF4), 0}},
+    {{COMB_D(0xA08FDFCA, 0x2CDCC330), COMB_D(0xC107F083, 0x7C972965), COMB_D(0x05CCDBCA, 0x1A612971), COMB_D(0x36E4CB28, 0x2F167158), 0},
+     {COMB_D(0x0EBAAB37, 0x0E38DA95), COMB_D(0xA5D4E525, 0xEC9B1844), COMB_D(0x847D1CEC, 0xB53E5236), COMB_D(0x768DDB5E, 0x40105A04), 0}},
+    {{COMB_D(0x7AFF18F3, 0x74CC2D0D), COMB_D(0xCF628322, 0x59D5E259), COMB_D(0xA018E147, 0x20F3ABC8), COMB_D(0xA1F200A9, 0xAB8D326D), 0},
+     {COMB_D(0x3683E2B9, 0x6F2989A0), COMB_D(0x7A62F4C2, 0xA3C4DBE1), COMB_D(0x897AEA6E, 0x6D4655BC), COMB_D(0x93C55B36, 0x43A191A5), 0}},
+    {{COMB_D(0x8E5AB7BE, 0x9DBE4AA0), COMB_D(0x561F0A79, 0x60DA1CC2), COMB_D(0xD776671A, 0xA9642FDE), COMB_D(0xD84D8DE8, 0x90F95405), 0},
+     {COMB_D(0x36CF7FD2, 0x404C8FD0), COMB_D(0x25004D01, 0xF5B0FB8F), COMB_D(0x0BB9E45F, 0x3066C00D), COMB_D(0x4ABE9615, 0x4CF5AB81), 0}},
+    {{COMB_D(0x2C822D58, 0x80F138BC), COMB_D(0x73D27215, 0x91F6273D), COMB_D(0x982649E5, 0x1FF4A8A9), COMB_D(0xD0FC2EBD, 0x668E770C), 0},
+     {COMB_D(0x8F54617E, 0x1A2B29AC), COMB_D(0x9EC17E80, 0x06CC01EB), COMB_D(0x2F3421F1, 0x25BB682D), COMB_D(0xF50AA621, 0xD9744678), 0}},
+    {{COMB_D(0xBAF15B80, 0x72F30763), COMB_D(0xB51FC741, 0xE312D7E2), COMB_D(0x1D9113A4, 0xCC9F6A3C), COMB_D(0x17D8718D, 0xDC310FDB), 0},
+     {COMB_D(0x781B7342, 0x207103D3), COMB_D(0x31911D91, 0x9B4DB72E), COMB_D(0xF6C251DA, 0xD1897DF4), COMB_D(0x71C0BBBA, 0xFA65E8C5), 0}},
+    {{COMB_D(0x38013E7B, 0x738A556D), COMB_D(0xFE415988, 0xD6FF9B02), COMB_D(0xA6338012, 0x2DA203D5), COMB_D(0xEE4D9C42, 0x659B957A), 0},
+     {COMB_D(0x5C840DB6, 0xC815D161), COMB_D(0xE5070BE1, 0x206DC5E5), COMB_D(0xE1F48531, 0x8C1D8426), COMB_D(0x77D9193A, 0x4BC8385F), 0}},
+    {{COMB_D(0x626F0885, 0xEDAD2980), COMB_D(0x208416CF, 0x2404D8C6), COMB_D(0xF4277515, 0x5FF4DEDB), COMB_D(0xEF98B317, 0xA917E8D2), 0},
+     {COMB_D(0xCB1CBE52, 0x560D71DE), COMB_D(0x2181D4D8, 0x355B2044), COMB_D(0xF9A05131, 0x34A88012), COMB_D(0xFBAE47C1, 0x39B727BF), 0}},
+    {{COMB_D(0xEEB19DD7, 0x2DF76969), COMB_D(0xDB7BB928, 0xA575D661), COMB_D(0x9B6C072B, 0xBB9B62DC), COMB_D(0x729AB2A7, 0xEEE79378), 0},
+     {COMB_D(0x86760511, 0x38A13277), COMB_D(0x73DA4980, 0x0B852495), COMB_D(0x5BDE0E7F, 0xF71FFD98), COMB_D(0x2CB18F61, 0x5DD0C8D5), 0}},
+    {{COMB_D(0x3F91D5B2, 0x9A601069), COMB_D(0xBBC69A74, 0x36FDB85E), COMB_D(0x935F6F7A, 0x44B208E5), COMB_D(0xA7DA818B, 0x7A433FDE), 0},
+     {COMB_D(0x1C6AC602, 0xABC02EBC), COMB_D(0x9B43FC71, 0x71E64428), COMB_D(0xD052300A, 0xD759D9D8), COMB_D(0x713B6E3B, 0x9026D85A), 0}},
+    {{COMB_D(0x1E433934, 0x1B619B3E), COMB_D(0x463B6F62, 0x6891AF90), COMB_D(0x64E42520, 0xEC8761A0), COMB_D(0x3CBB4A65, 0x59DBBA77), 0},
+     {COMB_D(0xEF9F4DC0, 0x3C759744), COMB_D(0xC1DAE508, 0xB89684CA), COMB_D(0x02758720, 0x29703BB4), COMB_D(0x1260ECF6, 0xCC9995CC), 0}},
+    {{COMB_D(0x420995E0, 0xFC081654), COMB_D(0x0469A8F0, 0xBC8CC88E), COMB_D(0x3BFEC2FE, 0x9E8310C0), COMB_D(0x08C93E27, 0x2D98F998), 0},
+     {COMB_D(0x0F814B64, 0x9B229066), COMB_D(0xFB718743, 0x08665879), COMB_D(0xAB5BCF4E, 0x03632841), COMB_D(0xF667CF2E, 0x6DA1478A), 0}},
+    {{COMB_D(0xEDF67990, 0x7970EA6B), COMB_D(0x7504E3C6, 0x499A3994), COMB_D(0x1F2F6789, 0x909DB4C6), COMB_D(0x9F6A178E, 0xB0DD4B3A), 0},
+     {COMB_D(0x36029C5C, 0xA2839EB3), COMB_D(0x67638406, 0x6B604708), COMB_D(0x39D149E2, 0xEE2E6A4B), COMB_D(0xDE98A923, 0xD1DB6596), 0}},
+    {{COMB_D(0x1D9A36EC, 0x6A3AB433), COMB_D(0x919CADC0, 0xB15BB6AD), COMB_D(0xDF7E3E59, 0xC0B3035E), COMB_D(0x27D42F6B, 0x4E12B787), 0},
+     {COMB_D(0x18FC87BD, 0xB91D37E0), COMB_D(0xC557FFB7, 0xDF403A87), COMB_D(0xB559B364, 0xE83B7FEC), COMB_D(0x6A79632F, 0x2DC1C1A8), 0}},
+    {{COMB_D(0x31112AA9, 0x2DCDB5BE), COMB_D(0x12C57CF8, 0x68107D2E), COMB_D(0xF311D10E, 0x47EFC770), COMB_D(0xC85DFBAD, 0x86661C89), 0},
+     {COMB_D(0xACAF2069, 0xD6DB38BB), COMB_D(0x53742395, 0x1C9A971C), COMB_D(0x7419C391, 0x13B31C17), COMB_D(0x882CD4A7, 0xD19AA7DF), 0}},
+    {{COMB_D(0xB62EAAB0, 0xD05D8ACE), COMB_D(0xBD879317, 0xFD9237A6), COMB_D(0xFDE20A4E, 0x0C078891), COMB_D(0xBCAAC8C9, 0x14494749), 0},
+     {COMB_D(0x50D8EDEB, 0xF4196BE2), COMB_D(0x2981A548, 0xCE7237F8), COMB_D(0x95D39B68, 0x76DDBF2C), COMB_D(0x22FAE66B, 0xDE660E90), 0}},
+    {{COMB_D(0xAF75322A, 0x075B0D51), COMB_D(0xB0EBD719, 0xF5058AA7), COMB_D(0xD5D8B4E0, 0xBDA28F2B), COMB_D(0x871CCDCF, 0xA652A1A9), 0},
+     {COMB_D(0xFE13FFA0, 0x4B114F8A), COMB_D(0x49867AFB, 0xAC2B9300), COMB_D(0x8BD09B08, 0xA83A7B11), COMB_D(0x89AEF5D4, 0xA061E54F), 0}},
+    {{COMB_D(0xFCA1C9D5, 0x5A737BBA), COMB_D(0x9D0F1494, 0x9E9DCAFC), COMB_D(0x6F1B4243, 0x7333C13E), COMB_D(0x0745C4C9, 0xAEDD0FCB), 0},
+     {COMB_D(0xF34384AB, 0x9978622B), COMB_D(0x45B92CA8, 0xE749C4A3), COMB_D(0x7F7676A5, 0x4FCF0D16), COMB_D(0xA987B782, 0xFC834282), 0}},
+    {{COMB_D(0x5173B1F7, 0xAC91B881), COMB_D(0x1DFD7553, 0x040E93BE), COMB_D(0x1C4A52AA, 0x78067D8E), COMB_D(0xBBEC5CD8, 0x7043B2BA), 0},
+     {COMB_D(0xF50FC883, 0x9C195B20), COMB_D(0x585B6AE1, 0xE8BE7B34), COMB_D(0x5F1B7DEB, 0x72AC4B16), COMB_D(0xB924FD7F, 0x7E035390), 0}},
+    {{COMB_D(0x7D269F38, 0x9A67B7F3), COMB_D(0x7B2B31A6, 0x1BAADB67), COMB_D(0xCF5CAE44, 0xAE198208), COMB_D(0x40155854, 0x4EFF9838), 0},
+     {COMB_D(0x04A117EC, 0x65B342CB), COMB_D(0xF159ABBB, 0x26E77CBD), COMB_D(0x9B5D8267, 0xA56720AB), COMB_D(0xCB8E1C37, 0x1580F038), 0}},
+    {{COMB_D(0x50199A9D, 0x460025F8), COMB_D(0x659629D5, 0x341C0698), COMB_D(0x4A3F13B1, 0x213F2790), COMB_D(0xD2671CA7, 0xF48006C3), 0},
+     {COMB_D(0x6F76860D, 0xAC2EE9F3), COMB_D(0x25E396B3, 0xC00F86BC), COMB_D(0xB8F0B652, 0x6E60334D), COMB_D(0x665EE025, 0x379585A9), 0}},
+    {{COMB_D(0x20B0CFA4, 0xA9EF3AB5), COMB_D(0x20F1CDF3, 0xB7A82108), COMB_D(0x4CABA5D0, 0x76ADF2C1), COMB_D(0x4D6F6D09, 0xE81DD987), 0},
+     {COMB_D(0x0E6CED18, 0x49F666B0), COMB_D(0xAEB446FE, 0x1B0F41C8), COMB_D(0x1715D734, 0x0DCCE523), COMB_D(0x16C2D8B7, 0xF6B3DAA8), 0}},
+    {{COMB_D(0x8C5A1FD2, 0x8C70B57A), COMB_D(0x82F62877, 0xCAD8E534), COMB_D(0x0C0C8D27, 0x5926E57E), COMB_D(0x6D9A9AAD, 0x9172F9FF), 0},
+     {COMB_D(0x02E37BE7, 0x64E49AC5), COMB_D(0x62F76394, 0xB82F46D0), COMB_D(0x98468E9B, 0xF1D7FA45), COMB_D(0x9D710230, 0x20B4CAEC), 0}},
+    {{COMB_D(0xB10FC53B, 0x315BB1BA), COMB_D(0x1D4E9512, 0x55A62AE9), COMB_D(0x736DEF9C, 0x6C9C3B84), COMB_D(0x93BDAF37, 0x60AE979C), 0},
+     {COMB_D(0x1E61D2D8, 0x98932A7B), COMB_D(0xBC7B27E7, 0xA83E7853), COMB_D(0xA1099CF4, 0x8C361F92), COMB_D(0x96C5E3D3, 0xC786A079), 0}},
+    {{COMB_D(0x0FC27839, 0xDDBB7DA8), COMB_D(0xDBC48AB5, 0x0A5AA182), COMB_D(0x96AF69B9, 0xD3685615), COMB_D(0x015935AA, 0xDE3E1424), 0},
+     {COMB_D(0x9632E440, 0x4B194401), COMB_D(0xF8734931, 0x9DCF31CE), COMB_D(0x67A65758, 0x4C696C12), COMB_D(0x9F67F8AB, 0xADFBF3AA), 0}},
+    {{COMB_D(0xC5CC8DF1, 0xFAA1423E), COMB_D(0xE86AA493, 0x7D40F1EA), COMB_D(0x54F38B84, 0xE3480CB4), COMB_D(0xBB459796, 0x9A6797F0), 0},
+     {COMB_D(0xC10D82BC, 0xA215595E), COMB_D(0x93324A3D, 0x7C7C85F2), COMB_D(0x08819A50, 0x5CF0251D), COMB_D(0xC5A2A673, 0xC13A60CD), 0}},
+    {{COMB_D(0x08EDA7DA, 0xEBAC1B91), COMB_D(0x435A4AFB, 0xF25AD54C), COMB_D(0xD8369622, 0x0C05D994), COMB_D(0xD2D78E14, 0xEC874346), 0},
+     {COMB_D(0x36EB8848, 0xEAE88B55), COMB_D(0xC06CA509, 0x5A54E6CD), COMB_D(0x322F2AF7, 0xE195A377), COMB_D(0x07DFF0FB, 0xC4B76412), 0}},
+    {{COMB_D(0xF8A42F39, 0x747D7676), COMB_D(0x5CF9A7C9, 0x3F9606AF), COMB_D(0x2E2F0A6D, 0xAE5A6D19), COMB_D(0xB93288E3, 0xE4B387E8), 0},
+     {COMB_D(0x7F00D996, 0xB52165D3), COMB_D(0x83C6A180, 0x795CF5C8), COMB_D(0x5B32F108, 0x8179F3B1), COMB_D(0xD0CBA558, 0xE9A1FE58), 0}},
+    {{COMB_D(0xF1C4BE6E, 0xB63FBB6B), COMB_D(0xC48CCE2B, 0xBAFB3322), COMB_D(0x5E5B656C, 0xA7425998), COMB_D(0x5B29DAD0, 0x1D986161), 0},
+     {COMB_D(0x681ECDEE, 0xE6CF380F), COMB_D(0x8FD7B9A4, 0x0D30221C), COMB_D(0xA6AEAD36, 0x34DDD477), COMB_D(0x196137C2, 0x43EB69D6), 0}},
+    {{COMB_D(0x532BA785, 0xBCABFEFE), COMB_D(0x724B7A9D, 0x58C91964), COMB_D(0x03EDE64A, 0x146DFCAA), COMB_D(0xC69C46CD, 0x09CF19E5), 0},
+     {COMB_D(0xB2F652D9, 0xCF304C95), COMB_D(0x79BA2004, 0x451BE596), COMB_D(0x266107A8, 0x5822ECE8), COMB_D(0xF20C0A71, 0xD9622679), 0}},
+    {{COMB_D(0x213E3BBE, 0xDB710A68), COMB_D(0x4DB9AC90, 0xC47D7BF1), COMB_D(0xAE8107D8, 0x74B4CC19), COMB_D(0x30256603, 0xEA04C883), 0},
+     {COMB_D(0xA188B0FF, 0x15C97D97), COMB_D(0xA3595F9F, 0xBE47F9FF), COMB_D(0x52D598C0, 0x9CB23655), COMB_D(0x741F2431, 0x8166749D), 0}},
+    {{COMB_D(0xE6404C4D, 0x5C74747F), COMB_D(0x2C0EA7F8, 0x687E58A7), COMB_D(0x92E3C58D, 0x3052F3F4), COMB_D(0xF27DCEB8, 0x95EA899D), 0},
+     {COMB_D(0x2EE12793, 0xCCBF1A4E), COMB_D(0x7BEEAD7F, 0xEFF0A6B9), COMB_D(0x715C1702, 0x7BD14BEB), COMB_D(0xFC794BDE, 0xA90D0CF0), 0}},
+    {{COMB_D(0x54C7D0FB, 0xE19EE4DC), COMB_D(0x3FB71EBF, 0xD6176115), COMB_D(0xAC627D73, 0x3BC20428), COMB_D(0xCEDE26DD, 0xB8EAF613), 0},
+     {COMB_D(0x8E6637A0, 0xE2B1C39E), COMB_D(0xF8360AC0, 0x990929FA), COMB_D(0x51EA6B24, 0x8B66019D), COMB_D(0x19475421, 0x78710626), 0}},
+    {{COMB_D(0x108080FE, 0xEE1FBBEA), COMB_D(0x16ADDAA7, 0x41DE0FD8), COMB_D(0xE57920C3, 0xEC458ED8), COMB_D(0x5EFBB28C, 0x466C9704), 0},
+     {COMB_D(0xBC309B61, 0x77834B69), COMB_D(0xA0051ECA, 0xBFB1EBC1), COMB_D(0xD8EFB68D, 0xF61C8D50), COMB_D(0xE23A08A2, 0x403907BF), 0}},
+    {{COMB_D(0xFC594204, 0xAB8E54F2), COMB_D(0x446ABA26, 0x59D16EE4), COMB_D(0x364981AB, 0xEAF2C957), COMB_D(0x4800B051, 0xAF1BED70), 0},
+     {COMB_D(0xDD117047, 0x2545A0B0), COMB_D(0x362F38C1, 0x306CA267), COMB_D(0xB4F4AE68, 0xECF652F1), COMB_D(0xBD186F44, 0x8FC1206F), 0}},
+    {{COMB_D(0xC035008E, 0x0F87E7B1), COMB_D(0x52C9F5E6, 0x26E8D5F3), COMB_D(0x959C5576, 0x105D2F85), COMB_D(0x49F25C23, 0xB35D8454), 0},
+     {COMB_D(0x3235E9DE, 0xDA94A25B), COMB_D(0x39C0D85F, 0xEDBB568F), COMB_D(0x3A1840DB, 0x076D1871), COMB_D(0xB1CAE64B, 0xE6233535), 0}},
+    {{COMB_D(0x3E2E687A, 0x93F517E4), COMB_D(0xF9BCC04C, 0xEE889493), COMB_D(0x9138F181, 0xFC2B0559), COMB_D(0x86AF95E0, 0xC8A37C08), 0},
+     {COMB_D(0xD400A824, 0x7C1A9231), COMB_D(0xD7E3CC2D, 0x7E49A81A), COMB_D(0x420F3027, 0x7CEB2C63), COMB_D(0x275BFECE, 0x5A45F619), 0}},
+    {{COMB_D(0x4F21A8EE, 0x022FD5FF), COMB_D(0x03E02210, 0xB33EF3F6), COMB_D(0xC52BE811, 0xD836C785), COMB_D(0xF1632C7A, 0x184841C9), 0},
+     {COMB_D(0x944D4A96, 0x97A1EF53), COMB_D(0xBCB33D42, 0x01DEC5EE), COMB_D(0xFEE11C20, 0x4B225859), COMB_D(0x7C32F635, 0x3EA98301), 0}},
+    {{COMB_D(0x7C221C0A, 0x85D970DB), COMB_D(0x6449AF75, 0x3FCDBC8A), COMB_D(0xA330C852, 0xFAB46C7A), COMB_D(0x3A994D02, 0x592BB34A), 0},
+     {COMB_D(0x1F462A2C, 0xA948A7CD), COMB_D(0xC7C2B996, 0x21ED0DFE), COMB_D(0xD19FD64C, 0xDE476AC7), COMB_D(0x1C8EFECB, 0xEA2C2EF8), 0}},
+    {{COMB_D(0x60527460, 0x3AB5583B), COMB_D(0xBC3DF8A2, 0x24AB7D10), COMB_D(0x4C96DB07, 0x35C0CAFB), COMB_D(0x6C058E7B, 0xE9B0FC3C), 0},
+     {COMB_D(0xCC87EF55, 0x35E9F3E6), COMB_D(0xC8C941ED, 0xB0EA0571), COMB_D(0xD9AC1DCC, 0x0111B9A8), COMB_D(0x716A62FD, 0xED24A9C1), 0}},
+    {{COMB_D(0xE803F893, 0xD93B72E2), COMB_D(0xF2173EC8, 0x4C79CADA), COMB_D(0xAB4875B3, 0x8B718FC4), COMB_D(0x2EB370A9, 0xADF8BB78), 0},
+     {COMB_D(0x282DD7BF, 0x101BBDEF), COMB_D(0x1E876889, 0x46DFD125), COMB_D(0xA5A4A705, 0xAD070E93), COMB_D(0x638921D5, 0x9B91FBF3), 0}},
+    {{COMB_D(0xBBA23AA9, 0x7A1EC426), COMB_D(0xC2EAC107, 0x28E62B54), COMB_D(0x0861AA9B, 0xEA2C8108), COMB_D(0xE26CA226, 0x1CF397E6), 0},
+     {COMB_D(0xA1C65B20, 0x76634CA7), COMB_D(0xF6EF083B, 0x5B7801B4), COMB_D(0x857A4DB1, 0x883903ED), COMB_D(0x0F7F60CA, 0x7A1FB62B), 0}},
+    {{COMB_D(0xDD36517D, 0x9656B118), COMB_D(0x60E7D311, 0x7FB1794D), COMB_D(0xDBE0559A, 0xFBA6D851), COMB_D(0x09338EBE, 0x6A8A8C34), 0},
+     {COMB_D(0x32C6E5B1, 0x596F817B), COMB_D(0xEA83AB78, 0xB086C446), COMB_D(0x6966517E, 0xAD77DC1E), COMB_D(0xFD20BAA1, 0x3D1A8A87), 0}},
+    {{COMB_D(0x2EA4A28A, 0xD5A45FBA), COMB_D(0xE2401FA7, 0x067219BC), COMB_D(0xBB95A052, 0xC1899E2F), COMB_D(0x1520E86F, 0x593F2DF8), 0},
+     {COMB_D(0xE8817173, 0x01FB0260), COMB_D(0xFC0276BE, 0xF62C0CAE), COMB_D(0x66C6E5FD, 0xB7880325), COMB_D(0xB51724B0, 0xC1448AA9), 0}},
+    {{COMB_D(0x776DA3C4, 0x1137FADF), COMB_D(0xFD518614, 0xD9FD646D), COMB_D(0xF4D71CA0, 0xEA221BC7), COMB_D(0x1301D85C, 0xBD1D94F3), 0},
+     {COMB_D(0x9B3D6DF8, 0x08A990B0), COMB_D(0x5C7F93DE, 0xF58374EB), COMB_D(0xB862F2DA, 0x8C0078B9), COMB_D(0xC357FDBE, 0x8F09EEA5), 0}},
+    {{COMB_D(0xA682E988, 0x1E0E415D), COMB_D(0xC886A615, 0x20A8EDB0), COMB_D(0x13A8F6EC, 0x265D1C33), COMB_D(0x0F0C222C, 0x1EDCA104), 0},
+     {COMB_D(0x4C4684F4, 0x904C3BC1), COMB_D(0x044A1DEB, 0x50BF5003), COMB_D(0x24CD7409, 0xBA59C6A6), COMB_D(0xD03F1BD6, 0x5F33C11F), 0}},
+    {{COMB_D(0xCE166DC1, 0xB4ED6863), COMB_D(0x752D9C10, 0x9290D276), COMB_D(0x87390CDB, 0x23E29F57), COMB_D(0xD4E7CFD7, 0x2A9F805E), 0},
+     {COMB_D(0xF16F8E71, 0x3A90F0DA), COMB_D(0x91C4EA20, 0xC4912D59), COMB_D(0xDEF5FC11, 0xA02C4CDB), COMB_D(0x369CEEF6, 0xCB1EBABD), 0}},
+    {{COMB_D(0x335D145F, 0x6CDFC7E2), COMB_D(0xBA8D2AC4, 0xA9D249EA), COMB_D(0x3EE5A7BD, 0x84156F63), COMB_D(0x209D78B1, 0xF5D0CE86), 0},
+     {COMB_D(0x04243827, 0x9C8B38A4), COMB_D(0xE3C357BB, 0x243D24C5), COMB_D(0xC2BFF10B, 0xA3E3E5F5), COMB_D(0xE6609D98, 0x5B17824E), 0}},
+    {{COMB_D(0xFC9295F1, 0x90549BAB), COMB_D(0x9356F93E, 0xB75EA7DD), COMB_D(0xCFAD8544, 0xEB092F24), COMB_D(0x706E8AA3, 0x730527B6), 0},
+     {COMB_D(0x7D04DCB8, 0xB809FCC5), COMB_D(0x8D81BEC3, 0xCB2AC386), COMB_D(0xD638FED7, 0xB227761A), COMB_D(0x2AD0E5D1, 0xEEA2CB01), 0}},
+    {{COMB_D(0xFB029AD0, 0x0E33BB31), COMB_D(0x845DDA78, 0xF4410207), COMB_D(0xFCEA818D, 0xB421ACE6), COMB_D(0xB7A9D712, 0xD3D6E7BF), 0},
+     {COMB_D(0xA5DD3A83, 0x5971017F), COMB_D(0x8B1044EF, 0x37C12D25), COMB_D(0xDB1A9186, 0xC9D10703), COMB_D(0x8800A6C6, 0xF047F4A2), 0}},
+    {{COMB_D(0xCFED1F7F, 0xE2AF8E87), COMB_D(0x24FE9D8A, 0x0D051CF6), COMB_D(0xCD0F9533, 0x7A1FB0C9), COMB_D(0xC2EC6148, 0xAAD81CD9), 0},
+     {COMB_D(0x178582F2, 0x8E713703), COMB_D(0xE1048CDA, 0xDD83EF2E), COMB_D(0x1B75D2EF, 0xD73566B7), COMB_D(0x22D99DC4, 0x7B7C4650), 0}},
+    {{COMB_D(0x22302882, 0xAF1AC644), COMB_D(0xCBC2EEA6, 0x90ECA380), COMB_D(0xA8980483, 0x37AAC930), COMB_D(0xB19B556E, 0xDC982971), 0},
+     {COMB_D(0x356F5D6B, 0xF19D7467), COMB_D(0x3879AD32, 0xB8E6C573), COMB_D(0x351DAC47, 0x0B9F4912), COMB_D(0x724E1904, 0x26417C30), 0}},
+    {{COMB_D(0xF506BCF1, 0x4814659A), COMB_D(0x4B6C1018, 0x67186D87), COMB_D(0xA1DE7C75, 0x7CD51B44), COMB_D(0xE96B2C13, 0xBEA9AEF6), 0},
+     {COMB_D(0xB66A644D, 0xA1CD533F), COMB_D(0x4AE16405, 0xA253CD58), COMB_D(0xFDBDD8BC, 0xAB51C362), COMB_D(0xC6633167, 0xDBB5D9A7), 0}},
+    {{COMB_D(0x0C7EF9F9, 0x0DB35500), COMB_D(0xC26F70E9, 0x808DDD83), COMB_D(0xC74AB71E, 0x7DD639C0), COMB_D(0x6F538777, 0x3D6F3A4C), 0},
+     {COMB_D(0xBAF34593, 0x706DD2DF), COMB_D(0xC415E647, 0xF1A1A617), COMB_D(0xACD37281, 0x2FD11DCD), COMB_D(0x07783073, 0x6306EE1B), 0}},
+    {{COMB_D(0x18AB6037, 0x42435D04), COMB_D(0x617961C6, 0xBBC242CA), COMB_D(0x4BE73BCF, 0xC7AEA910), COMB_D(0x6C4A9C52, 0xCA241BF1), 0},
+     {COMB_D(0xB8ED5956, 0x742B3191), COMB_D(0x23409E08, 0xBC7AD97C), COMB_D(0xE3A3D197, 0x891E34AF), COMB_D(0xA510910F, 0xDAB90B6C), 0}},
+    {{COMB_D(0x862FD28A, 0xA266D3AF), COMB_D(0x6788FA87, 0x9774A0E0), COMB_D(0xE52B6C77, 0xCB8CB5A6), COMB_D(0xACA96EB3, 0xEAF5FA88), 0},
+     {COMB_D(0x7BD60093, 0xC0B50680), COMB_D(0xB8DC70FC, 0x1DDD89F7), COMB_D(0x4F983DD0, 0xF7F51973), COMB_D(0x3B40B78A, 0xFEDF47AA), 0}},
+    {{COMB_D(0x97911A07, 0xA4B158B2), COMB_D(0xE1302247, 0x6AC71BD8), COMB_D(0xB7FDE6A8, 0x7B694005), COMB_D(0xE4258423, 0x981E079B), 0},
+     {COMB_D(0x0D75579A, 0x41956763), COMB_D(0xCA704728, 0x0FE33ED0), COMB_D(0x09E83B15, 0x3567A101), COMB_D(0xBCAF65F6, 0x86C932CC), 0}},
+    {{COMB_D(0xD7AC13DE, 0x2C1A1523), COMB_D(0x001B6EFC, 0x5AA5C17A), COMB_D(0x5733D1F8, 0x3EDE2061), COMB_D(0x4741E41B, 0x06FA7822), 0},
+     {COMB_D(0xA5BB604F, 0x96E6BC00), COMB_D(0x037B585C, 0x67C3A464), COMB_D(0x656183F1, 0x3CEE617E), COMB_D(0x148F6E0A, 0xA52CB505), 0}},
+    {{COMB_D(0xA326077A, 0x7F8D5ED0), COMB_D(0xA3A00F12, 0x0FC55AA5), COMB_D(0x73F080CA, 0x26404B30), COMB_D(0x75B2A659, 0x4786C339), 0},
+     {COMB_D(0xAD074D59, 0xC42F638E), COMB_D(0x660C92B5, 0xE885E530), COMB_D(0x8BADEB46, 0xA6CDF56E), COMB_D(0x917DFDC9, 0x72B8C223), 0}},
+    {{COMB_D(0x68BB2613, 0x43FE63AD), COMB_D(0x577ECFF2, 0x2453831B), COMB_D(0x1A3F43F5, 0x4EF6C0EE), COMB_D(0xF9F8D71C, 0xFE46D933), 0},
+     {COMB_D(0xF1EA72E0, 0x167971C6), COMB_D(0x29A88547, 0x1DC1C037), COMB_D(0x44BED5DB, 0xD74378B5), COMB_D(0x9A159031, 0x71C27E05), 0}},
+    {{COMB_D(0x88F545BC, 0x6AD19F2E), COMB_D(0x0AA20B3D, 0xB11C0974), COMB_D(0x6929E307, 0xA73283FD), COMB_D(0x22347793, 0x05492D13), 0},
+     {COMB_D(0x0E4B98B4, 0x71757D37), COMB_D(0xF94E6EB7, 0x82ADF1CE), COMB_D(0x88C43399, 0xFAC803EC), COMB_D(0x8DD4C729, 0x4A483669), 0}},
+    {{COMB_D(0x30ECD378, 0x822695E5), COMB_D(0xB34844F9, 0xB1AF5B00), COMB_D(0x4ED47B98, 0x7C1FF3A6), COMB_D(0x16E84C7C, 0xBA7E7093), 0},
+     {COMB_D(0x1FABA110, 0x8394310E), COMB_D(0x5DAE55B7, 0x2AE1ECF0), COMB_D(0x418CAED7, 0x3E988258), COMB_D(0x4820318F, 0x25B9913E), 0}},
+    {{COMB_D(0x910EEAF0, 0xB39F64F7), COMB_D(0x23D12EE1, 0x576F07DE), COMB_D(0xBF91FB41, 0x40BDDE97), COMB_D(0x87FA7C50, 0xF6211372), 0},
+     {COMB_D(0xA7FDB89D, 0x7698EC7D), COMB_D(0x07B20690, 0xA2868876), COMB_D(0xD934386F, 0x708CC03B), COMB_D(0xB8A75A80, 0x13AA5965), 0}},
+    {{COMB_D(0x5E2EB3B7, 0xB6DD3605), COMB_D(0xD5D0F612, 0xCC662339), COMB_D(0xEA986ADE, 0x2E29F250), COMB_D(0x03AE36C0, 0x31ADAAD6), 0},
+     {COMB_D(0xDCB71CC1, 0x8EADBA0C), COMB_D(0x856A29A9, 0x78797A12), COMB_D(0x7C23ACC7, 0xCBE519F6), COMB_D(0xAF0F98C4, 0x4E0DD7EC), 0}},
+    {{COMB_D(0xFBB31B7E, 0x353E0A1B), COMB_D(0x410C6278, 0xC658C1FD), COMB_D(0x490AB715, 0xCF922A43), COMB_D(0xB2FEC7E3, 0x33E8E0D6), 0},
+     {COMB_D(0xE1F66661, 0x8214099A), COMB_D(0xD145CF2B, 0xB8E5A6A1), COMB_D(0x42680F28, 0xFEA9EEA3), COMB_D(0x34A999B7, 0xBF39A42D), 0}},
+    {{COMB_D(0xE39ADD1A, 0xA2053F55), COMB_D(0xE3983F4C, 0x3B35D7A4), COMB_D(0x42281668, 0x53CF3875), COMB_D(0x72DE2733, 0x952AE6B7), 0},
+     {COMB_D(0xCAC12438, 0xB5BC2A4F), COMB_D(0x9DE0E9F4, 0xA274C518), COMB_D(0x12A467CC, 0xE09F2487), COMB_D(0xEBF6263C, 0x687F4F62), 0}},
+    {{COMB_D(0xBF0CAE3E, 0xB25DF126), COMB_D(0x4A6884C4, 0x3BED7E6C), COMB_D(0x4DC2136F, 0x98783158), COMB_D(0x04A0492E, 0x35F89309), 0},
+     {COMB_D(0x61540CAD, 0x91BE282C), COMB_D(0xA231CC6A, 0xF842F299), COMB_D(0x170BC72F, 0xB123FBD4), COMB_D(0x6E511ECD, 0xD370C707), 0}},
+    {{COMB_D(0xE6D908EC, 0xC39B2C3A), COMB_D(0xB24F0860, 0x8173A204), COMB_D(0x32EF842C, 0x546A5BCA), COMB_D(0xFE96BFBB, 0x8CF1A929), 0},
+     {COMB_D(0x0FD41D2B, 0xF2D8C3F7), COMB_D(0x24243951, 0xEB7E6FF5), COMB_D(0x412A0526, 0x9D9BDD09), COMB_D(0x1354BA4F, 0xE56E8CF1), 0}},
+    {{COMB_D(0x0B217818, 0xE8F11B34), COMB_D(0x824BB87F, 0xEA82D81F), COMB_D(0x9A6C8320, 0xAE5A8094), COMB_D(0x4181CC7F, 0xA122D331), 0},
+     {COMB_D(0xD362B8D6, 0x274A51D6), COMB_D(0xD4665A03, 0x707C4271), COMB_D(0x5F3ADC55, 0xB32C824C), COMB_D(0xD892F216, 0x6D3ADFAA), 0}},
+    {{COMB_D(0x0E9812A7, 0xF8A6E543), COMB_D(0x6863D078, 0x0B9A9785), COMB_D(0x4469F178, 0x5CF41DFE), COMB_D(0xB914DE73, 0x3F09A6BE), 0},
+     {COMB_D(0x6F6D4AE8, 0xC4615F3D), COMB_D(0x3A163A6A, 0xA77F261C), COMB_D(0xDB2A255B, 0x0CCE7DBC), COMB_D(0x0217A62C, 0xBEACE6D4), 0}},
+    {{COMB_D(0x791F3380, 0x77BC81DF), COMB_D(0x7CD03567, 0xB1362414), COMB_D(0x4DA5D26C, 0xD3DA5C0C), COMB_D(0xCE6F36CF, 0x5EA71ADF), 0},
+     {COMB_D(0x49D9C174, 0x42DCA724), COMB_D(0x260727A3, 0x118F2FA8), COMB_D(0x2F2CE327, 0xC2715AB7), COMB_D(0xC3943BF1, 0xDAB5FE22), 0}},
+    {{COMB_D(0x3D2E6D67, 0xFEDCEB62), COMB_D(0xD47B58E9, 0x6976004E), COMB_D(0xA35DAB06, 0x691A35F5), COMB_D(0xF0371C1E, 0x358FFEAE), 0},
+     {COMB_D(0xCC8659FC, 0xA35B38A9), COMB_D(0x3FF45EA3, 0xA137DF10), COMB_D(0xF5687EEF, 0x19B390B4), COMB_D(0x464AE863, 0x92A92CCA), 0}},
+    {{COMB_D(0x0DA5EA3F, 0x54B02561), COMB_D(0x2F489413, 0xD54BE5E4), COMB_D(0xBC81B7E9, 0xB418E4FF), COMB_D(0x171A165B, 0x2410F0FF), 0},
+     {COMB_D(0x5F1AE585, 0x35C2BE69), COMB_D(0x17699840, 0xD9EA7E94), COMB_D(0x66D2A33E, 0xD8B4F1AF), COMB_D(0x228B0B24, 0xD52325AE), 0}},
+    {{COMB_D(0x8A0747A4, 0x4AD831BF), COMB_D(0x5A3D5626, 0x7E2A7645), COMB_D(0x6959EE55, 0x21456D70), COMB_D(0x4E351EEA, 0x95895138), 0},
+     {COMB_D(0x222EF262, 0xBA526A91), COMB_D(0x99A6B79B, 0xDA918DDD), COMB_D(0x18CC0532, 0x132B9646), COMB_D(0xE69CFBD4, 0xA9A0933B), 0}},
+    {{COMB_D(0xF367D62B, 0x212C7EC6), COMB_D(0x6D3827D3, 0x453A6503), COMB_D(0xCFF9A934, 0xC80BB790), COMB_D(0xB9E9FFE3, 0x5D57A1D0), 0},
+     {COMB_D(0x353D6C28, 0x313A27FA), COMB_D(0x60EB13EE, 0xB8565DA8), COMB_D(0xDFEA11E1, 0x5C973741), COMB_D(0x57F11ED3, 0xA7C73DBA), 0}},
+    {{COMB_D(0xEA1E617C, 0xF0BCA63E), COMB_D(0x3DD1B5F9, 0x27888ACB), COMB_D(0xA01A7B64, 0xF71A8417), COMB_D(0xFA103BB6, 0x997BC67E), 0},
+     {COMB_D(0x0B2E64FC, 0xCF03BD17), COMB_D(0xE83A4540, 0x669DF4CD), COMB_D(0xB1217033, 0xACF155CA), COMB_D(0xBC0A0642, 0x08341B1D), 0}},
+    {{COMB_D(0xD3D9CBB9, 0x40BB2308), COMB_D(0x8075815B, 0x497CA71E), COMB_D(0x29475934, 0x6F3E3EA8), COMB_D(0xDD9D3F99, 0x10F7490D), 0},
+     {COMB_D(0x446BA424, 0x7CAC4D0B), COMB_D(0xFDA9DD4C, 0x81B11CA1), COMB_D(0xD2C03D6F, 0x03C453FE), COMB_D(0xFB7A4BB3, 0x8252D47F), 0}},
+    {{COMB_D(0x781D2399, 0xC5918A98), COMB_D(0xC2C61E99, 0xB77F0E87), COMB_D(0xACBF906C, 0xAE1BAA6E), COMB_D(0xE8135515, 0x66F3B318), 0},
+     {COMB_D(0xFEFCC91F, 0xE1CF1760), COMB_D(0x9AD324B4, 0xF19D0164), COMB_D(0x935F4728, 0x11A14FB6), COMB_D(0x19486312, 0xCBDDF5BA), 0}},
+    {{COMB_D(0xD9DF52F3, 0xA1942E3E), COMB_D(0x6F89C6D3, 0x4E78A905), COMB_D(0x7CD28027, 0xB126E1D2), COMB_D(0x6CC5F350, 0xC062EF18), 0},
+     {COMB_D(0xF975703B, 0xB6D0A388), COMB_D(0x65E60CD9, 0xFC45A371), COMB_D(0x97280432, 0x8FC44FBA), COMB_D(0x5EF88DA7, 0xB17A391B), 0}},
+    {{COMB_D(0x4FED7719, 0xF16AC67D), COMB_D(0x63CD58E6, 0xC01039EA), COMB_D(0x9EA440C1, 0x8F791744), COMB_D(0x6F40537E, 0x65FBFC89), 0},
+     {COMB_D(0x7EB44C81, 0x1D982825), COMB_D(0x5DB59F9A, 0x6E419D96), COMB_D(0xAEBBBAC0, 0x558508D8), COMB_D(0x610BFD9A, 0x3F49EC57), 0}},
+    {{COMB_D(0x37F48F21, 0xB6A930E4), COMB_D(0x41595ABB, 0x74732153), COMB_D(0x6EF75F3F, 0x1CE2A026), COMB_D(0xB8652F1A, 0xCFD70345), 0},
+     {COMB_D(0x2148EDB5, 0x59C3D781), COMB_D(0x5EB0A3B8, 0x69D770D4), COMB_D(0xBBF8DAF4, 0xCD982C5C), COMB_D(0xF28A84FF, 0x18F45243), 0}},
+    {{COMB_D(0x04DD1202, 0x12E0B7EB), COMB_D(0x42A2F48C, 0x63FEC901), COMB_D(0x4DDE1627, 0x07C4EC37), COMB_D(0x85A7EFCA, 0x2B994852), 0},
+     {COMB_D(0xE2EFCBAF, 0xEFB54BFA), COMB_D(0xF788BBEE, 0x39D74663), COMB_D(0xC136B211, 0x63534B48), COMB_D(0xBF148546, 0x62DD994A), 0}},
+    {{COMB_D(0x414530B2, 0x05A8F384), COMB_D(0xC98A178D, 0x28888C1D), COMB_D(0x037EE832, 0xFB857B67), COMB_D(0x073EA312, 0xDA2A8ADB), 0},
+     {COMB_D(0x1F2991D5, 0x076D719A), COMB_D(0x57C11473, 0xFDCD4549), COMB_D(0x725F5B61, 0xE8711B96), COMB_D(0xB820EE16, 0x3113CA19), 0}},
+    {{COMB_D(0x74F11949, 0xA20C6A53), COMB_D(0x7D12D9B3, 0xEDD2DDA7), COMB_D(0x89B8FBD1, 0x0304C70E), COMB_D(0x986697C5, 0xC132133B), 0},
+     {COMB_D(0x331C089D, 0xA11927C7), COMB_D(0x4883A1FB, 0x8AB3500E), COMB_D(0xF48D3AF4, 0xE605A660), COMB_D(0x4F8ED15F, 0x718D8449), 0}},
+    {{COMB_D(0x9E71A5B7, 0x2100D728), COMB_D(0x4991F0EC, 0x6DF7334A), COMB_D(0xD8AA69C4, 0x00755130), COMB_D(0x7C4E9872, 0xFAEC2DCB), 0},
+     {COMB_D(0xE190205D, 0xBB6CD3C1), COMB_D(0xF9AE9E79, 0x4D95AE27), COMB_D(0xEB8A4F78, 0xB3F0218B), COMB_D(0x4D38821C, 0x7343FFA4), 0}},
+    {{COMB_D(0xF6EC7746, 0x7A2F20C0), COMB_D(0x93EA77A6, 0x16C08844), COMB_D(0x097F5560, 0x86FDF45E), COMB_D(0xE57F3902, 0x2A294727), 0},
+     {COMB_D(0x50711B0A, 0x458F99F0), COMB_D(0x579F30E7, 0xF4870D9B), COMB_D(0xE6F8E50E, 0xE7DC2CEE), COMB_D(0xE9074A74, 0x1945DD14), 0}},
+    {{COMB_D(0xB89D529C, 0xF2BB12DF), COMB_D(0x4988B47D, 0x97307CD0), COMB_D(0x071EBBB3, 0x2A4C412C), COMB_D(0xB453FCCE, 0x132A61D0), 0},
+     {COMB_D(0x56F23A01, 0x2E3AC6E4), COMB_D(0x30E170FE, 0xE3A557ED), COMB_D(0x746D85FF, 0x4C9A5E8F), COMB_D(0xC51C066C, 0x0DAD72D6), 0}},
+    {{COMB_D(0x60D8D8B8, 0xBDDCCA86), COMB_D(0xEE81296A, 0x937BA490), COMB_D(0x1275FC17, 0x3636E0C9), COMB_D(0x1E9AC6AC, 0x9E6F5724), 0},
+     {COMB_D(0x856684D8, 0xE606B8BD), COMB_D(0xF7A239D0, 0x5AD0FAF2), COMB_D(0xAF3D23FA, 0xF0B6770A), COMB_D(0xC08D15E2, 0x44A0CD5F), 0}},
+    {{COMB_D(0x6A7305E4, 0xD5C8D26B), COMB_D(0x1D84F64E, 0x544A6FF7), COMB_D(0xE2ED4B21, 0x9162012E), COMB_D(0x6EFC4404, 0x14028260), 0},
+     {COMB_D(0xC042ABD8, 0x1280883F), COMB_D(0xF2C87CCA, 0x2806ECF2), COMB_D(0xACC42BD8, 0x858E3A5C), COMB_D(0x1B9244D9, 0x39969031), 0}},
+    {{COMB_D(0x8FF09467, 0x73792672), COMB_D(0x30CCD6ED, 0x475A1039), COMB_D(0xD4458235, 0x58DB7DD6), COMB_D(0xE649916C, 0x53D4DE10), 0},
+     {COMB_D(0x184E75C1, 0x9058503F), COMB_D(0xBDD8F4B1, 0x58540412), COMB_D(0x2E5FDAFC, 0xC7E247AD), COMB_D(0xC6B55B4E, 0x8AE06EFF), 0}},
+    {{COMB_D(0x67B302D5, 0x3ADDC8D3), COMB_D(0xC6BA3611, 0xD7C16FA3), COMB_D(0x13BE299C, 0x7AFED594), COMB_D(0xD52A4BF2, 0xD435E5A3), 0},
+     {COMB_D(0xFC6CBDC6, 0xCA1D3941), COMB_D(0xDA81E4AD, 0x82E17099), COMB_D(0xBCD97563, 0xDEC07BF5), COMB_D(0x6F67A1DF, 0xB012779A), 0}},
+  },
+  { /* table 2 */
+    {{COMB_D(0x03E8465C, 0x6EADE3C4), COMB_D(0x714AB749, 0xC9052A05), COMB_D(0x8E5C6433, 0x40E586B4), COMB_D(0xA018366F, 0x4E91E90D), 0},
+     {COMB_D(0xF45C4202, 0x6B26E8D0), COMB_D(0xD5F7284E, 0x44614F37), COMB_D(0x7C6CE578, 0x349D8369), COMB_D(0xE2BBEC17, 0x14110B16), 0}},
+    {{COMB_D(0xC2EBAF80, 0x17E55104), COMB_D(0xF73A835F, 0xBB8E9C71), COMB_D(0x63DE93C3, 0x4D8B561C), COMB_D(0xD8DE7652, 0x27B78737), 0},
+     {COMB_D(0x2A02EF80, 0xE52E08CD), COMB_D(0xC2F73FCE, 0x1940DB1B), COMB_D(0x5C4C628A, 0xD1DCF924), COMB_D(0x2FD29465, 0xBE13F2D1), 0}},
+    {{COMB_D(0xF633465E, 0xC5DB3D54), COMB_D(0xBC9B3180, 0x0F9FFC0D), COMB_D(0xB2B6BE39, 0x95FA1D21), COMB_D(0xCE6DA8D1, 0x538C2B64), 0},
+     {COMB_D(0x636B4040, 0xF1F8FE87), COMB_D(0xBC1E7A33, 0xD1F66AA4), COMB_D(0x158D2A1C, 0x0D8A8FD5), COMB_D(0x56714757, 0x323D2AB5), 0}},
+    {{COMB_D(0xD4D3D2DE, 0x4351964C), COMB_D(0x34692437, 0x6F5412C1), COMB_D(0xAE5ABCA1, 0x85755C08), COMB_D(0x6E29F959, 0xBE28C47F), 0},
+     {COMB_D(0x118824BD, 0x563FD88F), COMB_D(0xEF640C52, 0x7A0BFB63), COMB_D(0x5052EC6C, 0xC184246D), COMB_D(0x34565D9F, 0x500F32F6), 0}},
+    {{COMB_D(0x73286F88, 0x74DE97CA), COMB_D(0x676762CF, 0xF651CFE7), COMB_D(0xD5384A12, 0x225BFFB2), COMB_D(0xA7E595BB, 0xD2B50109), 0},
+     {COMB_D(0xA006F756, 0x7B6F5AA0), COMB_D(0xF7900054, 0x3F1A756B), COMB_D(0x59129F09, 0xC3B131FB), COMB_D(0x422808C9, 0xA8E763AA), 0}},
+    {{COMB_D(0xD6962F8A, 0xE30947CE), COMB_D(0x0D556CA3, 0xF0426347), COMB_D(0x5F2BE6C8, 0x86DA4230), COMB_D(0xAD6AD863, 0x545D9CDC), 0},
+     {COMB_D(0x82AC2C1A, 0x50B7212F), COMB_D(0x33FD6FBC, 0xDE709BEE), COMB_D(0x27098BCD, 0x302156DC), COMB_D(0x6C56BD56, 0x291BA48D), 0}},
+    {{COMB_D(0x0B4286FE, 0xA3569913), COMB_D(0xFFF43797, 0x993DDD47), COMB_D(0x41E68485, 0x3F629E38), COMB_D(0x47D71877, 0x267E4A27), 0},
+     {COMB_D(0x8B2D74C9, 0x3D01C076), COMB_D(0x10206BA7, 0xE57B3D40), COMB_D(0xF9BD0A5D, 0x0BF3EA30), COMB_D(0x809B82C0, 0x133A7094), 0}},
+    {{COMB_D(0xF0699BF9, 0xE2F2B734), COMB_D(0x79C3BB5B, 0x5501D267), COMB_D(0x0634A786, 0xF1164457), COMB_D(0x224A0229, 0x9EECC99A), 0},
+     {COMB_D(0x840F5854, 0x91EC7FDF), COMB_D(0x07B704B6, 0x73C7AFD0), COMB_D(0x149A08AD, 0x871D7FFF), COMB_D(0xFA41A8D2, 0x9B6D22B4), 0}},
+    {{COMB_D(0x8D77B903, 0x63A63611), COMB_D(0x985B599D, 0x3C58EEA9), COMB_D(0x9B1E5DAB, 0xA7F61AC6), COMB_D(0x8FBEBC0D, 0xE13B3D17), 0},
+     {COMB_D(0xB34724F0, 0x017BE257), COMB_D(0x079F9B39, 0x54ABDC50), COMB_D(0xD0EC057D, 0x63961ACF), COMB_D(0x99FF9E62, 0xC3F83393), 0}},
+    {{COMB_D(0x40B20058, 0xE47D3D41), COMB_D(0x57BE2B2F, 0xE102CE5F), COMB_D(0x8FE4C3D7, 0x3E354525), COMB_D(0xC6B5231E, 0x47CEECE4), 0},
+     {COMB_D(0xBF0B5834, 0x19D1EB09), COMB_D(0x3342E975, 0xC9540822), COMB_D(0xDA3C0B66, 0x592E0B4E), COMB_D(0x3A88C645, 0xBBFD94D7), 0}},
+    {{COMB_D(0x0CBEA404, 0xAFBDA95E), COMB_D(0xFC2ED059, 0x9B0543B8), COMB_D(0x1826999B, 0xD20F77F6), COMB_D(0xFBB2D56F, 0xAF67D226), 0},
+     {COMB_D(0xE4152F53, 0x8DD9724F), COMB_D(0x1F92AC30, 0x5405AF39), COMB_D(0x9851D215, 0xFAF1F5D6), COMB_D(0xDE8197A5, 0x7828B6E3), 0}},
+    {{COMB_D(0xF2479EE2, 0xF18D10A2), COMB_D(0x6220CD8B, 0xF842F3CC), COMB_D(0x60720080, 0x7F0C5F8B), COMB_D(0xA6355D63, 0x22CE6C24), 0},
+     {COMB_D(0x77EBEB1B, 0x8FF3191C), COMB_D(0x04CE4217, 0x99AC94F6), COMB_D(0x320144CD, 0x5878BDB5), COMB_D(0xA3D1F7B3, 0xDDF78C0A), 0}},
+    {{COMB_D(0x6EFC4F9A, 0x890C2059), COMB_D(0x67ED35FD, 0xD5D7A829), COMB_D(0x384AEBCC, 0x803A573D), COMB_D(0x88BD9621, 0x2C67D089), 0},
+     {COMB_D(0x319F213D, 0x86C543DF), COMB_D(0x54595D5E, 0x8D7935B4), COMB_D(0xDBA2DA99, 0x429BA426), COMB_D(0x4AAF3392, 0x39302B43), 0}},
+    {{COMB_D(0x7D5EAE1B, 0x3F4D49E2), COMB_D(0x3030669F, 0xDF608E92), COMB_D(0x91EA5A73, 0xE6F02D84), COMB_D(0xF64F25AF, 0x4E8A7CA1), 0},
+     {COMB_D(0x41A7D898, 0x7E890721), COMB_D(0xBB5E8D0D, 0xE9A09D4B), COMB_D(0x696D82C5, 0xCDF25853), COMB_D(0x7D3B4341, 0x489734E5), 0}},
+    {{COMB_D(0x3D71E76E, 0x7A9B37B8), COMB_D(0x7E46D26B, 0x79BF24A1), COMB_D(0x23A7239E, 0xE11C5BDF), COMB_D(0x8E6619FB, 0x42193E06), 0},
+     {COMB_D(0x1D8AD81D, 0xE50A2086), COMB_D(0x888F5265, 0xD66561FD), COMB_D(0x6A301C07, 0xA34F9D1B), COMB_D(0x4A972883, 0x951E70BF), 0}},
+    {{COMB_D(0x826FADC0, 0x523B716D), COMB_D(0x0D238966, 0xF74E1A6B), COMB_D(0xE8A5C793, 0x8D18DF9E), COMB_D(0xF81F5BE3, 0x8B8CA534), 0},
+     {COMB_D(0x464002F5, 0x12632401), COMB_D(0x66075850, 0x3A878330), COMB_D(0x1D56D29D, 0x380E0328), COMB_D(0xDC7F4932, 0x9C1F06DF), 0}},
+    {{COMB_D(0xF5D5C53F, 0x842817C3), COMB_D(0x43D268A1, 0x4856BC8D), COMB_D(0xABC15A6C, 0x479917A2), COMB_D(0x00D4AF7E, 0xAC5D29DD), 0},
+     {COMB_D(0x269912F5, 0x768356E1), COMB_D(0x75216556, 0xAD504FE4), COMB_D(0x9910EE99, 0x76BB80FA), COMB_D(0xDBD77F5C, 0xE8A63F46), 0}},
+    {{COMB_D(0x3EA334D3, 0x1BD661EB), COMB_D(0xE6C9A3CB, 0x56CA7B5F), COMB_D(0xB638FA19, 0x7F5B8C4D), COMB_D(0xB3E0256C, 0x67E9DB9B), 0},
+     {COMB_D(0x63ECBA5A, 0xDCA7558A), COMB_D(0x721DB338, 0xCD1A690E), COMB_D(0x0456FCDB, 0xAF1934D6), COMB_D(0x7FBC0E8D, 0x399A9854), 0}},
+    {{COMB_D(0x2C4F0FB9, 0x28CB057F), COMB_D(0xEB1EBFA0, 0xEC4927D2), COMB_D(0x219B190A, 0x7034DE40), COMB_D(0xF2F8E91F, 0xED6EB8F3), 0},
+     {COMB_D(0x036E601E, 0xA9BCEA0D), COMB_D(0xC672DC8B, 0x61A69BB3), COMB_D(0x5E603091, 0xC93B7C16), COMB_D(0x746193E6, 0xD5AF6EF0), 0}},
+    {{COMB_D(0x6CC15B46, 0x61C64FA8), COMB_D(0x10AA5C5D, 0x4F11C659), COMB_D(0x0674CF52, 0x3F7BEB8B), COMB_D(0x42AD3AB5, 0x19813E59), 0},
+     {COMB_D(0x14BA71A0, 0x68B1922B), COMB_D(0x2B7B716A, 0xF7DE2AB6), COMB_D(0xC7DB6916, 0x991B4AF7), COMB_D(0x516F6592, 0x7695DB98), 0}},
+    {{COMB_D(0x00E3C251, 0x6C316AE2), COMB_D(0x5E020053, 0xE3514C61), COMB_D(0x04E63A32, 0x714B7601), COMB_D(0x4882B625, 0x40A23C81), 0},
+     {COMB_D(0xB1F8911F, 0x7845A444), COMB_D(0x38CAFD92, 0xF6CAF4BA), COMB_D(0xEF73184D, 0x2B86633B), COMB_D(0x1CF38B40, 0xF5A348D3), 0}},
+    {{COMB_D(0x9CA445B2, 0x64E94292), COMB_D(0x87FB6240, 0xB18FEF0E), COMB_D(0x5E6C59E7, 0x6450DEB9), COMB_D(0x798A4D32, 0xFD6D5275), 0},
+     {COMB_D(0x9C155B9F, 0x910F2CFA), COMB_D(0x07E151EC, 0xF0B183A9), COMB_D(0x26949D64, 0x866B38E1), COMB_D(0xE988CA78, 0x3D699772), 0}},
+    {{COMB_D(0x331FE58D, 0xA33CA310), COMB_D(0xC7AD34E5, 0x35C0A97B), COMB_D(0x1C0B5A90, 0xDC0B75B2), COMB_D(0x4516DE11, 0xFDA83D6B), 0},
+     {COMB_D(0xFD1A499C, 0xE96616E6), COMB_D(0x40D46592, 0xBD7C4363), COMB_D(0xE9EF6948, 0x71F145CE), COMB_D(0xA9CEA0BE, 0x1FB255DB), 0}},
+    {{COMB_D(0x5E10C3F0, 0x1D7393B4), COMB_D(0x219E6A4B, 0x3282F3F1), COMB_D(0xEA201CE0, 0x9D1A514E), COMB_D(0xEBB0CBA5, 0x655C3E75), 0},
+     {COMB_D(0x00EEB157, 0x46FA6EC0), COMB_D(0x35765456, 0x3C77227E), COMB_D(0x24A78A3F, 0x5A555DE5), COMB_D(0x0A56B060, 0x10D2F17F), 0}},
+    {{COMB_D(0x94EB0599, 0x3859B3DD), COMB_D(0x59760B81, 0x03E4FFCE), COMB_D(0xBDC0E4D5, 0xED6CD9BB), COMB_D(0x07A68D30, 0xB75A28A2), 0},
+     {COMB_D(0x6071CE10, 0x23251398), COMB_D(0x766847F7, 0xF1D56F81), COMB_D(0xF55DA4B6, 0x459AE088), COMB_D(0x74513F26, 0x923B9053), 0}},
+    {{COMB_D(0xFC7AFE62, 0x31AC52FE), COMB_D(0x44F86CFB, 0x65CA8E85), COMB_D(0x2A379687, 0xFB1ED49B), COMB_D(0x5024185A, 0x3A958F8A), 0},
+     {COMB_D(0x5465261C, 0xCB514FDB), COMB_D(0x7E1428C0, 0xD63CC55C), COMB_D(0xEC8C96E4, 0xA0F38642), COMB_D(0xA6478F8C, 0x6C35C78C), 0}},
+    {{COMB_D(0x6A621198, 0xD1A51FBE), COMB_D(0xB3732C93, 0xB03C5282), COMB_D(0x45D042DE, 0x73275A28), COMB_D(0x9666D7EF, 0x77248A58), 0},
+     {COMB_D(0x7D327035, 0x815B986C), COMB_D(0xFA9E9EA9, 0xD1B8998E), COMB_D(0x8294EDD9, 0xE7D1B588), COMB_D(0x015F7B30, 0x9772BA06), 0}},
+    {{COMB_D(0x383DCCA8, 0xF95E2EB8), COMB_D(0xBF7A5A57, 0x5BD23733), COMB_D(0xB6661311, 0x7299B58F), COMB_D(0xFCAC136F, 0x4871DA06), 0},
+     {COMB_D(0xE092AA96, 0xE5207DC4), COMB_D(0xF2288295, 0x11B51AAC), COMB_D(0x4C38940B, 0x7987CCCE), COMB_D(0x6A711CBE, 0xA377D3C0), 0}},
+    {{COMB_D(0x6D170425, 0xC3A22427), COMB_D(0xF0A4E9CE, 0xC22A6A77), COMB_D(0xBEEBE70C, 0x09643F3B), COMB_D(0x67D867F6, 0xEEAD87A1), 0},
+     {COMB_D(0x80D90EB6, 0xA3646BE0), COMB_D(0x6043BBB0, 0xAD241AA0), COMB_D(0x1DF7DC5B, 0xBF8A3C02), COMB_D(0x92821691, 0xFF9104B3), 0}},
+    {{COMB_D(0x8712C8E0, 0xB3EB3DA8), COMB_D(0xD0F4AC7B, 0x1B160945), COMB_D(0x729CFF8D, 0xAAD8A14C), COMB_D(0x056EA576, 0x387A7236), 0},
+     {COMB_D(0x37A4F468, 0x4B00878A), COMB_D(0xE631E101, 0xC8176975), COMB_D(0xADE85A12, 0xE811CB5A), COMB_D(0x132F622E, 0x0655D745), 0}},
+    {{COMB_D(0x72DAFEA4, 0xCE5F65F9), COMB_D(0xF5BD3E0E, 0x89AC3F62), COMB_D(0xD8966325, 0x17EF4384), COMB_D(0x3CDFD4F8, 0xB0748A77), 0},
+     {COMB_D(0x331D883A, 0x97C3C945), COMB_D(0xF73994B3, 0xD10E063D), COMB_D(0xBFCFB166, 0xCE6990B2), COMB_D(0x1B0A29B8, 0xDF2A55D9), 0}},
+    {{COMB_D(0x28CF1AB9, 0x9076F57B), COMB_D(0x030B86E3, 0xCECAC607), COMB_D(0xB927E350, 0x1CF2A53F), COMB_D(0x20E11856, 0x4880C79C), 0},
+     {COMB_D(0x8583BEDB, 0xADA7AFE6), COMB_D(0x9FE0DC9B, 0x40E1B71E), COMB_D(0x31BDC3E3, 0xFB6DE997), COMB_D(0xFF67B352, 0xAC437EF7), 0}},
+    {{COMB_D(0xCF4B670D, 0x8251085F), COMB_D(0xE04399FF, 0x45760C17), COMB_D(0x6E473CD8, 0x54C494CD), COMB_D(0xFED3999F, 0xAFE30792), 0},
+     {COMB_D(0x1F230550, 0xACEF0CE8), COMB_D(0xDDB7EEAF, 0x190D531B), COMB_D(0x731E08D0, 0x2CDB0717), COMB_D(0xA710934F, 0x1D393EB0), 0}},
+    {{COMB_D(0x1ACEA0EB, 0x92A12FEF), COMB_D(0x39329D4F, 0x69989E5B), COMB_D(0x169BD383, 0x8A6F0C2D), COMB_D(0x46E428B7, 0x630CA9DA), 0},
+     {COMB_D(0x4F96219C, 0xCF3F9E41), COMB_D(0x5729C076, 0x9934D26F), COMB_D(0xE35316AD, 0xFA1ED69A), COMB_D(0x65971114, 0x4082017B), 0}},
+    {{COMB_D(0x60136B2A, 0xDCBB18EA), COMB_D(0x5A9C88EC, 0xCF275CA5), COMB_D(0xC1CF0514, 0x3CF1B951), COMB_D(0x3EBEEAF9, 0xD3C5F698), 0},
+     {COMB_D(0x37812A6D, 0x88EFC1FF), COMB_D(0x253C5EC4, 0x49DEBEC4), COMB_D(0x504CE7D6, 0xBB54FC57), COMB_D(0x44EB3DA0, 0xF84CAC4C), 0}},
+    {{COMB_D(0xB97F2FA8, 0x0FFA279A), COMB_D(0x1621A61D, 0x37462FDE), COMB_D(0x2F2C6DD5, 0x74303C78), COMB_D(0x1F9DF4D5, 0x5217F108), 0},
+     {COMB_D(0x2DCAC550, 0xC8188F6E), COMB_D(0x67DED844, 0xF21F4B9D), COMB_D(0x83A5ED2E, 0x4BBABDAA), COMB_D(0x65742D42, 0xFC6576EE), 0}},
+    {{COMB_D(0x8BDFD0F2, 0x6E52C781), COMB_D(0x711A52B5, 0x2363C095), COMB_D(0xC0EF3587, 0x6ABF8927), COMB_D(0x231A6816, 0xF0EC307E), 0},
+     {COMB_D(0x3CD67E6C, 0xE59E6432), COMB_D(0xCEF66940, 0x2FDFED6B), COMB_D(0x885E3F29, 0xE14A2AA3), COMB_D(0xDA9208FE, 0x4E4DDF37), 0}},
+    {{COMB_D(0x0C231650, 0x96AEE134), COMB_D(0x7C73E9AC, 0x7CEBB0A5), COMB_D(0x78142D47, 0x64289761), COMB_D(0x180D2907, 0xA64AA2D5), 0},
+     {COMB_D(0x052689E2, 0xA1797E3B), COMB_D(0xEB906062, 0x77F77116), COMB_D(0x3BA094A2, 0x37C84DC9), COMB_D(0xCA9F47B7, 0x0C60FC58), 0}},
+    {{COMB_D(0x11196C45, 0x2D95500E), COMB_D(0x0F2379BE, 0xA4E17CFF), COMB_D(0x6ACA4133, 0x6E99CC93), COMB_D(0x210CE6A0, 0x6C0F4CC0), 0},
+     {COMB_D(0x89108E71, 0xEA80CC0B), COMB_D(0x9B2F95F8, 0x304057A1), COMB_D(0xC7A2D635, 0xC3CBC0B0), COMB_D(0xC4F94BBB, 0x5E1F3928), 0}},
+    {{COMB_D(0xC5916F32, 0xFDFC3516), COMB_D(0x327C6649, 0x66D4F95F), COMB_D(0xF23CD640, 0x13E41417), COMB_D(0x582C073A, 0x9475B9AE), 0},
+     {COMB_D(0x512F0135, 0x95F3D3A4), COMB_D(0x021EE1E4, 0xBE2BFF82), COMB_D(0x3DA2D275, 0xE9F826D0), COMB_D(0x27226136, 0x1D417C42), 0}},
+    {{COMB_D(0xA0ABD19A, 0x971AFB20), COMB_D(0x1A73DBC5, 0x9FA4FD2A), COMB_D(0xD172A1F0, 0x05A3F483), COMB_D(0xB09776B7, 0x96BBA1A2), 0},
+     {COMB_D(0xDE1EDCC2, 0x2C361C84), COMB_D(0x7364592F, 0x42B07641), COMB_D(0x86374EB8, 0x1A750ED7), COMB_D(0x506A125E, 0x51F6731B), 0}},
+    {{COMB_D(0x093710E0, 0x117B5234), COMB_D(0x75C5235E, 0x085FECE4), COMB_D(0x6DD4865D, 0x191CCF2A), COMB_D(0xC851CB24, 0x31D78D97), 0},
+     {COMB_D(0x4CD24915, 0xB2179716), COMB_D(0xE06FB62B, 0xF1F176B8), COMB_D(0x6F2B80DE, 0xF6166978), COMB_D(0x85CE4D7B, 0xCACA2B12), 0}},
+    {{COMB_D(0x1A582CB3, 0xDA4061E2), COMB_D(0x39F26AA0, 0x917E4E57), COMB_D(0x4EBE8278, 0x22B600EA), COMB_D(0x506A531D, 0x5B532C4B), 0},
+     {COMB_D(0x3031CAA0, 0x3D18C0FD), COMB_D(0x08BA2319, 0x4625CDA0), COMB_D(0x4EB28BD0, 0x3B0CEA74), COMB_D(0xEC211BC1, 0xA7879391), 0}},
+    {{COMB_D(0x4DF572BA, 0x39E69106), COMB_D(0x3001D6DF, 0x0BB11647), COMB_D(0xB5A02AD3, 0x76779D2A), COMB_D(0x4CADA5E8, 0x6D23B30D), 0},
+     {COMB_D(0x5AB8F1A7, 0x5B77579A), COMB_D(0xE95B3187, 0x827337D2), COMB_D(0x2A75D82F, 0x3F4050BA), COMB_D(0x99978B51, 0xE30160F0), 0}},
+    {{COMB_D(0x3020C4B7, 0x52ECB668), COMB_D(0x7CB28E6F, 0x0A3DC4EF), COMB_D(0x8CE1C1FA, 0x589D2447), COMB_D(0x68A39B64, 0x20E9ECD4), 0},
+     {COMB_D(0x58B31A6B, 0x6A722A06), COMB_D(0x1FEF2DB5, 0xD1248170), COMB_D(0x35A9EC84, 0x9DD00971), COMB_D(0x9A4D1721, 0x4CC195D9), 0}},
+    {{COMB_D(0xA25339E1, 0x1881D1A3), COMB_D(0x5E2A3FCD, 0x96096D0F), COMB_D(0xA297FADB, 0xD2413079), COMB_D(0xFD89F296, 0xF37CA29C), 0},
+     {COMB_D(0x171508AB, 0xC1F3D3A2), COMB_D(0x8548C4BE, 0x995F624F), COMB_D(0x884C1ABD, 0xC1CAF8EE), COMB_D(0xC94CAF61, 0x9F4D88FC), 0}},
+    {{COMB_D(0x4F543B17, 0xD0609EA1), COMB_D(0x2A5B84F0, 0xB2ADC5EC), COMB_D(0x381EACD2, 0x7AD00986), COMB_D(0xF2302DCD, 0x02A675EE), 0},
+     {COMB_D(0xA9BABDF3, 0xF47B635C), COMB_D(0xB5B939EA, 0xF9116B8E), COMB_D(0x761E4D9A, 0xF08C66E5), COMB_D(0x94FCC8A9, 0x4BAFBA0A), 0}},
+    {{COMB_D(0xDDF3E9F0, 0x0BEA6F41), COMB_D(0xF7AD1899, 0x750CCB39), COMB_D(0xC6935FCC, 0xF042919E), COMB_D(0xE5230AF9, 0x31CBA163), 0},
+     {COMB_D(0xBB2AE0DA, 0xA37F48DB), COMB_D(0x3299B82A, 0xB8122957), COMB_D(0xF74CC2C4, 0x0DCDD0E5), COMB_D(0xA25F90E4, 0xC9E9D858), 0}},
+    {{COMB_D(0xF23B89B0, 0x80919CA5), COMB_D(0x23825D0E, 0xC5BC9BB8), COMB_D(0x4B775678, 0xB12C33CC), COMB_D(0x4FF00F8E, 0xF35BAAF9), 0},
+     {COMB_D(0x5AD8A198, 0x3F203AD1), COMB_D(0xDA264DEB, 0x39295CFD), COMB_D(0x81C2A5BB, 0xB597226F), COMB_D(0x0D347145, 0x79F5AF6C), 0}},
+    {{COMB_D(0xBA98AC24, 0x7703B920), COMB_D(0x8150D242, 0xC7592D4B), COMB_D(0xE3B5517F, 0x8F6D8AC5), COMB_D(0x2D3F47B0, 0x8B6C1146), 0},
+     {COMB_D(0x4353D696, 0x4FFC8C23), COMB_D(0x4855E938, 0x06156737), COMB_D(0x4B2A12E1, 0x245CF8A9), COMB_D(0xE6F96A85, 0xEC93C8AF), 0}},
+    {{COMB_D(0x7522E1ED, 0x260942C8), COMB_D(0xC8A0A5C5, 0xC15C7729), COMB_D(0x5762D0A3, 0xA3F180C4), COMB_D(0x18600C11, 0xEB2F5F50), 0},
+     {COMB_D(0x3BEB6089, 0x139C5E67), COMB_D(0xBD6D5D43, 0x78D82135), COMB_D(0x4DE2F505, 0x06F5F3CA), COMB_D(0xA5CF0A2D, 0x4884A1AA), 0}},
+    {{COMB_D(0x512E1B1C, 0x09E865C4), COMB_D(0x873BE121, 0x24E64335), COMB_D(0x34A6F98E, 0x51494907), COMB_D(0x0B2D78F4, 0xDDE05EFE), 0},
+     {COMB_D(0x79794C6F, 0xC9AACC90), COMB_D(0xF7CFC2F8, 0x988F4B3E), COMB_D(0xDD760B48, 0xA606A4E0), COMB_D(0x5B30085A, 0x1899896E), 0}},
+    {{COMB_D(0xFFB21259, 0x22B0FA88), COMB_D(0xBBBD5F10, 0xEC4A1DA9), COMB_D(0xEB59CFC3, 0x46CC4854), COMB_D(0xCF94F27A, 0x300BBE63), 0},
+     {COMB_D(0x09F4948E, 0x797030B0), COMB_D(0x6A9EC176, 0xE5F91925), COMB_D(0x0D9083B9, 0x31589189), COMB_D(0xB9847FF4, 0xA00EFBCD), 0}},
+    {{COMB_D(0xDC3F6558, 0xADB3004D), COMB_D(0xC15EACE8, 0xCCFEA4B1), COMB_D(0x2722DAE9, 0xA39A13F9), COMB_D(0x69C37151, 0x5FF6CFAF), 0},
+     {COMB_D(0xEB71CCCF, 0x4C53BFA4), COMB_D(0xD8E6B721, 0x23B3958B), COMB_D(0xDF40899B, 0x2A004A7B), COMB_D(0xF2D1C14E, 0x2DDB3A53), 0}},
+    {{COMB_D(0xA995EDA8, 0xF18E10D3), COMB_D(0xECB150B5, 0x1199C9A0), COMB_D(0x4D159515, 0xFFB85561), COMB_D(0x587D78E3, 0x5699DF74), 0},
+     {COMB_D(0xD1BDCED5, 0x86A6BDAA), COMB_D(0x3EF0384F, 0xC57CCBE1), COMB_D(0xCAAF1D61, 0xE0683BE2), COMB_D(0xC8DF68BA, 0x7785E424), 0}},
+    {{COMB_D(0xB54AE03A, 0x1E294D8C), COMB_D(0xB6235737, 0x8A90F0BD), COMB_D(0xAAA4FCEB, 0xB994F521), COMB_D(0xC0CA34FF, 0xA8E92A99), 0},
+     {COMB_D(0xFCC1AF1C, 0xC9B73D3C), COMB_D(0x6E750650, 0x7DCBD402), COMB_D(0x2F6B723A, 0xC355D979), COMB_D(0xA7E24DA5, 0xFDE32333), 0}},
+    {{COMB_D(0x16399AA2, 0x18364A71), COMB_D(0xDF1983B9, 0x4AE2A2D9), COMB_D(0xD1561270, 0xE2DCDC71), COMB_D(0x5687FE5F, 0xDEC3976C), 0},
+     {COMB_D(0x110DD48E, 0x29FE01E2), COMB_D(0x0780899E, 0x995E4E69), COMB_D(0x25E8EA38, 0xF47A39B1), COMB_D(0x8C605227, 0x2C7C4431), 0}},
+    {{COMB_D(0x92B69C0F, 0xCDB12C1A), COMB_D(0x2B4EE77E, 0x3515875B), COMB_D(0x35AB8BFF, 0x139ED0F3), COMB_D(0x5C34C40A, 0xC5605325), 0},
+     {COMB_D(0x2892F4BE, 0x3443E088), COMB_D(0x37FBCA74, 0x505CB984), COMB_D(0x1C2BE745, 0xBA6FA5A3), COMB_D(0x08EB9160, 0x53A3F09D), 0}},
+    {{COMB_D(0x53497D91, 0x86578833), COMB_D(0x93934176, 0x44C1D487), COMB_D(0xD3FC2AB9, 0x5108C624), COMB_D(0xBF4BED8C, 0x9CF98D55), 0},
+     {COMB_D(0x0AF6F00D, 0xB4F179FA), COMB_D(0xC4E50CEF, 0x02BB1BE1), COMB_D(0xBC8A89C3, 0xF27E00D9), COMB_D(0xECF2CCD3, 0xB3E9F0B9), 0}},
+    {{COMB_D(0x039265F7, 0x5F4C1E4E), COMB_D(0x967C8B1D, 0xCB482B1A), COMB_D(0x6E31FB23, 0x0C775EA9), COMB_D(0xE573AD1B, 0x5B99F4D2), 0},
+     {COMB_D(0x528CCEC5, 0x89EF42BA), COMB_D(0x3AFC3D28, 0xEC9B8853), COMB_D(0x48F06033, 0x050F8AC7), COMB_D(0x5F467A72, 0x695A99A1), 0}},
+    {{COMB_D(0x30C4179C, 0x3D13BDC2), COMB_D(0x1DC14888, 0x47954578), COMB_D(0x58DA77AF, 0x4B5B7348), COMB_D(0xA213AE95, 0x20E3B524), 0},
+     {COMB_D(0x4702EF40, 0xB61A1F9F), COMB_D(0x51EC4502, 0x7CADB356), COMB_D(0xC3899146, 0x142897E8), COMB_D(0xF3969AD6, 0xD66DE533), 0}},
+    {{COMB_D(0xC9780422, 0x66609B9B), COMB_D(0xAD6DA65B, 0x48A503E3), COMB_D(0x7E62BE4C, 0x551EAAA3), COMB_D(0xD22BB0E2, 0x73740E16), 0},
+     {COMB_D(0x25F2BA28, 0x7CEC20DA), COMB_D(0x53F9EC42, 0xEAC87885), COMB_D(0xCD923561, 0xB2ED63BC), COMB_D(0xC4AE6ABB, 0xE4209E4F), 0}},
+    {{COMB_D(0x7CBCB40D, 0x2A39E41E), COMB_D(0x27C35D4E, 0xA5912F18), COMB_D(0x21B16AA0, 0xDFC016CF), COMB_D(0x7BEF7D8A, 0xB2E5B027), 0},
+     {COMB_D(0x8EB4BB24, 0x7C2345A2), COMB_D(0xF5AF6B1A, 0x8A63D26C), COMB_D(0xA74B3E54, 0xC8938E2A), COMB_D(0xE5F26723, 0xD6C8B90D), 0}},
+    {{COMB_D(0x320F09C3, 0x839BB85F), COMB_D(0x0101FB06, 0xA050E62C), COMB_D(0x557582C9, 0x9AD53458), COMB_D(0x55D5398D, 0x1666432B), 0},
+     {COMB_D(0xF7F63118, 0x4FED936F), COMB_D(0xD90D6A7F, 0x1833D9E1), COMB_D(0x059C6A9E, 0x8EBAA72A), COMB_D(0x576E2290, 0x49FF8E2D), 0}},
+    {{COMB_D(0x2AED7E42, 0x431BA5A4), COMB_D(0xC78A312A, 0xE6B6D402), COMB_D(0x2B7B9088, 0x58261BC9), COMB_D(0x3443B9A6, 0xDE92D273), 0},
+     {COMB_D(0x0FA74245, 0x98F2648B), COMB_D(0x7460C6BB, 0x330DDE0A), COMB_D(0x989CA058, 0xBD6AA937), COMB_D(0x0DBAB95D, 0x9877B893), 0}},
+    {{COMB_D(0xDD16D384, 0x7701641B), COMB_D(0x9A09915D, 0xC43BAB9A), COMB_D(0x8D8E038C, 0x0570E0BF), COMB_D(0xFB7EE77C, 0x4277969A), 0},
+     {COMB_D(0x4B78C530, 0x3B1BD320), COMB_D(0x4889B123, 0xA90A96AB), COMB_D(0x163536D9, 0xD02F7649), COMB_D(0x186C3495, 0xDD7D2823), 0}},
+    {{COMB_D(0xC2F3DDDC, 0x6298571C), COMB_D(0xDB8F381B, 0x5B21B2F2), COMB_D(0x707AD1A2, 0x1CE902A8), COMB_D(0x28D2ECE6, 0x48039978), 0},
+     {COMB_D(0x4690DC4A, 0x6795FF01), COMB_D(0x41F132F9, 0x14552FA5), COMB_D(0xF42A3E3B, 0x3CCF205A), COMB_D(0xD5C4DDAD, 0xBFFD7F66), 0}},
+    {{COMB_D(0x15FC6F87, 0x748ECCD0), COMB_D(0x78645E40, 0xDB8DFFCF), COMB_D(0x844E7CB5, 0xBB35C5CD), COMB_D(0x8C2661F7, 0x5F7F75CD), 0},
+     {COMB_D(0xD1A245A0, 0x44134B3C), COMB_D(0x43AF528A, 0xEE18AD77), COMB_D(0x12621CE3, 0x1CF614CC), COMB_D(0x34A6E034, 0xC697E87F), 0}},
+    {{COMB_D(0x35732D03, 0xC35C06A8), COMB_D(0xAEC4184F, 0xDB83B8A3), COMB_D(0xAABD8BC0, 0x101DCF62), COMB_D(0xBC7E526D, 0x52DCD481), 0},
+     {COMB_D(0x5B0F3DFF, 0x4AED9E52), COMB_D(0x57920783, 0xBAD8CA1A), COMB_D(0x10A56E75, 0x7B561390), COMB_D(0xC497CC3A, 0xA575DC25), 0}},
+    {{COMB_D(0x8D3E2353, 0x6A047582), COMB_D(0x3CCE1061, 0xF1E28D06), COMB_D(0x0DAC99B9, 0xACF126EC), COMB_D(0x636B9F5B, 0xC643D2A7), 0},
+     {COMB_D(0xC5EB9DE7, 0xF901D9E4), COMB_D(0xEE840BBB, 0xE3306C6A), COMB_D(0x22C41A4A, 0xD95E8F25), COMB_D(0xA9591454, 0x896CB824), 0}},
+    {{COMB_D(0x06244A78, 0x03C1A650), COMB_D(0x2E6AFAE7, 0x2B9299BE), COMB_D(0xB37DCCCE, 0x1064BCEE), COMB_D(0xE5576738, 0x08B206F8), 0},
+     {COMB_D(0x815AD157, 0xA3C19348), COMB_D(0x763FE188, 0xAACDD778), COMB_D(0xC930F549, 0x29561188), COMB_D(0x92290685, 0x3F4F4A87), 0}},
+    {{COMB_D(0x0EE71C85, 0x75CC9B00), COMB_D(0x4A011CA2, 0x9CDE1231), COMB_D(0x9918D4EB, 0x1980CF32), COMB_D(0xD374F729, 0xD2EEB362), 0},
+     {COMB_D(0xB8B037EC, 0x9D81BF98), COMB_D(0x9998926E, 0xAAEDF1AB), COMB_D(0x17DF1F3F, 0x23828C1D), COMB_D(0x9B2C4B3D, 0x18009D6A), 0}},
+    {{COMB_D(0x6BCF0FB1, 0x81FE8216), COMB_D(0x739B976E, 0x01FA4FDF), COMB_D(0xBCEBEAED, 0x095DCF93), COMB_D(0x6749D600, 0x1EF165CF), 0},
+     {COMB_D(0x2B4DFFF1, 0x477965F4), COMB_D(0x96DA690A, 0x2C476200), COMB_D(0xB82BA413, 0x4FB5C6F1), COMB_D(0xDFE34633, 0x78C886AE), 0}},
+    {{COMB_D(0xFC33EF46, 0xF6A3C0BB), COMB_D(0x1D368B2C, 0x955D126F), COMB_D(0x9EAC60B1, 0x4DF2FADD), COMB_D(0x5F52E2D8, 0x735605BD), 0},
+     {COMB_D(0x8FFD3D4A, 0x3A3A02C8), COMB_D(0xC02494CE, 0x44635FB7), COMB_D(0xDFEBFA40, 0xB04D62E3), COMB_D(0xE184D4B3, 0x62AB335D), 0}},
+    {{COMB_D(0x9D2486F4, 0x0B4ED4E7), COMB_D(0xA1FC3F18, 0xD7601247), COMB_D(0x922D63C1, 0xBD0440DB), COMB_D(0xFAE4FD24, 0x00E8E384), 0},
+     {COMB_D(0x18FCBDBE, 0xC5EC310E), COMB_D(0xA89DAA0B, 0x90591CE1), COMB_D(0x62A1941E, 0x20075AB9), COMB_D(0xAAA01834, 0x23F94F2E), 0}},
+    {{COMB_D(0x1DFEF231, 0x80327766), COMB_D(0x4788E471, 0x58774D01), COMB_D(0x696E798C, 0xB8396774), COMB_D(0x682B2E6E, 0x60130289), 0},
+     {COMB_D(0xB6521134, 0xF8F154A0), COMB_D(0xBF6140EC, 0x50426522), COMB_D(0x33CC6441, 0x4E90030D), COMB_D(0xA2DE7662, 0xB45F6CBE), 0}},
+    {{COMB_D(0x85C29138, 0xE4A4088B), COMB_D(0xB8B3CC29, 0xBCDE513D), COMB_D(0xF58D03AB, 0xF0094247), COMB_D(0xC70E99F3, 0x6760014A), 0},
+     {COMB_D(0x40A5EE75, 0x7931E172), COMB_D(0x80EDDE86, 0x87105EAD), COMB_D(0x80011F4C, 0x26D7C8AF), COMB_D(0x312FA332, 0xAB9392CA), 0}},
+    {{COMB_D(0x62CD11D4, 0x439608E1), COMB_D(0x36E9B6B2, 0xC9327BB1), COMB_D(0x38B42C7D, 0xB8321BBD), COMB_D(0x2774ADBC, 0xFBF73336), 0},
+     {COMB_D(0x676A8238, 0x2EC066B2), COMB_D(0x3CDA84E0, 0x2CEE46DD), COMB_D(0xBC3218F0, 0xDB484544), COMB_D(0x09831B42, 0x98D26570), 0}},
+    {{COMB_D(0x2686365F, 0xFE3A320E), COMB_D(0x2EDE6DD0, 0x36D55534), COMB_D(0x6B2CACAF, 0xA9EE4BE7), COMB_D(0x720D27FC, 0xF3121BE0), 0},
+     {COMB_D(0xCD0D23D2, 0x3DA4CFF5), COMB_D(0xA04E7D78, 0xA3FE1082), COMB_D(0xC33A1701, 0x0C159C35), COMB_D(0x3CE6F830, 0xA9FD0E57), 0}},
+    {{COMB_D(0x7BF4E37C, 0xB0C31E5E), COMB_D(0xF5555DB5, 0xC0FD5EE0), COMB_D(0x2DBD3409, 0x454F3152), COMB_D(0xD8A9497A, 0x648BCEDA), 0},
+     {COMB_D(0x5F3E3EF9, 0x989F1A2B), COMB_D(0xE3C5E354, 0x51C5A791), COMB_D(0x4F0F2FE1, 0x9124878B), COMB_D(0x8CE7C1D4, 0x6AD513B6), 0}},
+    {{COMB_D(0xF74097D5, 0x25E09D44), COMB_D(0x499F2401, 0x504BAAAC), COMB_D(0x5178CCA5, 0x28630357), COMB_D(0xAE0F0EBA, 0x18174F11), 0},
+     {COMB_D(0xC1E0EE67, 0xB844B6F3), COMB_D(0x6981990D, 0xA9B3E591), COMB_D(0xBB221D63, 0x28F23B2C), COMB_D(0xEAB80A02, 0xE86C3B37), 0}},
+    {{COMB_D(0xB05975C9, 0xCE6D93B7), COMB_D(0x7E5FF8AC, 0x336EA6A1), COMB_D(0xD81CE47A, 0xD2D1835E), COMB_D(0x3595EA4F, 0xDC5C4B16), 0},
+     {COMB_D(0x4D4CFCC7, 0xE19DAD5F), COMB_D(0x374C21C5, 0x57A9ABDE), COMB_D(0x79CA16AD, 0xB26FF5C4), COMB_D(0x952A6EEE, 0x68D9E0C5), 0}},
+    {{COMB_D(0x9A194865, 0x28777F9D), COMB_D(0x1D4B0B68, 0x3E33248D), COMB_D(0xF44625F4, 0x2D63865D), COMB_D(0x50EADA17, 0x7B2F5B13), 0},
+     {COMB_D(0x0C7B0CBC, 0x26E9A28E), COMB_D(0xCDAB5766, 0xCD45D50D), COMB_D(0x1979DCD7, 0x9E2B2ECD), COMB_D(0xAC490934, 0x154010C2), 0}},
+    {{COMB_D(0x56212B36, 0x999BCA22), COMB_D(0xA1DF8080, 0x0D279AAF), COMB_D(0x7049F63E, 0xF0B663A7), COMB_D(0x9AFC0759, 0x7DDE0812), 0},
+     {COMB_D(0xAEBCE0BF, 0x0B39CC81), COMB_D(0x674599C8, 0xDD3D3C44), COMB_D(0x54E14CDF, 0xC822D8A8), COMB_D(0x6C9F1EF5, 0x7DF967FF), 0}},
+    {{COMB_D(0x98FBEA5E, 0xE72DD53A), COMB_D(0xDB46AE4D, 0x68A84BF0), COMB_D(0x144EBC2D, 0xE747AA83), COMB_D(0xE6AC67B1, 0x996218B7), 0},
+     {COMB_D(0x4ED6D73F, 0x7E384C3C), COMB_D(0x56484A26, 0x728E5D16), COMB_D(0xF3B563FF, 0x850D9B68), COMB_D(0xE91B8506, 0x3E7EF395), 0}},
+    {{COMB_D(0x699A4BC2, 0x00D9C802), COMB_D(0xB5A5B98A, 0x321F3966), COMB_D(0xE2A034FF, 0xAC1743AF), COMB_D(0x10F9BFD8, 0x193E3C52), 0},
+     {COMB_D(0x4501165D, 0xDE214131), COMB_D(0xAB8E8969, 0x3FC58D28), COMB_D(0xB8607F6E, 0x42743B20), COMB_D(0xFBB95C5F, 0x7333BD48), 0}},
+    {{COMB_D(0xC65D54FE, 0x73D19D20), COMB_D(0xFC399AA5, 0xA4479D9D), COMB_D(0x965D968C, 0xFF0AF477), COMB_D(0xD58F130E, 0xC1E96B22), 0},
+     {COMB_D(0x4FF43B1A, 0x47D955C2), COMB_D(0x596F2B3A, 0x1592DFC3), COMB_D(0xBE3557E0, 0xE801298E), COMB_D(0x6970F24D, 0x6539B810), 0}},
+    {{COMB_D(0xC7B73455, 0x01F6B205), COMB_D(0xA69E0460, 0x0B713C66), COMB_D(0xDBE1CDBE, 0x146D5575), COMB_D(0x2C7EB3D4, 0xFBC832BB), 0},
+     {COMB_D(0xDC588E3F, 0x9675913A), COMB_D(0xBFDAB731, 0x9BE90A66), COMB_D(0xDD3F7BCB, 0x9DE04594), COMB_D(0xCC43E7B8, 0x7155DD37), 0}},
+    {{COMB_D(0xD82CB2DE, 0x8232FBC9), COMB_D(0xA0018093, 0xA5AF8899), COMB_D(0x28EBAB45, 0x416D26E9), COMB_D(0xF20C8567, 0x88DE4944), 0},
+     {COMB_D(0x6F280E3A, 0xD9EBD3EF), COMB_D(0xB7A2400A, 0x958A6F45), COMB_D(0x25AB9F17, 0x9C883583), COMB_D(0xE993BC9B, 0x618C5016), 0}},
+    {{COMB_D(0x38424B5F, 0xDB4F036C), COMB_D(0x3DBD1832, 0xB69B1DCE), COMB_D(0x634C2AB7, 0xBBBC62FB), COMB_D(0x2B2D7F75, 0xB04AEB58), 0},
+     {COMB_D(0x2907A870, 0xD1C1F629), COMB_D(0x5B0CFE55, 0xCD4DEF15), COMB_D(0xD895AF75, 0xB3C28824), COMB_D(0x8D4A26BB, 0x48A6A82D), 0}},
+    {{COMB_D(0x90698E7A, 0xFBE03321), COMB_D(0x0E72FF05, 0xF7FF5600), COMB_D(0x247E2DA9, 0x95E5AE92), COMB_D(0xDD8D882C, 0xD712DBE9), 0},
+     {COMB_D(0xE37C85E8, 0xB690F090), COMB_D(0xA31AF26D, 0x585B6C35), COMB_D(0xBBDE4FFF, 0xC4C34A8B), COMB_D(0x273B8683, 0xEE0D9275), 0}},
+    {{COMB_D(0x19C48B35, 0xDBEE7C4D), COMB_D(0xAC64A8DF, 0x0C711C0F), COMB_D(0xF9164DAB, 0x70E7519C), COMB_D(0x9F99D113, 0x3E42C987), 0},
+     {COMB_D(0xFDDB4CFF, 0x3852A32A), COMB_D(0xD7C0CA6A, 0x8DBD7014), COMB_D(0x1F144562, 0xE4585A4E), COMB_D(0x80708C83, 0x97DB7D33), 0}},
+    {{COMB_D(0xC5E9F3C2, 0x6A61540B), COMB_D(0x666B01FA, 0x1F79DB61), COMB_D(0xBE90949A, 0x8A325694), COMB_D(0x825E155A, 0x030172BE), 0},
+     {COMB_D(0xD42DD836, 0x66B4F16F), COMB_D(0x2E3AD0B0, 0x24C1A284), COMB_D(0x9136201C, 0x46AEF59E), COMB_D(0xB2B7D3AF, 0x0FE0A8D1), 0}},
+    {{COMB_D(0x240B3A51, 0xC46A67BE), COMB_D(0x26B2020C, 0xBF46F929), COMB_D(0x51396F68, 0x67F7E44F), COMB_D(0x4C564C89, 0xEB174667), 0},
+     {COMB_D(0xF41AB407, 0x13517BD4), COMB_D(0xF6ED1E93, 0x42E7822A), COMB_D(0x0F2C4F5D, 0x748CA98F), COMB_D(0x2D6C8B42, 0x3D31B52A), 0}},
+    {{COMB_D(0x0A857660, 0xEEA53B36), COMB_D(0x85DF0F20, 0xFB9BBFE7), COMB_D(0xA7A1BE95, 0x2BAF095E), COMB_D(0x6CABD37E, 0xA8DC6581), 0},
+     {COMB_D(0xB7307F5D, 0xB64C7EC5), COMB_D(0xECA4D9AB, 0x4D4B31F4), COMB_D(0xE1902EFB, 0x5CB77C08), COMB_D(0xC7C5394B, 0x43DF6A0D), 0}},
+    {{COMB_D(0xFB9BD50F, 0x5662371A), COMB_D(0x877F897C, 0x823CCFAC), COMB_D(0x332A7C0B, 0x9166EBFC), COMB_D(0xF9E2FE5A, 0xD97F73D2), 0},
+     {COMB_D(0xDF189A30, 0xFBA51DB2), COMB_D(0x3604ED36, 0x9717518A), COMB_D(0xBA5D2BFF, 0x171FD183), COMB_D(0x7F005D71, 0x442627A8), 0}},
+    {{COMB_D(0x77E8C9F3, 0x2438613C), COMB_D(0xE57AFA07, 0xC5E025A0), COMB_D(0x1F63424C, 0x619472E9), COMB_D(0xB68E6E1C, 0xABF7944D), 0},
+     {COMB_D(0x866F94D5, 0x6A8497AB), COMB_D(0x931E8A55, 0x98DDB4C1), COMB_D(0xA397752C, 0x79401F6C), COMB_D(0xC48DEF28, 0xC8E6E0F6), 0}},
+    {{COMB_D(0x24BA307B, 0x465553A6), COMB_D(0xC87E3669, 0xB288FA9E), COMB_D(0x57C28310, 0x2C8A5FE0), COMB_D(0xAAA88477, 0x9DCA044D), 0},
+     {COMB_D(0xCE13859F, 0xE1D9213D), COMB_D(0x869BE8EE, 0x5EB28F38), COMB_D(0xE9E91A71, 0xC4E8A80B), COMB_D(0x164A25A8, 0x7394F532), 0}},
+    {{COMB_D(0xE7DBD9AA, 0xA28C05E3), COMB_D(0xAAFD804A, 0x8EA364CE), COMB_D(0x8FE3DC96, 0x2ABC6B7F), COMB_D(0x5464DD53, 0x5B2F4993), 0},
+     {COMB_D(0xE4A7EA44, 0x8FB02C61), COMB_D(0x72F8B7D0, 0xE801EBA3), COMB_D(0xB88A13EA, 0x346B6E7F), COMB_D(0xD21D8DB8, 0x875E4B65), 0}},
+    {{COMB_D(0x183EC635, 0x6956049D), COMB_D(0x4F7B129A, 0x6701E845), COMB_D(0xBF7D9A11, 0xD1EF131A), COMB_D(0xDF014254, 0x357DF0F2), 0},
+     {COMB_D(0xA6E7D0CE, 0x0FA39BA0), COMB_D(0xA54EB34F, 0x1D11FB2E), COMB_D(0x19885812, 0x9FA2ACF1), COMB_D(0x703547F2, 0xF87D76A4), 0}},
+    {{COMB_D(0x43533E08, 0xC33B88CB), COMB_D(0xEFC6D11A, 0x24467135), COMB_D(0xB623E373, 0xF92DE91C), COMB_D(0xFA8D8FBD, 0xBBCB0058), 0},
+     {COMB_D(0x7F311FE0, 0x33C43A29), COMB_D(0x5B52B53B, 0xF2F7A8A3), COMB_D(0x86E45C24, 0xF4F241F7), COMB_D(0x82A80B04, 0x562A86FC), 0}},
+    {{COMB_D(0x8F95747F, 0x9CF8AE4F), COMB_D(0x089926FE, 0x5B5184F5), COMB_D(0x6AFFE5D7, 0x9D9B450C), COMB_D(0xCFF94639, 0xDEEA240E), 0},
+     {COMB_D(0x778CE94A, 0x275BF514), COMB_D(0x440BFF99, 0xED26B8F3), COMB_D(0x2F8541AD, 0x9C1B669D), COMB_D(0x1B56613A, 0x971F2E01), 0}},
+    {{COMB_D(0x439C3389, 0xE0512283), COMB_D(0x2F318DCD, 0xC15AC004), COMB_D(0xFA7F16C0, 0xCBF3EB19), COMB_D(0x2E8B8962, 0xD7788C71), 0},
+     {COMB_D(0xC289428B, 0x54A6C364), COMB_D(0x46149933, 0x546DF213), COMB_D(0xA0268D09, 0xFAD8A9DD), COMB_D(0xB7E2B5A6, 0xB305437C), 0}},
+    {{COMB_D(0x89706797, 0x7AD3EFB2), COMB_D(0x2BD0657B, 0x10BB1597), COMB_D(0x126493DF, 0xEED3413B), COMB_D(0x7FC5A39C, 0x31D15637), 0},
+     {COMB_D(0x2847F71F, 0xA72E3F30), COMB_D(0x48B3D67E, 0xC221CA65), COMB_D(0xB5D6D37A, 0x5A02DEFB), COMB_D(0x347DAE72, 0x8DC21D4F), 0}},
+    {{COMB_D(0xA58AA522, 0x58480345), COMB_D(0xE0779210, 0x8C1441F0), COMB_D(0x3AAFE72D, 0x5D49B2CF), COMB_D(0xB745DE35, 0x13186D98), 0},
+     {COMB_D(0xB5E8832B, 0x63BD4A15), COMB_D(0x38F467D5, 0x4A0B0046), COMB_D(0xCB6A6785, 0x2001D416), COMB_D(0x50D08E95, 0x4E6D99D1), 0}},
+    {{COMB_D(0x6CA80230, 0xFCADDEA1), COMB_D(0x821A0A30, 0x3A150320), COMB_D(0x6874FE19, 0xF09D4253), COMB_D(0x95F072FB, 0x4CBD7163), 0},
+     {COMB_D(0x4C824DC4, 0x725DF005), COMB_D(0xDFC96216, 0x1CC8BA58), COMB_D(0x1F716FB0, 0x42ADA943), COMB_D(0xA31DC0B1, 0x2EDA4D42), 0}},
+    {{COMB_D(0x700DA7B3, 0xA29A3AD1), COMB_D(0xF8081DCF, 0x3B217555), COMB_D(0x409F0017, 0xB1DBECF7), COMB_D(0x9277C321, 0x80713DB9), 0},
+     {COMB_D(0x872A0217, 0xE3F8DFFD), COMB_D(0x2A72A53D, 0x1CD66CCD), COMB_D(0xAD2383CB, 0x9E744FB8), COMB_D(0x2C21D6F3, 0xC804B6CA), 0}},
+    {{COMB_D(0x5C65DA59, 0x1DC61237), COMB_D(0x7070537C, 0x1EAC189C), COMB_D(0xBF5C02C2, 0x596E35B2), COMB_D(0x0C69DACA, 0xDDABCB53), 0},
+     {COMB_D(0x5847AE6A, 0xE647ADE2), COMB_D(0x1D718A1E, 0xB46CF76D), COMB_D(0xFB126EAF, 0x23370FE9), COMB_D(0x186EC1DB, 0xCB1FA47E), 0}},
+    {{COMB_D(0xE77ABBC3, 0xC94B899C), COMB_D(0x7016E532, 0x06C89FD5), COMB_D(0xF3839E43, 0x730C289B), COMB_D(0x0983B4E3, 0xFF04DE8C), 0},
+     {COMB_D(0x987D0387, 0xB693A271), COMB_D(0x1E701535, 0x94683275), COMB_D(0xEC74315D, 0x3533B173), COMB_D(0x9755FBB0, 0xC69EC81A), 0}},
+    {{COMB_D(0xF6378F3A, 0x36C53470), COMB_D(0x2D6C1A02, 0xFEC172B2), COMB_D(0x11D30030, 0x190E6C34), COMB_D(0x3157AD5C, 0xAA2E6662), 0},
+     {COMB_D(0x43FE20CE, 0x7440AEB2), COMB_D(0x05CB2669, 0x9B7F39EB), COMB_D(0x4E3D336D, 0x6E535B49), COMB_D(0x67302D7F, 0xDD2EBB97), 0}},
+    {{COMB_D(0x3E0CBC9F, 0xB4F4C141), COMB_D(0x11FB5F25, 0x7F950613), COMB_D(0xF08B29E5, 0x60601065), COMB_D(0xDFCF3B0C, 0xCDBA613D), 0},
+     {COMB_D(0x126ABE42, 0x80E822DA), COMB_D(0x30414FFE, 0xA8EF72E3), COMB_D(0x83613697, 0x596BE210), COMB_D(0x5A2B83EF, 0xB181CB35), 0}},
+    {{COMB_D(0x7EA29F19, 0xA821BC57), COMB_D(0x5CD73AB4, 0x07BC1DF3), COMB_D(0xB9561240, 0x59989C24), COMB_D(0xBAC392CF, 0x11D10164), 0},
+     {COMB_D(0xB296CFE4, 0x3FD96053), COMB_D(0x6BFD87C5, 0x9636E37C), COMB_D(0x70EE686D, 0x3672FC95), COMB_D(0x9E3FC301, 0x23BAB169), 0}},
+    {{COMB_D(0xE1F2B34B, 0xF1C9C54F), COMB_D(0xF74C12C4, 0xCE0397B5), COMB_D(0x1F212586, 0x73D5CE82), COMB_D(0xED8B03AC, 0xC5580CD5), 0},
+     {COMB_D(0xF32548E2, 0x5C0C195E), COMB_D(0x45054008, 0x24D781AC), COMB_D(0x7CA512AC, 0xFE0CB204), COMB_D(0x3F1E6FEB, 0xCB7C5D5A), 0}},
+    {{COMB_D(0xC645C0CF, 0x91B65E5A), COMB_D(0x736D73B5, 0xFAA3D2D6), COMB_D(0xD3FCA658, 0x618392A1), COMB_D(0xF100B45C, 0x8B7D8679), 0},
+     {COMB_D(0x432F05FB, 0x25E4F5A6), COMB_D(0x66E2EE94, 0x3DA8C361), COMB_D(0xDA5CD703, 0x759BECCB), COMB_D(0xEF582557, 0x8FC52A02), 0}},
+    {{COMB_D(0x3F2101CF, 0xAE1C8602), COMB_D(0x2CC955E1, 0x6588270C), COMB_D(0xD79365C0, 0x4A8C3AF7), COMB_D(0x9CB50246, 0x4066787F), 0},
+     {COMB_D(0x30CA86BC, 0x05B509A2), COMB_D(0x4257B1DC, 0x68D13CB7), COMB_D(0xF219B9D9, 0xA2B09625), COMB_D(0x3DF58C95, 0xC053F072), 0}},
+    {{COMB_D(0x102099C6, 0x8F8BDA0D), COMB_D(0x2FC55367, 0x77CF057A), COMB_D(0xB221D65B, 0x23EA6817), COMB_D(0x5CDB3ED1, 0xA135538E), 0},
+     {COMB_D(0xA97E73E7, 0xF9DF0415), COMB_D(0xE4A793CE, 0xF45C4FC9), COMB_D(0x9A64FC2F, 0x30BD8B3A), COMB_D(0x651B7641, 0xC6376EC6), 0}},
+    {{COMB_D(0xC7A2C66F, 0xFA3297BB), COMB_D(0xCC4E3803, 0xA1AA8A60), COMB_D(0x9403933A, 0x60E622F2), COMB_D(0x506E90B2, 0xCD343123), 0},
+     {COMB_D(0x53677E3A, 0x438AEFD5), COMB_D(0xE63D911F, 0x5B986037), COMB_D(0x030CBA92, 0x4C1A0B90), COMB_D(0x303FFDE6, 0x2460E80D), 0}},
+    {{COMB_D(0x0304346F, 0x195C0634), COMB_D(0x18564ED9, 0x025E7E9E), COMB_D(0xCB7C7A8E, 0x73E3FF42), COMB_D(0x396840F0, 0x9811FF1F), 0},
+     {COMB_D(0xD56BA637, 0xB62E61C7), COMB_D(0xF22504AA, 0xEF0CB1A0), COMB_D(0xB4F56729, 0xBE8559C1), COMB_D(0x71608E8E, 0xD93E1703), 0}},
+    {{COMB_D(0x2B5F391D, 0x3C5EEC01), COMB_D(0x66F81020, 0x21E4B0D9), COMB_D(0x8CBDA161, 0x290D9658), COMB_D(0xCACFAB20, 0x2027BBFC), 0},
+     {COMB_D(0x028AFBC9, 0xC6919A91), COMB_D(0x5B1042D5, 0xC8AFD8F1), COMB_D(0x266419D8, 0x76E759B0), COMB_D(0x1A8F570A, 0x482C15D0), 0}},
+    {{COMB_D(0x06600006, 0x7B3A4F32), COMB_D(0x3253DA57, 0xAA5D44CF), COMB_D(0x6E63F37B, 0x20F2705D), COMB_D(0x9A277FAC, 0xE65F2369), 0},
+     {COMB_D(0x5DFA5CAD, 0x6C8A26E1), COMB_D(0xEE021932, 0x1CE1B423), COMB_D(0x55C5111F, 0xBFA02763), COMB_D(0x8D47A15A, 0x98063E67), 0}},
+    {{COMB_D(0x67E90537, 0xF3C8D7AB), COMB_D(0xDF649CFB, 0x03B716D9), COMB_D(0xCF78AF9E, 0x6F3D68F0), COMB_D(0x05EA58BE, 0xA6C7F4F5), 0},
+     {COMB_D(0x59598BD0, 0x273EF8DA), COMB_D(0xE317980B, 0x3CD5BBD2), COMB_D(0x1A4BDF17, 0x48B34133), COMB_D(0x8680581A, 0xC7666AE4), 0}},
+    {{COMB_D(0x00CC9B3C, 0x94453776), COMB_D(0x3E9420E9, 0xB9D0B65A), COMB_D(0x2D49C907, 0x7C6CEC9C), COMB_D(0xABA40BD2, 0x9AF13C2E), 0},
+     {COMB_D(0x74A4DEF0, 0x22738688), COMB_D(0x2DB4A786, 0xE6E71ACA), COMB_D(0xD01AED98, 0xA236AB41), COMB_D(0x3B9C6219, 0xA707AEEE), 0}},
+    {{COMB_D(0xAB1F5283, 0x85B0C642), COMB_D(0x0762F061, 0x09EABDDD), COMB_D(0x6D4C4DFC, 0xCA323E05), COMB_D(0xA4723B6E, 0x9F3C91DC), 0},
+     {COMB_D(0xF18B5FC3, 0xE0255A5F), COMB_D(0x5D662739, 0x69193B53), COMB_D(0x3F031264, 0x3117D110), COMB_D(0x717F9D01, 0x6E5801B8), 0}},
+    {{COMB_D(0xD56A7A79, 0x6BA27646), COMB_D(0xBDF6A46C, 0x65C7C216), COMB_D(0xA04B3924, 0x2E3448DC), COMB_D(0x75D4A860, 0x5FE76687), 0},
+     {COMB_D(0x63807291, 0x9874A1F3), COMB_D(0xCC2933E0, 0xAA31A3DE), COMB_D(0xC7DE852E, 0x4E518E4A), COMB_D(0x6B29AFE8, 0x129AACAB), 0}},
+    {{COMB_D(0xAF37B39A, 0x19AB48F0), COMB_D(0x9D23200C, 0xBCB538FC), COMB_D(0xDCF4A2D7, 0xED174369), COMB_D(0xA79DFF6A, 0x0EAC1B57), 0},
+     {COMB_D(0x64A3B061, 0x968BB5AB), COMB_D(0x66878F59, 0x9F970D43), COMB_D(0xCC7EEF80, 0x7F469461), COMB_D(0x6D530D8C, 0xE7075718), 0}},
+    {{COMB_D(0x56AC69BA, 0x64147F4D), COMB_D(0x7438996B, 0x1B12FC1F), COMB_D(0x700AF416, 0xFDA2DA22), COMB_D(0x00C68F84, 0xA9148F90), 0},
+     {COMB_D(0x768F3B91, 0x4C056D8D), COMB_D(0x29384940, 0x31E478BC), COMB_D(0x80741793, 0x5D9BE102), COMB_D(0x7A8C34D4, 0x769A1DCF), 0}},
+    {{COMB_D(0xD66E4996, 0x04A4DD61), COMB_D(0x19E6B25F, 0xBD628F5C), COMB_D(0xC9FD8ECE, 0x36B6BD96), COMB_D(0xB4FA28A8, 0xF72AD170), 0},
+     {COMB_D(0x85C2101C, 0x532B43F0), COMB_D(0xDB0398E6, 0x07804464), COMB_D(0x102C8D5D, 0xFCCF9525), COMB_D(0x6CBC0D4D, 0x1606F38F), 0}},
+    {{COMB_D(0x606304B1, 0xA44E8DE3), COMB_D(0x5C08966A, 0x2ECC1E07), COMB_D(0x3A5A7DCF, 0x08BD1791), COMB_D(0xF50B99B7, 0x468810B7), 0},
+     {COMB_D(0x4A3F3BA6, 0xDB7F3588), COMB_D(0xE975F18D, 0x21721E85), COMB_D(0x8789973A, 0x2DEDCEBB), COMB_D(0xE2B5061E, 0x55F18F0C), 0}},
+    {{COMB_D(0x9F7E1493, 0xDD42072E), COMB_D(0xF819F27C, 0x781588E7), COMB_D(0xC777A595, 0x7B39EDA8), COMB_D(0x6D1037A8, 0x25EB70E5), 0},
+     {COMB_D(0x0763C7BB, 0x3BB99C6D), COMB_D(0x55A316A4, 0x9A9238B5), COMB_D(0xAC7B7587, 0xB410C0E3), COMB_D(0xD2D99F75, 0x470A2A2F), 0}},
+    {{COMB_D(0x53B73854, 0x7310119E), COMB_D(0x7877F34C, 0x12B65072), COMB_D(0x5E370EBF, 0xE9CAE5B4), COMB_D(0x06ED1148, 0xF552387F), 0},
+     {COMB_D(0xF14ACC8F, 0xC463D605), COMB_D(0x88959A9E, 0x561FFB87), COMB_D(0x46203A23, 0x2A00D72C), COMB_D(0x4DCC1873, 0x4D95FACB), 0}},
+    {{COMB_D(0x62A1C5F5, 0x704F2D83), COMB_D(0xB3A39985, 0xB8EC056A), COMB_D(0x8689D78E, 0x315BB106), COMB_D(0x5F9437E9, 0x7C5F3E97), 0},
+     {COMB_D(0xC7FB9E00, 0x3A14A18C), COMB_D(0x3A422489, 0x21887A04), COMB_D(0x64BCB630, 0xE95D6C1E), COMB_D(0xCC7C883C, 0x667169B6), 0}},
+    {{COMB_D(0x3EBB9480, 0xDA2CE4E7), COMB_D(0x0AC64013, 0xF7A372F1), COMB_D(0xA7374BE5, 0x18EE23D7), COMB_D(0xAEC73497, 0x725DB62D), 0},
+     {COMB_D(0x0EECD05B, 0x078F743F), COMB_D(0x9506375A, 0x3E946DD7), COMB_D(0x2EE9DDBE, 0x827DD00B), COMB_D(0xD2B271C1, 0xDCFD0108), 0}},
+    {{COMB_D(0xA839AE82, 0x0221BABC), COMB_D(0x220DA27F, 0xEE454F1D), COMB_D(0xB36F6058, 0x68C8776B), COMB_D(0x9B5B8527, 0x7150DF6C), 0},
+     {COMB_D(0x8A939923, 0x234890E9), COMB_D(0x1476783F, 0x443E689A), COMB_D(0x60A9787D, 0xD67F476A), COMB_D(0xDA327D09, 0xE0F85425), 0}},
+    {{COMB_D(0xF1253D66, 0x213CB30D), COMB_D(0x0E185BE3, 0x9E102060), COMB_D(0xD5C7F049, 0x0609C8AB), COMB_D(0x36B53CE6, 0x8A240E47), 0},
+     {COMB_D(0x4C2C1564, 0x38E3DAEC), COMB_D(0xAF83DCB3, 0xB7AF652F), COMB_D(0x2ED045BE, 0xD96B1184), COMB_D(0xEA3245A9, 0x74F14261), 0}},
+    {{COMB_D(0x9DA0E425, 0xC941A32F), COMB_D(0xB9CCFB38, 0x49C4D4A8), COMB_D(0x2A196B7E, 0x26EEDFA3), COMB_D(0x56137B18, 0x72B811F4), 0},
+     {COMB_D(0x8A1FE99E, 0x7201AB6A), COMB_D(0x3E2A877F, 0x85CD7ADE), COMB_D(0x64D755DA, 0xFA310E9E), COMB_D(0x10531647, 0xED881580), 0}},
+    {{COMB_D(0xD7DEFCEC, 0xACE5E1ED), COMB_D(0xC83674F2, 0x910BDFFA), COMB_D(0x9C13C041, 0x1B333132), COMB_D(0xFAA431BA, 0x8697C225), 0},
+     {COMB_D(0xBAF10511, 0x6B1DF7A3), COMB_D(0xB3DC25BD, 0x5D81CCAC), COMB_D(0x35B48788, 0x366E420A), COMB_D(0x157C8C0C, 0xC04255A8), 0}},
+    {{COMB_D(0x299CF475, 0x25117EAD), COMB_D(0xE36D1E01, 0x8D51CF0C), COMB_D(0x137D74F8, 0x910A2458), COMB_D(0x6AA7A84C, 0x074EB1A4), 0},
+     {COMB_D(0xAB8F725D, 0x26ADF80C), COMB_D(0x079A60CE, 0x019B1983), COMB_D(0x4F605D5F, 0xD70988C3), COMB_D(0xB203E6E9, 0x0FC61EE1), 0}},
+    {{COMB_D(0xE942FC34, 0x805B4A7C), COMB_D(0x9579780B, 0x691358B2), COMB_D(0x51646C94, 0x504E2E27), COMB_D(0x4EB12668, 0xC612CC19), 0},
+     {COMB_D(0x3CAF7C93, 0x460BC7CF), COMB_D(0x74B25A52, 0x6B55878F), COMB_D(0x9CF18A95, 0xB59AF49E), COMB_D(0x04B0737C, 0x070C7EE9), 0}},
+    {{COMB_D(0x1F422216, 0x3E335CEF), COMB_D(0x14044B52, 0xF0928EBF), COMB_D(0xABFF9988, 0x13B2DBD0), COMB_D(0x7592EA07, 0xCC900399), 0},
+     {COMB_D(0x2DA5AE8B, 0x174E092A), COMB_D(0xFAAA7243, 0x6180BEF0), COMB_D(0x6A875B2D, 0x482254CF), COMB_D(0xDD03AA8B, 0xAB86BADB), 0}},
+    {{COMB_D(0x79C72367, 0x27EF5058), COMB_D(0xC9FB3F11, 0x1E32560D), COMB_D(0x89695C49, 0xA5DBAD32), COMB_D(0xF6280ABE, 0xA8010F2C), 0},
+     {COMB_D(0xA6A4F26F, 0x14C349A4), COMB_D(0xFBB6BB66, 0x8AA8DB0E), COMB_D(0xA7BE36EB, 0x91449A6D), COMB_D(0xF6A5E786, 0xA707B393), 0}},
+    {{COMB_D(0xF33AAFA8, 0xA9E69963), COMB_D(0x151E9E2B, 0x1EEA0238), COMB_D(0x34C3C721, 0xD5CB6E70), COMB_D(0xE2954828, 0xAE68DC6C), 0},
+     {COMB_D(0xD1A108C4, 0x4A1DF581), COMB_D(0xC9914968, 0x89C38365), COMB_D(0xA219FB08, 0x178380FC), COMB_D(0x5546D5AD, 0x487C50FA), 0}},
+    {{COMB_D(0xD67D4EED, 0x1E83032E), COMB_D(0x27786915, 0x1100E9DA), COMB_D(0x69ACE8E0, 0xFA5B3929), COMB_D(0x898FBE7C, 0xCECF08C3), 0},
+     {COMB_D(0x4E98023C, 0xBE532344), COMB_D(0xA961D049, 0xDCFD4AF0), COMB_D(0xE079EC9A, 0x57148F32), COMB_D(0x56312A41, 0x65A5F73E), 0}},
+    {{COMB_D(0xE40B22AA, 0xE2E3ED15), COMB_D(0x257EC10D, 0x8DDCC96F), COMB_D(0xDCF65B5C, 0xCA2FF505), COMB_D(0x23E758FB, 0xA100AE4E), 0},
+     {COMB_D(0xD7ADA179, 0x1DED7937), COMB_D(0xFFC76DDF, 0x1A80B698), COMB_D(0x8293D117, 0x2216F40E), COMB_D(0x846468CE, 0xDCA1FD60), 0}},
+    {{COMB_D(0xD431C64E, 0x4424D5B5), COMB_D(0x40F3C229, 0x9E52E067), COMB_D(0xC9684B86, 0x74EF7C94), COMB_D(0x06C6D70D, 0xAD590430), 0},
+     {COMB_D(0x0BB25810, 0xF2124236), COMB_D(0xEB7F0B1F, 0x419D8002), COMB_D(0x9979F008, 0xC6AEA495), COMB_D(0x59408EEB, 0x41E95B0D), 0}},
+    {{COMB_D(0x0E0A9E55, 0x9FB86F21), COMB_D(0xA094A894, 0xBAA60FDE), COMB_D(0x931AED64, 0xA8656392), COMB_D(0x0CD30000, 0x22D61F81), 0},
+     {COMB_D(0x9A09B321, 0xEE9077E8), COMB_D(0xCD05A655, 0x1DE617E4), COMB_D(0x2F61F3B7, 0x45719E7C), COMB_D(0x9DBB9DC3, 0x7F937AB8), 0}},
+    {{COMB_D(0x00BF1573, 0x0E574E5E), COMB_D(0xA21AC3EC, 0x24EFD99D), COMB_D(0x87C3E478, 0x6F8FE654), COMB_D(0x6E4EE021, 0x01ECCB19), 0},
+     {COMB_D(0xDBA86666, 0xFDFFE4B3), COMB_D(0x917A02CD, 0x495798BA), COMB_D(0xFD789A21, 0x81206258), COMB_D(0x5C91029F, 0xC8811CE0), 0}},
+    {{COMB_D(0x6D65792A, 0xD8FEBE13), COMB_D(0x0BCAA380, 0x2E9DDDD2), COMB_D(0x09A46EAB, 0x53E6DD35), COMB_D(0xAA706E2C, 0xC8B09450), 0},
+     {COMB_D(0x8BF21AFE, 0x51B52256), COMB_D(0xAD339211, 0xE9885A8C), COMB_D(0x73C5D067, 0x76010835), COMB_D(0xACF01B1D, 0x7D5A73AB), 0}},
+    {{COMB_D(0x31FD4B92, 0x4A88ADCF), COMB_D(0x14649C2F, 0x60CAEF08), COMB_D(0x52EA6E90, 0x52E0899E), COMB_D(0x3C90ACB8, 0x07ED2580), 0},
+     {COMB_D(0x12A34EF6, 0xB3CC37E8), COMB_D(0x447BA517, 0x08CC5F31), COMB_D(0xA8FF76D5, 0xB05E035C), COMB_D(0x78D41C76, 0x83414FEF), 0}},
+    {{COMB_D(0x5432837E, 0x28118C55), COMB_D(0xD426F711, 0x58F27E07), COMB_D(0xE0FECFA3, 0x785CF634), COMB_D(0x1E3FD7EC, 0xB101A8DD), 0},
+     {COMB_D(0xEE86A8F7, 0x7C3C9EAE), COMB_D(0xAA9D5A3F, 0xCA42DFBC), COMB_D(0xAE7ACF5B, 0xA8CEC1A2), COMB_D(0x08FBCB27, 0x8F32D3E9), 0}},
+    {{COMB_D(0xC2768199, 0x79C8AD4F), COMB_D(0x5FA7C59E, 0x74F7ED14), COMB_D(0x13AAF67E, 0x9C39D3D5), COMB_D(0xE6BF9050, 0xCA845202), 0},
+     {COMB_D(0x7641D027, 0xB39AF434), COMB_D(0x5AD9C8F2, 0x157F72D9), COMB_D(0x84BB7242, 0xD441E129), COMB_D(0xD782AB92, 0xBEA0A153), 0}},
+    {{COMB_D(0x83DB98E3, 0x1EB80446), COMB_D(0x4552A3E5, 0xB53ACB0C), COMB_D(0x730DD6A3, 0x9CD31A82), COMB_D(0x12843156, 0x90439645), 0},
+     {COMB_D(0x7701D5DF, 0xDC00A29E), COMB_D(0x0E970EEE, 0x779A956E), COMB_D(0x36CCA301, 0xE2B9CDEA), COMB_D(0xF8F006AD, 0x0F9181B4), 0}},
+    {{COMB_D(0x629AFE56, 0x16A6D43D), COMB_D(0xA97DD60B, 0x44BCA96A), COMB_D(0x46919965, 0x565118A1), COMB_D(0x4F456A9B, 0x3D14A10F), 0},
+     {COMB_D(0x3BBA70F2, 0x08E9B082), COMB_D(0xF99A68A0, 0xE86F4D61), COMB_D(0x2A682A80, 0xE5A546E0), COMB_D(0x025E3A6A, 0xE0DF5BF6), 0}},
+    {{COMB_D(0x267C9B6B, 0x8D5E8799), COMB_D(0x228048C4, 0xA760B8AF), COMB_D(0x4EEDAEF1, 0x3C4EA591), COMB_D(0x13C73DDB, 0x5394CDCE), 0},
+     {COMB_D(0x43E7895C, 0x1EB18BB8), COMB_D(0xF4092FB4, 0xB93A2776), COMB_D(0xE4F171DA, 0xD924D243), COMB_D(0x0B4EDE98, 0xBA9E4DF7), 0}},
+    {{COMB_D(0x2BB4A182, 0xE903D734), COMB_D(0xF7084250, 0x76CDB924), COMB_D(0xEC3110F0, 0x82A35CD2), COMB_D(0x069E9802, 0x83F509A9), 0},
+     {COMB_D(0x63C20D98, 0x6C2E6688), COMB_D(0x117AEC4B, 0xA5DE203B), COMB_D(0x1D6A2075, 0x0EC0CAC5), COMB_D(0x443CD2C7, 0xF9DFAF63), 0}},
+    {{COMB_D(0x081163FC, 0xF31816EC), COMB_D(0x952AF52F, 0xF194D66F), COMB_D(0x77F56D72, 0x53C4EAD7), COMB_D(0xC8E01B3A, 0xAC3D70B8), 0},
+     {COMB_D(0x34CD030C, 0xB0004E2A), COMB_D(0x50DF7CE6, 0xB3B6B8D8), COMB_D(0x84C1A256, 0x30EC064B), COMB_D(0x7D603861, 0x74864555), 0}},
+    {{COMB_D(0x9AF011C3, 0xD964518B), COMB_D(0x5D6FE609, 0x72BCD12C), COMB_D(0x730EF2DF, 0x7224C1C1), COMB_D(0x27D058D5, 0xC81063ED), 0},
+     {COMB_D(0x51FB8BE7, 0x8181F989), COMB_D(0x20900D79, 0xBC359B18), COMB_D(0x2CC71FA3, 0x040D70CD), COMB_D(0xA084A1E4, 0x50F40761), 0}},
+    {{COMB_D(0xCDF6707C, 0x7D54BA1B), COMB_D(0x8149CE88, 0x77A0CCD4), COMB_D(0xCD0E390C, 0xB9D1D683), COMB_D(0x4469A82D, 0x72A5AF7C), 0},
+     {COMB_D(0xEE6F41A5, 0x3D72565C), COMB_D(0xD83DA288, 0x25F4E012), COMB_D(0x51E6179E, 0x7C058233), COMB_D(0xB068F337, 0xF8CAC4A8), 0}},
+    {{COMB_D(0x10D90C4B, 0xA209B2A3), COMB_D(0x4CFBD76B, 0x5FC64464), COMB_D(0x912A06D4, 0x3708DFB6), COMB_D(0xB4EB1B9B, 0xBBACA4B5), 0},
+     {COMB_D(0x7B88FC41, 0xC9F8B8FE), COMB_D(0x37AF61CD, 0xD5FB5305), COMB_D(0x45FE7096, 0x7F3FD46C), COMB_D(0x501A7C27, 0x3730B15C), 0}},
+    {{COMB_D(0x249DC38A, 0x4D47E0E0), COMB_D(0x69A0787D, 0xE0E5FD40), COMB_D(0x61FB4642, 0x452C30BE), COMB_D(0x84B91166, 0xE4AA40BD), 0},
+     {COMB_D(0x541B07CC, 0xEA0FBE17), COMB_D(0x3EF40992, 0x45820749), COMB_D(0x15717468, 0x67785158), COMB_D(0x17C32E6C, 0xA6658B50), 0}},
+    {{COMB_D(0x7920DD88, 0x28449520), COMB_D(0x258806FE, 0xDBA9F371), COMB_D(0x34FB31D4, 0x24E659A9), COMB_D(0x2F7A7EA9, 0x9316D10E), 0},
+     {COMB_D(0x9DFCAA8A, 0xBB952FD0), COMB_D(0x5BB75386, 0xF20127BE), COMB_D(0xC924D450, 0x58BD9F77), COMB_D(0x54124CF9, 0x9388D610), 0}},
+    {{COMB_D(0xA03A6E22, 0xC1D44507), COMB_D(0x07EDE091, 0xD70AEFE2), COMB_D(0xA0868D4D, 0x1D869354), COMB_D(0xB64D2C0C, 0x456B54A3), 0},
+     {COMB_D(0xB55BCE1C, 0x20E573AA), COMB_D(0x1D41FBE2, 0xDF8EDFEC), COMB_D(0xD1B3879F, 0xA2B5946A), COMB_D(0x418CDE98, 0x4A00A965), 0}},
+    {{COMB_D(0xDCE4B2B8, 0xC1AA3E8E), COMB_D(0x05731A37, 0xD6A50CA0), COMB_D(0x55313F53, 0xCA86AA14), COMB_D(0x6CAAE776, 0x0EFE617D), 0},
+     {COMB_D(0x5D49AF6D, 0x06A0378A), COMB_D(0x546A652A, 0x52C8087F), COMB_D(0xAC133CC6, 0x78B41283), COMB_D(0xB6A5F5B4, 0x39321572), 0}},
+    {{COMB_D(0x27F51820, 0x3C5BB5FC), COMB_D(0xCAC5893D, 0xBC2CDD6D), COMB_D(0x11C298E9, 0x95C742AA), COMB_D(0x2C28CEE0, 0x3CD0D629), 0},
+     {COMB_D(0xBF6FA5CE, 0x48A524B6), COMB_D(0xEB98244A, 0xC7CE9998), COMB_D(0xF6D60926, 0x3FF5B8BB), COMB_D(0x5727A134, 0x05A83B33), 0}},
+    {{COMB_D(0x018B2FC1, 0x01BDEAE1), COMB_D(0x9E73FC1F, 0x5C611E88), COMB_D(0xB6DE6545, 0x53D7F4E8), COMB_D(0x7F67972B, 0x7A7D8A6E), 0},
+     {COMB_D(0x91ED77E2, 0xAEEE4C1A), COMB_D(0x2D194320, 0xD0DCD2EB), COMB_D(0x6D24E5E8, 0xD78C64ED), COMB_D(0xE9F21A2A, 0xF8EC204A), 0}},
+    {{COMB_D(0x1956FAA9, 0x95107AEB), COMB_D(0xC0D4EC18, 0x99B99E74), COMB_D(0x7380BF35, 0xD2E5BA27), COMB_D(0xD6ECC8E5, 0xEB8B319C), 0},
+     {COMB_D(0x6010343C, 0xCB0A9CDC), COMB_D(0x5F47EC87, 0xA8192DB4), COMB_D(0xDDBFDACF, 0x2AC93D99), COMB_D(0xD7C46E10, 0x4E616205), 0}},
+    {{COMB_D(0x5ECE000F, 0xB56A4198), COMB_D(0x0D05830B, 0x9C42E058), COMB_D(0x9B50864D, 0x7B32B537), COMB_D(0xB4DD00B0, 0x2F248826), 0},
+     {COMB_D(0x4AA3B816, 0x212B10F6), COMB_D(0x0E6BC9AA, 0x1AB5184B), COMB_D(0x99E979E1, 0x72CE0D95), COMB_D(0xE62F22C5, 0xE4CC8CC8), 0}},
+    {{COMB_D(0xC90B0219, 0xC3466907), COMB_D(0x988797AB, 0x4083AC74), COMB_D(0x7B28C58B, 0xB1FAED0F), COMB_D(0x5A71938F, 0xB48DEFBA), 0},
+     {COMB_D(0x9BC78A47, 0x1119790B), COMB_D(0x3D14910A, 0xFE8FCC5D), COMB_D(0xC453FE68, 0x13EFE12F), COMB_D(0x42E7B8F2, 0xCCA45301), 0}},
+    {{COMB_D(0x89B0D1BC, 0x954F0D1B), COMB_D(0x377164C2, 0x7A9591D5), COMB_D(0xFC172D77, 0xE7B989B0), COMB_D(0x78A0664A, 0x4F2434A2), 0},
+     {COMB_D(0x6811046B, 0x0D3C62F4), COMB_D(0x4997BAE1, 0xF4C495D6), COMB_D(0xF2300A53, 0xE21D680F), COMB_D(0x01526062, 0xE6BE26AB), 0}},
+    {{COMB_D(0x4FFB3476, 0x8EDB20A8), COMB_D(0xAF8DF8E7, 0x9E9D1257), COMB_D(0xDF48E843, 0xA4BB86F1), COMB_D(0x486672E6, 0x26232B00), 0},
+     {COMB_D(0xA47F1AD9, 0x86E62118), COMB_D(0x7D66A95B, 0xC116045C), COMB_D(0x26B08E10, 0xA7393657), COMB_D(0xE3AD6DCE, 0x2F8EE49E), 0}},
+    {{COMB_D(0xE294AF04, 0xB0991313), COMB_D(0x94C2A6DC, 0x9619917B), COMB_D(0xEDE61EE9, 0x473F7B11), COMB_D(0x1E861BC1, 0x972202BE), 0},
+     {COMB_D(0x0267E0C8, 0xE5E0F368), COMB_D(0x22F6E128, 0x649B84BA), COMB_D(0x5FC453C2, 0xC3291D1B), COMB_D(0x5C7126B9, 0xF8FE284A), 0}},
+    {{COMB_D(0xC77ECB6D, 0x62389C1F), COMB_D(0x78887A6D, 0x6FDEC726), COMB_D(0x7433913D, 0xB33BBB82), COMB_D(0x443720D3, 0x397DE3B6), 0},
+     {COMB_D(0x62DD6FB7, 0x59A41978), COMB_D(0x1218102A, 0x743E4016), COMB_D(0xDBC477D1, 0x637F5965), COMB_D(0xB395C5B3, 0xB9BFEDFC), 0}},
+    {{COMB_D(0xE4B91A57, 0xB59BDA57), COMB_D(0xE35AB229, 0x09311311), COMB_D(0xB48559CC, 0x61E39FBE), COMB_D(0xDAF488A5, 0xED346CBE), 0},
+     {COMB_D(0x6BCD6413, 0x523D3038), COMB_D(0xA9F6348F, 0xA5361121), COMB_D(0x6C3B2237, 0x2D3213F5), COMB_D(0x5DAE66B7, 0x749685B3), 0}},
+    {{COMB_D(0x3666C787, 0xA4F617D9), COMB_D(0xDD9E0208, 0x162C44E5), COMB_D(0x13D2FF24, 0x51F01DFF), COMB_D(0xFDE3D802, 0xA5AA26E3), 0},
+     {COMB_D(0x58CEB2A3, 0x7A630E35), COMB_D(0x7E6AD96A, 0xC61A7EFE), COMB_D(0x36EDF610, 0x43EA83B2), COMB_D(0xF4E6DBDB, 0x01D4D5B2), 0}},
+    {{COMB_D(0xCE8C3531, 0x80BD46DD), COMB_D(0x0B62DA88, 0xD2889137), COMB_D(0xDD79D123, 0x568A62A6), COMB_D(0x45416AEE, 0x7C5B1545), 0},
+     {COMB_D(0x0135E61D, 0x67EBEC02), COMB_D(0x7220F9C2, 0x63C69958), COMB_D(0xF10496C6, 0x819C88E0), COMB_D(0xA167478E, 0x6975D3B2), 0}},
+    {{COMB_D(0x95EA382E, 0xECA0AD40), COMB_D(0x800F4562, 0x047CC0B4), COMB_D(0xE0DDF1BB, 0xABC8EE4A), COMB_D(0x3C89CF63, 0x3921630B), 0},
+     {COMB_D(0x632FEA20, 0x8D3BBE19), COMB_D(0xDBE0A3C6, 0xF89405E0), COMB_D(0x99390ECE, 0x095D74DB), COMB_D(0xA8030267, 0x7040055C), 0}},
+    {{COMB_D(0x1AF3BDF8, 0xA686CCE2), COMB_D(0x8A150314, 0xAC99364B), COMB_D(0x4562C234, 0x9659444C), COMB_D(0x3DA214DF, 0x00F29919), 0},
+     {COMB_D(0xDAB05DC1, 0x4AEC0171), COMB_D(0xCD710FFD, 0x7DB9DA25), COMB_D(0x415E3DF8, 0xCE0D046A), COMB_D(0x79D00AE3, 0x7ADE6B88), 0}},
+    {{COMB_D(0x66C42AEF, 0x27669D01), COMB_D(0x33F67FF6, 0x04124C38), COMB_D(0x509265FC, 0x1093F7A7), COMB_D(0x8C99DF03, 0xD304216D), 0},
+     {COMB_D(0x613D1908, 0x9B4E3F64), COMB_D(0x5D3CF326, 0x40DE315F), COMB_D(0xA947E72C, 0x2ADCF28D), COMB_D(0xC9258AD0, 0x567F8262), 0}},
+    {{COMB_D(0xDD80810A, 0x4B8553B4), COMB_D(0x115B0EF9, 0x9154BDBA), COMB_D(0x77D73B80, 0x0CF261C6), COMB_D(0xFC617C2F, 0x8A44578D), 0},
+     {COMB_D(0x1A5452E3, 0x55C2A0BE), COMB_D(0x45EC0768, 0xE8402974), COMB_D(0x452E1603, 0x59906D24), COMB_D(0x001F4967, 0xEE77057D), 0}},
+    {{COMB_D(0x7C0153FA, 0x09B2CF7E), COMB_D(0x9E1CB469, 0x8C3D9EDD), COMB_D(0x2019B4DF, 0x4CCC3B78), COMB_D(0x0245C264, 0xD4B5EFAC), 0},
+     {COMB_D(0xC8DD96DE, 0x30A775A6), COMB_D(0x3D87EFC7, 0xE731132C), COMB_D(0xC74681A1, 0x664C2400), COMB_D(0x296B7724, 0xEADE398C), 0}},
+    {{COMB_D(0x898B3FAB, 0x9EE7F0A6), COMB_D(0x28F8C0DF, 0xC8CE477D), COMB_D(0xFFFF8FEF, 0x47A2AAEC), COMB_D(0xD520ADD0, 0x0D73690E), 0},
+     {COMB_D(0xC4888590, 0x5BABB073), COMB_D(0xAAF01FE8, 0x62459949), COMB_D(0x4194468A, 0x3311574C), COMB_D(0x67709418, 0xFD2700E8), 0}},
+    {{COMB_D(0x33FEE9D0, 0x7D6A8BEA), COMB_D(0x3A809EEA, 0x02ADF6F7), COMB_D(0xD99953A9, 0x152E97EF), COMB_D(0x2D679576, 0xE9F46A54), 0},
+     {COMB_D(0xBF603C59, 0xD5FA5E49), COMB_D(0xE3784EE0, 0x32D47356), COMB_D(0xA973B815, 0x0B6EBE34), COMB_D(0x3C469595, 0xD4CB6A35), 0}},
+    {{COMB_D(0x1B2D2CB4, 0x267F3F42), COMB_D(0x91ABFC29, 0x089269F0), COMB_D(0xA169EF87, 0x39C96029), COMB_D(0x4CF001D8, 0x58A0C3AA), 0},
+     {COMB_D(0x30D5722B, 0x94FB2B9D), COMB_D(0x72723FB3, 0x5D319EA0), COMB_D(0x893EE5E0, 0x6F923C3A), COMB_D(0xF661957B, 0xD56ED82C), 0}},
+    {{COMB_D(0x56AF5F67, 0xECDDC128), COMB_D(0xB5A35688, 0xD6DE131F), COMB_D(0x43C84FF7, 0x7AB1744A), COMB_D(0x9EDA3E00, 0x4B86489B), 0},
+     {COMB_D(0x24A480D8, 0xC37A7F07), COMB_D(0xEC09AD9F, 0xA6807C8B), COMB_D(0xB13D2039, 0xCEF69E09), COMB_D(0x05E01798, 0x86679FED), 0}},
+    {{COMB_D(0x5BA1C9D5, 0xCA42EEA7), COMB_D(0xFA562F1C, 0xC8506BFF), COMB_D(0x0CD1E9CE, 0xB37EA980), COMB_D(0xA4B8D391, 0x9F6D0537), 0},
+     {COMB_D(0xE0A4F0B7, 0xE35AACEF), COMB_D(0x0AC14963, 0x8EB32AD8), COMB_D(0x9B8B3436, 0xD9C6C16F), COMB_D(0x0E44CFE2, 0xBA1D05CC), 0}},
+    {{COMB_D(0x38263D11, 0xE22F36B2), COMB_D(0xFB451D01, 0x3831A625), COMB_D(0x6C074BFC, 0xB219E01B), COMB_D(0x2953CA52, 0xAC345011), 0},
+     {COMB_D(0xFAB693EA, 0x89DEF426), COMB_D(0xB001E4FC, 0x055A674E), COMB_D(0x634ED189, 0xCBBD71C7), COMB_D(0x1ECBFD19, 0xD29F55DB), 0}},
+    {{COMB_D(0x3413EEEE, 0x622D2E26), COMB_D(0x5E4069D7, 0xA9194821), COMB_D(0x3680FA52, 0x479AD24B), COMB_D(0x4942EF47, 0x4835F114), 0},
+     {COMB_D(0x670C3C12, 0xD2634BF8), COMB_D(0x266E16DC, 0xD5350E82), COMB_D(0x90EC3B66, 0xEB658CAE), COMB_D(0x6F4EFDA2, 0x311D0707), 0}},
+    {{COMB_D(0x20BB3347, 0x52799FF0), COMB_D(0x347FC90D, 0x1F35D31E), COMB_D(0x3C4EFCB3, 0x8597B57F), COMB_D(0x383BC04E, 0xDC4E3211), 0},
+     {COMB_D(0x1AEE1BF7, 0x35EFA8F5), COMB_D(0x84EB66C3, 0x0DAA582F), COMB_D(0x60738B8E, 0xB60A62EC), COMB_D(0x0F313077, 0xB01E0122), 0}},
+    {{COMB_D(0x5629832A, 0xE97427FE), COMB_D(0x50DF5932, 0x049762F0), COMB_D(0x64044E05, 0x954C04E6), COMB_D(0x97E3E51C, 0xC6A32A38), 0},
+     {COMB_D(0xF992DA2C, 0x16AEC155), COMB_D(0xFBA892DF, 0x9E53377E), COMB_D(0x274E8CC2, 0x15DA5369), COMB_D(0x0B64FBA3, 0x0041AF91), 0}},
+    {{COMB_D(0x8B28E814, 0xD4EDEDBB), COMB_D(0xDB16A989, 0x50ED8D43), COMB_D(0x7DB68164, 0x7DF4449A), COMB_D(0xFBC32C39, 0x12CB7A59), 0},
+     {COMB_D(0xC819E2B1, 0xFB6767D5), COMB_D(0xBE73ED5D, 0x2FD12841), COMB_D(0xB3F3078B, 0xB5FF87CA), COMB_D(0xBC815FBF, 0xEC9FA4B8), 0}},
+    {{COMB_D(0x6533C85F, 0xF5C3FD5E), COMB_D(0x700E3A62, 0xC4E79296), COMB_D(0xE7A7EA6A, 0x8603EE55), COMB_D(0x96F6C3AA, 0x86330A3E), 0},
+     {COMB_D(0xB28A97DB, 0x20621B93), COMB_D(0xAA9E5955, 0x4F7A6182), COMB_D(0x6EBC6E98, 0xEB6DCAA8), COMB_D(0x826316E3, 0x9D862BCF), 0}},
+    {{COMB_D(0x14FCDA2A, 0x9714850D), COMB_D(0x852D8C65, 0x60EBBBE9), COMB_D(0x7FA1A45C, 0x7A8CBCE1), COMB_D(0xD271E36F, 0x1B91C073), 0},
+     {COMB_D(0x3E83F3A9, 0x404AABF0), COMB_D(0xB13C80F9, 0x90EE7FAE), COMB_D(0x5EA3CADB, 0x87520D9F), COMB_D(0xA298AB8F, 0x0D8BBBC0), 0}},
+    {{COMB_D(0xA2A97031, 0xAD413FF9), COMB_D(0x6EAC3830, 0xC29648AA), COMB_D(0x6D5E349B, 0x200D49C8), COMB_D(0x2FBE7154, 0xBABDAD4D), 0},
+     {COMB_D(0x923CA313, 0xCCD5EB38), COMB_D(0xB020F49C, 0xFADE1971), COMB_D(0xEC41F119, 0x7C116DA2), COMB_D(0x2A48D013, 0x8DCC1A15), 0}},
+    {{COMB_D(0xC947082D, 0x923D88AD), COMB_D(0xC5149431, 0x8F3342A8), COMB_D(0x263AC53F, 0x06D9F128), COMB_D(0x98DAAE35, 0x7540B505), 0},
+     {COMB_D(0x8AE39052, 0x7288EFFB), COMB_D(0xDDA7EB1A, 0x21B05C2B), COMB_D(0x111E1842, 0x99525D81), COMB_D(0x2316AA04, 0x71596B84), 0}},
+    {{COMB_D(0x145C5FC5, 0xABA05637), COMB_D(0x590CCDD7, 0xE239281A), COMB_D(0x4D1AFE22, 0x9F1917AE), COMB_D(0x917D9B1B, 0xBF0FB4A5), 0},
+     {COMB_D(0x0CC9C0DF, 0x603616B6), COMB_D(0x484FE2B3, 0x6CA146F9), COMB_D(0x6807BE1B, 0x1BA68D82), COMB_D(0x721E931B, 0x08C817FE), 0}},
+    {{COMB_D(0x83BCC80E, 0x239A6D98), COMB_D(0x25D66556, 0x62BC3581), COMB_D(0x80D4745D, 0xF1095B1E), COMB_D(0x9D80714B, 0xCBE29568), 0},
+     {COMB_D(0x0B17FB92, 0xEA323989), COMB_D(0xFFB365B4, 0xEFB8E187), COMB_D(0x2357CB94, 0xBAAD93C4), COMB_D(0x0BCC34F0, 0x7EA86021), 0}},
+    {{COMB_D(0xC3E2C26C, 0xF99450BA), COMB_D(0x588B7EC7, 0x310664A0), COMB_D(0x43D9FCC0, 0x6ECCA28B), COMB_D(0xAB58E61F, 0xF041AD14), 0},
+     {COMB_D(0x9ED94888, 0xD98B7BAB), COMB_D(0x2A6DD24B, 0xAAE1FE87), COMB_D(0xAA6F11C4, 0xCAA2E8F1), COMB_D(0x90393746, 0x5FD4A7A8), 0}},
+    {{COMB_D(0xD02AB365, 0x9FBAE212), COMB_D(0xCC6050C2, 0xBCDA0958), COMB_D(0x62C5FB90, 0xF72B91A8), COMB_D(0x8DB5F4F7, 0x9698499F), 0},
+     {COMB_D(0xC45A36D0, 0xD58B60B6), COMB_D(0x250F5B07, 0x3C7D5436), COMB_D(0x95835E76, 0x76C4979C), COMB_D(0x4D47DE2F, 0xBE0E92C2), 0}},
+    {{COMB_D(0xBF0A0FF4, 0xBADDF21C), COMB_D(0x7990ADFE, 0x3214A05F), COMB_D(0x77403E80, 0x8E9D498D), COMB_D(0x1EB263DA, 0x83CE9EAA), 0},
+     {COMB_D(0xD30400D0, 0xE74B2FC5), COMB_D(0xA8796E20, 0x0F3C889E), COMB_D(0xBD063E61, 0xD2A57057), COMB_D(0xD7E4FEC1, 0x3CC57DF0), 0}},
+    {{COMB_D(0x40ECF980, 0xEAD29B15), COMB_D(0x244B292C, 0x7AD578BD), COMB_D(0x3E1537A3, 0xA47D548E), COMB_D(0x3648E4EB, 0xA10F8F6B), 0},
+     {COMB_D(0x831BE51D, 0x7B9EE8C0), COMB_D(0xB74A5E9B, 0x0B81E62F), COMB_D(0xD20FF936, 0xA8EE44BB), COMB_D(0x33CACD91, 0xA51D3507), 0}},
+    {{COMB_D(0x0F6916A1, 0x78E3A472), COMB_D(0x25742157, 0x0FDA6A0F), COMB_D(0x09CE0C6E, 0xB10AC9FD), COMB_D(0x5C4DB5A8, 0x10360CB5), 0},
+     {COMB_D(0x4B446F79, 0x37A50E3A), COMB_D(0x2BEC38B5, 0x3239E347), COMB_D(0x313740C5, 0xE92EDB56), COMB_D(0xD0BF1CAE, 0x92ED6E78), 0}},
+    {{COMB_D(0xBA17DF09, 0x42777585), COMB_D(0xB7D21217, 0x059956D1), COMB_D(0xC28F59F0, 0x1374DE9A), COMB_D(0xF1716900, 0xE02CE0B4), 0},
+     {COMB_D(0xC1BA6B72, 0xCA8D311B), COMB_D(0xE150F583, 0x4AC1D1A9), COMB_D(0x18B044A7, 0xB5BD1787), COMB_D(0xB7D0AA53, 0x45733243), 0}},
+    {{COMB_D(0x36126029, 0xC7E72C94), COMB_D(0x8F09BEA2, 0xD2861C4D), COMB_D(0xC04E16B5, 0x5DF04CAE), COMB_D(0x6402AD81, 0x00914FF4), 0},
+     {COMB_D(0xB97021F8, 0xEC207A6C), COMB_D(0x2D49CA04, 0xFB4765D0), COMB_D(0x6C608E98, 0xF3F6F0F4), COMB_D(0x183FEF5C, 0x226FB9C3), 0}},
+    {{COMB_D(0x740120D8, 0xA79B8423), COMB_D(0xB03A6F88, 0xA00B775B), COMB_D(0x1FAFA16F, 0x0215D31B), COMB_D(0x8E86B5AB, 0x61026F09), 0},
+     {COMB_D(0xAB84029E, 0x31D564DE), COMB_D(0x885FE20C, 0x8B7397D5), COMB_D(0xF615F253, 0x9B4155B2), COMB_D(0x3C158915, 0x7E290C37), 0}},
+    {{COMB_D(0x3E021999, 0x9CECAAE4), COMB_D(0x6B524CFB, 0x38CF666F), COMB_D(0x41FFE8B1, 0x02A133F4), COMB_D(0x41CBB092, 0x0BB8EB86), 0},
+     {COMB_D(0x2801E55E, 0xA90D80DC), COMB_D(0xCFE7259B, 0xE0739399), COMB_D(0x3738BE08, 0x4C6D04FF), COMB_D(0x46D08B49, 0xE7385E5C), 0}},
+    {{COMB_D(0x7CC91551, 0xB1CA2D2C), COMB_D(0xC700DBBA, 0x2CD4810F), COMB_D(0xAAD068BB, 0xD541D2C5), COMB_D(0x85EE7E09, 0xAD2DA2D9), 0},
+     {COMB_D(0xD03A5B39, 0xDA61F022), COMB_D(0x8F1D7B88, 0xA8887866), COMB_D(0x724C6AAC, 0xD9971C19), COMB_D(0x57FFEF2B, 0x69D43EA3), 0}},
+    {{COMB_D(0xA54309B8, 0x89311CED), COMB_D(0xD99A79A1, 0x416E9F15), COMB_D(0x815FF7E5, 0xCB6D67F7), COMB_D(0x1FC2E2AB, 0x1A21AA64), 0},
+     {COMB_D(0x7F876F6B, 0xB8C2F1E4), COMB_D(0xEFA4525D, 0xED9CB44B), COMB_D(0x24F0658E, 0x6DFD5EB2), COMB_D(0xE18E0B55, 0xC4D3315A), 0}},
+    {{COMB_D(0x23E3D60F, 0x5EB69BD9), COMB_D(0xBFF5F94A, 0xAC473357), COMB_D(0x32505BAE, 0x83F8E722), COMB_D(0x2C813480, 0x66376B8E), 0},
+     {COMB_D(0x9AEF0B26, 0x3F3AD6D2), COMB_D(0x671AF989, 0x16EE4273), COMB_D(0x56CBF658, 0x02F23C39), COMB_D(0x07EE59AD, 0x6E546CAE), 0}},
+    {{COMB_D(0x8BD37337, 0xF57977FA), COMB_D(0x17DAEFE0, 0x1EF67DE9), COMB_D(0x8AE3FEF7, 0xDA421842), COMB_D(0x47A4FC72, 0x0A65E4E5), 0},
+     {COMB_D(0xAECC7F21, 0x06624676), COMB_D(0xF582E55C, 0xA72A54B4), COMB_D(0x25934971, 0x3383D697), COMB_D(0x4D9CA044, 0x0D47E509), 0}},
+    {{COMB_D(0xE25F88C4, 0xE0F1A1FA), COMB_D(0x3A7E77C7, 0x78C0359B), COMB_D(0xF921E6C7, 0x5EE94B18), COMB_D(0x4F652076, 0x3FB634D7), 0},
+     {COMB_D(0x1197B572, 0xB9163AAB), COMB_D(0x57F98F19, 0x3F1D7912), COMB_D(0xD00B3C4C, 0xB6F7CEA6), COMB_D(0x90AAECD8, 0x434998BB), 0}},
+    {{COMB_D(0x404AE0D7, 0x8C9F3B43), COMB_D(0x729FB208, 0x3C4C596C), COMB_D(0x227D0F9A, 0xF60F5D9F), COMB_D(0x67157056, 0x067B82C7), 0},
+     {COMB_D(0x68ACB7A0, 0x25CD6FC4), COMB_D(0xB35E6E39, 0x1107C03F), COMB_D(0xB61DF171, 0xD576B338), COMB_D(0xDDBEE4D2, 0x03C70179), 0}},
+    {{COMB_D(0x2D8C1C91, 0x8431C3F9), COMB_D(0xAFA7A511, 0xE53E6462), COMB_D(0xD213B3D4, 0xF5C1F05A), COMB_D(0x80A5C2C8, 0xAED10695), 0},
+     {COMB_D(0x99D9D6E3, 0xAB9F93C1), COMB_D(0xC8D3A933, 0x69D8647B), COMB_D(0x241A9EA8, 0x5BE0AD12), COMB_D(0xC69C3920, 0x78DC923D), 0}},
+    {{COMB_D(0x7CCB10D2, 0xD59AB3A9), COMB_D(0x22F3FC06, 0x5D979EB6), COMB_D(0x583A8930, 0x63740ED2), COMB_D(0x9A048971, 0x793EEA3D), 0},
+     {COMB_D(0xD5F0DE5E, 0x608E1A14), COMB_D(0x3ECED4E6, 0xB15917A0), COMB_D(0x9753EE7E, 0x3780598C), COMB_D(0x7B525CC8, 0xA9A97137), 0}},
+    {{COMB_D(0xD8FB310B, 0x543303F1), COMB_D(0x89E19F09, 0xB325B143), COMB_D(0x1DDB5725, 0xD4B5F9CD), COMB_D(0x69BB9B4A, 0x2F0B3AA7), 0},
+     {COMB_D(0xCBFAF01B, 0xF270CBEC), COMB_D(0xE0E1D928, 0x1CE3FAE3), COMB_D(0xBCA1FD49, 0x9860D870), COMB_D(0xA12D27A4, 0x7F551A2F), 0}},
+    {{COMB_D(0x4D8F225D, 0x6389C4F2), COMB_D(0xF790B44B, 0x7877185A), COMB_D(0x05E3A241, 0x049103F9), COMB_D(0x10746643, 0xB5B67464), 0},
+     {COMB_D(0x3555510E, 0x7331082E), COMB_D(0x847D21BC, 0x8425BB1C), COMB_D(0xD7801763, 0xF0705413), COMB_D(0x5ED5DDED, 0x36A073F0), 0}},
+    {{COMB_D(0x2C4E47F2, 0x87E7137D), COMB_D(0x3D7EB959, 0x8617175A), COMB_D(0x3244742D, 0xB31AB836), COMB_D(0x932A3951, 0xDB7ED3DA), 0},
+     {COMB_D(0xAD3D8EF6, 0x417B92E5), COMB_D(0xCB46A33F, 0x9C5C9C68), COMB_D(0xF4BC3AA4, 0x4AEB7FB8), COMB_D(0x555DF7D2, 0xCFB601A5), 0}},
+    {{COMB_D(0x184C594E, 0xCAC46C71), COMB_D(0x458B3497, 0x005DC3E6), COMB_D(0x40C9C74F, 0x7681585B), COMB_D(0xF4E99E88, 0x00EF993D), 0},
+     {COMB_D(0x0A0F5E5A, 0xC84F7105), COMB_D(0xC1169E0A, 0x07D54BD7), COMB_D(0x8B7ADC46, 0x194C6D97), COMB_D(0x4CCC1B69, 0xD9011BF6), 0}},
+    {{COMB_D(0x07DFFA5B, 0xA4DF6364), COMB_D(0x86BB4403, 0xA6696EE5), COMB_D(0xD1C619E1, 0xC85DFB32), COMB_D(0x1A82A11B, 0x675B5DB7), 0},
+     {COMB_D(0x12CD4CFA, 0x07D47093), COMB_D(0xBFC8F228, 0xB59E31D7), COMB_D(0xDE87F885, 0x4427ED21), COMB_D(0xE9CB1066, 0x8DCFAA3F), 0}},
+    {{COMB_D(0x4F8791DA, 0x91ABC552), COMB_D(0x79CED076, 0x1C211B3B), COMB_D(0xAE15327E, 0xB59C65D9), COMB_D(0x5EC52C3D, 0x073F264E), 0},
+     {COMB_D(0x58B3AC50, 0x5AD530FD), COMB_D(0x424F6850, 0x7E77C110), COMB_D(0xF9C5C2B1, 0xB06B6449), COMB_D(0xD13715A6, 0x48EE585E), 0}},
+    {{COMB_D(0x40D3FDBF, 0xF457854E), COMB_D(0x773AE822, 0x52CC4B26), COMB_D(0x28667C01, 0x7D8DE486), COMB_D(0x45848AC0, 0xB8783F7D), 0},
+     {COMB_D(0x4C5D58F7, 0x80894F48), COMB_D(0x49256F3B, 0x3BD8C0F4), COMB_D(0xA2246C84, 0xE8271664), COMB_D(0x762323BC, 0xA3372C8C), 0}},
+    {{COMB_D(0xBBD78838, 0xCF42DA32), COMB_D(0x04F5C163, 0xDAA50757), COMB_D(0x575761EF, 0xE18DBB98), COMB_D(0xDD63AECC, 0x1A8C4B16), 0},
+     {COMB_D(0x69417B97, 0x5F0CC155), COMB_D(0x47FFA20D, 0x3F05BFA6), COMB_D(0x846FD2BD, 0x9CF039FC), COMB_D(0x0564E5F9, 0x1C150012), 0}},
+    {{COMB_D(0x692FFB95, 0xE91E21FC), COMB_D(0x95FB125F, 0x81223A8F), COMB_D(0xE70F6FCA, 0x93781448), COMB_D(0x9F63D44E, 0x7C8F668B), 0},
+     {COMB_D(0x445C5D75, 0x948A1DC9), COMB_D(0xA32F6301, 0x9BE0B0DC), COMB_D(0xD372DB93, 0xAB55C12A), COMB_D(0x77F56B57, 0xF6FAD584), 0}},
+    {{COMB_D(0x7A4B9DAF, 0x72E9ED24), COMB_D(0xA695E832, 0xA5D5E905), COMB_D(0xB7975699, 0x6B7D2BFA), COMB_D(0x42E17B72, 0x567C7FF7), 0},
+     {COMB_D(0xF6633856, 0x9E9B09E4), COMB_D(0xE3B4E2E5, 0x32244273), COMB_D(0x9E1E4E07, 0x4257903B), COMB_D(0xCACE28FC, 0xA30198B5), 0}},
+    {{COMB_D(0x3BB260DF, 0xE6992D39), COMB_D(0xC889E275, 0x85B0A8BC), COMB_D(0x5F8DFB69, 0xA15E7C37), COMB_D(0x066F9396, 0x787C2E5F), 0},
+     {COMB_D(0xBA777F2C, 0xDBDEEA2D), COMB_D(0xC3611029, 0x209E18ED), COMB_D(0xBD24FECD, 0xB03B60D5), COMB_D(0xE66D33BA, 0xFBF7328B), 0}},
+    {{COMB_D(0xCCF20BB9, 0x0548C996), COMB_D(0x9F43D761, 0x474D504E), COMB_D(0xEFFF071F, 0x6FCCD171), COMB_D(0x7907301F, 0x20EC6804), 0},
+     {COMB_D(0xA27468D6, 0xA8C582F0), COMB_D(0xE004A50F, 0x8369CD0E), COMB_D(0x3277AB12, 0xBF31D30A), COMB_D(0x93DE98A2, 0x8F640D07), 0}},
+    {{COMB_D(0x7AF73530, 0x77943D5E), COMB_D(0x7F5A4C1D, 0x34E0E03B), COMB_D(0xFD1B1D97, 0xAF973170), COMB_D(0x8629BD4F, 0x32FD8FE4), 0},
+     {COMB_D(0x9098117B, 0x6DF2D4A2), COMB_D(0xF7467E23, 0xCBE4F09B), COMB_D(0x05C1C352, 0xC58A7FD4), COMB_D(0x4385783A, 0x0A7CC8E4), 0}},
+    {{COMB_D(0x1165DBF2, 0x54FD8C1B), COMB_D(0x28BF5B82, 0x6EE18370), COMB_D(0x555CE451, 0xBA7516C5), COMB_D(0x8848094C, 0x2CA69BCC), 0},
+     {COMB_D(0x56324443, 0x4F2CD508), COMB_D(0x83835914, 0xF78F5A5B), COMB_D(0x9AC1884A, 0x9BF67266), COMB_D(0x9DEAE20E, 0xF6625C8B), 0}},
+    {{COMB_D(0xFE1AFF0C, 0x8B108B65), COMB_D(0x841D4557, 0xC5D7969B), COMB_D(0xB1FF64E4, 0xF11AF4CC), COMB_D(0x7412E775, 0x016EE5BA), 0},
+     {COMB_D(0x05AD8F36, 0x0132BDCA), COMB_D(0xD71C83E3, 0xEBD3CBB6), COMB_D(0x659DBBA6, 0x54616E24), COMB_D(0x3F881080, 0x1FCBEA72), 0}},
+    {{COMB_D(0xB2019257, 0x5B8C8E9C), COMB_D(0x17F28630, 0x29B5A878), COMB_D(0x2D2A22E4, 0xD0C46329), COMB_D(0xF95A51D1, 0xDA2C2D12), 0},
+     {COMB_D(0x623E710A, 0x803402A7), COMB_D(0x532C91FE, 0x5189A2AE), COMB_D(0x072CDE0D, 0xA7E48FAA), COMB_D(0x38E2DAA0, 0x5A984766), 0}},
+    {{COMB_D(0x0F58971F, 0xC6A0A57E), COMB_D(0x3F4A2A1C, 0xE51DE560), COMB_D(0x77F4AEEB, 0x70C85EF6), COMB_D(0x7D210604, 0x1F377F16), 0},
+     {COMB_D(0x4B9C366F, 0x992D9A18), COMB_D(0x0B1F3379, 0x6BE2ED4B), COMB_D(0x0468370A, 0x5E2615BD), COMB_D(0x59039AD1, 0xB55480A9), 0}},
+    {{COMB_D(0xB96472CD, 0x42AFAFBD), COMB_D(0x1D873EA5, 0xB79ECCD9), COMB_D(0x38534CD6, 0xE401B756), COMB_D(0x54A86CB2, 0x0914A1BA), 0},
+     {COMB_D(0x8B4B5042, 0xA0AA09EC), COMB_D(0xFF1D6039, 0xEC544A16), COMB_D(0x3CA1857E, 0x0AD6D11E), COMB_D(0xA2733155, 0x6DA3537C), 0}},
+    {{COMB_D(0x00EC502B, 0x5113DBEE), COMB_D(0x91D73289, 0x3B439695), COMB_D(0x8D9EFA00, 0x0CFA23D6), COMB_D(0x00057223, 0x94DDC087), 0},
+     {COMB_D(0x1B1AB1CB, 0x0FADA4E0), COMB_D(0xE5928BD2, 0x3A0212A3), COMB_D(0x0493B499, 0x09A296C2), COMB_D(0x3A43BC0D, 0x1E3EAC46), 0}},
+    {{COMB_D(0xA4B26297, 0x51B732F3), COMB_D(0xBA457B50, 0xDBCFEC8B), COMB_D(0x3B8253D9, 0xD8745157), COMB_D(0xB9B58F60, 0xADB33C4A), 0},
+     {COMB_D(0x2B4ACAC6, 0xA3A4E1E0), COMB_D(0xD0B767AC, 0xA5E0088A), COMB_D(0x9E4746A6, 0xF6247860), COMB_D(0xB23DFEDB, 0xFC5E0178), 0}},
+    {{COMB_D(0x44E7980E, 0x4E53DE30), COMB_D(0xB254D2EA, 0xC23B3A7C), COMB_D(0x89629955, 0xA77F8677), COMB_D(0x862F0556, 0xDB716835), 0},
+     {COMB_D(0xFCC1C38C, 0xBD20D541), COMB_D(0xA754FE67, 0x956906C1), COMB_D(0x6F8C57CB, 0x69ECE6E5), COMB_D(0x2EB41854, 0xF6D9C563), 0}},
+    {{COMB_D(0x51A8D0CD, 0x8C73AEA4), COMB_D(0x20C66C7A, 0x140A2078), COMB_D(0x8731CD87, 0xBC75EFFA), COMB_D(0x614AFC0D, 0xD1376406), 0},
+     {COMB_D(0x5274FAD9, 0xD007BD58), COMB_D(0xE180A05B, 0x0D22F114), COMB_D(0x7A06334A, 0x8DE212F8), COMB_D(0x7A6D7279, 0x92130C0F), 0}},
+    {{COMB_D(0xB7BF7BF0, 0x3D72CFCE), COMB_D(0x619D7932, 0x584398F2), COMB_D(0xCBF5F144, 0xF084B396), COMB_D(0x63730E0E, 0x99E932D4), 0},
+     {COMB_D(0x1BB57B4A, 0xF5AA8C2E), COMB_D(0xC87D3AF1, 0x74521E07), COMB_D(0x7E573828, 0x73750AF7), COMB_D(0xF927B0EA, 0xEBBF35FA), 0}},
+    {{COMB_D(0x036796F6, 0xEAC69138), COMB_D(0x5873D25E, 0x9DD60669), COMB_D(0x9857BF64, 0xFF20A1D1), COMB_D(0x794986F6, 0x07047D40), 0},
+     {COMB_D(0xB03BDF13, 0x6E3CA958), COMB_D(0x9208EF73, 0xA1224FC6), COMB_D(0x825FB866, 0xD94ECC24), COMB_D(0x90917150, 0x5E778A0E), 0}},
+    {{COMB_D(0x477FAC64, 0x6A12D8C3), COMB_D(0xEB8769E6, 0x2FBB5961), COMB_D(0x894DB468, 0xDB2D5FB4), COMB_D(0x74CB994B, 0x6697AF31), 0},
+     {COMB_D(0xFF6909E1, 0x093854DD), COMB_D(0xC6D3F769, 0x56B49523), COMB_D(0x94B1539F, 0xB4EA468E), COMB_D(0x185A9279, 0xB2F98EA6), 0}},
+    {{COMB_D(0x04E4FDEE, 0x27EBD032), COMB_D(0xD5B06922, 0x5FB25922), COMB_D(0x67B902B1, 0x34CD0B84), COMB_D(0x97AC1DF4, 0x9837983A), 0},
+     {COMB_D(0x96FADC06, 0xA49FB02A), COMB_D(0xDC1BA329, 0x8E1B9085), COMB_D(0x387A74C1, 0xE5474407), COMB_D(0xBF2DBE50, 0x7710E222), 0}},
+    {{COMB_D(0x8005B823, 0x54B4A531), COMB_D(0x87951033, 0xF2845C60), COMB_D(0x552EFD5C, 0xF37D28B1), COMB_D(0x0E23486E, 0x514F54EA), 0},
+     {COMB_D(0xC0FE9C9B, 0x52F9BA1F), COMB_D(0xC42947A9, 0x37F7BA22), COMB_D(0x5B130689, 0xBE104D8F), COMB_D(0x4D0FB5D8, 0x832B43C2), 0}},
+    {{COMB_D(0x447658E6, 0x015EE1AE), COMB_D(0xB47EB453, 0x9AEAB41A), COMB_D(0x920AA229, 0x2E3DCB72), COMB_D(0x4AB0CEBA, 0xBD28B6B8), 0},
+     {COMB_D(0xBC6041E4, 0x9AA19C8C), COMB_D(0xC57918CB, 0xC8CB2EBB), COMB_D(0xE9484CF4, 0x5259CAD3), COMB_D(0x76E8BBB7, 0x448B079C), 0}},
+    {{COMB_D(0x5B972833, 0xA0037F43), COMB_D(0xD576ADB4, 0x64B16C24), COMB_D(0x35F80DDD, 0x4FB2F5D3), COMB_D(0xDB17AC79, 0x149E3775), 0},
+     {COMB_D(0x411F9E04, 0xB1E98867), COMB_D(0xB78200A8, 0x34FB4744), COMB_D(0x17663047, 0x12A0B440), COMB_D(0x1ABCC3C0, 0x213812B1), 0}},
+    {{COMB_D(0xA91016A5, 0x3BC2FC57), COMB_D(0x2EEE023A, 0x07D8BE83), COMB_D(0xA243AE71, 0x331DA3B0), COMB_D(0x61BA2655, 0x7AEAF942), 0},
+     {COMB_D(0xAC9FFD38, 0x7AE20751), COMB_D(0xD6336993, 0x2803464C), COMB_D(0xAD499161, 0x14EA950B), COMB_D(0x842AE3E6, 0xBF5BE208), 0}},
+    {{COMB_D(0x9DD2C619, 0x05D7379D), COMB_D(0xD83CA5D5, 0x3E55A158), COMB_D(0x2C8CD71E, 0xB9F5F7A2), COMB_D(0x3B3ECADB, 0xD271DE97), 0},
+     {COMB_D(0x7A2822E6, 0x42512442), COMB_D(0xE4A95A64, 0x0F66D6EC), COMB_D(0xC62D8659, 0xB157FD69), COMB_D(0xEBE21C4C, 0x941C1904), 0}},
+    {{COMB_D(0xE10AFCE4, 0x097828EE), COMB_D(0xC5967D51, 0x5CBAAA48), COMB_D(0x42758E3C, 0x801D6894), COMB_D(0xF4795B54, 0x1C3A8352), 0},
+     {COMB_D(0x25BE615D, 0x32BA1151), COMB_D(0xA4187961, 0x55C0CD08), COMB_D(0x57F87FE5, 0x96F85914), COMB_D(0x8F923086, 0xF5FA72C6), 0}},
+    {{COMB_D(0xF68002CE, 0xA96C6740), COMB_D(0x9576B685, 0x48E286C1), COMB_D(0xFA617C2A, 0x0EF2A444), COMB_D(0x320A1610, 0xF48C68D1), 0},
+     {COMB_D(0x0287B78B, 0xBA2DB1D8), COMB_D(0x65B3A4EC, 0x27FBC18C), COMB_D(0x0446D828, 0x401F80A4), COMB_D(0x79E07E7B, 0x81A3171F), 0}},
+    {{COMB_D(0x64C3B780, 0xDC8AEBDC), COMB_D(0x405758C5, 0xE8A21AB1), COMB_D(0x4E3A8541, 0xB603CBE1), COMB_D(0xD59646D6, 0x15720900), 0},
+     {COMB_D(0xBC5329C4, 0xF5DDF207), COMB_D(0xA94A393E, 0x8D9B1E8F), COMB_D(0xDB0B69FB, 0xF6E6A4BD), COMB_D(0xD4BC41FA, 0x3BF30545), 0}},
+    {{COMB_D(0x2B412E81, 0x6D983E57), COMB_D(0xAF9BE9EE, 0xE043231F), COMB_D(0x862224D0, 0x4BAE76F6), COMB_D(0x38FAB32F, 0xEFA9B192), 0},
+     {COMB_D(0x12D71C60, 0x272C78A5), COMB_D(0x95876ED6, 0x73B8DBC7), COMB_D(0xE9196E8E, 0x391B7B2A), COMB_D(0x342C82B7, 0xDA16366A), 0}},
+    {{COMB_D(0x7CBDFC0E, 0x03A7C8F3), COMB_D(0x4962EF09, 0xE2FA1E93), COMB_D(0x6F9B97B2, 0xD64A3BE2), COMB_D(0xE81B1A44, 0x65243B49), 0},
+     {COMB_D(0x11731A58, 0x1D85E57D), COMB_D(0x70DA55B2, 0xE6857D9D), COMB_D(0x830949E9, 0x15DDD0BA), COMB_D(0x087614D8, 0xB5A6D2A1), 0}},
+    {{COMB_D(0x0317FC69, 0x84E9FD28), COMB_D(0x4B1E6F63, 0xC99C42DB), COMB_D(0x329BD3DF, 0xAD531093), COMB_D(0x42997A61, 0x6B40642C), 0},
+     {COMB_D(0x81255568, 0x8C069598), COMB_D(0x8AD1C19C, 0x408545CD), COMB_D(0x28501A8D, 0x733F2B1D), COMB_D(0x34A19F81, 0xAFA8ACFA), 0}},
+    {{COMB_D(0x6C51FB3B, 0x7A0F7FC0), COMB_D(0xE64BDE35, 0x45C9E6F5), COMB_D(0x46F65519, 0xC261FB83), COMB_D(0x4AEDA4A4, 0xD2FA3D47), 0},
+     {COMB_D(0xEEEFBA84, 0xC35C971B), COMB_D(0x987F5795, 0x05273BA8), COMB_D(0x3A87E1B6, 0xB73210A8), COMB_D(0x3DBAAF86, 0x3EF5BC1E), 0}},
+    {{COMB_D(0xD6A89C03, 0x8E844CF7), COMB_D(0x37AE0F21, 0x867DAD70), COMB_D(0xE58C8A0A, 0xB9188181), COMB_D(0xB4DCAACD, 0x1CEDD1CA), 0},
+     {COMB_D(0x9A225ACE, 0x36CD357B), COMB_D(0x2D3C9C40, 0xACCA0BAE), COMB_D(0xF284A4B6, 0xCADB75E4), COMB_D(0xE6C674C0, 0x5A626024), 0}},
+    {{COMB_D(0xB175F8FE, 0xE945F035), COMB_D(0xE8ABB8A7, 0x6D365898), COMB_D(0x1B1E4D6A, 0x421C1490), COMB_D(0xA10F29D9, 0x1B9E762E), 0},
+     {COMB_D(0xD064C433, 0xC3E94DF6), COMB_D(0xA3E39DDD, 0xFFDBB2EB), COMB_D(0x54662C53, 0xB9FCC29F), COMB_D(0x282CF1B2, 0x2B1EECC3), 0}},
+    {{COMB_D(0x93E24715, 0xC6A3BC71), COMB_D(0xA6D15ECF, 0xA189744B), COMB_D(0x8CD63ED9, 0x3EF74754), COMB_D(0x9DA9D5C0, 0x8458EECF), 0},
+     {COMB_D(0x3A42563F, 0x23FACCA8), COMB_D(0xD228E342, 0x718455AD), COMB_D(0xB7CA9613, 0x90179CAE), COMB_D(0x66FF63E0, 0x42C9620E), 0}},
+    {{COMB_D(0x825F0EEC, 0xC199EB0E), COMB_D(0xAEC711DB, 0x45AFBC41), COMB_D(0x5516F585, 0x41CD1A0D), COMB_D(0xCC9EDFE7, 0x39444EAE), 0},
+     {COMB_D(0xD572C13F, 0xABF296E0), COMB_D(0xB74B730F, 0x629E3CAC), COMB_D(0xAE3EE467, 0x4624E30F), COMB_D(0x4962AFEF, 0x531A2F2F), 0}},
+    {{COMB_D(0x1B77771F, 0x8DF11A2C), COMB_D(0x415FF463, 0xB9E52750), COMB_D(0x02576BCA, 0xD32402B7), COMB_D(0x538F1E95, 0x1B074F8D), 0},
+     {COMB_D(0xC065A409, 0x2DC59ED1), COMB_D(0xC2E089FC, 0x7ACF8D99), COMB_D(0x9EA2B348, 0xAFDD97EA), COMB_D(0x43CB118A, 0x9542E9B4), 0}},
+  },
+  { /* table 3 */
+    {{COMB_D(0x3725C5DC, 0xE392D805), COMB_D(0xA87A8069, 0x875405D4), COMB_D(0xA4A54DAA, 0xFAA3449A), COMB_D(0xF8F5DCCF, 0x4C6A93D7), 0},
+     {COMB_D(0x02661951, 0x6CDA02FA), COMB_D(0x51F3DA64, 0xA52143BA), COMB_D(0x389D3E33, 0x64613273), COMB_D(0xE58176CF, 0x66D63054), 0}},
+    {{COMB_D(0xC30FB771, 0x22D32936), COMB_D(0xE40CD02E, 0x32847F01), COMB_D(0x9F6CC7D1, 0x513D7F38), COMB_D(0xC5440C59, 0x7814A47D), 0},
+     {COMB_D(0x9A42FA37, 0x47CABFD4), COMB_D(0xD8A6D286, 0x31E41E5D), COMB_D(0x2EDC1E1D, 0x23ECF4AC), COMB_D(0xD27EE9BA, 0x383E1FA7), 0}},
+    {{COMB_D(0x6AB80495, 0x1E693266), COMB_D(0x66CEFEE2, 0x5728923E), COMB_D(0x038BA959, 0xDD900A64), COMB_D(0xE14C7A14, 0x71343AE8), 0},
+     {COMB_D(0xB6BBF87A, 0xE9DDC87C), COMB_D(0x3EFA4D87, 0x43685763), COMB_D(0xA6C684E6, 0x7FA2FFAA), COMB_D(0x98E34EF4, 0x186B0525), 0}},
+    {{COMB_D(0xC7D0B24C, 0xC5852E50), COMB_D(0x8B2C7E63, 0xCF570CC5), COMB_D(0xC1F9AA23, 0x49EE7EFF), COMB_D(0xE486C7DF, 0xFEABB058), 0},
+     {COMB_D(0x66BA3CAD, 0xAECF107D), COMB_D(0x694463D6, 0x3392EBD8), COMB_D(0x9EE88A5C, 0x9F51E05A), COMB_D(0x51FD75ED, 0x5606A12E), 0}},
+    {{COMB_D(0xE57C1C95, 0x76441565), COMB_D(0x1CED56A5, 0x93EC5F84), COMB_D(0x5D6E5748, 0x24AA893F), COMB_D(0xC97AE634, 0x5DD7B5E7), 0},
+     {COMB_D(0x998736E0, 0xAF15684B), COMB_D(0x876F7F46, 0x00548D72), COMB_D(0x20665986, 0xAAA2DC36), COMB_D(0xA2007F62, 0x92A3D28F), 0}},
+    {{COMB_D(0x9A27E2BC, 0x32D0FBF5), COMB_D(0xE1EF8452, 0x2EB57270), COMB_D(0x733030BF, 0x0A042546), COMB_D(0x6ABDC494, 0x7EAD66C3), 0},
+     {COMB_D(0xC9E0EED1, 0x754EB367), COMB_D(0x92542323, 0x22A9084B), COMB_D(0xED9EB74F, 0x40319AAF), COMB_D(0x04D1DD9F, 0x3EAF5D8E), 0}},
+    {{COMB_D(0x8E2FA867, 0xA8EA5E16), COMB_D(0xD732A766, 0x74A28ACF), COMB_D(0x0B2A3C9B, 0xD5F8203F), COMB_D(0x64B119F4, 0x5D689184), 0},
+     {COMB_D(0xF691BBC9, 0xFA8BA832), COMB_D(0x4D615B2C, 0x5F2624FD), COMB_D(0x9DC717D7, 0xE8C65922), COMB_D(0xB55306A3, 0x6D64CA0F), 0}},
+    {{COMB_D(0x3438C84A, 0x72BD05A0), COMB_D(0xBA82337D, 0x0B1FC80D), COMB_D(0xEDC2F995, 0xF36D1F90), COMB_D(0xE5E89236, 0x3A31885C), 0},
+     {COMB_D(0xC936DE2B, 0xE1A69F5D), COMB_D(0xCA73995B, 0x9CD099AE), COMB_D(0x1301EB01, 0xE79B5C3E), COMB_D(0x77439DE4, 0xDA1B87D2), 0}},
+    {{COMB_D(0x81985E66, 0x06AD55B4), COMB_D(0xE6B9A72E, 0x5C6E20A1), COMB_D(0x96FB5601, 0x1B54E745), COMB_D(0xE5B28FDB, 0x8A521173), 0},
+     {COMB_D(0x242972AA, 0x41E603AB), COMB_D(0xCBA9CCDF, 0x712435F1), COMB_D(0xC1647D54, 0x45D05AAC), COMB_D(0xB0CA4187, 0xE8DAE85D), 0}},
+    {{COMB_D(0x97CD6DEB, 0x7923AA15), COMB_D(0x77301698, 0x1DB57AE8), COMB_D(0xCDFB841F, 0x7653E922), COMB_D(0xF51854E0, 0x6D2EC282), 0},
+     {COMB_D(0x120D7176, 0x58FEF988), COMB_D(0xBDA5F11B, 0xC94B0FE9), COMB_D(0xC757499D, 0x5E268357), COMB_D(0x6C8FA764, 0x0DEEE14E), 0}},
+    {{COMB_D(0x9F211DF3, 0xFCA895A3), COMB_D(0xEF1959FF, 0xC5A45994), COMB_D(0xCB91A863, 0x058591F8), COMB_D(0x724A2F83, 0x0A64E52E), 0},
+     {COMB_D(0x3A97BA42, 0xBE9A3BB5), COMB_D(0x5A50B37F, 0x9CA0915A), COMB_D(0x3C8A41B5, 0xDD58A02E), COMB_D(0x0D3E0149, 0x6368D0D1), 0}},
+    {{COMB_D(0x7C7C81C0, 0x338B76FA), COMB_D(0xE62983BC, 0xA5C16CA8), COMB_D(0xAA2E70A0, 0xCD910F3C), COMB_D(0xB242B027, 0x39DE28E2), 0},
+     {COMB_D(0xE6C28391, 0x2F5FD8F2), COMB_D(0x05234DAE, 0x1F57C222), COMB_D(0x4F0DA794, 0x39634112), COMB_D(0xE536D7BF, 0xC2CF7904), 0}},
+    {{COMB_D(0x0B74B1B6, 0xCAEF0865), COMB_D(0x29CDF495, 0x9338BC6D), COMB_D(0x3E34EADE, 0xAB066EE2), COMB_D(0xBED83EB5, 0xD77B8563), 0},
+     {COMB_D(0x3AD701F5, 0x20939403), COMB_D(0x3BB2C8A8, 0xEBAB7235), COMB_D(0xCA9A595C, 0xD581512A), COMB_D(0xAC305D2D, 0x41EA99DF), 0}},
+    {{COMB_D(0xBC5CE3BA, 0xAE1B16C9), COMB_D(0xB95659FB, 0x2F7C3A3D), COMB_D(0x94B46661, 0xBBB3F203), COMB_D(0x0C2737B3, 0x8E55E7E4), 0},
+     {COMB_D(0x0418E9CB, 0x4A276353), COMB_D(0xFC1DC9F5, 0x299D7EB6), COMB_D(0x14D47F9A, 0x7EAB1C01), COMB_D(0xD8BEFCBE, 0x3D1AF2DB), 0}},
+    {{COMB_D(0x66607288, 0xEF0AF6DC), COMB_D(0x89A0F431, 0x45179EAC), COMB_D(0x6D25245B, 0x2E52D4FB), COMB_D(0x39AD8D4F, 0xD100B94E), 0},
+     {COMB_D(0xC3D8F8EF, 0xA2D3D23F), COMB_D(0xB193072F, 0xFED1EB82), COMB_D(0xCE74C379, 0x22D3197C), COMB_D(0xF548595E, 0xD0A2D70E), 0}},
+    {{COMB_D(0xDDC6DC1B, 0x12378C16), COMB_D(0x9E360755, 0x4615622A), COMB_D(0xB319E52D, 0x6BF9597D), COMB_D(0x1136B759, 0xC12B3B11), 0},
+     {COMB_D(0x79F59BD0, 0xB3488127), COMB_D(0x9614AA28, 0xE751CCE3), COMB_D(0x09F0ABC6, 0x0FE9ECB2), COMB_D(0x7DEC0FCF, 0x45168FDD), 0}},
+    {{COMB_D(0xA9F89340, 0xB8804973), COMB_D(0x4A87971A, 0x5B9B4DAF), COMB_D(0x7B0515AA, 0xBD958142), COMB_D(0xD620A538, 0x78096999), 0},
+     {COMB_D(0xB7B3CF1B, 0x73601261), COMB_D(0xC23B0B68, 0xEFBA05E5), COMB_D(0xF2AADAB2, 0x6B7691B2), COMB_D(0x32EEA8DA, 0x44B1AA1A), 0}},
+    {{COMB_D(0x007202C5, 0x0F3F1763), COMB_D(0x21BAD486, 0x78FE4D56), COMB_D(0x72FAD56B, 0xF45E33EC), COMB_D(0x6EFB642E, 0xAFCA9C88), 0},
+     {COMB_D(0x8A943799, 0x1A72055D), COMB_D(0xBD0FA9ED, 0xF97CFC28), COMB_D(0x349941D6, 0x208D6E28), COMB_D(0x4BA8394F, 0xDDD1BD63), 0}},
+    {{COMB_D(0x4B3C37CA, 0x10471752), COMB_D(0x1A4E1CF5, 0xE4B2F41C), COMB_D(0xFF969B4F, 0xD0B8341A), COMB_D(0x90DD7DA9, 0x8AAF8A33), 0},
+     {COMB_D(0x5369CE58, 0xAE430733), COMB_D(0x7B77828C, 0x5F59D45A), COMB_D(0x7391E93B, 0xDC85AF8F), COMB_D(0x28305624, 0xC82DF8D0), 0}},
+    {{COMB_D(0xDE946452, 0x58093218), COMB_D(0x02DDE5C4, 0x6B079F66), COMB_D(0x30A88B46, 0x704FC557), COMB_D(0x12ECA739, 0xA6F32894), 0},
+     {COMB_D(0x4163D048, 0x5B66D3BC), COMB_D(0xC4C9BA6D, 0x481B4650), COMB_D(0x4B514BE8, 0x057F11DE), COMB_D(0xB70FFE9A, 0x7D0BA7D3), 0}},
+    {{COMB_D(0x193E23EC, 0xCCEA36A0), COMB_D(0xD7C1FBAE, 0xE19FBDFD), COMB_D(0xC1EED5BB, 0x393A901C), COMB_D(0xD50BD4C0, 0x32350F7D), 0},
+     {COMB_D(0x915C6C48, 0x23E01FC0), COMB_D(0xD5346AB3, 0x6386EC0D), COMB_D(0x3CA5DA83, 0x230AFFDA), COMB_D(0xBB231993, 0x5E7C5512), 0}},
+    {{COMB_D(0xC6A48AB2, 0x29395EC0), COMB_D(0x67AB1DFB, 0x02D8449C), COMB_D(0xF8770DBD, 0x6EFB8984), COMB_D(0x0FA66F76, 0xB1288B1C), 0},
+     {COMB_D(0xC71080DC, 0x417A86A3), COMB_D(0xCB74C364, 0x11C3D669), COMB_D(0x11EA2C48, 0x0D8B2616), COMB_D(0xF25C0BBB, 0xEA7D430C), 0}},
+    {{COMB_D(0xEF51E9F2, 0x309AE5DF), COMB_D(0x67E27094, 0x431758E4), COMB_D(0xB65E1A11, 0x601467F8), COMB_D(0xD8C6877F, 0x2856EE5D), 0},
+     {COMB_D(0xF3ADEA81, 0x06575740), COMB_D(0x535FC792, 0x1169BD67), COMB_D(0x19D93A5B, 0xDFF16D9E), COMB_D(0x9B6936B4, 0x5DFF01AD), 0}},
+    {{COMB_D(0xAD0E41F8, 0x4C1A449B), COMB_D(0xE7DCC026, 0xE4BCEB7C), COMB_D(0xC57BB065, 0xAD449F5F), COMB_D(0x4CADCB8C, 0xEE8E0220), 0},
+     {COMB_D(0x282696CC, 0x5DA71FB9), COMB_D(0x2587B36F, 0xCA5CA789), COMB_D(0x8003F754, 0x30326D6C), COMB_D(0x562EB795, 0x21A23C87), 0}},
+    {{COMB_D(0xAAEE4AAE, 0x26B5B439), COMB_D(0xC3AD8FC7, 0x8C30AFC5), COMB_D(0x1DE64771, 0x2A3EB227), COMB_D(0xA9C0484B, 0x0B97B5FE), 0},
+     {COMB_D(0xAF77100F, 0x2345DC46), COMB_D(0x8A2CAB9D, 0xE88234BB), COMB_D(0x981F6639, 0x85DEF10C), COMB_D(0x4A68A1B0, 0x3F0C67D5), 0}},
+    {{COMB_D(0x90283A68, 0xDB8099D6), COMB_D(0x5768E6A0, 0x63EE9EA9), COMB_D(0x124967A6, 0xD9ADBD40), COMB_D(0x3D916A23, 0x4513E534), 0},
+     {COMB_D(0xE7649B3B, 0xFFE87A98), COMB_D(0xBE4A095A, 0xE1E2D27F), COMB_D(0x75A81B18, 0x2BB282BC), COMB_D(0xB557BE09, 0x5C706EF3), 0}},
+    {{COMB_D(0x09215899, 0x1C402704), COMB_D(0x4694319F, 0x69847B16), COMB_D(0x5DC5EFCD, 0x8FB030FB), COMB_D(0xE537FCC9, 0xD34EEA37), 0},
+     {COMB_D(0xDBBD56B7, 0x8FE4A098), COMB_D(0x173C0921, 0xEC198328), COMB_D(0x29209C3F, 0x8E6CDC70), COMB_D(0x3A83D2E2, 0x582E9FCE), 0}},
+    {{COMB_D(0x998C273F, 0xDE59E922), COMB_D(0x25113E3E, 0x682AE968), COMB_D(0x108F8626, 0x349E3AB7), COMB_D(0xBFD60FF9, 0x8FB9F92A), 0},
+     {COMB_D(0x55E49785, 0x7A6F5E19), COMB_D(0x5E0AE50C, 0x768B50E7), COMB_D(0xA4969E54, 0x0761B56D), COMB_D(0xE39442F1, 0xDEF27B7C), 0}},
+    {{COMB_D(0xD7BB0BF5, 0x1F9C4473), COMB_D(0x119E2469, 0xD5BD529C), COMB_D(0xA758F275, 0x30AE29AE), COMB_D(0x48C24976, 0x36B46322), 0},
+     {COMB_D(0x58CBAB34, 0x5D0CD942), COMB_D(0xFAB75FAE, 0x375D054E), COMB_D(0xAD7D40A5, 0x0BBFA31D), COMB_D(0x1E597D63, 0x3852162F), 0}},
+    {{COMB_D(0x10D66D56, 0xAB76BE72), COMB_D(0xBFB0B89D, 0x3A38761E), COMB_D(0xE124903F, 0xE7ED25C9), COMB_D(0xFF187502, 0x1F42FDE4), 0},
+     {COMB_D(0x8261D17B, 0x1B65FE9D), COMB_D(0x0E1565DD, 0x7CD923F7), COMB_D(0xA4AB7BE6, 0xBC59B71F), COMB_D(0xDE9CD074, 0x7BC1017C), 0}},
+    {{COMB_D(0x917EE72C, 0x78DD791E), COMB_D(0x320CBB17, 0xBEBA5B3D), COMB_D(0x7C1B316F, 0xEE33B0EF), COMB_D(0xE7F45225, 0xB60CCDCE), 0},
+     {COMB_D(0xD6225F87, 0x35F763BA), COMB_D(0x569CAF8A, 0x5604A9A4), COMB_D(0xD79319F2, 0xE4B35039), COMB_D(0x577B9D97, 0x7A0A8DF2), 0}},
+    {{COMB_D(0xE7DD9AB3, 0x28523EB3), COMB_D(0x351A3A75, 0x556C6C4A), COMB_D(0x46AC1844, 0x4F3DCDE3), COMB_D(0xBAFFD4EB, 0xF8A8B5AB), 0},
+     {COMB_D(0x1978300C, 0xD5ACF387), COMB_D(0x24511CCF, 0xBF48B6EE), COMB_D(0x003A8EB3, 0x795AC09C), COMB_D(0x0FA93DC5, 0xDBC95E83), 0}},
+    {{COMB_D(0x582581D0, 0x37BCD457), COMB_D(0xB061410F, 0xC2D6E515), COMB_D(0xD6D043AD, 0x0913A8BB), COMB_D(0x37E84AF8, 0xF066E80F), 0},
+     {COMB_D(0x01E73186, 0xAB3001B8), COMB_D(0x8E421C61, 0x8D0B96DD), COMB_D(0xC8F80C68, 0x3F6D7DAC), COMB_D(0xC38CFD3B, 0x8FA54149), 0}},
+    {{COMB_D(0xAA11CF32, 0xD386399C), COMB_D(0x25B12289, 0x4376A93E), COMB_D(0x37868F55, 0x24FEA678), COMB_D(0x9EF5153B, 0xFAA1B25D), 0},
+     {COMB_D(0x1022426C, 0xB2983041), COMB_D(0x63B5B984, 0x03BFC63F), COMB_D(0x924FB8E1, 0x21C8AA61), COMB_D(0x4E3E263B, 0x3C5D9C5C), 0}},
+    {{COMB_D(0x57EE3AEB, 0x1C3E515D), COMB_D(0xAB169447, 0xE65E4389), COMB_D(0xD050B90E, 0x0EEE5AEC), COMB_D(0xA8B836F0, 0xEA861E76), 0},
+     {COMB_D(0x36AE249A, 0xBAB882B0), COMB_D(0x8085A10F, 0xD6BF30B2), COMB_D(0x69E440B7, 0xA03EF5F8), COMB_D(0x09CD929E, 0xA6FEA516), 0}},
+    {{COMB_D(0x96D75FA5, 0xFC59997F), COMB_D(0xFF6F8194, 0xAF664A0D), COMB_D(0xAC584950, 0xEE4A5BA7), COMB_D(0x5EA6CD5D, 0x71C55482), 0},
+     {COMB_D(0x8641BE43, 0x1DAC80D3), COMB_D(0x4A265BE7, 0xBDA87ACF), COMB_D(0xB14DDECA, 0x1AC3407E), COMB_D(0xF04EC1B6, 0xA11F9CA5), 0}},
+    {{COMB_D(0x3A97014B, 0x08C155A2), COMB_D(0x3F63AAF7, 0x3F3F5617), COMB_D(0x9123D5FF, 0x5DAACB32), COMB_D(0xFB3A486F, 0x71422EF7), 0},
+     {COMB_D(0x3D58F550, 0x20257695), COMB_D(0xADDA6DA3, 0x70CE596F), COMB_D(0x46256A18, 0xD45D6F09), COMB_D(0x8097BD1F, 0xD10286C5), 0}},
+    {{COMB_D(0xFA307666, 0x6AC29391), COMB_D(0x386F6978, 0xC6C7D998), COMB_D(0x1C144436, 0x310A05E6), COMB_D(0x68CF2A81, 0xFA887387), 0},
+     {COMB_D(0x8A63E9A5, 0xCF23BE37), COMB_D(0x312DAB1B, 0x4A76EF96), COMB_D(0xCC13C6AA, 0x7ACECA76), COMB_D(0xC3E13A45, 0x3FBD7B07), 0}},
+    {{COMB_D(0xE1381C2B, 0x031AA8E4), COMB_D(0x84F8EDF6, 0x922DAE17), COMB_D(0xA1CE8E57, 0x6FFADC3C), COMB_D(0xE7FEAF61, 0x523FFB64), 0},
+     {COMB_D(0x840669D9, 0x1EC2D62F), COMB_D(0xE0E47F19, 0xF7F74A11), COMB_D(0x5D69B5B1, 0x54B9909C), COMB_D(0xEE06F3B8, 0x98D83B65), 0}},
+    {{COMB_D(0x909EBD0C, 0x2206D976), COMB_D(0xFEC2825C, 0xD0645E5D), COMB_D(0x6538F3DD, 0x5D51BC44), COMB_D(0x00C6FB1E, 0x4A1A4AD6), 0},
+     {COMB_D(0xB9B363D6, 0x9CBA5612), COMB_D(0x0F2A0E9C, 0xB9B48971), COMB_D(0xC8643000, 0x6F5BD28A), COMB_D(0x32ED6D9D, 0x81285B74), 0}},
+    {{COMB_D(0x9EB494B1, 0xFF28B353), COMB_D(0x94B8214C, 0x1546A258), COMB_D(0x2D69A01C, 0x8CCD1831), COMB_D(0x088C96CD, 0x683143B2), 0},
+     {COMB_D(0x3E5BB004, 0x2E803F23), COMB_D(0xEA891E9B, 0xEF618D4F), COMB_D(0x9A07BD95, 0x7CD22B15), COMB_D(0x2130C84D, 0x00883D4F), 0}},
+    {{COMB_D(0x69CBF2EB, 0xD8E8970E), COMB_D(0x936C2CC2, 0x6B89F78C), COMB_D(0xDDE2548E, 0x0BF19101), COMB_D(0xC1BF27C2, 0x6EC3626D), 0},
+     {COMB_D(0xA4B1E755, 0x09FC3A20), COMB_D(0x53A8B6B0, 0xB8EC7065), COMB_D(0x35AA4B82, 0x3C2F7550), COMB_D(0xD7D80F2C, 0x15A56549), 0}},
+    {{COMB_D(0xD966A70D, 0x264DCC50), COMB_D(0xDFA23AF4, 0x74C6FD9B), COMB_D(0x07FD90C1, 0x6CF30DD6), COMB_D(0x1282CCFE, 0xD30DD2AF), 0},
+     {COMB_D(0x5567959F, 0xC8D5107A), COMB_D(0x579B70B9, 0xF8936C29), COMB_D(0xCB32EA61, 0x8548C72A), COMB_D(0x14C365B3, 0xDBB1E914), 0}},
+    {{COMB_D(0x913081D8, 0xBF68B773), COMB_D(0x12115BB1, 0x8795ABF9), COMB_D(0x6BF681CE, 0xFD4E8C5C), COMB_D(0x16352B21, 0x8982095B), 0},
+     {COMB_D(0x7FDA56B7, 0xA01652DD), COMB_D(0xD3571314, 0xA841C40D), COMB_D(0x4D2CABEA, 0xCAE6B288), COMB_D(0x153BA90C, 0x2CB01213), 0}},
+    {{COMB_D(0x74242213, 0xCF100EC4), COMB_D(0xA8B856C6, 0xCE3DBB2A), COMB_D(0x86417E4E, 0x335E0932), COMB_D(0xBBD058BC, 0xC01198DB), 0},
+     {COMB_D(0x72AA1964, 0x2DC096C5), COMB_D(0xBA3DEEDD, 0xD3CD2A2A), COMB_D(0x7B286B63, 0x398E745B), COMB_D(0x92CF8461, 0x8B8FBCE9), 0}},
+    {{COMB_D(0x69A15E7A, 0x133EAAAD), COMB_D(0x264D72B4, 0x4D8D718C), COMB_D(0x3D8EDC8F, 0x2E13141A), COMB_D(0xB424E333, 0x96B95AFF), 0},
+     {COMB_D(0xCEEB374C, 0xC6F91027), COMB_D(0xE5AA7970, 0x879CBF16), COMB_D(0x9AB24034, 0x1937F4F6), COMB_D(0xEB339528, 0x43D3EA97), 0}},
+    {{COMB_D(0xE7075681, 0xAF036B21), COMB_D(0x52D88501, 0x3E178CAA), COMB_D(0xE9F2C947, 0xB4C56737), COMB_D(0x16066118, 0x9CC1E7D9), 0},
+     {COMB_D(0x689D29D4, 0x30201A33), COMB_D(0x241909D5, 0x29DCB018), COMB_D(0xB8ABBF05, 0x5C1F86C0), COMB_D(0x91A0106A, 0x100D01E6), 0}},
+    {{COMB_D(0x13344AB8, 0x3B49D6A2), COMB_D(0xE4F9A70E, 0x0D4066A5), COMB_D(0x9E4BB156, 0x3959D00D), COMB_D(0x941BBD7E, 0x788F4DF3), 0},
+     {COMB_D(0x195AA671, 0x66AFFC96), COMB_D(0xEDDF1062, 0xFEDF8748), COMB_D(0x70A7E0FA, 0xD2E1ABD9), COMB_D(0x5679DAE3, 0x23C0632B), 0}},
+    {{COMB_D(0xC8A1C638, 0xFA516BF6), COMB_D(0xAD138835, 0xD6A3F5B9), COMB_D(0xE29A695F, 0x5EAC0303), COMB_D(0x35C1FA56, 0x83431993), 0},
+     {COMB_D(0x11EC5166, 0xF97B6CB5), COMB_D(0xDA8BC052, 0xF88165AD), COMB_D(0x13EC0A6D, 0x6902D389), COMB_D(0x2E723B7B, 0x16439A95), 0}},
+    {{COMB_D(0xDACC7F16, 0x2B692075), COMB_D(0x2DC1F23B, 0xF90BE99D), COMB_D(0x9D427AF4, 0x9CD1C9DE), COMB_D(0x0E1F5BAD, 0x9E276884), 0},
+     {COMB_D(0x26E620C5, 0xB87225B4), COMB_D(0x20A30789, 0xC510BEC0), COMB_D(0x7378C05C, 0x4C6936E0), COMB_D(0xDF21E482, 0x82F6B548), 0}},
+    {{COMB_D(0xBF724050, 0xB9D56B66), COMB_D(0xFC65B6E7, 0x6BF65F01), COMB_D(0x783BE7AE, 0x2DE7E1C6), COMB_D(0xDB617C38, 0xAC3BB15E), 0},
+     {COMB_D(0x82F45C51, 0x9B57AD88), COMB_D(0x1B784412, 0x41587221), COMB_D(0x5DEA6BFE, 0x750AA9EC), COMB_D(0xC53DB472, 0x6B38855A), 0}},
+    {{COMB_D(0x10A80F22, 0x2FDDAFE6), COMB_D(0xF22BF899, 0x227E1D9D), COMB_D(0x61C54852, 0xA77D2F10), COMB_D(0xD28D772E, 0x7F49C42A), 0},
+     {COMB_D(0x81CED215, 0x29B34AD5), COMB_D(0x08A94988, 0xB89899C8), COMB_D(0xB6073B32, 0x6936F5B6), COMB_D(0x6E3978AC, 0xE13CA80E), 0}},
+    {{COMB_D(0x8D9A8CE2, 0x86021FFA), COMB_D(0xCDCAF0BE, 0x2785AECA), COMB_D(0x1761E522, 0x9DCE1FCF), COMB_D(0x487EB61E, 0xC252033B), 0},
+     {COMB_D(0x36114593, 0x81CFE9CA), COMB_D(0xD44B301E, 0xF778EE20), COMB_D(0xEA236C60, 0x7B002BC4), COMB_D(0xB4731AC5, 0x534BD718), 0}},
+    {{COMB_D(0x7C96939D, 0x883997E8), COMB_D(0x374645E1, 0xB4332DE9), COMB_D(0x9A61A72E, 0xDDA2C0DB), COMB_D(0x473B5FAB, 0x3BE67C04), 0},
+     {COMB_D(0x03AB619D, 0x5B2F8477), COMB_D(0xD34DEAC9, 0x61720549), COMB_D(0x19AD1178, 0x120B1D6D), COMB_D(0xEEBFE594, 0x1C0EC973), 0}},
+    {{COMB_D(0x221D93DB, 0x85923872), COMB_D(0xE8479009, 0x5672890A), COMB_D(0x8D7D228C, 0x9581368D), COMB_D(0xBC238F64, 0xC276AFC9), 0},
+     {COMB_D(0xBFE4C430, 0x939451A7), COMB_D(0xB76B984E, 0x31BD98D8), COMB_D(0x3B1B9E28, 0xC67C4AF5), COMB_D(0xC6A05912, 0x46BB0E69), 0}},
+    {{COMB_D(0xD211A383, 0x71BF0160), COMB_D(0xE994807C, 0xF1E9FC52), COMB_D(0xD5D57E45, 0xDDF817C1), COMB_D(0xB56D5A01, 0x5BADEB0B), 0},
+     {COMB_D(0x25E950AA, 0x9616EC31), COMB_D(0x226FAD07, 0x764ED4D0), COMB_D(0xB53A6FBD, 0xEDDD28CD), COMB_D(0x38140F47, 0xB482428D), 0}},
+    {{COMB_D(0xF76211B6, 0xD2868092), COMB_D(0x3FAE0D9F, 0x7861A829), COMB_D(0x096F8756, 0x02D8DDB3), COMB_D(0xCDF82159, 0x877262C9), 0},
+     {COMB_D(0xA3816AE6, 0xE76D018C), COMB_D(0x54E206F2, 0x9F2ACA23), COMB_D(0xABB9769F, 0xBBDA92CC), COMB_D(0x34B561AF, 0x1F748CC3), 0}},
+    {{COMB_D(0xFCD7E4C0, 0x33943845), COMB_D(0xAC262017, 0xCF848096), COMB_D(0x33AC2587, 0x0FEA1EAB), COMB_D(0xBF03144A, 0xE1061977), 0},
+     {COMB_D(0xA8EEA50B, 0x05F861D5), COMB_D(0xA209B88F, 0x2DEC77AE), COMB_D(0x5C73E80D, 0xF2AF3959), COMB_D(0x1F99B3EA, 0xE2717239), 0}},
+    {{COMB_D(0x52D64E52, 0xA966E5C6), COMB_D(0x6FD9740B, 0xC8A182A8), COMB_D(0xB13839EF, 0xB8E4524E), COMB_D(0xF5C817A1, 0x605A26D5), 0},
+     {COMB_D(0x52E60E8A, 0xDD9D0E48), COMB_D(0x6AB81939, 0x527E3F19), COMB_D(0x0F62AC52, 0x930DB2CF), COMB_D(0xCCCC0337, 0x0FDF7B82), 0}},
+    {{COMB_D(0xD804CF7D, 0xB4836998), COMB_D(0x21F1EE47, 0x56A0F0A7), COMB_D(0x1E2A1525, 0x36BD1138), COMB_D(0x3054CF29, 0x41BDF921), 0},
+     {COMB_D(0x286075D1, 0xD8BA8255), COMB_D(0x0D44D82B, 0x2E8B2F0A), COMB_D(0xD0175615, 0x6AD64558), COMB_D(0x1F6885C0, 0x17911C81), 0}},
+    {{COMB_D(0xC3AA9E29, 0x4BE017C5), COMB_D(0x91CB80DF, 0x21D84ABE), COMB_D(0xE714D961, 0x97F13B0C), COMB_D(0xE1F6294A, 0x0448DF98), 0},
+     {COMB_D(0x4AC68178, 0x06D6B1BF), COMB_D(0xC29E5472, 0xC30FFC01), COMB_D(0xD60621DB, 0xF91D577F), COMB_D(0x4EC818FD, 0xA22BB635), 0}},
+    {{COMB_D(0x9BF6FF4C, 0xCE805328), COMB_D(0xADC901D9, 0x68A0B392), COMB_D(0x69E24379, 0x47EF1934), COMB_D(0xAFE4F64B, 0x186446C8), 0},
+     {COMB_D(0xC94AA7F4, 0x47EE7B23), COMB_D(0xCDCA1421, 0x70ABD7EE), COMB_D(0x01828D96, 0xCD71F7C8), COMB_D(0xCF422B2F, 0x0E4A2D48), 0}},
+    {{COMB_D(0x4948026E, 0x21D7A2A0), COMB_D(0x4D68A06D, 0x5E31088B), COMB_D(0xC81A8091, 0x81EF725A), COMB_D(0x6A3D8700, 0x0DECA504), 0},
+     {COMB_D(0x2BDC03BF, 0xF97A5C2A), COMB_D(0x63BE860B, 0xAFBC7846), COMB_D(0x911D7CA8, 0x63389064), COMB_D(0xA01F4032, 0xC24681DC), 0}},
+    {{COMB_D(0x3E0B5D5A, 0xD4441FBB), COMB_D(0x9EAA8520, 0xA5ED115E), COMB_D(0x7FB60C55, 0xEDB92555), COMB_D(0xB4958C4E, 0x21DE21D4), 0},
+     {COMB_D(0x4C7E3C9F, 0x4ADD7118), COMB_D(0x2DB9F613, 0x2D463841), COMB_D(0xE5C041FB, 0xC38CB7E1), COMB_D(0xFCD6E7BF, 0x996640EF), 0}},
+    {{COMB_D(0x2F720E8E, 0xFF750EFC), COMB_D(0xCA2E8C8E, 0x37545712), COMB_D(0xA3BF7C0B, 0x9E326507), COMB_D(0xDD8871E7, 0x97D2E0FE), 0},
+     {COMB_D(0x51F0FAFF, 0x5E60D8A5), COMB_D(0xD15DFB98, 0xCFBC7FF8), COMB_D(0x37D787DC, 0xEE9D850E), COMB_D(0xF768B0F3, 0x2487A372), 0}},
+    {{COMB_D(0x0D2AB664, 0x7ABC8301), COMB_D(0xD88B351B, 0xE3DB34F0), COMB_D(0xEDF145F3, 0x034B5C53), COMB_D(0xBF069CD2, 0xF1D23A3A), 0},
+     {COMB_D(0x46E9F2C4, 0x22A8DD3A), COMB_D(0x7925B71B, 0xC8BD0AD4), COMB_D(0xF8C03564, 0xD2129FC9), COMB_D(0x865323AC, 0x5D8D13DC), 0}},
+    {{COMB_D(0xCEE39EA7, 0xDB2A5B0D), COMB_D(0x335033F8, 0x6F6D421B), COMB_D(0x65EA1D81, 0x413DF7B9), COMB_D(0x496650F9, 0xAA7DFB45), 0},
+     {COMB_D(0x8852C269, 0x34AEC70E), COMB_D(0x1EA94B2E, 0x380C74C3), COMB_D(0x5EBB7DE6, 0xCA831A0C), COMB_D(0x61F3C64C, 0xA0AC684C), 0}},
+    {{COMB_D(0xE0BD0398, 0x8D9C6D09), COMB_D(0x8D81FCF6, 0x3D64CC1B), COMB_D(0x334293B0, 0xB6860D19), COMB_D(0x5AD752FA, 0x6BA478E3), 0},
+     {COMB_D(0x382B3211, 0x357E204E), COMB_D(0x7CC26943, 0xC9E215BB), COMB_D(0xDA91D521, 0x43094A3F), COMB_D(0x8D311F10, 0x8A3358BE), 0}},
+    {{COMB_D(0x38BC0E86, 0xEFB7601D), COMB_D(0xEC09C934, 0xF1123134), COMB_D(0x41D56D43, 0xB411D237), COMB_D(0x6B5F83BE, 0xD7F5CA5D), 0},
+     {COMB_D(0x1E467735, 0xF44208D1), COMB_D(0xE01C8A81, 0x2F03169C), COMB_D(0x88C8D507, 0x01D1D0CF), COMB_D(0xCC052A5C, 0xE010A889), 0}},
+    {{COMB_D(0x9FA6CD30, 0xAD81A4F3), COMB_D(0xE6518887, 0x53E56768), COMB_D(0xF857C707, 0x57397C71), COMB_D(0x9380D40E, 0x1C09FF72), 0},
+     {COMB_D(0x871D6766, 0xC8B2B0AA), COMB_D(0xE501C6F2, 0x36F618DE), COMB_D(0xC4827784, 0xD0B97DDA), COMB_D(0x956508F3, 0xE09827E9), 0}},
+    {{COMB_D(0x2873F268, 0x5D99D424), COMB_D(0xDE524D95, 0x8DC1B8E9), COMB_D(0x416DC58D, 0xAC2C0DD8), COMB_D(0x449F9AF2, 0x67B72FF5), 0},
+     {COMB_D(0x3BAD60AE, 0xB2AE4D58), COMB_D(0x1A904971, 0x6EBD662F), COMB_D(0x80DDF161, 0xE96CC409), COMB_D(0xC2FE18D2, 0x84638980), 0}},
+    {{COMB_D(0x3BA5DECB, 0xA32960C9), COMB_D(0x20DC2A80, 0x093306FF), COMB_D(0x8B41C6CC, 0x6CC7434A), COMB_D(0x5EBE2303, 0xAE848FFE), 0},
+     {COMB_D(0x15507D27, 0x2F66B5A4), COMB_D(0x8C7FD9DD, 0x002370AD), COMB_D(0x3C620CD0, 0x9D0AC6A3), COMB_D(0xA025A2BA, 0x69AA9FC1), 0}},
+    {{COMB_D(0xF613BD1F, 0x208FE66C), COMB_D(0x509CEEED, 0x7B02241B), COMB_D(0xCE4E52DA, 0x5A00F08D), COMB_D(0xF1D6C1F2, 0xF6B54139), 0},
+     {COMB_D(0x09E3CFAC, 0xA3790203), COMB_D(0x7726087D, 0x02761A17), COMB_D(0xCFB15C73, 0xF5BC403C), COMB_D(0x1C871925, 0x848F6498), 0}},
+    {{COMB_D(0x5C5A2B0B, 0x986FA0FF), COMB_D(0x87CC98DB, 0x94ACC9C8), COMB_D(0xD8B003ED, 0xCDB33B68), COMB_D(0x5997F491, 0x81863C5F), 0},
+     {COMB_D(0x66AB6D93, 0xBCC2A2A1), COMB_D(0x597C7A43, 0xCA7BC7BA), COMB_D(0x3D8D5528, 0x6D10DEBE), COMB_D(0x04CA43D6, 0xAD42A9DC), 0}},
+    {{COMB_D(0x2ED296E6, 0xC9B79843), COMB_D(0x62FA13AE, 0x8E84F681), COMB_D(0xBBCA2A23, 0x9C8F05BE), COMB_D(0x6720E988, 0x72AD6308), 0},
+     {COMB_D(0x7FDE79BA, 0x5C702EF8), COMB_D(0x8D25DDDB, 0x93C8EC53), COMB_D(0xCFF12309, 0xE4F7DCED), COMB_D(0x9FC80E7D, 0xADDBA879), 0}},
+    {{COMB_D(0xA16E1354, 0x06FC896F), COMB_D(0x501AB89E, 0x9026ABFA), COMB_D(0x7E74D368, 0xF2EECB1E), COMB_D(0x580BAD7B, 0x391F2ADE), 0},
+     {COMB_D(0x4A456391, 0xE68E1BEC), COMB_D(0xA2F10EA3, 0xD0573A6F), COMB_D(0x7ABC0845, 0xC7D28C3D), COMB_D(0x311349EF, 0xAF19E32A), 0}},
+    {{COMB_D(0xC32C9706, 0xD9238B17), COMB_D(0x0620225A, 0xDE3AB2A8), COMB_D(0x39B7E9C9, 0x17AD01CD), COMB_D(0xE90CE6B4, 0x8EC169F0), 0},
+     {COMB_D(0x1B248198, 0x38DDB626), COMB_D(0x91EC34E3, 0xAFA59D84), COMB_D(0xF1DFD7DD, 0x21EECCFA), COMB_D(0x215D98E2, 0x2757CBE3), 0}},
+    {{COMB_D(0xD44D5E24, 0xF911AFCD), COMB_D(0x432C3EF7, 0x5E48874F), COMB_D(0xEB05F728, 0x91F2C5A7), COMB_D(0xBFE8AAEA, 0x7DD404F8), 0},
+     {COMB_D(0xF033A978, 0x89ADB79F), COMB_D(0x9DF26D9F, 0x8FADF75A), COMB_D(0xCE065365, 0xB4AC831B), COMB_D(0x4EBE0E4B, 0x58B0DAC3), 0}},
+    {{COMB_D(0x25B906F1, 0x6DFA8EC4), COMB_D(0x61C2AAF7, 0x7436A680), COMB_D(0xB130A443, 0xDF6A5110), COMB_D(0x4785E64A, 0x228A27BA), 0},
+     {COMB_D(0xA9120736, 0xB0C9C1D9), COMB_D(0xF817D120, 0xB18F506B), COMB_D(0xDAE55B2C, 0x8CBC2953), COMB_D(0xA6E9B87B, 0xF9DB00B5), 0}},
+    {{COMB_D(0x18FDE277, 0x4FD9CB02), COMB_D(0x9D8A4DD6, 0x017D066A), COMB_D(0x58434F82, 0xA96698A6), COMB_D(0xFF368DFE, 0x6244D17F), 0},
+     {COMB_D(0x6CD6725A, 0x381DD62F), COMB_D(0xD8441C1A, 0x9F173F78), COMB_D(0xA1EB4988, 0x67ADC921), COMB_D(0x5A447AF4, 0x0BCBDCB0), 0}},
+    {{COMB_D(0x5896C026, 0x0CCCC524), COMB_D(0x8980E853, 0xD6B4089C), COMB_D(0xE6D38436, 0xBBA58679), COMB_D(0xE34F772C, 0xAFBFC3FE), 0},
+     {COMB_D(0x63BC0D11, 0x635B85DA), COMB_D(0x72428FFA, 0x4B2C8142), COMB_D(0x53BCA5F5, 0x3396F36F), COMB_D(0x8943A631, 0x872F36DE), 0}},
+    {{COMB_D(0x3CB7F1ED, 0xE037E288), COMB_D(0xFFA74755, 0x76DF03CB), COMB_D(0x575522E7, 0x7B644BE8), COMB_D(0x0852BAB8, 0x99A0E46D), 0},
+     {COMB_D(0xABDE1434, 0xCB3EDB58), COMB_D(0x578EC01D, 0x268E8319), COMB_D(0xE8CC239F, 0xD51833F7), COMB_D(0xB32C275E, 0xA7CC58EC), 0}},
+    {{COMB_D(0x64394392, 0xE62ECDDF), COMB_D(0x58B9BAC4, 0x433C3582), COMB_D(0xB737FB07, 0x6F80BB4E), COMB_D(0xDC623302, 0x1E0B1B42), 0},
+     {COMB_D(0x07DD1B5A, 0x471CC8A8), COMB_D(0x5182C1D3, 0xD327F94C), COMB_D(0xC7262AF1, 0x88B353D5), COMB_D(0x60D87744, 0x1FC0B337), 0}},
+    {{COMB_D(0xD68E0227, 0x6EBFAB70), COMB_D(0xD0EB3709, 0x211C8956), COMB_D(0x833E84CC, 0xE3B1F65D), COMB_D(0xE69E485D, 0x318B89D7), 0},
+     {COMB_D(0x80C1BA1B, 0x9894F968), COMB_D(0x69F647CB, 0x0C7E3693), COMB_D(0x18736F2F, 0xBE27C7F6), COMB_D(0x33FB9A0B, 0x47B187A5), 0}},
+    {{COMB_D(0xF3E7D045, 0x90890CB5), COMB_D(0xE8796672, 0xDF358248), COMB_D(0xBF812459, 0x1FFFF702), COMB_D(0x3E5E2648, 0xA6658DD9), 0},
+     {COMB_D(0x8F61032D, 0xDD0307B0), COMB_D(0xAE029961, 0x5A99B1BE), COMB_D(0xFFFBDB3B, 0xFA1D8004), COMB_D(0x5C17ABE6, 0x2DA25BA4), 0}},
+    {{COMB_D(0x572C0CD6, 0xBE30C3B5), COMB_D(0x8308ABC8, 0x249269DB), COMB_D(0x7F2337EC, 0x5BBD8AD3), COMB_D(0xD86B3D5C, 0x3643B9BA), 0},
+     {COMB_D(0xCE5183FB, 0x5E0ECC9E), COMB_D(0x72E3D5DC, 0x49958908), COMB_D(0xA05D7CCF, 0x9E71845C), COMB_D(0x60DE08A7, 0x478E8DC7), 0}},
+    {{COMB_D(0x5711814B, 0xC198247A), COMB_D(0x332C5190, 0x2AF6E977), COMB_D(0x7A4F430B, 0xEBC67298), COMB_D(0x622BFC21, 0x551CC9BD), 0},
+     {COMB_D(0x4BB4338A, 0x42627DD4), COMB_D(0x9FD60B65, 0x61887A42), COMB_D(0xDF1E59EE, 0x7B4D0DA7), COMB_D(0x128F6DEB, 0xE780A661), 0}},
+    {{COMB_D(0x626BCC01, 0x353DFAB1), COMB_D(0xA0B44542, 0xF9EF482F), COMB_D(0xEC10866E, 0x7A115E0A), COMB_D(0x8518BE9F, 0xDA72A728), 0},
+     {COMB_D(0xD2FF1BDF, 0x2F3D41DE), COMB_D(0x0251B4C4, 0x0BB58789), COMB_D(0xBB35C863, 0x1D76C5AC), COMB_D(0xC29B59D3, 0x739300E1), 0}},
+    {{COMB_D(0x1EFF0381, 0x6AC5F5FC), COMB_D(0x7D11BAF9, 0x794D1669), COMB_D(0xA9E33381, 0xD2C1FD8D), COMB_D(0xD3AAE719, 0x76C09A71), 0},
+     {COMB_D(0x798D7CA4, 0x2ACA447C), COMB_D(0x4A6E97D4, 0x77EA0018), COMB_D(0x8B9B0F4F, 0x1FFAE635), COMB_D(0x92C3CD50, 0xEB7A9172), 0}},
+    {{COMB_D(0x6922ABEF, 0xE2D05223), COMB_D(0x6E2DE154, 0xAA4BF809), COMB_D(0x1F60B549, 0x228B5B7C), COMB_D(0x6AA4AFC7, 0xC9EB8C41), 0},
+     {COMB_D(0xB72A8135, 0x19CF7CE9), COMB_D(0x898433A6, 0xCC23A72C), COMB_D(0x1DF5272C, 0x0E981AE3), COMB_D(0xE4185DBC, 0x2D67D3E2), 0}},
+    {{COMB_D(0xBB6289D5, 0x622F0D40), COMB_D(0x72AFA5FB, 0x59BD94F3), COMB_D(0xD66E68E7, 0xBDA3CB8B), COMB_D(0x2F23046B, 0xAB90582D), 0},
+     {COMB_D(0x3721D78D, 0x6498DEBD), COMB_D(0xCA850487, 0xA44B242D), COMB_D(0x0F2F86C3, 0x097B6F05), COMB_D(0x7CBF34AA, 0x230974DA), 0}},
+    {{COMB_D(0x29145657, 0x22D30DB2), COMB_D(0x3C54C161, 0x4C0D8ABC), COMB_D(0x5B2E1F2A, 0xC2BA51EE), COMB_D(0x13BE8EED, 0x6A5A9D65), 0},
+     {COMB_D(0xB50B70CF, 0x2ED4EB65), COMB_D(0x8C65E962, 0x57AE9BE1), COMB_D(0xF5179F89, 0x9436B58F), COMB_D(0xE4547813, 0x690DB98F), 0}},
+    {{COMB_D(0xDE41B9E7, 0x1AED4F3D), COMB_D(0xB552DEF5, 0x7DD8FE5D), COMB_D(0x03FE1432, 0xE4C4BDF2), COMB_D(0x47E9D2EF, 0xF2BE24F2), 0},
+     {COMB_D(0xAEE0170F, 0x0BE089E6), COMB_D(0xC300EE75, 0xFCA64CFF), COMB_D(0x18B336C9, 0xE9741749), COMB_D(0x6A6CE312, 0xC589D220), 0}},
+    {{COMB_D(0x16DAE276, 0xAD8FAE96), COMB_D(0x9FC10C54, 0x5F0C47FF), COMB_D(0x72E318C2, 0xA0A16177), COMB_D(0x1B60AF71, 0x9FBBB830), 0},
+     {COMB_D(0x3E27740A, 0x8E116B03), COMB_D(0x22F05A58, 0xB840D278), COMB_D(0x44C433E5, 0x6D979913), COMB_D(0xC3AB9030, 0x64C19FD3), 0}},
+    {{COMB_D(0x8CD1A0CE, 0x4D42B26D), COMB_D(0x1F8D443E, 0xC19535F8), COMB_D(0x1D4AD270, 0xE953FFAC), COMB_D(0x1E986E56, 0x45FAE792), 0},
+     {COMB_D(0xD80AA9AD, 0xF2F487DC), COMB_D(0x26155BA3, 0x31255C52), COMB_D(0x49E2FFF2, 0xD24785A6), COMB_D(0x4EDCF5B4, 0xEA43BCCE), 0}},
+    {{COMB_D(0x73B76AB2, 0xEDAD2B59), COMB_D(0x08ED5520, 0x01890337), COMB_D(0xFDBF9785, 0x17F7DDAF), COMB_D(0x3DBBCEFF, 0x54386F48), 0},
+     {COMB_D(0x8627AC1C, 0xD3192765), COMB_D(0x2BCE5344, 0xDD0BE200), COMB_D(0xA768EF4A, 0x31DAA54F), COMB_D(0x072978E8, 0xBBD23293), 0}},
+    {{COMB_D(0x9BE73834, 0x2BC2A0AE), COMB_D(0x0B3B8934, 0x95A32C79), COMB_D(0xCE44C762, 0xD8D49523), COMB_D(0xA1DF404B, 0x9E4C4E9A), 0},
+     {COMB_D(0x9832DFB2, 0x4ED09610), COMB_D(0x14FE6ACD, 0xC2D27386), COMB_D(0xEE60EBCE, 0x88E5B06A), COMB_D(0xE00BD880, 0xDEE92568), 0}},
+    {{COMB_D(0x0D9BAC8A, 0x917FAC64), COMB_D(0xFE1E93B2, 0x8B4B2758), COMB_D(0x17E9991D, 0x4BC24DDE), COMB_D(0x20BFE073, 0xAC79E949), 0},
+     {COMB_D(0xF90EF1BE, 0x648A1328), COMB_D(0x3EDCB557, 0xC14C0977), COMB_D(0x67657544, 0x6283E227), COMB_D(0xDC19F4E5, 0x137EA6EA), 0}},
+    {{COMB_D(0xA05D7C04, 0x5CC956B3), COMB_D(0xA2250B84, 0xF6DA3189), COMB_D(0xA13A435C, 0xC46AB1A0), COMB_D(0x761F2193, 0x5B3E8F46), 0},
+     {COMB_D(0xC4D97E5F, 0x4655947E), COMB_D(0xDA218ED5, 0xC74B893C), COMB_D(0x954C99F6, 0xCE75832C), COMB_D(0xE6962A77, 0xA06E8094), 0}},
+    {{COMB_D(0x06A0CB60, 0xA11BEDCC), COMB_D(0x71CA0EEC, 0xC7EC686D), COMB_D(0xF5B1A58F, 0x4A2599FE), COMB_D(0x3BB89278, 0x72A426E6), 0},
+     {COMB_D(0x5BB23082, 0x37174A5B), COMB_D(0x9534F3DF, 0x78469923), COMB_D(0x4C7DEB52, 0xDF1EFD34), COMB_D(0x8BD48FA4, 0x9F51F2EE), 0}},
+    {{COMB_D(0x8F68241A, 0x13B7007F), COMB_D(0xBCB7B079, 0xA6764113), COMB_D(0xF0A17C65, 0x15FA305C), COMB_D(0x97A3C9F7, 0xD32562B1), 0},
+     {COMB_D(0xDE8C92F1, 0x8D7DCDA7), COMB_D(0x6E534DB2, 0x8E304840), COMB_D(0xF849343C, 0xF8209283), COMB_D(0xE9AF9B24, 0xF73DF215), 0}},
+    {{COMB_D(0x28320997, 0xC103E99D), COMB_D(0x143DC3AE, 0x87693ADE), COMB_D(0xEA541AC5, 0xB29B35CE), COMB_D(0xFDE12AF2, 0x4682F72C), 0},
+     {COMB_D(0xC9253928, 0x1096754F), COMB_D(0x44DC2178, 0xE0B97E9C), COMB_D(0xAC5F0EE2, 0x635D67A5), COMB_D(0x74FB9FC4, 0xA2F69057), 0}},
+    {{COMB_D(0xA2AD0CBF, 0x93DF2235), COMB_D(0xC6B4407E, 0xBBA90BF6), COMB_D(0x3C853B6B, 0xE6904C99), COMB_D(0x31DE8700, 0xCD4E2077), 0},
+     {COMB_D(0xD30DDDBA, 0x9B19A260), COMB_D(0xD7830812, 0x5F625300), COMB_D(0x0DC074C6, 0x12D8580C), COMB_D(0x98B9B91B, 0xB927A4F1), 0}},
+    {{COMB_D(0xB4A2734F, 0x06E17FE3), COMB_D(0x52AE6523, 0xA1ED36FB), COMB_D(0x42E1B23A, 0x5D647ED9), COMB_D(0xD78DEAFF, 0xF9273D7F), 0},
+     {COMB_D(0xC3C1D18F, 0x7BC1D1D2), COMB_D(0xA80A0F39, 0x1D827E2A), COMB_D(0x0C2A2FC5, 0xAEA0B782), COMB_D(0xBEA65C7B, 0x52C380E6), 0}},
+    {{COMB_D(0x0998AD7B, 0xE4F13118), COMB_D(0x5472A87A, 0x26DC9CF9), COMB_D(0x56842EB6, 0x28CC0F5B), COMB_D(0xA6219F64, 0x290A014F), 0},
+     {COMB_D(0xCBF724B4, 0x3D798CCE), COMB_D(0x4FB841DB, 0xADE3DB6E), COMB_D(0xB2E6DCB5, 0x5EAB67BE), COMB_D(0x7751E4EE, 0xE771AC92), 0}},
+    {{COMB_D(0xE195D45A, 0xB1380E2D), COMB_D(0x8A0AF4D2, 0x552D158D), COMB_D(0x9AE9E9FA, 0x7D24D25B), COMB_D(0xECAF2518, 0xDB33B95A), 0},
+     {COMB_D(0xDE0CDA96, 0xB62F512F), COMB_D(0x015D3422, 0x4C0A9871), COMB_D(0x12DE442B, 0xA3A310B4), COMB_D(0x8F20C90B, 0x44720BEF), 0}},
+    {{COMB_D(0x0E22AB15, 0x4F2A8858), COMB_D(0xE04DACE2, 0x40879551), COMB_D(0x1CE3B100, 0x0A9E6EC7), COMB_D(0x87F66FA0, 0x176F5EBE), 0},
+     {COMB_D(0xA77EA5F4, 0x83960E66), COMB_D(0xF8696894, 0x73C1E060), COMB_D(0x0810EC2D, 0x490550CF), COMB_D(0xDA6824A2, 0x970CF5AF), 0}},
+    {{COMB_D(0xDB671134, 0xD9D35F6B), COMB_D(0x97167E95, 0x1BB611E0), COMB_D(0x1BC4FE82, 0x0582FF4B), COMB_D(0x3CE8749E, 0xF104A6CA), 0},
+     {COMB_D(0x1C445403, 0x039D8152), COMB_D(0xE38FB904, 0xF0118C33), COMB_D(0x4D9864ED, 0xFBD99CCF), COMB_D(0xE5681285, 0x90D4C180), 0}},
+    {{COMB_D(0xCB7D9685, 0x627D5843), COMB_D(0x1F26DB21, 0x3E22445C), COMB_D(0x06C20825, 0x06870EA3), COMB_D(0xDFFB091D, 0x4058858B), 0},
+     {COMB_D(0xA8791913, 0x119069CB), COMB_D(0x6DC8E0E3, 0xCF7770BA), COMB_D(0x01475748, 0x9E02F091), COMB_D(0xF8D03393, 0xD50712DA), 0}},
+    {{COMB_D(0x15866EAE, 0xFF0B5C6C), COMB_D(0x9D31F7F4, 0x0619D3F8), COMB_D(0x4BA5FC19, 0x4F513B68), COMB_D(0x97AF5E3B, 0xE910FC58), 0},
+     {COMB_D(0xAECC38D6, 0x401B7854), COMB_D(0x58091588, 0x9359141D), COMB_D(0xA3E8B6AA, 0x6B0C1B3C), COMB_D(0xDD218BAC, 0x9459F899), 0}},
+    {{COMB_D(0xB43512D1, 0x44946650), COMB_D(0x9662B316, 0xABFA2619), COMB_D(0xFFD119C5, 0x289EC8E3), COMB_D(0xF5FC82F0, 0x411D0F9F), 0},
+     {COMB_D(0x0EF3344E, 0x0EF99CD4), COMB_D(0xABFFC33F, 0x368EDE15), COMB_D(0xBA77846D, 0xAA0C6D36), COMB_D(0xCCE17F5D, 0xFBB42AA2), 0}},
+    {{COMB_D(0xF99E8E39, 0x9C1AC4B6), COMB_D(0xB20B2B7B, 0xAA34D44D), COMB_D(0x44ED200F, 0x257A2BF4), COMB_D(0xC16E4BE6, 0xF039604F), 0},
+     {COMB_D(0x1E33003B, 0x316FCB64), COMB_D(0x7CA181AD, 0xF55E9CB2), COMB_D(0x9E1D8FBB, 0x51D583C7), COMB_D(0x887F1562, 0x46E277FA), 0}},
+    {{COMB_D(0x870CE13D, 0xD5ABE823), COMB_D(0x9A2C20AA, 0x1DDCD210), COMB_D(0xE4448B7D, 0x2F829AF9), COMB_D(0xCE6139E8, 0xFA1B3B1C), 0},
+     {COMB_D(0x3B6359BE, 0xE9C54D7C), COMB_D(0x27612234, 0x2EDD93D3), COMB_D(0xD06B8AEB, 0x360B967B), COMB_D(0xA52484F1, 0xEEE6C157), 0}},
+    {{COMB_D(0x32AA5FE4, 0x28842328), COMB_D(0xBB931D10, 0x667FB7B8), COMB_D(0x20A08C1E, 0xB55C6C51), COMB_D(0x565B9375, 0x78346D11), 0},
+     {COMB_D(0xA2BE7DEE, 0x7E715B34), COMB_D(0x6D4048E2, 0x35C8A739), COMB_D(0xFB805CCF, 0x836B97C4), COMB_D(0x08553879, 0x0D6F35E3), 0}},
+    {{COMB_D(0xF6B7E3D6, 0x675DAD8F), COMB_D(0x946A39D5, 0x98FA513D), COMB_D(0xFB31C0AD, 0xCE40DD3E), COMB_D(0x74B4F46E, 0x6F0DFBA7), 0},
+     {COMB_D(0xBAF4AD80, 0xC3A98CBD), COMB_D(0x37779CF6, 0xD7DA405F), COMB_D(0x20B1E930, 0xA16A6388), COMB_D(0x6296EE0B, 0x215FC9E5), 0}},
+    {{COMB_D(0xFA432D3C, 0xD3230CC5), COMB_D(0x72F602B9, 0x182A2856), COMB_D(0x324AB536, 0x46887556), COMB_D(0x16B7B09E, 0xC6028A3E), 0},
+     {COMB_D(0x3693E58B, 0xF6A2D7BD), COMB_D(0xE00DC8E5, 0x6263C227), COMB_D(0xE95AF771, 0x06E31A0E), COMB_D(0xEC507E8E, 0x3005A25B), 0}},
+    {{COMB_D(0x0633D31B, 0x5630F041), COMB_D(0x1E77D0C3, 0x7C068EDB), COMB_D(0xF6B65BA6, 0x33086885), COMB_D(0x5105FAA8, 0xDD8DD4D3), 0},
+     {COMB_D(0xBBED3B50, 0x7F446916), COMB_D(0x27F6ED6E, 0x870E2E7C), COMB_D(0x9CDE1B48, 0x50C46A55), COMB_D(0xA6846679, 0x6CFFF90A), 0}},
+    {{COMB_D(0xB8A2860B, 0x563C1432), COMB_D(0xEB2E3B57, 0x01A40062), COMB_D(0x22BFBF8D, 0x11E94C64), COMB_D(0x89CAD40C, 0x5D205675), 0},
+     {COMB_D(0x9352062B, 0x806978A4), COMB_D(0x04B8849C, 0x64BB2FC9), COMB_D(0xB3228DB7, 0x864EEB23), COMB_D(0x8B041BD0, 0x3F9C124A), 0}},
+    {{COMB_D(0xF3A366B2, 0xE2DED659), COMB_D(0x1977A2F5, 0xE125F9A1), COMB_D(0xC581BB24, 0x8D35D370), COMB_D(0xDEC003B7, 0xBCF6ABB3), 0},
+     {COMB_D(0xB9A5F0AA, 0x3D9C19AE), COMB_D(0x04251EB1, 0x234E91A3), COMB_D(0xC67A1762, 0xB85859BF), COMB_D(0x058CCF7B, 0x0F93F8A6), 0}},
+    {{COMB_D(0xE083A749, 0x75EA562E), COMB_D(0x90325290, 0x25D89826), COMB_D(0x1A74654D, 0xF905D017), COMB_D(0xDBBD5AC0, 0x74A8BFBE), 0},
+     {COMB_D(0x523A1F41, 0x461A620B), COMB_D(0xF1703B26, 0xC1E2BF4B), COMB_D(0x21D476AC, 0x0B8BB5D6), COMB_D(0x7E1C8E1B, 0xA0E5EA01), 0}},
+    {{COMB_D(0x95B69999, 0x707BD0FF), COMB_D(0xC2B9B249, 0x391222C9), COMB_D(0xE82058A6, 0xA97B072C), COMB_D(0x73A902CA, 0xBBE9FE93), 0},
+     {COMB_D(0x166149B5, 0x53BA4278), COMB_D(0xA11F4960, 0xFAD1C068), COMB_D(0x854FDFBA, 0xD0D525F0), COMB_D(0xFEEA4430, 0xB90EB3F0), 0}},
+    {{COMB_D(0xB04EB7F5, 0x452725A5), COMB_D(0x481137A4, 0xA579F02D), COMB_D(0x156A5D46, 0x93F38E93), COMB_D(0xC156516E, 0x953CBC57), 0},
+     {COMB_D(0xECC43F0F, 0xC9308735), COMB_D(0x0B9A6FEF, 0xE3C8DFA7), COMB_D(0x1AD24241, 0x3D73BA06), COMB_D(0x4926EF61, 0x9E063D49), 0}},
+    {{COMB_D(0x1841E21D, 0x5761A3A6), COMB_D(0xBA7820A2, 0x4F7A3B3C), COMB_D(0x29F2F31E, 0xBF8F4667), COMB_D(0x4AD3E923, 0xF3D9C5B3), 0},
+     {COMB_D(0x7B1B4E6C, 0x71213D16), COMB_D(0x80B0841D, 0x12C3BBA0), COMB_D(0x86A4FCC1, 0x84C1F95A), COMB_D(0x86B1E519, 0x9165DF58), 0}},
+    {{COMB_D(0xA0CF50F5, 0x666F4F00), COMB_D(0x99EF0E9C, 0xC0E6F4D4), COMB_D(0x4F093B15, 0x1FAE3641), COMB_D(0xB5DCB60D, 0x5DD90B89), 0},
+     {COMB_D(0xE75426CE, 0x754E23D4), COMB_D(0xBFB2A02D, 0x729816EF), COMB_D(0xE356E86E, 0x54EFBBA4), COMB_D(0x87CF605D, 0x55FB5001), 0}},
+    {{COMB_D(0xC29A84EA, 0x3ABE033B), COMB_D(0xD497F5CA, 0xAE4EDB06), COMB_D(0x1AFE7B1D, 0x7AB6F1A8), COMB_D(0xDD3F2EC9, 0x89A1A641), 0},
+     {COMB_D(0x6D7F0312, 0x89D51159), COMB_D(0xBFCC0B01, 0xD7D81E4B), COMB_D(0xDFF21849, 0x11150A8D), COMB_D(0xB2CA7BE4, 0xEA6D4401), 0}},
+    {{COMB_D(0x857749CA, 0x78DA993A), COMB_D(0x9259DB3D, 0xBAE73038), COMB_D(0x8BB6C7B9, 0xAEF9D7E6), COMB_D(0xBD5D5CDB, 0xE610113D), 0},
+     {COMB_D(0xD8913D69, 0x8E4B3781), COMB_D(0xDE38E2DE, 0x96713380), COMB_D(0x5F2FDE42, 0x22DE3664), COMB_D(0x290F5102, 0xFB2F71F3), 0}},
+    {{COMB_D(0xFB9E2BC5, 0xCE50C3C3), COMB_D(0x4545820F, 0x305E33CA), COMB_D(0xD0F66E90, 0xF757A6A6), COMB_D(0x189E18D2, 0x8F65025A), 0},
+     {COMB_D(0x6F61CEA0, 0x16FBB137), COMB_D(0xEC57E274, 0x76314866), COMB_D(0xB539C33E, 0x7CE79FE7), COMB_D(0xC65502DC, 0xD4D67029), 0}},
+    {{COMB_D(0xC0747129, 0x885FBD44), COMB_D(0x89C2CAA3, 0x9F26267A), COMB_D(0xE05471CE, 0x16D5222C), COMB_D(0x9BBF06DA, 0xD9AB5905), 0},
+     {COMB_D(0xA3447DFA, 0x7A1D3E88), COMB_D(0xC0D4BDDC, 0x15036ED2), COMB_D(0x6755DAF3, 0x0A6F47E8), COMB_D(0x1BCC7FA8, 0x4DE120A3), 0}},
+    {{COMB_D(0x41E0B13E, 0x9DBD17EF), COMB_D(0xCB378364, 0x7CD46BEB), COMB_D(0xF346CDCA, 0xD0816129), COMB_D(0xD93588C0, 0x1475D57C), 0},
+     {COMB_D(0xE9D305CA, 0x4E9D073D), COMB_D(0xC52F2DF7, 0x406EAD1D), COMB_D(0x09421D96, 0xB1FEDE1C), COMB_D(0x68050969, 0x752CBC98), 0}},
+    {{COMB_D(0x1DE179E1, 0xE1B248BB), COMB_D(0xCDEF8189, 0x2C0FCC2D), COMB_D(0xA360FBE2, 0xCE7D2D4E), COMB_D(0x6504E40D, 0xCA0AD208), 0},
+     {COMB_D(0x23101DC0, 0x9A4F47E4), COMB_D(0xD86C3309, 0xEB6E3B92), COMB_D(0xAE4B1C09, 0x9737C8EB), COMB_D(0xEFE2CEB3, 0x455B5E1B), 0}},
+    {{COMB_D(0xCB24777A, 0x38467CCB), COMB_D(0x27058D6D, 0x1EF15F43), COMB_D(0x7B808054, 0x23586908), COMB_D(0x7706BF51, 0x164E85A8), 0},
+     {COMB_D(0x823319C4, 0xC680058C), COMB_D(0x15CBDEB5, 0x4202B4FC), COMB_D(0xE87F859A, 0x227CFF08), COMB_D(0xB318D921, 0xECD83FA9), 0}},
+    {{COMB_D(0x51823030, 0xF1158503), COMB_D(0xA9EEA84E, 0x8553BE69), COMB_D(0x687A7585, 0xBDF6C293), COMB_D(0xCE5FE050, 0xA0B9FF64), 0},
+     {COMB_D(0x70D28F8D, 0x8AC54586), COMB_D(0x21D6C93B, 0xF13C44A4), COMB_D(0x80B6D7A4, 0x4915859C), COMB_D(0x105CA5CA, 0xB4BB37FA), 0}},
+    {{COMB_D(0xABE105E9, 0x2193ADEF), COMB_D(0x7B30EC59, 0xFFBA9FB9), COMB_D(0xC351B349, 0x50AC861E), COMB_D(0xF6D224F8, 0xFB4B24C9), 0},
+     {COMB_D(0x593ABDB1, 0xA6D12B77), COMB_D(0x79A5CB62, 0x99B06ED7), COMB_D(0xE4261BBF, 0xDD82F74C), COMB_D(0x3434E71B, 0xDA4DAA59), 0}},
+    {{COMB_D(0xAF572C56, 0xE2188442), COMB_D(0x57A9F4C2, 0x6C2C324D), COMB_D(0x8CCBBFCE, 0x35AF9A8E), COMB_D(0x86827030, 0x3B36F132), 0},
+     {COMB_D(0x728B56DB, 0x0C5C8F56), COMB_D(0x1E6423E7, 0x0DB50338), COMB_D(0x0EE70277, 0x0075417C), COMB_D(0x69F15696, 0xED419342), 0}},
+    {{COMB_D(0xCE9A1BC0, 0x7B186249), COMB_D(0x85220AC9, 0xAF62B793), COMB_D(0x63065C71, 0x2982843F), COMB_D(0x7AC31903, 0xDEBB455B), 0},
+     {COMB_D(0xBE9ABAE7, 0x343999D3), COMB_D(0x0E6D37A3, 0x0C3E5F0C), COMB_D(0x10E496DA, 0xFE39AD0D), COMB_D(0xBABA33BF, 0x095A9B89), 0}},
+    {{COMB_D(0xF96C17AB, 0x2E9686A1), COMB_D(0x27E9D6AB, 0xE0A0EB7D), COMB_D(0x11774865, 0xA7E5385D), COMB_D(0x1F7ED895, 0x0DB53590), 0},
+     {COMB_D(0x17595E76, 0xFD47F3D3), COMB_D(0xD9A3BC0F, 0xF49D01DE), COMB_D(0x25A9014E, 0x1E9E429D), COMB_D(0xC29DAFAA, 0x5D39E1BF), 0}},
+    {{COMB_D(0x90BBEE5C, 0xBDCD1514), COMB_D(0xF46F5D88, 0x9D988153), COMB_D(0xA19D8FEB, 0xB7271CD8), COMB_D(0x1ABD2FFB, 0x9FC799BF), 0},
+     {COMB_D(0x57AA4AA8, 0x25634D5C), COMB_D(0x91CD05BE, 0x9C8E16F1), COMB_D(0x1B6488E4, 0xCEFD7D31), COMB_D(0x5D77A7D2, 0xACD3A29D), 0}},
+    {{COMB_D(0xB08E659C, 0x79E13E3A), COMB_D(0x66723BAE, 0x6E23334D), COMB_D(0x9AC73E55, 0x30AF01EC), COMB_D(0xC24A0897, 0x5F8598D5), 0},
+     {COMB_D(0x640DC8C9, 0xDB28E44D), COMB_D(0x93AF21EC, 0xC85E0C67), COMB_D(0x495D5D36, 0xD105F676), COMB_D(0xBF1B261A, 0xD7378979), 0}},
+    {{COMB_D(0xE7252023, 0xF32F340C), COMB_D(0x3AF0AFDB, 0x04E90BFB), COMB_D(0xB6BD64BF, 0xE856506C), COMB_D(0x35B623EE, 0x5F8F92A9), 0},
+     {COMB_D(0x18052DB1, 0x5E654A60), COMB_D(0x04EB83DC, 0x486CE1B2), COMB_D(0xACB67387, 0x131660B7), COMB_D(0xA5E2D6F5, 0x63EDF774), 0}},
+    {{COMB_D(0x2417574D, 0xECB9A105), COMB_D(0x97A462C9, 0x5149C382), COMB_D(0xE52F2397, 0x32704E08), COMB_D(0x447668F7, 0xB9912CE5), 0},
+     {COMB_D(0xC923F787, 0x805F92D8), COMB_D(0xCCF3FABA, 0x8311ED64), COMB_D(0xC1BACF7B, 0xF34621C6), COMB_D(0xDB81A690, 0xCFE3EEE9), 0}},
+    {{COMB_D(0x576FE4B1, 0xE2B41647), COMB_D(0xA1BCBF57, 0x4D4B20B8), COMB_D(0x551DAD6C, 0xEC604C49), COMB_D(0x9D40ED30, 0x160A8BD2), 0},
+     {COMB_D(0x1F805BB2, 0x0782298F), COMB_D(0xA24212D3, 0x64E5420C), COMB_D(0x36D57E60, 0x581A90AD), COMB_D(0xFD5E1FE0, 0x9E997F9E), 0}},
+    {{COMB_D(0x22488C43, 0x67BA8EA1), COMB_D(0x1CF89670, 0x9345816A), COMB_D(0xCE14F57C, 0xCB3E8CBD), COMB_D(0xD32F99A5, 0xAEB05BEC), 0},
+     {COMB_D(0x6A5DD7B2, 0x5AA59D6E), COMB_D(0x53DBD28D, 0x59EEF55F), COMB_D(0xE52BD353, 0x20CCD29F), COMB_D(0x302E57F1, 0xEBAE3D7E), 0}},
+    {{COMB_D(0xEB5288AE, 0x0287E147), COMB_D(0x2A71B4E2, 0xB3FDFB6B), COMB_D(0xDE45D52A, 0x1FBB44B5), COMB_D(0x3E7E62EB, 0x7CE65D91), 0},
+     {COMB_D(0xA106F061, 0xB4A10166), COMB_D(0x1E6E51A1, 0xF65CC0C0), COMB_D(0xA35FEC23, 0xF5896053), COMB_D(0x856BE963, 0xB4A6F31C), 0}},
+    {{COMB_D(0xED0A5FB4, 0x655E70C8), COMB_D(0xFCC4F5F9, 0x16FD67B3), COMB_D(0x794BE0E9, 0x3C302BF8), COMB_D(0x163ADC55, 0xA86470EC), 0},
+     {COMB_D(0x4517547D, 0x7B5A9D6C), COMB_D(0x127AB2C9, 0xAE43271A), COMB_D(0x76E2D3E4, 0xFD8118A8), COMB_D(0xEE3D73C3, 0xDB8AC849), 0}},
+    {{COMB_D(0x2D47BAEB, 0xAA054022), COMB_D(0xD0DB35D8, 0x1B392DD7), COMB_D(0x0EAB9185, 0x4BF39328), COMB_D(0xA6641013, 0x9CD10541), 0},
+     {COMB_D(0x6E7BAFFE, 0x188DFDE7), COMB_D(0x472AA1BA, 0x5DD355AD), COMB_D(0x41031783, 0xF32F362B), COMB_D(0xEEDA077E, 0x480A09FE), 0}},
+    {{COMB_D(0x99BDB27B, 0x8974DB5C), COMB_D(0x2251F7C5, 0x477DEBAA), COMB_D(0xD3869A21, 0xB0D5FF84), COMB_D(0xDB12ABF3, 0xCC15AA10), 0},
+     {COMB_D(0xAED2D33C, 0x1FF03F4C), COMB_D(0xF2331091, 0x938C043A), COMB_D(0xA0C8282E, 0xAB472F56), COMB_D(0xEB9BC995, 0x6139184A), 0}},
+    {{COMB_D(0x690D7E9B, 0x502A8D1E), COMB_D(0x711C608A, 0x1476F914), COMB_D(0xE7FC3391, 0x18CF854D), COMB_D(0x8F145879, 0xFDA27A89), 0},
+     {COMB_D(0x6033519E, 0x479F51BF), COMB_D(0xB8BA70AE, 0x77A8A90D), COMB_D(0x2FB4F40F, 0xEE997430), COMB_D(0xCD29A90D, 0x5FF0AAED), 0}},
+    {{COMB_D(0x157D3771, 0x8AB23C58), COMB_D(0x58E065DC, 0x16431483), COMB_D(0x75D5255E, 0x28D7E778), COMB_D(0x8654256A, 0xE520B2FF), 0},
+     {COMB_D(0xA13B305A, 0xBF64122B), COMB_D(0x22A1149F, 0xE71FE2E4), COMB_D(0xAE2FB6D8, 0x4E8DAB83), COMB_D(0x6058DD9A, 0xB65731C2), 0}},
+    {{COMB_D(0xB6109BA2, 0x6E5704B5), COMB_D(0x68AE1CAC, 0xA60836E5), COMB_D(0x3E7E4B58, 0xCD7AC581), COMB_D(0x144247C1, 0xE4EDF2E3), 0},
+     {COMB_D(0x779A63A3, 0xC3691B39), COMB_D(0xAEC48ECF, 0x841D21E2), COMB_D(0xC5AC77C2, 0x4549DEE5), COMB_D(0x297E8D47, 0x9C8A6C4A), 0}},
+    {{COMB_D(0xFCBDF4C0, 0x485BCE8C), COMB_D(0xB36A5300, 0x1B43549A), COMB_D(0x5C824F4E, 0x14A519F2), COMB_D(0xCC07F891, 0xFF31C829), 0},
+     {COMB_D(0xDD7727FF, 0x03A130C2), COMB_D(0x74D8397D, 0xD7B5048A), COMB_D(0xD23FCB8C, 0x1960B317), COMB_D(0x47411432, 0x6AFF91A9), 0}},
+    {{COMB_D(0x8E887A23, 0x95255881), COMB_D(0x13D46192, 0x458769CC), COMB_D(0xA50252DE, 0xEACE8A8C), COMB_D(0xD4C1BA5F, 0xD8621934), 0},
+     {COMB_D(0x1CC6DD0E, 0x7B94A1EC), COMB_D(0xB436922C, 0x1112ECDE), COMB_D(0x88DE6B41, 0xC4DE99A0), COMB_D(0x9DEE0C79, 0xF3CA630C), 0}},
+    {{COMB_D(0xFB21230C, 0xB9B91205), COMB_D(0xF5E7BFA2, 0x5F6AEFAF), COMB_D(0xC67DC74E, 0x4D2C1CA4), COMB_D(0x091873DF, 0x47386A67), 0},
+     {COMB_D(0x726D25F2, 0x6BBD8E4B), COMB_D(0xB7F7E036, 0x6F403C62), COMB_D(0x576DA6C9, 0xA577C4B9), COMB_D(0xB704E0B5, 0xC5E2E272), 0}},
+    {{COMB_D(0x3406A3F4, 0xA5F2EF61), COMB_D(0x891C3AB9, 0x192F569A), COMB_D(0xD6D9224C, 0xA0528A1C), COMB_D(0x797044C0, 0xD7E531D1), 0},
+     {COMB_D(0xB49B80BA, 0x2D18AB17), COMB_D(0x5346ECAD, 0x9F3E88F5), COMB_D(0xB9155C4C, 0xCD4CC886), COMB_D(0xCA7DEE5C, 0x7907D3F2), 0}},
+    {{COMB_D(0x9CBDE149, 0x02FEA492), COMB_D(0xFBDDAB74, 0x955B7928), COMB_D(0x6C8EE18D, 0x456E9E20), COMB_D(0x21C02473, 0x4860592D), 0},
+     {COMB_D(0xA15B6AAE, 0x43B0C006), COMB_D(0xC1DC616D, 0xBC06C1DF), COMB_D(0x15DFEF76, 0x7DF0DD37), COMB_D(0xABCE117A, 0x623C1E0D), 0}},
+    {{COMB_D(0x8A05CE84, 0xF0179FF6), COMB_D(0xEB766CD1, 0xABB3C247), COMB_D(0x49D1811E, 0x64958D3B), COMB_D(0x470892D8, 0x15923EDD), 0},
+     {COMB_D(0x2AB3EFD0, 0xF5BF4FAA), COMB_D(0xAAF22934, 0xA006C422), COMB_D(0x3A638BFB, 0x37A4A348), COMB_D(0x46CF2CDA, 0xAFDB4041), 0}},
+    {{COMB_D(0xA08C1323, 0xF4560D44), COMB_D(0x8A1F0AF2, 0x910BCF7D), COMB_D(0xD813FF1A, 0x85909A05), COMB_D(0x19848C8E, 0x2D28FC31), 0},
+     {COMB_D(0x5627FE6B, 0x4FF993D8), COMB_D(0xB57ADE10, 0xBA797DDE), COMB_D(0xCE0BD101, 0x7CCFFA84), COMB_D(0x8B41E469, 0x8BF6C053), 0}},
+    {{COMB_D(0x5CB3E081, 0x755C591A), COMB_D(0x2297CF34, 0xC529B3F7), COMB_D(0xE346D638, 0xC3C50708), COMB_D(0x5175D622, 0x793FFA37), 0},
+     {COMB_D(0x7422B8F5, 0xCA095448), COMB_D(0x3F51F97D, 0x50911199), COMB_D(0x40D6786E, 0x145B0C40), COMB_D(0x58232C23, 0x2C5B5542), 0}},
+    {{COMB_D(0xFE0BD01E, 0x7154F807), COMB_D(0xBC046993, 0x2A232EDF), COMB_D(0x200B6986, 0xBEA2CAE4), COMB_D(0x8485E00F, 0x440CD238), 0},
+     {COMB_D(0x3D227A7D, 0x5640911C), COMB_D(0xC6867BA3, 0xE1E1E488), COMB_D(0x54DD826D, 0xA9925F04), COMB_D(0x6DE16D55, 0x8E6E0F82), 0}},
+    {{COMB_D(0x16BA7BC3, 0xD16F4B48), COMB_D(0xE880C83C, 0xCB9B27EE), COMB_D(0x2898AFDA, 0x70238484), COMB_D(0xB8B577D4, 0x2EE76BCC), 0},
+     {COMB_D(0x197959B2, 0x0C955B15), COMB_D(0xA67EEDA5, 0xD9D82EF5), COMB_D(0xDAB8E2BD, 0xC53B641D), COMB_D(0x63023631, 0x786139FC), 0}},
+    {{COMB_D(0xB4080755, 0x9373853E), COMB_D(0xBACD00D7, 0x12AAA144), COMB_D(0x0F1794EC, 0x6749744C), COMB_D(0x26230C62, 0x9B9288F6), 0},
+     {COMB_D(0x1D9A43D3, 0x0B01CD44), COMB_D(0x5D713369, 0x9DE58017), COMB_D(0xD094452A, 0x3D12E0DD), COMB_D(0xE4439409, 0xEBB0F3DD), 0}},
+    {{COMB_D(0x4FEE642D, 0x447DAC01), COMB_D(0x129D2E04, 0x43A12C47), COMB_D(0x41FBE367, 0x7829DCED), COMB_D(0x82A8922D, 0x31189A39), 0},
+     {COMB_D(0xB36AAC01, 0x98D9B4BF), COMB_D(0x74478AA6, 0xFBD2BE00), COMB_D(0x6AB0356C, 0xC275754C), COMB_D(0x70560CE0, 0xF687D9E7), 0}},
+    {{COMB_D(0xBE5BB9F6, 0xCBF7548F), COMB_D(0x6F1E20EC, 0x834542F9), COMB_D(0x4D1AE3CE, 0x9D00EC71), COMB_D(0xE7DAFA25, 0x95E0B51B), 0},
+     {COMB_D(0x2057CC1D, 0x063607B1), COMB_D(0x0580E956, 0x936B423D), COMB_D(0x056007ED, 0x07C7ABCE), COMB_D(0x227CAD7E, 0x39C112F6), 0}},
+    {{COMB_D(0x80250824, 0x1A50E701), COMB_D(0x02F533BA, 0xA8ACFBEB), COMB_D(0x8B1343B7, 0xFEA7F566), COMB_D(0x33A5C737, 0xFA01A34D), 0},
+     {COMB_D(0xBA889653, 0xB1EE275E), COMB_D(0x59F22CD7, 0x735A6708), COMB_D(0x42AEEBC4, 0x1A7C13B8), COMB_D(0x6272A497, 0x53E884D8), 0}},
+    {{COMB_D(0x20BDC305, 0x663B683B), COMB_D(0xCF18CECA, 0x7F1FD183), COMB_D(0xDB0615D3, 0xC788E2F8), COMB_D(0xAB7E2DEC, 0x19A058AE), 0},
+     {COMB_D(0x0443E14F, 0x39B7A500), COMB_D(0x7A5C5A31, 0x80DBDA18), COMB_D(0x401646C4, 0x88BA480E), COMB_D(0x1587370B, 0x04A82C1A), 0}},
+    {{COMB_D(0x648471D6, 0x60D388B1), COMB_D(0x4F3C0376, 0xEAE58957), COMB_D(0x7EAA3117, 0xECDF0E2D), COMB_D(0x851CAE8B, 0x8BAF6579), 0},
+     {COMB_D(0xFA4E6E3B, 0x2EA63F3A), COMB_D(0x4E762941, 0xF64539C5), COMB_D(0xFDFE12D7, 0x52885A5A), COMB_D(0x7AB765ED, 0x4EF0961E), 0}},
+    {{COMB_D(0xBE54B2CA, 0x94693CAA), COMB_D(0x81F17304, 0x69BE22AB), COMB_D(0xBEF8B992, 0x43384AC3), COMB_D(0x94843E18, 0x0983C83A), 0},
+     {COMB_D(0x43F8B399, 0x88E9BF5E), COMB_D(0xAED50C45, 0x1F7BC625), COMB_D(0xC3D87872, 0x6050526A), COMB_D(0xC83C9A33, 0xA1DD6285), 0}},
+    {{COMB_D(0x3FFBD77C, 0x77750A82), COMB_D(0x64C59189, 0x802D6386), COMB_D(0xD58B63C5, 0xB2D3CC18), COMB_D(0xE0D83BDA, 0xB7D2AA9C), 0},
+     {COMB_D(0x37060332, 0x69B6132B), COMB_D(0xCF01DDEB, 0xB9EA2755), COMB_D(0xA49DE33D, 0xA5B3B4BC), COMB_D(0x3611AAE4, 0x55C707C5), 0}},
+    {{COMB_D(0xA575EE2F, 0x1536B2BA), COMB_D(0xDB226CF7, 0x1F51CA5F), COMB_D(0x0F64D980, 0x0ECB5FD1), COMB_D(0x6E4F3C55, 0x56C55A04), 0},
+     {COMB_D(0xA2B2289A, 0xB881541F), COMB_D(0xAC64D0C4, 0x8CB329D7), COMB_D(0x97B1B5E6, 0x2041032D), COMB_D(0xB1ECE1EF, 0x9F7F9087), 0}},
+    {{COMB_D(0xE2250731, 0x776CFDBA), COMB_D(0xF2710487, 0xE672F7C1), COMB_D(0x4D121B7E, 0x111F450A), COMB_D(0x7953D0EA, 0xC69AFF3E), 0},
+     {COMB_D(0x70353836, 0xADCD1EC4), COMB_D(0x5A033919, 0x8CB8F892), COMB_D(0xCF2B81A9, 0x3B38E4DF), COMB_D(0x752A633E, 0xC2C1B147), 0}},
+    {{COMB_D(0xE25570D7, 0x25786F95), COMB_D(0x43013E8C, 0x279158F9), COMB_D(0x8BB808AB, 0x1CFDF7E1), COMB_D(0x67AFD035, 0x1B340651), 0},
+     {COMB_D(0x62A8A000, 0x22ECD88D), COMB_D(0x24A3D455, 0xE69C7DF2), COMB_D(0xF71FAD53, 0xAEE5FE54), COMB_D(0x605F0CCF, 0xF6EF31C3), 0}},
+    {{COMB_D(0x400F413B, 0x403EFA25), COMB_D(0x280D7A30, 0xE2FD635D), COMB_D(0x1743A450, 0xB555E673), COMB_D(0xF84B1561, 0x3439D3BA), 0},
+     {COMB_D(0x79DC9341, 0x33994FAC), COMB_D(0xA66C27E4, 0xA676044B), COMB_D(0xCA5020F7, 0x3480BBE7), COMB_D(0xF00A11A0, 0xAB4803EC), 0}},
+    {{COMB_D(0x718B11AC, 0x243FC5C5), COMB_D(0xB7A303EB, 0x7AE4F2CC), COMB_D(0x44E0DD44, 0x7DC5B3B6), COMB_D(0x6BCF68F5, 0x6B4B0612), 0},
+     {COMB_D(0x5BE83966, 0xE3ED1295), COMB_D(0x0FC80767, 0x80E83CDE), COMB_D(0x21221C44, 0x61331F95), COMB_D(0x0D093BA3, 0x3105708C), 0}},
+    {{COMB_D(0xE4690ADD, 0x38610E13), COMB_D(0xDC7D7DF2, 0xF5DD4FE9), COMB_D(0x0B181F75, 0xFE2C2E4A), COMB_D(0xEC3F5FCB, 0xF87CA046), 0},
+     {COMB_D(0x51D5F01B, 0x42916CAF), COMB_D(0x0A55BF96, 0xCA863D4D), COMB_D(0xA769A2BB, 0xCD1B4C75), COMB_D(0x2AA58680, 0x8CDDCCB9), 0}},
+    {{COMB_D(0x55EA4119, 0x86633D5F), COMB_D(0x2AAEFB19, 0xE71C685B), COMB_D(0xD8CFA26C, 0x315BA7DC), COMB_D(0x33062D88, 0xFE5B1F2F), 0},
+     {COMB_D(0xD981D5AF, 0xF74F0E91), COMB_D(0x54D57729, 0x6782B33D), COMB_D(0x5F0CCCFE, 0x7E1BFFB4), COMB_D(0xC257D173, 0xD321DBBB), 0}},
+    {{COMB_D(0xC18923D9, 0x99A955A8), COMB_D(0x2C681BDE, 0x3CB62F64), COMB_D(0x36C0BB92, 0xCA69163B), COMB_D(0xA7617D3F, 0x827FFD33), 0},
+     {COMB_D(0x1F7F93EB, 0x38A9FB7B), COMB_D(0x7C22B7AD, 0x921FC7DC), COMB_D(0x559774C0, 0x59B5994B), COMB_D(0xE5A46B0B, 0x2EB427D8), 0}},
+    {{COMB_D(0x5D23F33A, 0xA5411C0A), COMB_D(0x4FFB01C4, 0x6A537888), COMB_D(0x6573CE64, 0x4E503AD7), COMB_D(0xEB7B545F, 0xC66A2CD0), 0},
+     {COMB_D(0x62C08608, 0xD969C95B), COMB_D(0x74CB3F04, 0xA965863A), COMB_D(0x3E366A6A, 0x67A9945B), COMB_D(0xDCD9799C, 0x977CC2E3), 0}},
+    {{COMB_D(0x8480E275, 0xFE7AE044), COMB_D(0x4C126DC7, 0x35618FC5), COMB_D(0xD1E8675B, 0xE4586326), COMB_D(0x003BC134, 0xFFE44497), 0},
+     {COMB_D(0xC8D732C5, 0x65EB57F3), COMB_D(0x38AF827E, 0xC10820DB), COMB_D(0x340C5838, 0xBA0A7168), COMB_D(0x865E94A9, 0xE520D787), 0}},
+    {{COMB_D(0x8B02E268, 0xDC733EFB), COMB_D(0x83423291, 0x8C170180), COMB_D(0x2F39EEC8, 0x374C962D), COMB_D(0x2209B594, 0x5501938F), 0},
+     {COMB_D(0xCDE1BBE3, 0xE98CEA44), COMB_D(0xACC820DB, 0x2196973A), COMB_D(0x3F3E6607, 0x58B1B4F0), COMB_D(0xC35022BB, 0x6AFF0BE9), 0}},
+    {{COMB_D(0x330F2EC7, 0xA6249422), COMB_D(0xC5708B74, 0x375ADD40), COMB_D(0xBF6B0428, 0xF9E1B72F), COMB_D(0x0FD10AF2, 0x1FE1CA30), 0},
+     {COMB_D(0x6C543837, 0xA9E8FA54), COMB_D(0x167FDEC7, 0x39F4BCEB), COMB_D(0xF560BE70, 0xD6A8F27A), COMB_D(0x96F26210, 0x33A140F9), 0}},
+    {{COMB_D(0x19192186, 0x8A453663), COMB_D(0xF66B61C8, 0x35FE8DE8), COMB_D(0x939DA998, 0xC4C591A2), COMB_D(0x3DFC2054, 0x4CEF4DD5), 0},
+     {COMB_D(0x4E841D01, 0x4D06BC47), COMB_D(0x0CBEEFDC, 0x09C4A8AD), COMB_D(0x629B088D, 0xEA4689B2), COMB_D(0x7A773411, 0xDBF83D74), 0}},
+    {{COMB_D(0x80CE2BBE, 0x00D5DAE9), COMB_D(0x3CFF07C7, 0xA897B935), COMB_D(0x5C1D70F0, 0x76DE019B), COMB_D(0xE9A9D83F, 0xE915FD24), 0},
+     {COMB_D(0xCB99FB62, 0xB285FB88), COMB_D(0x0ED1C972, 0xC024C932), COMB_D(0x61F435EA, 0x1C1394C3), COMB_D(0xF58F4FFF, 0xCA22AB66), 0}},
+    {{COMB_D(0xF2351804, 0x05187B38), COMB_D(0xF56F9A0A, 0x2295DBD1), COMB_D(0xE77CB0F4, 0x511D45CC), COMB_D(0x3EF2FA08, 0x76388A74), 0},
+     {COMB_D(0x9FD8C5D3, 0xAD6E7D1B), COMB_D(0x50D4A78C, 0x77AAD312), COMB_D(0xD9E8B2AC, 0x13229426), COMB_D(0xE98201C3, 0x81A920C1), 0}},
+    {{COMB_D(0x82D3425A, 0xB8DDA8E6), COMB_D(0x223F7D93, 0x3581E3E9), COMB_D(0x86E0AD6A, 0x47F43EDE), COMB_D(0x27664FE0, 0x6371EEAE), 0},
+     {COMB_D(0xAA3860D0, 0x79EFB166), COMB_D(0x1CC94DC2, 0xB7C11705), COMB_D(0x39AFE7AE, 0xF801E32C), COMB_D(0x9FFDEC4B, 0x9045F50C), 0}},
+    {{COMB_D(0xA5C5E73A, 0x2EDBB6FA), COMB_D(0xF3EA7813, 0x6084F069), COMB_D(0x0B4460CE, 0xBEA1E880), COMB_D(0x70966A91, 0x47BEA907), 0},
+     {COMB_D(0x6345BEAE, 0x6F761872), COMB_D(0xF4E01327, 0x50C1F0ED), COMB_D(0x5AA68274, 0x9A01B7B5), COMB_D(0xC5C311A2, 0x4CA68679), 0}},
+    {{COMB_D(0x40FB6927, 0x8F47FFE6), COMB_D(0x6F5F8211, 0x0F49342E), COMB_D(0x0F4DF11B, 0xA0CD6413), COMB_D(0x175AA4BC, 0x2639A524), 0},
+     {COMB_D(0xDCAEEB34, 0x46C6BA37), COMB_D(0xF397D674, 0xCC120560), COMB_D(0xCE74CDC8, 0x988CF101), COMB_D(0x52248C9D, 0xC3E06B8C), 0}},
+    {{COMB_D(0xAF9957C4, 0x84C795BF), COMB_D(0x24EAB95C, 0xA212EACC), COMB_D(0xAF7959F7, 0x8AC755BB), COMB_D(0x43DF1539, 0xE96FD0A4), 0},
+     {COMB_D(0xC1DFC681, 0x79B1131A), COMB_D(0xA59A4489, 0x1F322B37), COMB_D(0xFAFD8FB6, 0x7AED06E5), COMB_D(0x30E211FA, 0x5DE54C37), 0}},
+    {{COMB_D(0x223F5A87, 0x10E54190), COMB_D(0x8D0C74BD, 0x364FE050), COMB_D(0x90E011A5, 0x738D6149), COMB_D(0xF25CC64C, 0xB4D0B6E7), 0},
+     {COMB_D(0xFF7C9AF1, 0xEDB24544), COMB_D(0x7698E268, 0x6EF9EF80), COMB_D(0x151F7BF8, 0xEB21BF44), COMB_D(0x6AAEFB13, 0x0D7272AF), 0}},
+    {{COMB_D(0x02EE0ACA, 0xB515E7A5), COMB_D(0xFFDC4E8B, 0x8FDB5519), COMB_D(0x30964E60, 0x1133F11A), COMB_D(0x473A471C, 0x29A7D6CA), 0},
+     {COMB_D(0x78D14728, 0x67923916), COMB_D(0x0C24535E, 0xA6C2026C), COMB_D(0x1565B23C, 0x01FD58A1), COMB_D(0x744B0A35, 0xDC9E4F64), 0}},
+    {{COMB_D(0x39F73A5A, 0x169DFDFA), COMB_D(0x5D1FDC73, 0x68BD8D4B), COMB_D(0xD494FB9A, 0x17EE0670), COMB_D(0xD3004BCA, 0xB3FAB814), 0},
+     {COMB_D(0x2A64B8F2, 0x414F8A01), COMB_D(0xC50EA4C8, 0x2F108ED8), COMB_D(0xF3D09750, 0x6D3BC5E1), COMB_D(0x1E5098AD, 0x60B100E6), 0}},
+    {{COMB_D(0x8AED1115, 0xAA62912A), COMB_D(0x2A8875A6, 0x5B60A67D), COMB_D(0x7B1CF68C, 0xE6D292F0), COMB_D(0xE15FCFB5, 0x80CDD5D7), 0},
+     {COMB_D(0x2356DB80, 0xDA745FC2), COMB_D(0x816DA1C0, 0x9570E93B), COMB_D(0x6B0FEEF6, 0x96EED586), COMB_D(0xC22B6503, 0xFD69F88A), 0}},
+    {{COMB_D(0x2BED2C71, 0x0FBE61E3), COMB_D(0x69E4E091, 0xAF12A504), COMB_D(0x08649C7C, 0x328453BF), COMB_D(0x8595F6BB, 0x05E7BA56), 0},
+     {COMB_D(0xD1B8C750, 0x707D3FE5), COMB_D(0x085ED9BF, 0x14762A52), COMB_D(0x00A38FF0, 0xE243ABF1), COMB_D(0x3488A9CD, 0x4ED552B4), 0}},
+    {{COMB_D(0xAA457339, 0x4A4908DA), COMB_D(0x215EA3F9, 0xB24CD414), COMB_D(0x42294F8E, 0x2AB2D4D0), COMB_D(0xAD748E7F, 0x3990FF78), 0},
+     {COMB_D(0xBA4EA725, 0x641D6B86), COMB_D(0xA75DD432, 0x124B0EA7), COMB_D(0x0AC380D9, 0xC1479247), COMB_D(0x09882005, 0xC3388433), 0}},
+    {{COMB_D(0xD5AC4A23, 0x27FE220E), COMB_D(0x2506238D, 0xD886FC6E), COMB_D(0x58BDB1B1, 0xB0F4F2E6), COMB_D(0xEDB24E21, 0x02F808DA), 0},
+     {COMB_D(0xF621DCEC, 0xEDC9754D), COMB_D(0xF619285D, 0x0F5AC51E), COMB_D(0x82491318, 0xA963D604), COMB_D(0x8386A110, 0x3B87771E), 0}},
+    {{COMB_D(0x9CA919D9, 0x2EB890B6), COMB_D(0x859D6625, 0x739DA581), COMB_D(0x7354BB80, 0xD556C297), COMB_D(0x2EC670AC, 0x423C9404), 0},
+     {COMB_D(0x6CE4A79F, 0x2AFE6E1B), COMB_D(0xC10EB84A, 0x55CF7612), COMB_D(0xBC6A239E, 0x7A013369), COMB_D(0xBE2A9F08, 0xEA6EAA37), 0}},
+    {{COMB_D(0x0C4D3C00, 0xC065D810), COMB_D(0x783FC92A, 0xD767BBDD), COMB_D(0x933D5B05, 0x88DC8E22), COMB_D(0xA26675B6, 0x18D0B0C7), 0},
+     {COMB_D(0xF2A373F5, 0x19929A17), COMB_D(0x411881DC, 0x07C05654), COMB_D(0x2F45C526, 0xA202760B), COMB_D(0x7D9DF9FD, 0xAFCEA651), 0}},
+    {{COMB_D(0xADFC4165, 0xEBD9C7CB), COMB_D(0x4074595B, 0x1AF27F95), COMB_D(0x09FC4492, 0x4549C625), COMB_D(0xB0F2442D, 0xDA0CE4F3), 0},
+     {COMB_D(0x0A2484EC, 0xD623F428), COMB_D(0x9377423B, 0x056D5B85), COMB_D(0x4360F95A, 0xB5ACAD05), COMB_D(0x25DC5808, 0x5254E2E0), 0}},
+    {{COMB_D(0xDA9024E9, 0xB2B7CA82), COMB_D(0xFA9FE016, 0xD53B23DB), COMB_D(0x6AB55AD2, 0xD286CDFB), COMB_D(0x8DDAB49B, 0x903AE53E), 0},
+     {COMB_D(0x18EB0794, 0xF223AE81), COMB_D(0x85854556, 0xAE8495D4), COMB_D(0xF4252A40, 0xAC9D99AC), COMB_D(0x601EE274, 0x64C87D22), 0}},
+    {{COMB_D(0x989C1D9B, 0x9B7BFD06), COMB_D(0x6B51633C, 0x4AA6495E), COMB_D(0x2A5AD552, 0xAB1A3143), COMB_D(0x43C10D0B, 0xE49DFE51), 0},
+     {COMB_D(0x6E6D99D3, 0xC4F69BA9), COMB_D(0x97020239, 0x595E6625), COMB_D(0x9E318D1F, 0x8D3E81AA), COMB_D(0xEA6F4675, 0xD63107D4), 0}},
+    {{COMB_D(0xC5DC82D1, 0x6E379E36), COMB_D(0x4F0ECC7D, 0x13411651), COMB_D(0x47EA38A9, 0xBD80C6FE), COMB_D(0x2342CDED, 0xAAD8FD26), 0},
+     {COMB_D(0x55772890, 0x489A2809), COMB_D(0xD9D00B77, 0xD82335C2), COMB_D(0x40E08BBB, 0xC1B6F3A3), COMB_D(0xE9A38E4B, 0xA7D8BFAD), 0}},
+    {{COMB_D(0x912D92F3, 0x06D731CB), COMB_D(0x4E904B41, 0x9B75190B), COMB_D(0x7FB1D9FD, 0xA1AEDB22), COMB_D(0x490C9764, 0xFA69E8D7), 0},
+     {COMB_D(0x8029CCCE, 0x55E986CF), COMB_D(0x0A4835F4, 0x2BBC56D3), COMB_D(0x961286E1, 0xC039D8A2), COMB_D(0xD7D3C284, 0xF1D8DAA4), 0}},
+    {{COMB_D(0xC16D3E0E, 0x67C43BE6), COMB_D(0x7F6D840C, 0x704F1C03), COMB_D(0x93F6F89C, 0x4F1CD715), COMB_D(0xA289FFA4, 0xD83ECE6D), 0},
+     {COMB_D(0xA1FD6119, 0x5C1CB0B3), COMB_D(0x328955B5, 0x3A1CFB7B), COMB_D(0x16CD63EF, 0x7669B9EA), COMB_D(0xD5220DB9, 0x7A44063F), 0}},
+    {{COMB_D(0x1C67A3F2, 0x4B0467AB), COMB_D(0x3AF2C198, 0x7E261D72), COMB_D(0xC0E694A3, 0xA62545F6), COMB_D(0xAE5727A0, 0x24A98777), 0},
+     {COMB_D(0x0613D312, 0x976839E0), COMB_D(0xFC763177, 0x88BF0629), COMB_D(0x7E638A95, 0x39314C37), COMB_D(0xA295E541, 0x9AC99391), 0}},
+    {{COMB_D(0x4EC101CF, 0x05F3F4E5), COMB_D(0x35D9F113, 0x972DB9C0), COMB_D(0x4426BA8F, 0xA6FE8CEE), COMB_D(0x9A6B77E7, 0xF67B17CB), 0},
+     {COMB_D(0x58ACC4F9, 0xD1A1B485), COMB_D(0xCC0FF914, 0x2970AAF3), COMB_D(0xE4778B64, 0x10AC12E8), COMB_D(0x202C8F6E, 0xD2ADBE40), 0}},
+    {{COMB_D(0x735495C8, 0x8A33B070), COMB_D(0xD3265DA1, 0xF66FD634), COMB_D(0x3CCBB14E, 0xEB704D94), COMB_D(0x4E337F16, 0x467A2535), 0},
+     {COMB_D(0x6A3043FA, 0x54F4A4C6), COMB_D(0x275CF6FA, 0x639EBE5D), COMB_D(0xB9F6E1B0, 0xC942F0AE), COMB_D(0x10C0B444, 0x1F515865), 0}},
+    {{COMB_D(0x84B01675, 0x61E996E9), COMB_D(0xBCEE8EE2, 0xE85E6D53), COMB_D(0xF91FC775, 0x9E62DE7C), COMB_D(0xABE6CFFB, 0x496FCEC1), 0},
+     {COMB_D(0xEE1A8C9F, 0x71B512CC), COMB_D(0x3C73295C, 0xC8B0BAA5), COMB_D(0x29E89CB5, 0x7DC762CC), COMB_D(0x2BACBFA2, 0xDC001907), 0}},
+    {{COMB_D(0x917B8017, 0xE5C115CC), COMB_D(0x45270670, 0x04587BCB), COMB_D(0x23ECE617, 0x09B14174), COMB_D(0x418505A3, 0x9FB7D184), 0},
+     {COMB_D(0x4CA5DFA8, 0x96310C2F), COMB_D(0xA950A74F, 0x6ECC307B), COMB_D(0x094E36A5, 0x1C6C5612), COMB_D(0xBC3B96CF, 0xD2F50751), 0}},
+    {{COMB_D(0x5AB169EA, 0xE4F6BA4B), COMB_D(0x3E54C28F, 0x1940BED6), COMB_D(0x78ACCC58, 0x7931C33D), COMB_D(0x958B9D6F, 0x2DCDF252), 0},
+     {COMB_D(0x5B4BF449, 0x7D4A1C60), COMB_D(0x099165BC, 0x6145AFAE), COMB_D(0xBC4626C0, 0xFFAA6133), COMB_D(0x76DFB1A0, 0x4739BD2E), 0}},
+    {{COMB_D(0x555427CC, 0xD4B1E291), COMB_D(0x45D0725F, 0x6C80FAFE), COMB_D(0xA5DE354D, 0x30496424), COMB_D(0x6BDD9443, 0x9E8640C2), 0},
+     {COMB_D(0x0B6A7E81, 0x4282EBEE), COMB_D(0x8C250428, 0xAFE7DC39), COMB_D(0x916D0E0F, 0x9500E2A8), COMB_D(0x914C703A, 0xAFAC24C4), 0}},
+    {{COMB_D(0x013021B4, 0x4E2A841A), COMB_D(0x70794A54, 0xD458E426), COMB_D(0x7CFD6C3B, 0xB0299814), COMB_D(0x69233A06, 0x07CD98C4), 0},
+     {COMB_D(0xC2019032, 0xDF7CE32D), COMB_D(0x22B66570, 0x2036F2D9), COMB_D(0x71135FC0, 0x5FBDD36A), COMB_D(0x68D97A99, 0x6BE684DA), 0}},
+    {{COMB_D(0x2A7EAC33, 0x6E93BEA5), COMB_D(0x6513D5F3, 0xEF5EF94E), COMB_D(0x503C96CE, 0xBA5B2E67), COMB_D(0xB72FDACC, 0xE878AD78), 0},
+     {COMB_D(0x43339DA1, 0x720F5610), COMB_D(0x632C7FAD, 0x48DCE288), COMB_D(0x4CE09B96, 0xCCDA5CE1), COMB_D(0x60EB62CE, 0xE819C728), 0}},
+    {{COMB_D(0xDC9274B3, 0xB003C0ED), COMB_D(0x755D0CD8, 0xE7BE5017), COMB_D(0x1637D9F4, 0xAA144661), COMB_D(0x8C1518AA, 0xBFCBBB7C), 0},
+     {COMB_D(0x0AABE45D, 0x8FB86295), COMB_D(0xE0DC576B, 0x8AF5F44A), COMB_D(0x7C0E5277, 0xA96324A1), COMB_D(0xFDE26E38, 0xFBA03CA4), 0}},
+    {{COMB_D(0xEE2ABAF8, 0x5B107064), COMB_D(0x9E94B6ED, 0x472E0261), COMB_D(0xAC83C3FF, 0x9372070F), COMB_D(0x860A81B9, 0xB6917A13), 0},
+     {COMB_D(0x5FA4A634, 0x546D449A), COMB_D(0x73B2F70A, 0x268CFA9A), COMB_D(0x1039A748, 0x69B14B0B), COMB_D(0xF5C12FEB, 0x56522F42), 0}},
+    {{COMB_D(0x7EC0FA5D, 0x9EDB4CF0), COMB_D(0x13574975, 0xB15FBCDA), COMB_D(0x0CBC2468, 0xF95216F7), COMB_D(0x921EC903, 0x037BD1DC), 0},
+     {COMB_D(0xD15133BB, 0x18AC4E2B), COMB_D(0x4891A3D4, 0xE50B2FCB), COMB_D(0x7246D692, 0x0C773C40), COMB_D(0xAC4CAD72, 0x1B8C1DB6), 0}},
+    {{COMB_D(0x3E80D086, 0x43580325), COMB_D(0xD0E557CE, 0x60EC2801), COMB_D(0xEC3A4C23, 0x0EAE4CF8), COMB_D(0x7002DD3B, 0x18A37376), 0},
+     {COMB_D(0x95FC9B10, 0xFBE11E59), COMB_D(0x51C965A5, 0xF56FE7B9), COMB_D(0x3B5B52A9, 0x4D2A0A7D), COMB_D(0x0D7DB31C, 0x0136EA67), 0}},
+    {{COMB_D(0xE004F92B, 0x8D5E8FBE), COMB_D(0xD76B6FFF, 0x3A8FE969), COMB_D(0xF72F40C9, 0x1A0F4122), COMB_D(0x4A57B0A4, 0x869C1672), 0},
+     {COMB_D(0x1C7311CD, 0xA33D2F76), COMB_D(0x8FD5D0F1, 0xBF7AAC77), COMB_D(0xD1C81243, 0xC661D26F), COMB_D(0xADE76216, 0x49E08973), 0}},
+    {{COMB_D(0x65308F49, 0x7A5930A0), COMB_D(0x728F6241, 0xDB1431F1), COMB_D(0x07C449E9, 0x1CF8E5C1), COMB_D(0x543B4FB8, 0xCD2F88D6), 0},
+     {COMB_D(0x5D9F72BE, 0x170B0D95), COMB_D(0x6716726E, 0x5665E566), COMB_D(0x2351E9C1, 0x943D4B4E), COMB_D(0xBE5BED00, 0x2E704AAA), 0}},
+    {{COMB_D(0x68EABCAF, 0xD7CE7AC1), COMB_D(0xA9B288A3, 0x2ABBAF4A), COMB_D(0x4F99E036, 0x7E51DF5E), COMB_D(0x0719DCCF, 0xE500BB1C), 0},
+     {COMB_D(0x29E9A59A, 0x9CB833B3), COMB_D(0x748620C3, 0x0B7C5221), COMB_D(0xCC445FDF, 0x842B0181), COMB_D(0x7C524638, 0x13892A7A), 0}},
+    {{COMB_D(0xA0068F17, 0x6C398789), COMB_D(0x60E92840, 0xA80793F5), COMB_D(0x32B50E82, 0x29C9C34C), COMB_D(0xC2715B3C, 0x724E0D7F), 0},
+     {COMB_D(0xB56F49CB, 0x2DAEA84E), COMB_D(0xC4230F7C, 0x51297B3E), COMB_D(0xD6D83DD8, 0x50299DC0), COMB_D(0xE516517B, 0x7AC06F77), 0}},
+    {{COMB_D(0xBC2BF195, 0x98DC40D9), COMB_D(0x6A499A11, 0x83F2FD0D), COMB_D(0x0CBD3E3B, 0x7662A7EA), COMB_D(0x86551B55, 0xA8FCB702), 0},
+     {COMB_D(0x189F59C4, 0x826164EF), COMB_D(0x5B22B852, 0xF078F3FB), COMB_D(0x2A201BDE, 0x015B2644), COMB_D(0xBBE2ADEC, 0xA9A1EA29), 0}},
+    {{COMB_D(0x29ACD32B, 0xEB1B0F19), COMB_D(0xCAA831E4, 0x102F6F3C), COMB_D(0x5E91A878, 0xB3B383BC), COMB_D(0x237ACAF4, 0xD3DC328C), 0},
+     {COMB_D(0xD1B36E8D, 0x5B91A144), COMB_D(0xF5961D28, 0x9FE87EF4), COMB_D(0xCECC5AA7, 0x6A48EF09), COMB_D(0x104256E2, 0x11458735), 0}},
+    {{COMB_D(0x7E4BB3EC, 0x92D294B4), COMB_D(0x1E7EE88F, 0x1150C794), COMB_D(0x295FED1B, 0xB874E7FE), COMB_D(0x57433D12, 0xB122F763), 0},
+     {COMB_D(0x4CB943E5, 0x5A4252EF), COMB_D(0xBFFCB5BD, 0x702AE9B4), COMB_D(0xE93DC0C9, 0x4F4786EF), COMB_D(0xB2395C13, 0x51BAAE7E), 0}},
+    {{COMB_D(0x79DA7671, 0xC40ED21D), COMB_D(0xF723BBCD, 0x4BB8C18A), COMB_D(0x208C69BC, 0x1C2B52C3), COMB_D(0xB9698CAF, 0x921C96A2), 0},
+     {COMB_D(0x75786C53, 0xBDCBDFC1), COMB_D(0x9B163491, 0x7B447A27), COMB_D(0xC434BBE8, 0x447C02A5), COMB_D(0x2021B48C, 0xA69FD156), 0}},
+    {{COMB_D(0xCF74E515, 0x8F9568BB), COMB_D(0xE91D4B9F, 0x60598BE9), COMB_D(0x939E7109, 0x6A5F4563), COMB_D(0x84E2894F, 0xF2BF7931), 0},
+     {COMB_D(0xC9276565, 0xCB6B3999), COMB_D(0x2BEF5C85, 0x65F8AC29), COMB_D(0xF44CC8B8, 0x4D1F178D), COMB_D(0x196E6033, 0xC8C3C6B0), 0}},
+    {{COMB_D(0xF1F447A4, 0xFEB2FA6E), COMB_D(0x6339D245, 0x92B28AA9), COMB_D(0x86BB4528, 0xEF77500F), COMB_D(0xD08840FF, 0xC262FE68), 0},
+     {COMB_D(0x3F0214DD, 0x881FDE63), COMB_D(0xA58F0684, 0xED06BE5A), COMB_D(0xC832008A, 0x422B5EBE), COMB_D(0x98EABD04, 0x795A3108), 0}},
+    {{COMB_D(0x06ABBA11, 0x9EBF3E13), COMB_D(0x08A87C61, 0x7BB87D42), COMB_D(0x000C1B45, 0x04DEAAC4), COMB_D(0x6AFEFFD8, 0x43A12FB0), 0},
+     {COMB_D(0x4DEC081A, 0xE073B764), COMB_D(0x0A8C80BD, 0x6D000327), COMB_D(0x2D01D4CE, 0xC252178A), COMB_D(0x48BF0728, 0x84CC32D4), 0}},
+    {{COMB_D(0xB7C38433, 0x2200387B), COMB_D(0x904DE68E, 0x39FDDB35), COMB_D(0xE0E222ED, 0x2B8EA7E1), COMB_D(0xD5B81E41, 0x1F6FC5DB), 0},
+     {COMB_D(0x80D34692, 0x612A0ADE), COMB_D(0x38A70957, 0x543C13E5), COMB_D(0xB8D4B615, 0xA8926A38), COMB_D(0x748FEB35, 0xADA1C509), 0}},
+    {{COMB_D(0xFD7E3364, 0xDFF26BAA), COMB_D(0xCAD4B3AC, 0x5C9838A9), COMB_D(0xF40500F8, 0x1527C84E), COMB_D(0xEB1F7A3D, 0x3CC8D6F8), 0},
+     {COMB_D(0x844F1824, 0x4045D69E), COMB_D(0x733D2D90, 0xB05A0203), COMB_D(0xB5DE6D92, 0x5CD1BCD0), COMB_D(0xFA7A181A, 0x14FE69C1), 0}},
+    {{COMB_D(0x63312DBF, 0x4B571407), COMB_D(0x3F97327F, 0xCAB658EA), COMB_D(0xC2E9D37E, 0x33CB69D1), COMB_D(0x3AB3994B, 0x51299DF2), 0},
+     {COMB_D(0x5C6B8BCA, 0x7BB88B0D), COMB_D(0xFCF3CE57, 0xF6957237), COMB_D(0xBF3D899F, 0x8E8412D9), COMB_D(0x4595A47B, 0x03D01CC9), 0}},
+    {{COMB_D(0xF3EF6808, 0xC31A80F5), COMB_D(0x0214F417, 0x54D17CF7), COMB_D(0x4DB2D9D4, 0x565F1FB7), COMB_D(0x6A202F03, 0xDE27432A), 0},
+     {COMB_D(0xDED416AD, 0xFA990A07), COMB_D(0x86B92225, 0x8876DBC1), COMB_D(0x26C13050, 0x003B2645), COMB_D(0xC5489B38, 0x14232B63), 0}},
+    {{COMB_D(0x1D851107, 0xF037D87F), COMB_D(0x41BA3FC4, 0x5703358B), COMB_D(0xE2A54A09, 0xD4589BA0), COMB_D(0xF8FA5280, 0xB29D497F), 0},
+     {COMB_D(0xA0AA02FE, 0x52BF37DB), COMB_D(0x5FD0E7D6, 0x377F80CF), COMB_D(0x3C149EB0, 0x4E990D44), COMB_D(0x4918B0F0, 0x257B051B), 0}},
+    {{COMB_D(0x266AFFDA, 0x6FA17128), COMB_D(0x85E2308D, 0x23E97953), COMB_D(0x210BF6ED, 0x76C70F0C), COMB_D(0x87A686D1, 0xCE165CB0), 0},
+     {COMB_D(0xA92EB667, 0xE361C49D), COMB_D(0xFFF191B2, 0xE19DC403), COMB_D(0x279494CC, 0xA6552BFC), COMB_D(0x3EC73FFB, 0x0608E100), 0}},
+    {{COMB_D(0xC9D4CCE2, 0xBACC2C7C), COMB_D(0xF185BED6, 0xBF8042D8), COMB_D(0xA82B476D, 0xC8D1DD38), COMB_D(0x23C17D8B, 0x5A81FE47), 0},
+     {COMB_D(0xA344D6E9, 0x7EA08CF1), COMB_D(0xDAEF9D37, 0x952FF329), COMB_D(0x9B33AFFB, 0x29328B1D), COMB_D(0x40BE2B9B, 0x0745FF8F), 0}},
+    {{COMB_D(0x2B316206, 0x5F248E1A), COMB_D(0x61DB3BB3, 0xE00025F8), COMB_D(0xD616DBE8, 0x2324DB9B), COMB_D(0x91EFA00B, 0x7B9E3C4F), 0},
+     {COMB_D(0x6844BAEE, 0x87B220A4), COMB_D(0x852170C9, 0x6D39BAF2), COMB_D(0xF5B04A6C, 0x90C06025), COMB_D(0xEB7020F6, 0xDA6C7DBB), 0}},
+    {{COMB_D(0x6BA91696, 0x8FDAE067), COMB_D(0x5EDCF7FB, 0x8C7BD930), COMB_D(0xC0E0A6EC, 0xD47B7670), COMB_D(0x33032546, 0x454DAF5C), 0},
+     {COMB_D(0xA0C648DF, 0x83680E0C), COMB_D(0xF6A15B67, 0x362A45BB), COMB_D(0xB9D7A4B7, 0xBA8EBC8D), COMB_D(0xC88FE5AB, 0xB7F2662B), 0}},
+    {{COMB_D(0xF48F7D62, 0x4598CD70), COMB_D(0x770D293E, 0x639D4504), COMB_D(0x639E07BB, 0x1EBD9267), COMB_D(0x3B5B691B, 0x6EE50817), 0},
+     {COMB_D(0xA0CA8A6E, 0x6B1DE0C9), COMB_D(0x89190B17, 0x15EA15A9), COMB_D(0xE6AE285C, 0x1F0F620C), COMB_D(0x716FE61B, 0x3CAF43F6), 0}},
+    {{COMB_D(0xC9D16F0D, 0xDEEEFDEE), COMB_D(0xD946EE6F, 0x9DA4A064), COMB_D(0x6171C467, 0x7F23542B), COMB_D(0x6965414F, 0x1912A6EF), 0},
+     {COMB_D(0x1974D027, 0x8FF07D8B), COMB_D(0x8740E8C3, 0x44948493), COMB_D(0x88320388, 0x738B42DE), COMB_D(0x0B42E598, 0xB2D79A24), 0}},
+    {{COMB_D(0xF404673E, 0x0EAD96C4), COMB_D(0xC5466091, 0xFB7AEE39), COMB_D(0xF9E161A2, 0x19EAF2F9), COMB_D(0x18E3D33C, 0x9BC5CBC4), 0},
+     {COMB_D(0xF91E6E51, 0x04BCE84F), COMB_D(0xE145D2BB, 0x9233BF3E), COMB_D(0xA9EBBFF8, 0x4AA4E21D), COMB_D(0xE8599A84, 0x21E7D500), 0}},
+    {{COMB_D(0xD06792A8, 0x8662E6CD), COMB_D(0xC17274C4, 0x5BB5EB1F), COMB_D(0xDA59B565, 0xEE886926), COMB_D(0x9597DB7B, 0x9C43A252), 0},
+     {COMB_D(0x264C4050, 0x96C625BC), COMB_D(0xF8A69875, 0x7456B81D), COMB_D(0xEE7CF15F, 0x405B6EEC), COMB_D(0x3C85DB5B, 0x7DB30676), 0}},
+    {{COMB_D(0x5EDF710F, 0xD1CE6C0C), COMB_D(0x79840D17, 0x256C7866), COMB_D(0x82A651DD, 0xD3D10BFE), COMB_D(0x22D28D69, 0xFBE22420), 0},
+     {COMB_D(0x86B74719, 0x0C004524), COMB_D(0x2DF2FCB1, 0xDB4FC06E), COMB_D(0x4FDFF16E, 0x23EB5FAF), COMB_D(0xBDC64220, 0x7CBA639C), 0}},
+    {{COMB_D(0xF0535FBB, 0xA8767F56), COMB_D(0x2EBC7F4B, 0x51F15324), COMB_D(0x1BF4B322, 0x8863B80E), COMB_D(0x99D40899, 0x29BD6CE1), 0},
+     {COMB_D(0x6F4B9349, 0xA1F97549), COMB_D(0xFE21EFE7, 0x5464A696), COMB_D(0xB6463965, 0x2B7D1777), COMB_D(0xE6617187, 0x7D79D9CD), 0}},
+    {{COMB_D(0xF6A83683, 0x485DAA3A), COMB_D(0x74C5F311, 0x9ADC111D), COMB_D(0x7095CF61, 0x1E7A8882), COMB_D(0xCDE25DDD, 0x0698FFD5), 0},
+     {COMB_D(0x62653ECA, 0x4A4970BF), COMB_D(0xDF624C4F, 0x4C37AE32), COMB_D(0xE9D4B8CB, 0xF42BD954), COMB_D(0x1A2A9C9F, 0x7D42D0FF), 0}},
+    {{COMB_D(0xB3A2DB21, 0x05E0206C), COMB_D(0x0DEEEE13, 0x42B9D040), COMB_D(0x0E6A77A5, 0x317347E2), COMB_D(0x5CBB5DDB, 0x46D350DB), 0},
+     {COMB_D(0x1734FF86, 0x67FECBED), COMB_D(0xF3412F32, 0x58F9AD9A), COMB_D(0xF3A2F930, 0x41BEEFFB), COMB_D(0x3611ACC1, 0x6ED94972), 0}},
+    {{COMB_D(0xB872386D, 0x4FABE31F), COMB_D(0x249838F9, 0x3A08AEBF), COMB_D(0x028FA9B5, 0xED8517D4), COMB_D(0x04024305, 0xE75B6016), 0},
+     {COMB_D(0xBC16BE7B, 0xDB281437), COMB_D(0xEDF5F054, 0x158195F5), COMB_D(0x2FAF3F6A, 0x0D3C5493), COMB_D(0x5ADD817B, 0x0F49078E), 0}},
+    {{COMB_D(0x1EFCB4A8, 0x07CDA53A), COMB_D(0x4BE32A34, 0x8D19747F), COMB_D(0x925A165B, 0x6BDF50F3), COMB_D(0x97F8385A, 0x31E45D77), 0},
+     {COMB_D(0x2976F2B2, 0x41B97F42), COMB_D(0xA94E88F1, 0x9B7E6B38), COMB_D(0xE9BA0AF6, 0xC640B19C), COMB_D(0x1A534BE2, 0xF2EC7F76), 0}},
+    {{COMB_D(0x1D3BA3F6, 0xFEB69F58), COMB_D(0xACDF2129, 0xA907EC44), COMB_D(0xF7E1612B, 0xCFE00C6A), COMB_D(0xACDA5DB9, 0x03CB3952), 0},
+     {COMB_D(0x03F7E973, 0x009A688C), COMB_D(0x639192C5, 0x61193079), COMB_D(0xA6E57B63, 0x8A4DAC17), COMB_D(0x9197AD69, 0x3CB671CA), 0}},
+    {{COMB_D(0x37863B24, 0xFABBDE65), COMB_D(0x7CFC42EF, 0xE87CE985), COMB_D(0xADC9F5A4, 0xCFCD3275), COMB_D(0x3744C04D, 0x568BA7F1), 0},
+     {COMB_D(0xD3077595, 0x0A8D6B59), COMB_D(0xC6005CCE, 0xF8744D67), COMB_D(0xC3A2C0AB, 0x7224A589), COMB_D(0xA983C0A0, 0x3727A017), 0}},
+    {{COMB_D(0xDA60C424, 0x2C3AC9D6), COMB_D(0x5A47AB50, 0xA3FEEFF0), COMB_D(0x0395C4C1, 0x0BEA2673), COMB_D(0x9C9B1B39, 0xC07E1254), 0},
+     {COMB_D(0x563111C5, 0x4E82175A), COMB_D(0xF4A0F6FF, 0x830921AF), COMB_D(0x81B48A73, 0x1C69FAB4), COMB_D(0x18D6F670, 0xFAC55B44), 0}},
+    {{COMB_D(0x95C9D2E4, 0xA1E24407), COMB_D(0xBDC68A59, 0xF914031A), COMB_D(0x5CF8D268, 0x90CCA262), COMB_D(0xE08D05CF, 0x3896F66C), 0},
+     {COMB_D(0x02E8C5C3, 0x70D67CBF), COMB_D(0xD00132CE, 0x3AF6D520), COMB_D(0x99D91EB9, 0xB4504E4F), COMB_D(0xD3B067D8, 0x0857DA8A), 0}},
+    {{COMB_D(0x8A17D814, 0x543723FF), COMB_D(0xE3D4A7C6, 0xB6E85D34), COMB_D(0x43D76206, 0x1D98D26D), COMB_D(0x163F8DC1, 0xF7E6AD6B), 0},
+     {COMB_D(0x8B53290F, 0x9CEEBA02), COMB_D(0x894FFDED, 0x81CC90C8), COMB_D(0x656BF6A9, 0xF22F6366), COMB_D(0x29482519, 0x720C5C6A), 0}},
+    {{COMB_D(0x737D5720, 0x33A27A94), COMB_D(0x3A14589D, 0xFC6466E3), COMB_D(0xF7717930, 0xF7EF65B6), COMB_D(0x48700F76, 0x5F794EF7), 0},
+     {COMB_D(0x7FB6F908, 0x8FD359CE), COMB_D(0x34A9E42F, 0xF2DBEBAD), COMB_D(0xE80045A9, 0xADADF5D4), COMB_D(0xACC51C8A, 0x077147EA), 0}},
+    {{COMB_D(0x1FBDCDF2, 0xCD649918), COMB_D(0x612E9BA6, 0x901B64FB), COMB_D(0xE6125E9A, 0x9568C6F6), COMB_D(0x81E7462D, 0xE643922A), 0},
+     {COMB_D(0x11F09578, 0xE4BC55D3), COMB_D(0x0C023F0C, 0x9A7DE7A3), COMB_D(0x0B2877E8, 0x82E7715A), COMB_D(0x5E018C78, 0xB2DD5238), 0}},
+    {{COMB_D(0xB0ADD135, 0x786761F7), COMB_D(0xDEF377F9, 0xC41FD62B), COMB_D(0x45439721, 0x5A7A9FB5), COMB_D(0x5D5B18C2, 0x51F0CD7A), 0},
+     {COMB_D(0x8E1AA8E9, 0xEC8E88AC), COMB_D(0xDD086BDF, 0x06414382), COMB_D(0x4E3DDB17, 0x0E54A72A), COMB_D(0x8D24C8AB, 0x13DAF049), 0}},
+    {{COMB_D(0xC88EA06E, 0x31455E1E), COMB_D(0x55E596A3, 0xEC2F2908), COMB_D(0x0974861B, 0xD4A9219C), COMB_D(0xF79D4228, 0x470FBBAE), 0},
+     {COMB_D(0xEF28FEE5, 0x75854F72), COMB_D(0x2579C407, 0x9040BACA), COMB_D(0x94450ADE, 0xA3756ACE), COMB_D(0x8C5E25E6, 0xE19C44E2), 0}},
+    {{COMB_D(0x5EEF7C55, 0x4D26347F), COMB_D(0x782DE27B, 0xF40FF126), COMB_D(0x8B0F5866, 0x29C99B14), COMB_D(0xA909460D, 0x89FF3D55), 0},
+     {COMB_D(0x2C9DBDD5, 0x17DDCBC7), COMB_D(0xE2A53904, 0x95B1B74D), COMB_D(0xFB13E828, 0x3BA4E2A9), COMB_D(0x46E92CD3, 0x62DA15CD), 0}},
+    {{COMB_D(0x906D33E2, 0x69E673F8), COMB_D(0xD4533F34, 0x95080590), COMB_D(0x0E3D3FA5, 0x815C1869), COMB_D(0x206F0331, 0x2C134341), 0},
+     {COMB_D(0x88C88BE4, 0x30E0BB48), COMB_D(0xB37ECDC1, 0xCFF95413), COMB_D(0x7C5D2C69, 0x8CE58E32), COMB_D(0x138DC5CE, 0x1610C019), 0}},
+  },
+};
+
+#undef COMB_D
+
+#endif /* __SECP256R1_COMB_H__ */
@@ -11,8 +11,16 @@
  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
  * See the License for the specific language governing permissions and
  * limitations under the License.
- *****************************************************************************/
+******************************************************************************
+* CHANGES AUTHOR   : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CHANGES HISTORY  :
+*   10/19/2026 - Added JwtSigner: curve/ECDSA state set up once per key, token
+*     built in a fixed buffer with a table-driven base64url encoder.
+*   10/19/2026 - Added PayloadVerifier for payloads signed by a pinned backend
+*     key, and base64url_decode.
+*****************************************************************************/
 
+#include <ctype.h>
 #include <stdio.h>
 
 #include "crypto/ecdsa.h"
@@ -20,55 +28,80 @@
 #include "crypto/sha256.h"
 #include "jwt.h"
 
-// base64_encode copied from https://github.com/ReneNyffenegger/cpp-base64
+// URL-safe alphabet, no padding (JWT)
 static const char base64_chars[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
     "abcdefghijklmnopqrstuvwxyz"
     "0123456789-_";
 
-String base64_encode(const unsigned char *bytes_to_encode,
-                     unsigned int in_len) {
-  String ret;
-  int i = 0;
-  int j = 0;
-  unsigned char char_array_3[3];
-  unsigned char char_array_4[4];
-
-  while (in_len--) {
-    char_array_3[i++] = *(bytes_to_encode++);
-    if (i == 3) {
-      char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-      char_array_4[1] =
-          ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-      char_array_4[2] =
-          ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-      char_array_4[3] = char_array_3[2] & 0x3f;
-
-      for (i = 0; (i < 4); i++) {
-        ret += base64_chars[char_array_4[i]];
-      }
-      i = 0;
-    }
+// Encodes in_len bytes into out without padding, returns the chars written.
+// out must hold (in_len * 4 + 2) / 3 bytes.
+size_t base64url_encode(const unsigned char *in, size_t in_len, char *out) {
+  char *p = out;
+  while (in_len >= 3) {
+    uint32_t v = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8) | in[2];
+    *p++ = base64_chars[(v >> 18) & 0x3f];
+    *p++ = base64_chars[(v >> 12) & 0x3f];
+    *p++ = base64_chars[(v >> 6) & 0x3f];
+    *p++ = base64_chars[v & 0x3f];
+    in += 3;
+    in_len -= 3;
   }
+  if (in_len == 2) {
+    uint32_t v = ((uint32_t)in[0] << 16) | ((uint32_t)in[1] << 8);
+    *p++ = base64_chars[(v >> 18) & 0x3f];
+    *p++ = base64_chars[(v >> 12) & 0x3f];
+    *p++ = base64_chars[(v >> 6) & 0x3f];
+  } else if (in_len == 1) {
+    uint32_t v = (uint32_t)in[0] << 16;
+    *p++ = base64_chars[(v >> 18) & 0x3f];
+    *p++ = base64_chars[(v >> 12) & 0x3f];
+  }
+  return p - out;
+}
 
-  if (i) {
-    for (j = i; j < 3; j++) {
-      char_array_3[j] = '\0';
-    }
-
-    char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-    char_array_4[1] =
-        ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-    char_array_4[2] =
-        ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-    char_array_4[3] = char_array_3[2] & 0x3f;
+static int base64url_value(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '-') return 62;
+  if (c == '_') return 63;
+  return -1;
+}
 
-    for (j = 0; (j < i + 1); j++) {
-      ret += base64_chars[char_array_4[j]];
+// Decodes unpadded base64url, returns the bytes written or (size_t)-1 on a
+// character outside the alphabet or an impossible length.
+// out must hold in_len * 3 / 4 bytes.
+size_t base64url_decode(const char *in, size_t in_len, unsigned char *out) {
+  unsigned char *p = out;
+  uint32_t v = 0;
+  int bits = 0;
+  if (in_len % 4 == 1) {
+    return (size_t)-1;
+  }
+  for (size_t i = 0; i < in_len; i++) {
+    int c = base64url_value(in[i]);
+    if (c < 0) {
+      return (size_t)-1;
+    }
+    v = (v << 6) | c;
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      *p++ = (unsigned char)(v >> bits);
     }
   }
+  return p - out;
+}
 
-  return ret;
+String base64_encode(const unsigned char *bytes_to_encode,
+                     unsigned int in_len) {
+  char out[JWT_MAX_LENGTH];
+  if ((in_len * 4 + 2) / 3 >= sizeof(out)) {
+    return String();
+  }
+  out[base64url_encode(bytes_to_encode, in_len, out)] = '\0';
+  return String(out);
 }
 
 String base64_encode(String str) {
@@ -88,35 +121,82 @@ String MakeBase64Signature(NN_DIGIT *signature_r, NN_DIGIT *signature_s) {
   return base64_encode(signature, 64);
 }
 
-String CreateJwt(const char *project_id, long long int time, NN_DIGIT *priv_key, int jwt_exp_secs) {
-  ecc_init();
-  // Making jwt token json
+// header: base64_encode("{\"alg\":\"ES256\",\"typ\":\"JWT\"}") + "."
+static const char jwt_header[] = "eyJhbGciOiJFUzI1NiIsInR5cCI6IkpXVCJ9.";
 
-  // payload
-  String payload = String("{\"iat\":") + (int) time
-    + ",\"exp\":" + (int) (time + jwt_exp_secs)
-    + ",\"aud\":\"" + project_id + "\"}";
+static bool curve_ready = false;
 
-  // header: base64_encode("{\"alg\":\"ES256\",\"typ\":\"JWT\"}") + "."
-  String header_payload_base64 =
-      "eyJhbGciOiJFUzI1NiIsInR5cCI6IkpXVCJ9." + base64_encode(payload);
+JwtSigner::JwtSigner() : length(0) {
+  buffer[0] = '\0';
+}
+
+// Curve parameters and the base point table are shared by every key and built
+// only once. Signing needs nothing derived from the key, so no public key or
+// verification table is computed here.
+void JwtSigner::begin(const NN_DIGIT *priv_key) {
+  if (!curve_ready) {
+    ecc_init();
+    curve_ready = true;
+  }
+  ecdsa_sign_init();
+  NN_Assign(key, (NN_DIGIT *)priv_key, NUMWORDS);
+  length = 0;
+  buffer[0] = '\0';
+}
+
+// Returns the token length, 0 if it does not fit in JWT_MAX_LENGTH
+size_t JwtSigner::sign(const char *project_id, long long int time, int jwt_exp_secs) {
+  char payload[JWT_MAX_LENGTH / 2];
+  int payload_len = snprintf(payload, sizeof(payload),
+      "{\"iat\":%d,\"exp\":%d,\"aud\":\"%s\"}",
+      (int) time, (int) (time + jwt_exp_secs), project_id);
+  size_t header_len = sizeof(jwt_header) - 1;
+  size_t signed_len = header_len + (payload_len * 4 + 2) / 3;
+
+  length = 0;
+  buffer[0] = '\0';
+  if (payload_len < 0 || payload_len >= (int) sizeof(payload) ||
+      signed_len + 1 + 86 + 1 > JWT_MAX_LENGTH) {
+    return 0;
+  }
+
+  memcpy(buffer, jwt_header, header_len);
+  base64url_encode((const unsigned char *)payload, payload_len, buffer + header_len);
 
   Sha256 sha256Instance;
-  sha256Instance.update((const unsigned char *)header_payload_base64.c_str(), header_payload_base64.length());
+  sha256Instance.update((const unsigned char *)buffer, signed_len);
   unsigned char sha256[SHA256_DIGEST_LENGTH];
   sha256Instance.final(sha256);
 
-  // Signing sha with ec key. Bellow is the ec private key.
-  point_t pub_key;
-  ecc_gen_pub_key(priv_key, &pub_key);
+  NN_DIGIT signature_r[NUMWORDS], signature_s[NUMWORDS];
+  ecdsa_sign((uint8_t *)sha256, signature_r, signature_s, key);
 
-  ecdsa_init(&pub_key);
+  unsigned char signature[64];
+  NN_Encode(signature, (NUMWORDS - 1) * NN_DIGIT_LEN, signature_r,
+            (NN_UINT)(NUMWORDS - 1));
+  NN_Encode(signature + (NUMWORDS - 1) * NN_DIGIT_LEN,
+            (NUMWORDS - 1) * NN_DIGIT_LEN, signature_s,
+            (NN_UINT)(NUMWORDS - 1));
 
-  NN_DIGIT signature_r[NUMWORDS], signature_s[NUMWORDS];
-  ecdsa_sign((uint8_t *)sha256, signature_r, signature_s, priv_key);
+  buffer[signed_len] = '.';
+  length = signed_len + 1 + base64url_encode(signature, 64, buffer + signed_len + 1);
+  buffer[length] = '\0';
+  return length;
+}
+
+const char *JwtSigner::token() {
+  return buffer;
+}
+
+size_t JwtSigner::tokenLength() {
+  return length;
+}
 
-  return header_payload_base64 + "." +
-         MakeBase64Signature(signature_r, signature_s);
+String CreateJwt(const char *project_id, long long int time, NN_DIGIT *priv_key, int jwt_exp_secs) {
+  JwtSigner signer;
+  signer.begin(priv_key);
+  signer.sign(project_id, time, jwt_exp_secs);
+  return String(signer.token());
 }
 
 String CreateJwt(String &project_id, long long int time, NN_DIGIT *priv_key, int jwt_exp_secs) {
@@ -126,3 +206,100 @@ String CreateJwt(String &project_id, long long int time, NN_DIGIT *priv_key, int
 String CreateJwt(String &project_id, long long int time, NN_DIGIT *priv_key) {
   return CreateJwt(project_id, time, priv_key, 3600); // one hour default
 }
+
+PayloadVerifier::PayloadVerifier() : ready(false) {
+}
+
+// pub_key is the uncompressed point "04:xx:..." as printed by
+//   openssl ec -pubin -in <public-key.pem> -noout -text
+// The key must lie on the curve, otherwise every payload is rejected.
+bool PayloadVerifier::begin(const char *pub_key) {
+  unsigned char key_bytes[65];
+  int n = 0;
+  ready = false;
+
+  while (*pub_key && n < 65) {
+    if (isxdigit((unsigned char)pub_key[0]) && isxdigit((unsigned char)pub_key[1])) {
+      char hex[3] = {pub_key[0], pub_key[1], '\0'};
+      key_bytes[n++] = strtoul(hex, NULL, 16);
+      pub_key += 2;
+    } else {
+      pub_key++;  // ':', spaces and line breaks
+    }
+  }
+  if (n != 65 || key_bytes[0] != 0x04) {
+    return false;
+  }
+
+  NN_Decode(key.x, NUMWORDS - 1, key_bytes + 1, 32);
+  NN_Decode(key.y, NUMWORDS - 1, key_bytes + 33, 32);
+  key.x[NUMWORDS - 1] = 0;
+  key.y[NUMWORDS - 1] = 0;
+
+  if (!curve_ready) {
+    ecc_init();
+    curve_ready = true;
+  }
+
+  // y^2 = x^3 + ax + b = x(x^2 + a) + b
+  curve_params_t *param = ecc_get_param();
+  NN_DIGIT lhs[NUMWORDS], rhs[NUMWORDS];
+  if (NN_Cmp(key.x, param->p, NUMWORDS) >= 0 ||
+      NN_Cmp(key.y, param->p, NUMWORDS) >= 0) {
+    return false;
+  }
+  NN_ModSqrOpt(lhs, key.y, param->p, param->omega, NUMWORDS);
+  NN_ModSqrOpt(rhs, key.x, param->p, param->omega, NUMWORDS);
+  NN_ModAdd(rhs, rhs, param->E.a, param->p, NUMWORDS);
+  NN_ModMultOpt(rhs, rhs, key.x, param->p, param->omega, NUMWORDS);
+  NN_ModAdd(rhs, rhs, param->E.b, param->p, NUMWORDS);
+  if (NN_Cmp(lhs, rhs, NUMWORDS) != 0) {
+    return false;
+  }
+
+  ecdsa_key_init(&key, table);
+  ready = true;
+  return true;
+}
+
+// On success body_len is the length of the signed body at the start of
+// payload. The signature is split at the last '.', base64url has no dots.
+bool PayloadVerifier::verify(const char *payload, size_t length, size_t *body_len) {
+  if (!ready) {
+    return false;
+  }
+
+  const char *dot = NULL;
+  for (size_t i = length; i > 0; i--) {
+    if (payload[i - 1] == '.') {
+      dot = payload + i - 1;
+      break;
+    }
+  }
+  if (dot == NULL) {
+    return false;
+  }
+
+  size_t sig_len = length - (dot - payload) - 1;
+  unsigned char signature[64];
+  if (sig_len != 86 || base64url_decode(dot + 1, sig_len, signature) != 64) {
+    return false;
+  }
+
+  Sha256 sha256Instance;
+  sha256Instance.update((const unsigned char *)payload, dot - payload);
+  unsigned char sha256[SHA256_DIGEST_LENGTH];
+  sha256Instance.final(sha256);
+
+  NN_DIGIT signature_r[NUMWORDS], signature_s[NUMWORDS];
+  NN_Decode(signature_r, NUMWORDS - 1, signature, 32);
+  NN_Decode(signature_s, NUMWORDS - 1, signature + 32, 32);
+  signature_r[NUMWORDS - 1] = 0;
+  signature_s[NUMWORDS - 1] = 0;
+
+  if (ecdsa_verify_key((uint8_t *)sha256, signature_r, signature_s, table) != 1) {
+    return false;
+  }
+  *body_len = dot - payload;
+  return true;
+}
@@ -18,6 +18,49 @@
 
 #include <Arduino.h>
 #include "crypto/nn.h"
+#include "crypto/ecc.h"
+#include "crypto/ecdsa.h"
+
+// Room for header, payload with a project id up to 64 chars and signature
+#define JWT_MAX_LENGTH 384
+
+// Signs ES256 JWTs for one private key. The curve and ECDSA state is set up
+// once in begin(), so each sign() is a single ecdsa_sign plus SHA-256, and the
+// token is written into a fixed buffer.
+class JwtSigner {
+ private:
+  NN_DIGIT key[NUMWORDS];
+  char buffer[JWT_MAX_LENGTH];
+  size_t length;
+
+ public:
+  JwtSigner();
+
+  void begin(const NN_DIGIT *priv_key);
+  size_t sign(const char *project_id, long long int time, int jwt_exp_secs);
+  const char *token();
+  size_t tokenLength();
+};
+
+// Checks payloads signed by a backend key pinned in the firmware. A signed
+// payload is "<body>.<signature>", the signature being the base64url ES256
+// r||s over the body bytes, encoded as in a JWT. begin() loads the key into
+// the ECDSA verify table, so call it once before any task signs or verifies.
+class PayloadVerifier {
+ private:
+  point_t key;
+  point_t table[ECDSA_KEY_POINTS];  // wNAF multiples of key, per verifier
+  bool ready;
+
+ public:
+  PayloadVerifier();
+
+  bool begin(const char *pub_key);
+  bool verify(const char *payload, size_t length, size_t *body_len);
+};
+
+size_t base64url_encode(const unsigned char *in, size_t in_len, char *out);
+size_t base64url_decode(const char *in, size_t in_len, unsigned char *out);
 
 String CreateJwt(String &project_id, long long int time, NN_DIGIT *priv_key);
 String CreateJwt(String &project_id, long long int time, NN_DIGIT *priv_key, int jwt_exp_secs);
@@ -0,0 +1,407 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Decoding of LoRa frames into the JSON records sent to the cloud
+*****************************************************************************/
+
+#include "RecordFormat.h"
+
+#define ADS8668_LSB 0.0025  // V per code, 0 to 10.24 V range
+
+static float dlCurrent = 2;
+static float dlVoltage400 = 40;
+static float dlVoltage500 = 50;
+static float dlPower = 3600;
+
+void setDataLoggerCalibration(float current, float voltage400, float voltage500, float power){
+  dlCurrent = current;
+  dlVoltage400 = voltage400;
+  dlVoltage500 = voltage500;
+  dlPower = power;
+}
+
+//Raw code of channel 8*device + channel converted with the same transducers
+//the datalogger uses: devices 0, 1 and channels 20-23 are currents, 25 the
+//500 V divider, the rest up to device 4 the 400 V divider and device 5 the
+//power transducers
+static float channelValue(int id, uint16_t code){
+  int device = id/8;
+  int channel = id%8;
+  float volts = code*ADS8668_LSB;
+
+  if(device < 2 || (device == 2 && channel < 4)){
+    return volts*dlCurrent;
+  }
+  if(device == 2 && channel == 5){
+    return volts*dlVoltage500;
+  }
+  if(device < 5){
+    return volts*dlVoltage400;
+  }
+  return -(volts*dlPower - 9000.0);
+}
+
+//Record sizes in bytes, from the header to the last field
+#define STATION_SIZE     15
+#define WEATHER_SIZE     18
+#define DATALOGGER_SIZE  14
+#define STATS_SIZE       (8 + 5*(1 + 1 + 2 + 2 + 3))
+#define CHANNELS_HEADER  (6 + LPP_MAP_SIZE)
+#define EVENT_HEADER     24
+#define DIAG_SIZE        (6 + DIAG_STAGES*(5 + 2*DIAG_BUCKETS))
+
+static int mapChannels(uint64_t map){
+  int channels = 0;
+  for(int bit = 0; bit < 8*LPP_MAP_SIZE; bit++){
+    channels += (map >> bit) & 1;
+  }
+  return channels;
+}
+
+//Bytes of count 12 bit codes packed in pairs of 3 bytes
+static int packedSize(int count){
+  return (count*3 + 1)/2;
+}
+
+DateTime recordDate(DataEncDec &decoder, char* received){
+  return DateTime(decoder.getDate(received[1], received[2], received[3], received[4]));
+}
+
+String stationRecord(DataEncDec &decoder, char* received, int size){
+  if(size < RECORD_MIN_SIZE){
+    return String();
+  }
+  if(decoder.getRecordType(received[0], received[5]) == RECORD_WEATHER){
+    return weatherRecord(decoder, received, size);
+  }
+  if(size < STATION_SIZE){
+    return String();
+  }
+  DateTime now = recordDate(decoder, received);
+  float temp = decoder.getTemp(received[5], received[6]);
+  int humi = decoder.getHumi(received[7]);
+  float irrad = decoder.getIrrad(received[8], received[9]);
+  float windSpeed = decoder.getWindSpeed(received[10]);
+  int windDirection = decoder.getWindDirection(received[11]);
+  float rain = decoder.getRain(received[12]);
+  float pvtemp = decoder.getTemp(received[13], received[14]);
+
+  return "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
+         "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
+         "\",\"AMB_TEMPERATURE\": "+String(temp)+
+         ",\"PRESSURE\": 0"+
+         ",\"HUMIDITY\": "+String(humi)+
+         ",\"IRRADIANCE\": "+String(irrad)+
+         ",\"WIND_SPEED\": "+String(windSpeed)+
+         ",\"WIND_DIRECTION\": "+String(windDirection)+
+         ",\"RAIN\": "+String(rain)+
+         ",\"PV_TEMPERATURE\": "+String(pvtemp)+"}";
+}
+
+// Station average with the 3 s gust and the vector mean wind direction
+String weatherRecord(DataEncDec &decoder, char* received, int size){
+  if(size < WEATHER_SIZE){
+    return String();
+  }
+  DateTime now = recordDate(decoder, received);
+  float temp = decoder.getTemp(received[6], received[7]);
+  int humi = decoder.getHumi(received[8]);
+  float irrad = decoder.getIrrad(received[9], received[10]);
+  float windSpeed = decoder.getWindSpeed(received[11]);
+  float windGust = decoder.getWindSpeed(received[12]);
+  int windDirection = decoder.getWindDegrees(received[13], received[14]);
+  float rain = decoder.getRain(received[15]);
+  float pvtemp = decoder.getTemp(received[16], received[17]);
+
+  return "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
+         "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
+         "\",\"AMB_TEMPERATURE\": "+String(temp)+
+         ",\"PRESSURE\": 0"+
+         ",\"HUMIDITY\": "+String(humi)+
+         ",\"IRRADIANCE\": "+String(irrad)+
+         ",\"WIND_SPEED\": "+String(windSpeed)+
+         ",\"WIND_GUST\": "+String(windGust)+
+         ",\"WIND_DIRECTION\": "+String(windDirection)+
+         ",\"RAIN\": "+String(rain)+
+         ",\"PV_TEMPERATURE\": "+String(pvtemp)+"}";
+}
+
+String dataLoggerRecord(DataEncDec &decoder, char* received, int size){
+  if(size < RECORD_MIN_SIZE){
+    return String();
+  }
+  if(decoder.getRecordType(received[0], received[5]) == RECORD_STATS){
+    return dataLoggerStatsRecord(decoder, received, size);
+  }
+  if(decoder.getRecordType(received[0], received[5]) == RECORD_CHANNELS){
+    return dataLoggerChannelsRecord(decoder, received, size);
+  }
+  if(decoder.getRecordType(received[0], received[5]) == RECORD_EVENT){
+    return dataLoggerEventRecord(decoder, received, size);
+  }
+  if(size < DATALOGGER_SIZE){
+    return String();
+  }
+
+  DateTime now = recordDate(decoder, received);
+  float current1 = decoder.getCurrent(received[5]);
+  float current2 = decoder.getCurrent(received[6]);
+  float voltage1 = decoder.getVoltage(received[7], received[8]);
+  float voltage2 = decoder.getVoltage(received[9], received[10]);
+  float power = decoder.getPower(received[11], received[12], received[13]);
+
+  return
+      "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
+      "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
+      "\",\"ADC00\": "+String(current1)+
+      ",\"ADC01\": "+String(current2)+
+      /*",\"ADC02\": "+data[2]+
+      ",\"ADC03\": "+data[3]+
+      ",\"ADC04\": "+data[4]+
+      ",\"ADC05\": "+data[5]+
+      ",\"ADC06\": "+data[6]+
+      ",\"ADC07\": "+data[7]+
+      ",\"ADC10\": "+data[8]+
+      ",\"ADC11\": "+data[9]+
+      ",\"ADC12\": "+data[10]+
+      ",\"ADC13\": "+data[11]+
+      ",\"ADC14\": "+data[12]+
+      ",\"ADC15\": "+data[13]+
+      ",\"ADC16\": "+data[14]+
+      ",\"ADC17\": "+data[15]+
+      ",\"ADC20\": "+data[16]+
+      ",\"ADC21\": "+data[17]+
+      ",\"ADC22\": "+data[18]+
+      ",\"ADC23\": "+data[19]+*/
+      ",\"ADC24\": "+String(voltage1)+
+      ",\"ADC25\": "+String(voltage2)+
+      ",\"ADC26\": 0"+
+      /*",\"ADC27\": "+data[23]+
+      ",\"ADC30\": "+data[24]+
+      ",\"ADC31\": "+data[25]+
+      ",\"ADC32\": "+data[26]+
+      ",\"ADC33\": "+data[27]+
+      ",\"ADC34\": "+data[28]+
+      ",\"ADC35\": "+data[29]+
+      ",\"ADC36\": "+data[30]+
+      ",\"ADC37\": "+data[31]+
+      ",\"ADC40\": "+data[32]+
+      ",\"ADC41\": "+data[33]+
+      ",\"ADC42\": "+data[34]+
+      ",\"ADC43\": "+data[35]+
+      ",\"ADC44\": "+data[36]+
+      ",\"ADC45\": "+data[37]+
+      ",\"ADC46\": "+data[38]+
+      ",\"ADC47\": "+data[39]+*/
+      ",\"ADC50\": "+String(power)+
+      /*",\"ADC51\": "+data[41]+
+      ",\"ADC52\": "+data[42]+
+      ",\"ADC53\": "+data[43]+
+      ",\"ADC54\": "+data[44]+
+      ",\"ADC55\": "+data[45]+
+      ",\"ADC56\": "+data[46]+
+      ",\"ADC57\": "+data[47]+*/
+      "}";
+}
+
+//Per-minute statistics of the high-rate sampling: the mean keeps the ADCxx
+//key of the average record, min, max, RMS and std get a suffix
+String dataLoggerStatsRecord(DataEncDec &decoder, char* received, int size){
+  static const char *keys[5] = {"ADC00", "ADC01", "ADC24", "ADC25", "ADC50"};
+  static const char *suffixes[5] = {"", "_MIN", "_MAX", "_RMS", "_STD"};
+  if(size < STATS_SIZE){
+    return String();
+  }
+  DateTime now = recordDate(decoder, received);
+  uint16_t samples = decoder.getCount(received[6], received[7]);
+
+  String record =
+      "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
+      "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
+      "\",\"SAMPLES\": "+String(samples);
+
+  int cursor = 8;
+  for(int c = 0; c < 5; c++){
+    for(int k = 0; k < 5; k++){
+      float value;
+      if(c < 2){
+        value = decoder.getCurrent(received[cursor]);
+        cursor += 1;
+      }
+      else if(c < 4){
+        value = decoder.getVoltage(received[cursor], received[cursor+1]);
+        cursor += 2;
+      }
+      else{
+        value = decoder.getPower(received[cursor], received[cursor+1], received[cursor+2]);
+        cursor += 3;
+      }
+      record += ",\""+String(keys[c])+suffixes[k]+"\": "+String(value);
+    }
+  }
+  record += ",\"ADC26\": 0}";
+
+  return record;
+}
+
+//Minute mean of the mapped ADS8668 channels as raw 12 bit codes
+String dataLoggerChannelsRecord(DataEncDec &decoder, char* received, int size){
+  if(size < CHANNELS_HEADER){
+    return String();
+  }
+  uint64_t map = decoder.getChannelMap(&received[6]);
+  if(size < CHANNELS_HEADER + packedSize(mapChannels(map))){
+    return String();
+  }
+  DateTime now = recordDate(decoder, received);
+  char *packed = &received[CHANNELS_HEADER];
+
+  String record =
+      "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
+      "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+"\"";
+
+  uint16_t index = 0;
+  for(int bit = 0; bit < 8*LPP_MAP_SIZE; bit++){
+    if(!((map >> bit) & 1)){
+      continue;
+    }
+    float value = channelValue(bit, decoder.getCode(packed, index++));
+    record += ",\"ADC"+String(bit/8)+String(bit%8)+"\": "+String(value);
+  }
+  record += "}";
+
+  return record;
+}
+
+//One chunk of a transient event: the date is the trigger time and FIRST the
+//index of the chunk's first sample in the window, the trigger being sample
+//PRE. Each mapped channel gets the array of its values.
+String dataLoggerEventRecord(DataEncDec &decoder, char* received, int size){
+  static const char *kinds[3] = {"BELOW", "ABOVE", "SLOPE"};
+  if(size < EVENT_HEADER){
+    return String();
+  }
+  DateTime now = recordDate(decoder, received);
+  uint64_t map = decoder.getChannelMap(&received[6]);
+  uint16_t rate = decoder.getCount(received[12], received[13]);
+  uint16_t pre = decoder.getCount(received[14], received[15]);
+  uint16_t post = decoder.getCount(received[16], received[17]);
+  uint8_t triggerId = received[18];
+  uint8_t kind = received[19];
+  uint16_t first = eventFirstSample(decoder, received, size);
+  uint16_t rows = decoder.getCount(received[22], received[23]);
+  char *packed = &received[EVENT_HEADER];
+
+  int channels = mapChannels(map);
+  if(size < EVENT_HEADER + packedSize(rows*channels)){
+    return String();
+  }
+
+  String record =
+      "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
+      "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
+      "\",\"RATE\": "+String(rate)+
+      ",\"PRE\": "+String(pre)+
+      ",\"POST\": "+String(post)+
+      ",\"TRIGGER\": \"ADC"+String(triggerId/8)+String(triggerId%8)+"\""+
+      ",\"KIND\": \""+(kind < 3 ? kinds[kind] : "UNKNOWN")+"\""+
+      ",\"FIRST\": "+String(first);
+
+  int column = 0;
+  for(int bit = 0; bit < 8*LPP_MAP_SIZE; bit++){
+    if(!((map >> bit) & 1)){
+      continue;
+    }
+    record += ",\"ADC"+String(bit/8)+String(bit%8)+"\": [";
+    for(int row = 0; row < rows; row++){
+      if(row > 0){
+        record += ",";
+      }
+      record += String(channelValue(bit, decoder.getCode(packed, row*channels + column)));
+    }
+    record += "]";
+    column++;
+  }
+  record += "}";
+
+  return record;
+}
+
+uint16_t eventFirstSample(DataEncDec &decoder, char* received, int size){
+  if(size < EVENT_HEADER){
+    return 0;
+  }
+  return decoder.getCount(received[20], received[21]);
+}
+
+
+//Upper bound of the bucket holding the p-th percentile (max for the last one)
+static uint32_t diagPercentile(DataEncDec &decoder, char* histogram, uint32_t count, uint8_t p){
+  if(count == 0){
+    return 0;
+  }
+  uint32_t max = decoder.getHistogramMax(histogram);
+  uint32_t target = ((uint64_t)count*p + 99)/100;
+  uint32_t seen = 0;
+  for(int i = 0; i < DIAG_BUCKETS - 1; i++){
+    seen += decoder.getHistogramBucket(histogram, i);
+    if(seen >= target){
+      return DIAG_BOUNDS[i] < max ? DIAG_BOUNDS[i] : max;
+    }
+  }
+  return max;
+}
+
+//Stage timing histograms of a node, in us, with the percentiles taken from
+//the bucket bounds like the gateway metrics
+String diagnosticsRecord(DataEncDec &decoder, char* received, int size){
+  static const char *stages[DIAG_STAGES] = {"JITTER_US", "READ_US", "PROCESS_US", "SAVE_US", "SEND_US"};
+  if(size < DIAG_SIZE){
+    return String();
+  }
+  DateTime now = recordDate(decoder, received);
+  uint8_t from = decoder.getFrom(received[0]);
+
+  String record =
+      "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
+      "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
+      "\",\"NODE\": \""+(from == STATION ? "STATION" : "DATALOGGER")+"\"";
+
+  char *histogram = &received[6];
+  for(int s = 0; s < DIAG_STAGES; s++, histogram += 5 + 2*DIAG_BUCKETS){
+    uint8_t id = histogram[0];
+    uint32_t max = decoder.getHistogramMax(histogram);
+    uint32_t count = 0;
+    for(int i = 0; i < DIAG_BUCKETS; i++){
+      count += decoder.getHistogramBucket(histogram, i);
+    }
+
+    record += ",\""+String(id < DIAG_STAGES ? stages[id] : "STAGE_US")+"\": {\"N\": "+String(count)+
+              ",\"P50\": "+String(diagPercentile(decoder, histogram, count, 50))+
+              ",\"P99\": "+String(diagPercentile(decoder, histogram, count, 99))+
+              ",\"MAX\": "+String(max)+
+              ",\"BUCKETS\": [";
+    for(int i = 0; i < DIAG_BUCKETS; i++){
+      record += String(decoder.getHistogramBucket(histogram, i));
+      if(i < DIAG_BUCKETS - 1){
+        record += ",";
+      }
+    }
+    record += "]}";
+  }
+  record += "}";
+
+  return record;
+}
@@ -0,0 +1,45 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Decoding of LoRa frames into the JSON records sent to the cloud
+*****************************************************************************/
+
+#include <Arduino.h>
+#include <RTClib.h>
+#include "DataEncDec.h"
+
+#ifndef _RECORD_FORMAT_
+#define _RECORD_FORMAT_
+
+// Kept apart from main.cpp so the host bench builds the same code path.
+// size is the frame length; a frame too short for its record type gives an
+// empty String, so a truncated frame is never read past its end.
+#define RECORD_MIN_SIZE 6   // header, date and the record type byte
+
+DateTime recordDate(DataEncDec &decoder, char* received);
+String stationRecord(DataEncDec &decoder, char* received, int size);
+String weatherRecord(DataEncDec &decoder, char* received, int size);
+String dataLoggerRecord(DataEncDec &decoder, char* received, int size);
+String dataLoggerStatsRecord(DataEncDec &decoder, char* received, int size);
+String dataLoggerChannelsRecord(DataEncDec &decoder, char* received, int size);
+String dataLoggerEventRecord(DataEncDec &decoder, char* received, int size);
+uint16_t eventFirstSample(DataEncDec &decoder, char* received, int size);
+String diagnosticsRecord(DataEncDec &decoder, char* received, int size);
+
+// Transducer gains of the datalogger, the ones sent to it in the settings,
+// used to calibrate the raw codes of the channel-map records
+void setDataLoggerCalibration(float current, float voltage400, float voltage500, float power);
+
+#endif
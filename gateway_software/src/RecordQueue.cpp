@@ -0,0 +1,358 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Append-only flash queue for records not yet delivered to the
+*               cloud (store-and-forward)
+*****************************************************************************/
+
+#include "RecordQueue.h"
+
+RecordQueue::RecordQueue(fs::FS &_fs) : fs(_fs){
+    dataPath = QUEUE_DATA_PATH;
+    headPath = QUEUE_HEAD_PATH;
+    compactPath = String(dataPath) + ".tmp";
+    head = 0;
+    tail = 0;
+    count = 0;
+    next = 0;
+    unsynced = 0;
+    unterminated = false;
+}
+
+RecordQueue::RecordQueue(fs::FS &_fs, const char* _dataPath, const char* _headPath) : fs(_fs){
+    dataPath = _dataPath;
+    headPath = _headPath;
+    compactPath = String(dataPath) + ".tmp";
+    head = 0;
+    tail = 0;
+    count = 0;
+    next = 0;
+    unsynced = 0;
+    unterminated = false;
+}
+
+bool RecordQueue::begin(){
+    head = 0;
+    tail = 0;
+    count = 0;
+    next = 0;
+    unsynced = 0;
+    unterminated = false;
+
+    // Power lost while compacting, the copy is complete once the old file is gone
+    if(fs.exists(compactPath.c_str())){
+        if(fs.exists(dataPath)){
+            fs.remove(compactPath.c_str());
+        }
+        else{
+            fs.rename(compactPath.c_str(), dataPath);
+        }
+    }
+
+    if(!fs.exists(dataPath)){
+        if(fs.exists(headPath)){
+            fs.remove(headPath);
+        }
+        return true;
+    }
+
+    File file = fs.open(dataPath, FILE_READ);
+    if(!file){
+        Serial.println("Failed to open queue for reading");
+        return false;
+    }
+    tail = file.size();
+
+    loadHead();
+    if(head > tail){
+        // Head file from a previous queue generation, start over
+        head = 0;
+    }
+
+    // Count what is left to deliver
+    file.seek(head);
+    uint8_t buf[128];
+    int len = 0;
+    while(file.available()){
+        len = file.read(buf, sizeof(buf));
+        if(len <= 0){
+            break;
+        }
+        for(int i = 0; i < len; i++){
+            if(buf[i] == '\n'){
+                count++;
+            }
+        }
+    }
+    file.close();
+
+    // Power lost in the middle of an append, the next one closes the line
+    unterminated = len > 0 && buf[len - 1] != '\n';
+
+    if(count == 0){
+        clear();
+    }
+
+    return true;
+}
+
+bool RecordQueue::push(const String &subfolder, const String &payload){
+    uint32_t size = subfolder.length() + payload.length() + 2;
+    if((tail - head + size) > QUEUE_MAX_BYTES){
+        return false;
+    }
+
+    File file = fs.open(dataPath, FILE_APPEND);
+    if(!file){
+        Serial.println("Failed to open queue for appending");
+        return false;
+    }
+
+    String line = subfolder + "\t" + payload + "\n";
+    if(unterminated){
+        // The partial line left by a failed append becomes its own record
+        line = "\n" + line;
+        size++;
+    }
+    size_t written = file.print(line);
+    file.close();
+
+    if(written > 0 && unterminated){
+        unterminated = false;
+        count++;
+    }
+
+    if(written != line.length()){
+        // Keep the line framing so the partial record is skipped on replay,
+        // if even the newline does not fit the next append writes it
+        Serial.println("Queue append failed");
+        file = fs.open(dataPath, FILE_APPEND);
+        size_t closed = 0;
+        if(file){
+            closed = file.print("\n");
+            file.close();
+        }
+        tail += written + closed;
+        if(closed > 0){
+            count++;
+        }
+        else if(written > 0){
+            unterminated = true;
+        }
+        return false;
+    }
+
+    tail += written;
+    count++;
+    return true;
+}
+
+bool RecordQueue::peek(String &subfolder, String &payload){
+    if(count == 0){
+        return false;
+    }
+
+    File file = fs.open(dataPath, FILE_READ);
+    if(!file){
+        Serial.println("Failed to open queue for reading");
+        return false;
+    }
+    file.seek(head);
+    String line = file.readStringUntil('\n');
+    file.close();
+
+    int delimiter = line.indexOf('\t');
+    if(delimiter < 0){
+        // Corrupted record, returned empty so the caller just pops it
+        subfolder = "";
+        payload = "";
+        next = head + line.length() + 1;
+        return true;
+    }
+
+    subfolder = line.substring(0, delimiter);
+    payload = line.substring(delimiter + 1);
+    next = head + line.length() + 1;
+    return true;
+}
+
+// Reads the record at offset and moves offset past it, lets the caller look
+// ahead of the head (e.g. several publishes in flight) without popping.
+bool RecordQueue::peekAt(uint32_t &offset, String &subfolder, String &payload){
+    if(offset < head || offset >= tail){
+        return false;
+    }
+
+    File file = fs.open(dataPath, FILE_READ);
+    if(!file){
+        Serial.println("Failed to open queue for reading");
+        return false;
+    }
+    file.seek(offset);
+    String line = file.readStringUntil('\n');
+    file.close();
+
+    offset += line.length() + 1;
+    int delimiter = line.indexOf('\t');
+    if(delimiter < 0){
+        subfolder = "";
+        payload = "";
+        return true;
+    }
+
+    subfolder = line.substring(0, delimiter);
+    payload = line.substring(delimiter + 1);
+    return true;
+}
+
+uint32_t RecordQueue::headOffset(){
+    return head;
+}
+
+bool RecordQueue::pop(){
+    if(count == 0){
+        return false;
+    }
+
+    if(next <= head){
+        String subfolder, payload;
+        peek(subfolder, payload);
+    }
+
+    head = next;
+    count--;
+
+    if(count == 0 || head >= tail){
+        clear();
+        return true;
+    }
+
+    if(++unsynced >= QUEUE_HEAD_SYNC){
+        saveHead();
+    }
+    return true;
+}
+
+void RecordQueue::sync(){
+    if(unsynced > 0){
+        saveHead();
+    }
+}
+
+// Rewrites the pending records at the start of a new file once more than
+// QUEUE_COMPACT_BYTES were delivered. Returns how far the offsets moved back
+// (0 if nothing was done), callers holding peekAt() offsets subtract it.
+// A power loss after the index is removed replays the delivered records
+// again, it never loses pending ones.
+uint32_t RecordQueue::compact(){
+    if(head < QUEUE_COMPACT_BYTES || count == 0){
+        return 0;
+    }
+
+    File from = fs.open(dataPath, FILE_READ);
+    File to = fs.open(compactPath.c_str(), FILE_WRITE);
+    if(!from || !to){
+        Serial.println("Failed to open queue for compacting");
+        return 0;
+    }
+    from.seek(head);
+    uint8_t buf[256];
+    uint32_t copied = 0;
+    int len;
+    while((len = from.read(buf, sizeof(buf))) > 0){
+        if(to.write(buf, len) != (size_t)len){
+            break;
+        }
+        copied += len;
+    }
+    from.close();
+    to.close();
+
+    if(copied != tail - head){
+        // No room for the copy, keep appending to the old file
+        Serial.println("Queue compaction failed");
+        fs.remove(compactPath.c_str());
+        return 0;
+    }
+
+    if(fs.exists(headPath)){
+        fs.remove(headPath);
+    }
+    fs.remove(dataPath);
+    fs.rename(compactPath.c_str(), dataPath);
+
+    uint32_t shift = head;
+    head = 0;
+    tail = copied;
+    next = next > shift ? next - shift : 0;
+    unsynced = 0;
+    return shift;
+}
+
+bool RecordQueue::isEmpty(){
+    return count == 0;
+}
+
+uint32_t RecordQueue::pending(){
+    return count;
+}
+
+uint32_t RecordQueue::bytes(){
+    return tail - head;
+}
+
+void RecordQueue::loadHead(){
+    head = 0;
+    File file = fs.open(headPath, FILE_READ);
+    if(!file){
+        return;
+    }
+    uint8_t buf[4];
+    if(file.read(buf, 4) == 4){
+        head = ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) | ((uint32_t)buf[2] << 8) | buf[3];
+    }
+    file.close();
+}
+
+void RecordQueue::saveHead(){
+    File file = fs.open(headPath, FILE_WRITE);
+    if(!file){
+        Serial.println("Failed to open queue index for writing");
+        return;
+    }
+    uint8_t buf[4];
+    buf[0] = head >> 24;
+    buf[1] = head >> 16;
+    buf[2] = head >> 8;
+    buf[3] = head;
+    file.write(buf, 4);
+    file.close();
+    unsynced = 0;
+}
+
+void RecordQueue::clear(){
+    if(fs.exists(dataPath)){
+        fs.remove(dataPath);
+    }
+    if(fs.exists(headPath)){
+        fs.remove(headPath);
+    }
+    head = 0;
+    tail = 0;
+    count = 0;
+    next = 0;
+    unsynced = 0;
+    unterminated = false;
+}
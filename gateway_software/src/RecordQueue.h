@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Append-only flash queue for records not yet delivered to the
+*               cloud (store-and-forward)
+*****************************************************************************/
+
+#include <Arduino.h>
+#include <FS.h>
+
+#ifndef _RECORD_QUEUE_
+#define _RECORD_QUEUE_
+
+// Default file names and limits
+#define QUEUE_DATA_PATH   "/queue.dat"
+#define QUEUE_HEAD_PATH   "/queue.idx"
+#define QUEUE_MAX_BYTES   524288  // stop accepting records above 512 kB pending
+#define QUEUE_HEAD_SYNC   16      // persist the read offset every N pops
+#define QUEUE_COMPACT_BYTES 65536 // delivered bytes before compact() rewrites the file
+
+// Records are stored one per line as "<subfolder>\t<payload>\n" in a file that
+// is only ever appended to. The read offset (head) lives in a separate file, so
+// a pop never rewrites the data. When the queue drains both files are removed,
+// and compact() drops the delivered records of a queue that never drains.
+class RecordQueue {
+    public:
+        RecordQueue(fs::FS &fs);
+        RecordQueue(fs::FS &fs, const char* dataPath, const char* headPath);
+
+        bool begin();
+        bool push(const String &subfolder, const String &payload);
+        bool peek(String &subfolder, String &payload);
+        bool peekAt(uint32_t &offset, String &subfolder, String &payload);
+        uint32_t headOffset();
+        bool pop();
+        void sync();
+        uint32_t compact();
+
+        bool isEmpty();
+        uint32_t pending();
+        uint32_t bytes();
+
+    private:
+        fs::FS &fs;
+        const char* dataPath;
+        const char* headPath;
+        String compactPath; // copy of the pending records while compacting
+
+        uint32_t head;      // offset of the next record to deliver
+        uint32_t tail;      // size of the data file
+        uint32_t count;     // records between head and tail
+        uint32_t next;      // offset after the record returned by peek()
+        uint8_t unsynced;   // pops since the head was last persisted
+        bool unterminated;  // data file does not end with a newline
+
+        void loadHead();
+        void saveHead();
+        void clear();
+};
+
+#endif
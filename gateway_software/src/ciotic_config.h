@@ -17,6 +17,7 @@
 *   01/11/2021 - Added project data, Wi-Fi information and certificate.
 *   01/13/2021 - Changing defalt NTP servers tp NTP.BR
 *   03/22/2021 - Removing project data, Wi-Fi information and certificate for publication.
+*   10/19/2026 - Added the pinned backend public key for signed config and commands.
 *****************************************************************************/
 // This file contains your configuration used to connect to Cloud IoT Core
 
@@ -48,6 +49,17 @@ const char* ntp_secondary = "b.ntp.br";
 // is probably wrong with your key.
 const char *private_key_str = "private_key_str";
 
+// Configuration and commands are only applied when signed by the backend.
+// To get its public key run (where backend-public.pem is the P-256 public key
+// the backend signs with):
+// openssl ec -pubin -in <backend-public.pem> -noout -text
+// and copy the pub: part (65 pairs of hex digits starting with 04).
+// Payloads are sent as "<body>.<signature>", the signature being the
+// base64url ES256 r||s over the body, as in a JWT. Commands also carry the
+// Unix time they were issued: "<command> <time>".
+const char *backend_public_key_str = "backend_public_key_str";
+const int command_max_age_secs = 300; // older or replayed commands are dropped
+
 // Time (seconds) to expire token += 20 minutes for drift
 const int jwt_exp_secs = 3600*24; // Maximum 24H (3600*24)
 
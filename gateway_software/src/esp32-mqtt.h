@@ -18,12 +18,12 @@
 
 #include <Client.h>
 #include <WiFi.h>
-#include <WiFiClientSecure.h>
 
 #include <MQTT.h>
 
 #include <Google Cloud IoT Core JWT/src/CloudIoTCore.h>
 #include <Google Cloud IoT Core JWT/src/CloudIoTCoreMqtt.h>
+#include <Google Cloud IoT Core JWT/src/CloudIoTCoreTlsClient.h>
 #include "ciotic_config.h" // Update this file with your configuration
 
 // !!REPLACEME!!
@@ -40,13 +40,34 @@
 ///////////////////////////////
 
 // Initialize WiFi and MQTT for this board
-Client *netClient;
+CloudIoTCoreTlsClient *netClient; // resumes the TLS session on reconnect
 CloudIoTCoreDevice *device;
 CloudIoTCoreMqtt *mqtt;
 MQTTClient *mqttClient;
 unsigned long iat = 0;
 String jwt;
 
+#define WIFI_RETRY_INTERVAL 10000 // ms between WiFi.begin() while disconnected
+#define MQTT_BUFFER_SIZE 2048 // largest packet publishTelemetry()/publishState() can encode
+unsigned long lastWifiBegin = 0;
+bool timeRequested = false;
+
+// The next JWT is minted by a low priority task on core 0 (loop() and LoRa
+// run on core 1), so a reconnect at token expiry finds it ready.
+#define JWT_PREMINT_LEAD  600000 // ms before expiry the next token is minted
+#define JWT_MIN_LIFETIME   60000 // a cached token closer to expiry is not used
+#define JWT_TASK_INTERVAL   5000 // ms between checks of the cached token
+#define JWT_TASK_STACK      8192
+#define JWT_TASK_PRIORITY      1 // just above idle
+SemaphoreHandle_t jwtLock = NULL;  // guards nextJwt/nextJwtExp, held only to read or swap them
+SemaphoreHandle_t signLock = NULL; // one signer, serializes device->signJWT
+String nextJwt;
+unsigned long nextJwtExp = 0;    // millis() at which nextJwt expires
+
+// Config and commands must be signed by the pinned backend key
+PayloadVerifier backendVerifier;
+long long lastCommandTime = 0; // issue time of the last command applied
+
 ///////////////////////////////
 // Helpers specific to this board
 ///////////////////////////////
@@ -54,31 +75,96 @@ String getDefaultSensor() {
   return  "Wifi: " + String(WiFi.RSSI()) + "db";
 }
 
+// Clock is set once NTP answered, JWTs and node ACKs depend on it
+bool timeSynced() {
+  return time(nullptr) >= 1510644967;
+}
+
+// True if the cached token expires within lead ms (or there is none)
+bool jwtExpiresWithin(long lead) {
+  xSemaphoreTake(jwtLock, portMAX_DELAY);
+  bool expiring = nextJwt.length() == 0 || (long)(nextJwtExp - millis()) < lead;
+  xSemaphoreGive(jwtLock);
+  return expiring;
+}
+
+// Signs a new token unless another caller did while this one waited for the
+// signer. The ECDSA signature is made into a local String outside jwtLock,
+// so a reconnect reading the cached token never waits for it.
+void mintJwt(long lead) {
+  xSemaphoreTake(signLock, portMAX_DELAY);
+  if (jwtExpiresWithin(lead)) {
+    unsigned long now = time(nullptr);
+    unsigned long expAt = millis() + (unsigned long)jwt_exp_secs * 1000;
+    String token = device->signJWT(now, jwt_exp_secs);
+
+    xSemaphoreTake(jwtLock, portMAX_DELAY);
+    iat = now;
+    nextJwt = token;
+    nextJwtExp = expAt;
+    xSemaphoreGive(jwtLock);
+  }
+  xSemaphoreGive(signLock);
+}
+
+// Called on every (re)connection: uses the pre-minted token and only signs
+// here when the task has not produced one yet (e.g. first connection right
+// after NTP) or it is about to expire.
 String getJwt() {
-  iat = time(nullptr);
-  Serial.println("Refreshing JWT");
-  jwt = device->createJWT(iat, jwt_exp_secs);
+  if (jwtExpiresWithin(JWT_MIN_LIFETIME)) {
+    Serial.println("Refreshing JWT");
+    mintJwt(JWT_MIN_LIFETIME);
+  }
+  xSemaphoreTake(jwtLock, portMAX_DELAY);
+  jwt = nextJwt;
+  device->useJWT(jwt, nextJwtExp);
+  xSemaphoreGive(jwtLock);
   return jwt;
 }
 
+void jwtPremintTask(void *param) {
+  for (;;) {
+    if (timeSynced() && jwtExpiresWithin(JWT_PREMINT_LEAD)) {
+      unsigned long started = millis();
+      mintJwt(JWT_PREMINT_LEAD);
+      Serial.println("Pre-minted JWT in " + String(millis() - started) + " ms");
+    }
+    vTaskDelay(JWT_TASK_INTERVAL / portTICK_PERIOD_MS);
+  }
+}
+
 void setupWifi() {
   Serial.println("Starting wifi");
 
   WiFi.mode(WIFI_STA);
   // WiFi.setSleep(false); // May help with disconnect? Seems to have been removed from WiFi
   WiFi.begin(ssid, password);
-  Serial.println("Connecting to WiFi");
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(500);
-    WiFi.begin(ssid, password);
+  lastWifiBegin = millis();
+}
+
+// Non-blocking network check used by the MQTT state machine: restarts the WiFi
+// association now and then and requests NTP time once the link is up.
+bool networkReady() {
+  if (WiFi.status() != WL_CONNECTED) {
+    if (millis() - lastWifiBegin > WIFI_RETRY_INTERVAL) {
+      Serial.println("Connecting to WiFi");
+      WiFi.begin(ssid, password);
+      lastWifiBegin = millis();
+    }
+    timeRequested = false;
+    return false;
   }
-  Serial.println(WiFi.localIP());
 
-  configTime(0, 0, ntp_primary, ntp_secondary);
-  Serial.println("Waiting on time sync...");
-  while (time(nullptr) < 1510644967) {
-    delay(10);
+  if (!timeSynced()) {
+    if (!timeRequested) {
+      Serial.println(WiFi.localIP());
+      configTime(0, 0, ntp_primary, ntp_secondary);
+      Serial.println("Waiting on time sync...");
+      timeRequested = true;
+    }
+    return false;
   }
+  return true;
 }
 
 void connectWifi() {
@@ -89,6 +175,34 @@ void connectWifi() {
   }
 }
 
+// Checks the signature of a config/command payload and returns its body.
+// Cheap enough to run inline in the MQTT callback.
+bool verifiedPayload(const String &payload, String &body) {
+  size_t body_len = 0;
+  if (!backendVerifier.verify(payload.c_str(), payload.length(), &body_len)) {
+    return false;
+  }
+  body = payload.substring(0, body_len);
+  return true;
+}
+
+// A signed command "<command> <issued unix time>" is accepted once, and only
+// while fresh, so a captured one cannot be played back later.
+bool freshCommand(const String &body) {
+  int space = body.lastIndexOf(' ');
+  if (space < 0 || !timeSynced()) {
+    return false;
+  }
+  long long issued = atoll(body.c_str() + space + 1);
+  long long now = time(nullptr);
+  if (issued <= lastCommandTime || issued > now + command_max_age_secs ||
+      now - issued > command_max_age_secs) {
+    return false;
+  }
+  lastCommandTime = issued;
+  return true;
+}
+
 ///////////////////////////////
 // Orchestrates various methods from preceeding code.
 ///////////////////////////////
@@ -108,6 +222,14 @@ bool publishTelemetry(String subfolder, const char* data, int length) {
   return mqtt->publishTelemetry(subfolder, data, length);
 }
 
+// True if a telemetry record fits the client buffer. Larger ones can only go
+// through publishTelemetryAsync(), which encodes the packet itself.
+bool telemetryFits(const String &subfolder, const String &payload) {
+  // fixed header, topic length, packet id
+  size_t length = 5 + 2 + device->getEventsTopic().length() + subfolder.length() + 2 + payload.length();
+  return length <= MQTT_BUFFER_SIZE;
+}
+
 bool publishState(String data) {
   return mqtt->publishState(data);
 }
@@ -121,13 +243,25 @@ void setupCloudIoT() {
   device = new CloudIoTCoreDevice(
       project_id, location, registry_id, device_id,
       private_key_str);
+  // before the JWT task starts, both share the ECDSA state
+  if (!backendVerifier.begin(backend_public_key_str)) {
+    Serial.println("Warning: invalid backend public key, config and commands will be rejected");
+  }
 
   setupWifi();
-  netClient = new WiFiClientSecure();
-  mqttClient = new MQTTClient(512);
+  netClient = new CloudIoTCoreTlsClient();
+  netClient->setCACert(root_cert);
+  mqttClient = new MQTTClient(MQTT_BUFFER_SIZE);
   mqttClient->setOptions(180, true, 1000); // keepAlive, cleanSession, timeout
   mqtt = new CloudIoTCoreMqtt(mqttClient, netClient, device);
   mqtt->setUseLts(true);
+  mqtt->setNetworkCheck(networkReady);
+  mqtt->setAsyncConnect(true); // connection advances in mqtt->loop()
   mqtt->startMQTT();
+
+  jwtLock = xSemaphoreCreateMutex();
+  signLock = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(jwtPremintTask, "jwt", JWT_TASK_STACK, NULL,
+                          JWT_TASK_PRIORITY, NULL, 0);
 }
 #endif //__ESP32_MQTT_H__
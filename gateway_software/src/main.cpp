@@ -27,6 +27,10 @@
 #include <DataEncDec.h>
 #include "esp32-mqtt.h"
 #include <RTClib.h>
+#include <SPIFFS.h>
+#include "RecordQueue.h"
+#include "GatewayMetrics.h"
+#include "RecordFormat.h"
 
 // Pin definitions 
 #define SCK 5   // GPIO5  SCK
@@ -37,40 +41,97 @@
 #define DI00 26 // GPIO26 IRQ(Interrupt Request)
  
 #define BAND 915E6 //Frequência do radio - exemplo : 433E6, 868E6, 915E6
+
+#define REPLAY_BATCH 20 //max queued records published per loop iteration
+#define REPLAY_WINDOW 8 //max replayed records waiting for a PUBACK
+#define REPLAY_ACK_TIMEOUT 10000 //ms before an unacknowledged record is sent again
+#define REPLAY_MAX_ATTEMPTS 5 //failed publishes of a record before it is parked
+#define DEAD_LETTER_RETRY 60000 //ms between parked records moved back to an empty backlog
+
+#define METRICS_INTERVAL 600000 //ms between metrics published as device state
+#define REG_IRQ_FLAGS 0x12 //SX127x IRQ flags register
+#define IRQ_PAYLOAD_CRC_ERROR_MASK 0x20
  
 //Objects declaration
 SSD1306 display(0x3c, 4, 15);
 DataEncDec decoder(0);
 hw_timer_t *timer = NULL;
+RecordQueue backlog(SPIFFS);
+RecordQueue deadLetters(SPIFFS, "/dead.dat", "/dead.idx"); //records the broker never took
+GatewayMetrics metrics;
 
 //Variable declaration
-float settings[6] = {2, 200, 2, 40, 50, 3600};
+//Station gains, data logger calibration, station irradiance (ms), ambient (s)
+//and PV temperature (s) periods, 0 keeps the station defaults
+float settings[9] = {2, 200, 2, 40, 50, 3600, 0, 0, 0};
 int settingsStation = 0;
 int settingsDatalogger = 0;
 long lastStationData = 0;
-long lastDLData = 0;
-
-//Menssage handler
+long lastDLData[RECORD_EVENT+1] = {0}; //per record type, a minute sends several
+uint16_t lastEventFirst = 0; //chunks of an event share its date
+long lastDiagData[3] = {0}; //per node
+//Replayed records in the window, oldest first
+enum ReplayState {REPLAY_SENT, REPLAY_ACKED, REPLAY_RESEND};
+struct ReplayEntry {
+  uint32_t offset;      //record position in the backlog
+  uint16_t id;          //packet id while in flight
+  uint8_t state;
+  uint8_t attempts;     //failed publishes while connected
+  unsigned long sentAt;
+};
+ReplayEntry replay[REPLAY_WINDOW];
+int replayCount = 0;
+uint32_t replayCursor = 0;
+unsigned long packetReceivedAt = 0;
+unsigned long lastMetrics = 0;
+unsigned long lastDeadLetterRetry = 0;
+bool wasConnected = false;
+bool everConnected = false; //the first connect is not a reconnect
+
+//PUBACK results of the replayed records, registered in setup()
+void onReplayAck(uint16_t id, bool acked);
+
+//Menssage handler, config and commands are only applied when signed by the backend
 void messageReceived(String &topic, String &payload) {
   Serial.println("\n\nIncoming: " + topic + " - " + payload + "\n\n");
+  String body;
   if(topic == "/devices/DL-Node-1/commands"){
-    publishState("{\"LOG\": \"Recived command: " + payload +"\"}");
+    if(!verifiedPayload(payload, body) || !freshCommand(body)){
+      Serial.println("Rejected command: bad signature or stale");
+      publishState("{\"LOG\": \"Rejected command\"}");
+      return;
+    }
+    publishState("{\"LOG\": \"Recived command: " + body +"\"}");
     delay(2000);
 
     //Reset
-    if(payload[0] == 'R'){
+    if(body[0] == 'R'){
       esp_restart();
     }
   }
   if(topic == "/devices/DL-Node-1/config"){
-    // publishState("{\"LOG\": \"Recived config: " + payload +"\"}"); // bug??
+    if(!verifiedPayload(payload, body) || body.length() < 35){
+      Serial.println("Rejected config: bad signature or format");
+      return;
+    }
+    // publishState("{\"LOG\": \"Recived config: " + body +"\"}"); // bug??
+
+    settings[0] = (float)(body[0])*1000 + (float)(body[1])*100 + (float)(body[2])*10 + (float)(body[3]) + (float)(body[4])*0.1 - 53332.8;
+    settings[1] = (float)(body[6])*1000 + (float)(body[7])*100 + (float)(body[8])*10 + (float)(body[9]) + (float)(body[10])*0.1 - 53332.8;
+    settings[2] = (float)(body[12])*1000 + (float)(body[13])*100 + (float)(body[14])*10 + (float)(body[15]) + (float)(body[16])*0.1 - 53332.8;
+    settings[3] = (float)(body[18])*1000 + (float)(body[19])*100 + (float)(body[20])*10 + (float)(body[21]) + (float)(body[22])*0.1 - 53332.8;
+    settings[4] = (float)(body[24])*1000 + (float)(body[25])*100 + (float)(body[26])*10 + (float)(body[27]) + (float)(body[28])*0.1 - 53332.8;
+    settings[5] = (float)(body[30])*1000 + (float)(body[31])*100 + (float)(body[32])*10 + (float)(body[33]) + (float)(body[34])*0.1 - 53332.8;
+    //Station sampling periods, older configs stop at the calibration
+    if(body.length() >= 47){
+      settings[6] = (float)(body[36])*1000 + (float)(body[37])*100 + (float)(body[38])*10 + (float)(body[39]) + (float)(body[40])*0.1 - 53332.8;
+      settings[7] = (float)(body[42])*1000 + (float)(body[43])*100 + (float)(body[44])*10 + (float)(body[45]) + (float)(body[46])*0.1 - 53332.8;
+    }
+    if(body.length() >= 53){
+      settings[8] = (float)(body[48])*1000 + (float)(body[49])*100 + (float)(body[50])*10 + (float)(body[51]) + (float)(body[52])*0.1 - 53332.8;
+    }
 
-    settings[0] = (float)(payload[0])*1000 + (float)(payload[1])*100 + (float)(payload[2])*10 + (float)(payload[3]) + (float)(payload[4])*0.1 - 53332.8;
-    settings[1] = (float)(payload[6])*1000 + (float)(payload[7])*100 + (float)(payload[8])*10 + (float)(payload[9]) + (float)(payload[10])*0.1 - 53332.8;
-    settings[2] = (float)(payload[12])*1000 + (float)(payload[13])*100 + (float)(payload[14])*10 + (float)(payload[15]) + (float)(payload[16])*0.1 - 53332.8;
-    settings[3] = (float)(payload[18])*1000 + (float)(payload[19])*100 + (float)(payload[20])*10 + (float)(payload[21]) + (float)(payload[22])*0.1 - 53332.8;
-    settings[4] = (float)(payload[24])*1000 + (float)(payload[25])*100 + (float)(payload[26])*10 + (float)(payload[27]) + (float)(payload[28])*0.1 - 53332.8;
-    settings[5] = (float)(payload[30])*1000 + (float)(payload[31])*100 + (float)(payload[32])*10 + (float)(payload[33]) + (float)(payload[34])*0.1 - 53332.8;
+    setDataLoggerCalibration(settings[2], settings[3], settings[4], settings[5]);
 
     settingsStation = 1;
     settingsDatalogger = 1;
@@ -80,6 +141,7 @@ void messageReceived(String &topic, String &payload) {
 void setupLoRa(){ 
   SPI.begin(SCK, MISO, MOSI, SS);
   LoRa.setPins(SS, RST, DI00);
+  pinMode(DI00, INPUT); //RxDone, gates the IRQ flags read in loop()
   digitalWrite(RST, LOW);
   digitalWrite(RST, HIGH);
  
@@ -138,20 +200,26 @@ void setup(){
     //Configuring the LoRa radio
     setupLoRa();
 
-    setupCloudIoT();
-    delay(1000);
-    mqtt->loop();
-    delay(10);  // <- fixes some issues with WiFi stability
-    if (!mqttClient->connected()) {
-      connect();
-      delay(500);
+    //Store-and-forward queue for records the cloud did not accept
+    if(!SPIFFS.begin(true) || !backlog.begin() || !deadLetters.begin()){
+      Serial.println("Backlog queue unavailable");
     }
+    Serial.println("Backlog records: " + String(backlog.pending()) +
+                   ", dead letters: " + String(deadLetters.pending()));
+
+    //WiFi and MQTT come up in the background, stepped by mqtt->loop()
+    setupCloudIoT();
+    mqtt->setPublishWindow(REPLAY_WINDOW, REPLAY_ACK_TIMEOUT);
+    mqtt->setPublishResultCallback(onReplayAck);
     Serial.println("CloudIoT initialized");
 }
 
 void sendACK(uint8_t to){
   int size = 5;
-  if((to == STATION && settingsStation) || (to == DATALOGGER && settingsDatalogger)){
+  if(to == STATION && settingsStation){
+    size = 16;
+  }
+  if(to == DATALOGGER && settingsDatalogger){
     size = 14;
   }
   DataEncDec encoder(size);
@@ -171,8 +239,9 @@ void sendACK(uint8_t to){
   if(to == STATION && settingsStation){
     encoder.addVoltage(settings[0]);
     encoder.addVoltage(settings[1]);
-    encoder.addVoltage(0);
-    encoder.addPower(0);
+    encoder.addVoltage(settings[6]);
+    encoder.addPower(settings[7]);
+    encoder.addVoltage(settings[8]);
     settingsStation = 0;
   }
   if(to == DATALOGGER && settingsDatalogger){
@@ -189,51 +258,243 @@ void sendACK(uint8_t to){
     LoRa.print(buffer[i]);
   }
   LoRa.endPacket();
+
+  metrics.acksSent++;
+  metrics.ackLatency.record(millis() - packetReceivedAt);
 }
 
-void readStationData(char* received){
-  DateTime now = decoder.getDate(received[1], received[2], received[3], received[4]);
-  float temp = decoder.getTemp(received[5], received[6]);
-  int humi = decoder.getHumi(received[7]);
-  float irrad = decoder.getIrrad(received[8], received[9]);
-  float windSpeed = decoder.getWindSpeed(received[10]);
-  int windDirection = decoder.getWindDirection(received[11]);
-  float rain = decoder.getRain(received[12]);
-  float pvtemp = decoder.getTemp(received[13], received[14]);
-
-  Serial.println(now.year());
-  Serial.println(now.month());
-  Serial.println(now.day());
-  Serial.println(now.hour());
-  Serial.println(now.minute());
-  Serial.println(now.second());
-  Serial.println(temp);
-  Serial.println(humi);
-  Serial.println(irrad);
-  Serial.println(windSpeed);
-  Serial.println(windDirection);
-  Serial.println(rain);
-  Serial.println(pvtemp);
+//The LoRa library drops frames with a bad CRC silently, so the IRQ flags are
+//peeked before parsePacket() clears them. Only called once DIO0 (RxDone) is
+//up, a bad frame raises it too, so idle spins cost no SPI transaction.
+uint8_t readLoRaIrqFlags(){
+  SPI.beginTransaction(SPISettings(8E6, MSBFIRST, SPI_MODE0));
+  digitalWrite(SS, LOW);
+  SPI.transfer(REG_IRQ_FLAGS & 0x7f);
+  uint8_t flags = SPI.transfer(0x00);
+  digitalWrite(SS, HIGH);
+  SPI.endTransaction();
+  return flags;
+}
 
-  if(lastStationData != now.unixtime()){
-    mqtt->loop();
-    delay(10);  // <- fixes some issues with WiFi stability
-    if (!mqttClient->connected()) {
-      connect();
-      delay(500);
+//Periodic metrics publish and serial dump on request ('m')
+void reportMetrics(){
+  if(Serial.available() > 0){
+    if(Serial.read() == 'm'){
+      metrics.print();
+    }
+  }
+
+  if(millis() - lastMetrics > METRICS_INTERVAL){
+    lastMetrics = millis();
+    if(mqttClient->connected()){
+      publishState(metrics.toJson());
+    }
+  }
+}
+
+//Publishes a record or, if the cloud is unreachable, appends it to the backlog.
+//While the backlog is not empty new records are queued behind it to keep order.
+//A record too large for the MQTT client buffer is queued as well, the replay
+//publishes it without going through that buffer.
+bool deliverRecord(String subfolder, String payload){
+  if(backlog.isEmpty() && mqttClient->connected() && telemetryFits(subfolder, payload)){
+    unsigned long start = millis();
+    if(publishTelemetry(subfolder, payload)){
+      metrics.publishLatency.record(millis() - start);
+      metrics.published++;
+      return true;
+    }
+    metrics.publishFailures++;
+  }
+
+  if(backlog.push(subfolder, payload)){
+    metrics.queued++;
+    Serial.println("Record queued, backlog: " + String(backlog.pending()));
+    return true;
+  }
+
+  Serial.println("Backlog full, record left on the node");
+  return false;
+}
+
+//A record leaves the backlog only when it and every record before it were
+//acknowledged. A lost publish is sent again on its own, the acknowledged
+//records around it stay acknowledged.
+void onReplayAck(uint16_t id, bool acked){
+  for(int i = 0; i < replayCount; i++){
+    if(replay[i].state == REPLAY_SENT && replay[i].id == id){
+      if(acked){
+        replay[i].state = REPLAY_ACKED;
+        metrics.published++;
+        metrics.pubackLatency.record(millis() - replay[i].sentAt);
+      }
+      else{
+        metrics.publishFailures++;
+        replay[i].state = REPLAY_RESEND;
+        //Publishes dropped by a disconnect are not the record's fault
+        if(mqttClient->connected()){
+          replay[i].attempts++;
+        }
+      }
+      return;
+    }
+  }
+}
+
+//Publishes the record of a window entry, false if the client refused it.
+//next is set to the offset of the record after it. A record that failed
+//REPLAY_MAX_ATTEMPTS times is moved to the dead-letter queue instead, so it
+//cannot hold the backlog back.
+bool replayPublish(int i, uint32_t &next){
+  String subfolder, payload;
+  next = replay[i].offset;
+  if(!backlog.peekAt(next, subfolder, payload)){
+    return false;
+  }
+
+  if(payload.length() == 0){
+    //Corrupted record, dropped in order with the others
+    replay[i].state = REPLAY_ACKED;
+    return true;
+  }
+
+  if(replay[i].attempts >= REPLAY_MAX_ATTEMPTS){
+    if(deadLetters.push(subfolder, payload)){
+      Serial.println("Record parked after " + String(replay[i].attempts) + " attempts, dead letters: " + String(deadLetters.pending()));
+    }
+    else{
+      Serial.println("Dead-letter queue full, record dropped");
+      metrics.dropped++;
+    }
+    metrics.deadLettered++;
+    replay[i].state = REPLAY_ACKED;
+    return true;
+  }
+
+  uint16_t id = 0;
+  if(!mqtt->publishTelemetryAsync(subfolder, payload, &id)){
+    //Refused with room in the window, the record itself failed to encode/write
+    if(mqttClient->connected() && mqtt->publishWindowFree() > 0){
+      replay[i].attempts++;
+      replay[i].state = REPLAY_RESEND;
+    }
+    return false;
+  }
+  replay[i].id = id;
+  replay[i].state = REPLAY_SENT;
+  replay[i].sentAt = millis();
+  return true;
+}
+
+//Moves the oldest parked record to the backlog, where it is replayed with a
+//fresh attempt count. One that fails again is parked at the back.
+void retryDeadLetter(){
+  String subfolder, payload;
+  lastDeadLetterRetry = millis();
+  if(!deadLetters.peek(subfolder, payload)){
+    return;
+  }
+  if(payload.length() > 0){
+    if(!backlog.push(subfolder, payload)){
+      return;
     }
+    metrics.deadRetried++;
+  }
+  deadLetters.pop();
+  deadLetters.sync();
+  deadLetters.compact();
+  Serial.println("Dead letter retried, dead letters: " + String(deadLetters.pending()));
+}
 
-    bool sent = publishTelemetry("/station",
-            "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
-            "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
-            "\",\"AMB_TEMPERATURE\": "+String(temp)+
-            ",\"PRESSURE\": 0"+
-            ",\"HUMIDITY\": "+String(humi)+
-            ",\"IRRADIANCE\": "+String(irrad)+
-            ",\"WIND_SPEED\": "+String(windSpeed)+
-            ",\"WIND_DIRECTION\": "+String(windDirection)+
-            ",\"RAIN\": "+String(rain)+
-            ",\"PV_TEMPERATURE\": "+String(pvtemp)+"}");
+//Keeps up to REPLAY_WINDOW QoS 1 publishes in flight and pops the acknowledged
+//prefix, so replay is bound by bandwidth instead of one round trip per record.
+void replayBacklog(){
+  int replayed = 0;
+  int sent = 0;
+  bool refused = false;
+  uint32_t next;
+
+  //A disconnect fails every publish in flight (clean session), they are
+  //marked for resending by onReplayAck
+  if(!mqttClient->connected()){
+    return;
+  }
+
+  while(replayCount > 0 && replay[0].state == REPLAY_ACKED){
+    backlog.pop();
+    replayed++;
+    replayCount--;
+    for(int i = 0; i < replayCount; i++){
+      replay[i] = replay[i + 1];
+    }
+  }
+
+  //Parked records get a slow retry once the live backlog drained
+  if(replayCount == 0 && backlog.isEmpty() && !deadLetters.isEmpty() &&
+     millis() - lastDeadLetterRetry > DEAD_LETTER_RETRY){
+    retryDeadLetter();
+  }
+
+  if(replayCount == 0){
+    replayCursor = backlog.headOffset();
+  }
+
+  //A backlog that never drains is rewritten without its delivered records,
+  //the window offsets move back with it
+  uint32_t shift = backlog.compact();
+  if(shift > 0){
+    for(int i = 0; i < replayCount; i++){
+      replay[i].offset -= shift;
+    }
+    replayCursor -= shift;
+  }
+
+  //Lost publishes first, they hold the head back
+  for(int i = 0; i < replayCount && sent < REPLAY_BATCH; i++){
+    if(replay[i].state != REPLAY_RESEND){
+      continue;
+    }
+    if(!replayPublish(i, next)){
+      refused = true;
+      break;
+    }
+    sent++;
+  }
+
+  while(!refused && sent < REPLAY_BATCH && replayCount < REPLAY_WINDOW && !backlog.isEmpty()){
+    replay[replayCount].offset = replayCursor;
+    replay[replayCount].attempts = 0;
+    if(!replayPublish(replayCount, next)){
+      if(replay[replayCount].attempts > 0){
+        //Kept in the window, retried by the loop above
+        replayCount++;
+        replayCursor = next;
+      }
+      break;
+    }
+    replayCount++;
+    replayCursor = next;
+    sent++;
+  }
+
+  if(replayed > 0){
+    backlog.sync();
+    Serial.println("Replayed " + String(replayed) + " records, backlog: " + String(backlog.pending()));
+  }
+}
+
+void readStationData(char* received, int packetSize){
+  DateTime now = recordDate(decoder, received);
+  String payload = stationRecord(decoder, received, packetSize);
+  if(payload.length() == 0){
+    Serial.println("Station frame too short: " + String(packetSize) + " bytes");
+    metrics.rejected++;
+    return;
+  }
+  Serial.println(payload);
+
+  if(lastStationData != now.unixtime()){
+    bool sent = deliverRecord("/station", payload);
 
     display.clear();
     display.drawString(0, 0, "Station data received");
@@ -241,99 +502,63 @@ void readStationData(char* received){
                               " "+String(now.hour())+":"+String(now.minute())+":"+String(now.second()));
     display.display();
 
-    //fixes some issues with LoRA stability
+    //ACK once the record is in the cloud or safely in the backlog
     if (sent){
       sendACK(STATION);
       lastStationData = now.unixtime();
     }
-    else esp_restart();
   }
   else{
+    metrics.duplicates++;
     setupLoRa();
     sendACK(STATION);
   }
 }
 
-void readDataLoggerData(char* received){
-  DateTime now = decoder.getDate(received[1], received[2], received[3], received[4]);
-  float current1 = decoder.getCurrent(received[5]);
-  float current2 = decoder.getCurrent(received[6]);
-  float voltage1 = decoder.getVoltage(received[7], received[8]);
-  float voltage2 = decoder.getVoltage(received[9], received[10]);
-  float power = decoder.getPower(received[11], received[12], received[13]);
-
-  Serial.println(now.year());
-  Serial.println(now.month());
-  Serial.println(now.day());
-  Serial.println(now.hour());
-  Serial.println(now.minute());
-  Serial.println(now.second());
-  Serial.println(current1);
-  Serial.println(current2);
-  Serial.println(voltage1);
-  Serial.println(voltage2);
-  Serial.println(power);
-
-  if(lastDLData != now.unixtime()){
-    mqtt->loop();
-    delay(10);  // <- fixes some issues with WiFi stability
-    if (!mqttClient->connected()) {
-      connect();
-      delay(500);
+void readDiagnostics(char* received, int packetSize){
+  DateTime now = recordDate(decoder, received);
+  uint8_t from = decoder.getFrom(received[0]);
+  String payload = diagnosticsRecord(decoder, received, packetSize);
+  if(payload.length() == 0){
+    Serial.println("Diagnostics frame too short: " + String(packetSize) + " bytes");
+    metrics.rejected++;
+    return;
+  }
+  Serial.println(payload);
+
+  if(lastDiagData[from] != now.unixtime()){
+    //ACK once the record is in the cloud or safely in the backlog
+    if(deliverRecord("/diagnostics", payload)){
+      sendACK(from);
+      lastDiagData[from] = now.unixtime();
     }
+  }
+  else{
+    metrics.duplicates++;
+    setupLoRa();
+    sendACK(from);
+  }
+}
+
+void readDataLoggerData(char* received, int packetSize){
+  DateTime now = recordDate(decoder, received);
+  uint8_t type = decoder.getRecordType(received[0], received[5]);
+  if(type > RECORD_EVENT){
+    metrics.rejected++;
+    return;
+  }
+  String payload = dataLoggerRecord(decoder, received, packetSize);
+  if(payload.length() == 0){
+    Serial.println("Data logger frame too short: " + String(packetSize) + " bytes");
+    metrics.rejected++;
+    return;
+  }
+  Serial.println(payload);
 
-    bool sent = publishTelemetry("/datalogger",
-        "{\"DATE\": \""+String(now.year())+"-"+String(now.month())+"-"+String(now.day())+
-        "\",\"TIME\": \""+String(now.hour())+":"+String(now.minute())+":"+String(now.second())+
-        "\",\"ADC00\": "+String(current1)+
-        ",\"ADC01\": "+String(current2)+
-        /*",\"ADC02\": "+data[2]+
-        ",\"ADC03\": "+data[3]+
-        ",\"ADC04\": "+data[4]+
-        ",\"ADC05\": "+data[5]+
-        ",\"ADC06\": "+data[6]+
-        ",\"ADC07\": "+data[7]+
-        ",\"ADC10\": "+data[8]+
-        ",\"ADC11\": "+data[9]+
-        ",\"ADC12\": "+data[10]+
-        ",\"ADC13\": "+data[11]+
-        ",\"ADC14\": "+data[12]+
-        ",\"ADC15\": "+data[13]+
-        ",\"ADC16\": "+data[14]+
-        ",\"ADC17\": "+data[15]+
-        ",\"ADC20\": "+data[16]+
-        ",\"ADC21\": "+data[17]+
-        ",\"ADC22\": "+data[18]+
-        ",\"ADC23\": "+data[19]+*/
-        ",\"ADC24\": "+String(voltage1)+
-        ",\"ADC25\": "+String(voltage2)+
-        ",\"ADC26\": 0"+
-        /*",\"ADC27\": "+data[23]+
-        ",\"ADC30\": "+data[24]+
-        ",\"ADC31\": "+data[25]+
-        ",\"ADC32\": "+data[26]+
-        ",\"ADC33\": "+data[27]+
-        ",\"ADC34\": "+data[28]+
-        ",\"ADC35\": "+data[29]+
-        ",\"ADC36\": "+data[30]+
-        ",\"ADC37\": "+data[31]+
-        ",\"ADC40\": "+data[32]+
-        ",\"ADC41\": "+data[33]+
-        ",\"ADC42\": "+data[34]+
-        ",\"ADC43\": "+data[35]+
-        ",\"ADC44\": "+data[36]+
-        ",\"ADC45\": "+data[37]+
-        ",\"ADC46\": "+data[38]+
-        ",\"ADC47\": "+data[39]+*/
-        ",\"ADC50\": "+String(power)+
-        /*",\"ADC51\": "+data[41]+
-        ",\"ADC52\": "+data[42]+
-        ",\"ADC53\": "+data[43]+
-        ",\"ADC54\": "+data[44]+
-        ",\"ADC55\": "+data[45]+
-        ",\"ADC56\": "+data[46]+
-        ",\"ADC57\": "+data[47]+*/
-        "}");
+  uint16_t first = type == RECORD_EVENT ? eventFirstSample(decoder, received, packetSize) : 0;
+
+  if(lastDLData[type] != now.unixtime() || (type == RECORD_EVENT && lastEventFirst != first)){
+    bool sent = deliverRecord(type == RECORD_EVENT ? "/events" : "/datalogger", payload);
 
     display.clear();
     display.drawString(0, 0, "Data logger data received");
@@ -341,23 +566,33 @@ void readDataLoggerData(char* received){
                               " "+String(now.hour())+":"+String(now.minute())+":"+String(now.second()));
     display.display();
 
-    //fixes some issues with LoRA stability
+    //ACK once the record is in the cloud or safely in the backlog
     if (sent){
       sendACK(DATALOGGER);
-      lastDLData = now.unixtime();
+      lastDLData[type] = now.unixtime();
+      if(type == RECORD_EVENT){
+        lastEventFirst = first;
+      }
     }
-    else esp_restart();
   }
   else{
+    metrics.duplicates++;
     setupLoRa();
-    sendACK(STATION);
+    sendACK(DATALOGGER);
   }
 }
 
 void loop(){
+  //parsePacket() still runs every spin, it re-arms the receiver
+  uint8_t irqFlags = digitalRead(DI00) == HIGH ? readLoRaIrqFlags() : 0;
   int packetSize = LoRa.parsePacket();
+
+  if (packetSize == 0 && (irqFlags & IRQ_PAYLOAD_CRC_ERROR_MASK)){
+    metrics.crcErrors++;
+  }
  
   if (packetSize > 0){
+    packetReceivedAt = millis();
     char received[packetSize];
     int cursor = 0;
  
@@ -366,25 +601,64 @@ void loop(){
       cursor++;
     }
 
-    if(decoder.getTo(received[0]) == GATEWAY){
+    if(packetSize < RECORD_MIN_SIZE){
+      //Every field read below, the record type included, is past the end
+      metrics.rejected++;
+    }
+    else if(decoder.getTo(received[0]) == GATEWAY && !timeSynced()){
+      //Nodes take their clock from the ACK, keep the frame there until NTP answers
+      Serial.println("Clock not synced, frame not acknowledged");
+    }
+    else if(decoder.getTo(received[0]) == GATEWAY){
       timerWrite(timer, 0);
-      if(decoder.getFrom(received[0]) == STATION){
+      metrics.packetsReceived++;
+      if(decoder.getRecordType(received[0], received[5]) == RECORD_DIAG &&
+         (decoder.getFrom(received[0]) == STATION || decoder.getFrom(received[0]) == DATALOGGER)){
+        Serial.println("Diagnostics received");
+
+        readDiagnostics(received, packetSize);
+      }
+      else if(decoder.getFrom(received[0]) == STATION){
         digitalWrite(25, HIGH);   // indicative LED
 
         Serial.println("Station data received");
 
-        readStationData(received);
+        readStationData(received, packetSize);
         digitalWrite(25, LOW);   // indicative LED
       }
-
-      if(decoder.getFrom(received[0]) == DATALOGGER){
+      else if(decoder.getFrom(received[0]) == DATALOGGER){
         digitalWrite(25, HIGH);   // indicative LED
 
         Serial.println("Data Logger data received");
 
-        readDataLoggerData(received);
+        readDataLoggerData(received, packetSize);
         digitalWrite(25, LOW);   // indicative LED
       }
+
+      if(decoder.getFrom(received[0]) != STATION && decoder.getFrom(received[0]) != DATALOGGER){
+        metrics.rejected++;
+      }
+    }
+    else{
+      metrics.rejected++;
     }
   }
+  else{
+    //Cloud link is stepped only between frames so the radio keeps receiving
+    mqtt->loop();
+    if(mqttClient->connected() && !wasConnected){
+      if(everConnected){
+        metrics.reconnects++;
+      }
+      everConnected = true;
+      metrics.handshakeLatency.record(netClient->lastHandshakeMs());
+      if(netClient->lastResumed()){
+        metrics.tlsResumed++;
+      }
+    }
+    wasConnected = mqttClient->connected();
+
+    replayBacklog();
+    reportMetrics();
+  }
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Arduino and FreeRTOS API for building data logger
+*               code on Linux (bench)
+*****************************************************************************/
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <thread>
+
+HostSerial Serial;
+SPIClass SPI;
+
+static const std::chrono::steady_clock::time_point hostStart = std::chrono::steady_clock::now();
+
+unsigned long millis(){
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - hostStart).count();
+}
+
+unsigned long micros(){
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - hostStart).count();
+}
+
+void delay(unsigned long ms){
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Arduino and FreeRTOS API for building data logger
+*               code on Linux (bench)
+*****************************************************************************/
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define LOW    0
+#define HIGH   1
+#define INPUT  0
+#define OUTPUT 1
+
+#define IRAM_ATTR
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+
+// Critical sections are a no-op: the benches run single threaded
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL(mux)
+#define portENTER_CRITICAL_ISR(mux)
+#define portEXIT_CRITICAL_ISR(mux)
+#define portYIELD_FROM_ISR()
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+#define pdFALSE 0
+#define pdTRUE  1
+#define portMAX_DELAY 0xFFFFFFFF
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// Tasks are never started, code under test is called directly
+inline BaseType_t xTaskCreatePinnedToCore(void (*)(void *), const char *, uint32_t, void *, int,
+                                          TaskHandle_t *handle, int){
+  if(handle){
+    *handle = NULL;
+  }
+  return pdTRUE;
+}
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return NULL; }
+inline void xTaskNotifyGive(TaskHandle_t) {}
+inline void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t *) {}
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+
+typedef std::timed_mutex *SemaphoreHandle_t;
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new std::timed_mutex; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks){
+  return ticks == portMAX_DELAY ? (mutex->lock(), pdTRUE) :
+         mutex->try_lock_for(std::chrono::milliseconds(ticks));
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) { mutex->unlock(); return pdTRUE; }
+
+struct hw_timer_t {};
+inline hw_timer_t *timerBegin(uint8_t, uint16_t, bool) { static hw_timer_t timer; return &timer; }
+inline void timerAttachInterrupt(hw_timer_t *, void (*)(), bool) {}
+inline void timerAlarmWrite(hw_timer_t *, uint64_t, bool) {}
+inline void timerAlarmEnable(hw_timer_t *) {}
+
+// Serial goes to stdout
+class HostSerial {
+  public:
+    void begin(unsigned long) {}
+    void print(const char *s) { fputs(s, stdout); }
+    void println(const char *s) { puts(s); }
+    void println() { fputc('\n', stdout); }
+    int printf(const char *format, ...){
+      va_list args;
+      va_start(args, format);
+      int n = vprintf(format, args);
+      va_end(args);
+      return n;
+    }
+};
+
+extern HostSerial Serial;
+
+#endif
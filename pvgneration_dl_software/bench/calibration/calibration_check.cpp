@@ -0,0 +1,260 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Host check of the fixed-point Calibration against the double
+*               then float conversion the data logger used before it
+*****************************************************************************/
+
+// Usage: calibration_check [-v]
+//
+// Sweeps every ADS8668 code through the current, voltage and power channels
+// under four settings sets and compares Calibration::toTenths() with the
+// old path: the adcread formula in double, cast to float, rounded by
+// DataEncDec, and with the exact value of the formula. Fixed point must be
+// the correctly rounded value for every pair. The old path is known to
+// differ on 35 of them, by one tenth next to a tie, where the double and
+// float steps moved the value across it. -v prints those pairs.
+// Exits with 1 if a check fails, so it can gate changes to calibration.cpp.
+
+#include <Arduino.h>
+
+#include "DataEncDec.h"
+#include "ads8668.h"
+#include "acquisition.h"
+#include "calibration.h"
+
+#define KNOWN_DIFFERENCES 35
+
+// Settings of the transducers, as in myLog.getSettings(): current, voltage
+// 400, voltage 500 (not logged here) and power
+const float SETTINGS[4][4] = {{2, 200, 0, 3600}, {2.5, 69.4, 97.3, 3589.9},
+                              {1.7, 123.45, 0, 1234.5}, {3.3, 640, 0, 4400}};
+
+#define CHANNELS 3
+const char *channelNames[CHANNELS] = {"current", "voltage", "power"};
+const float channelMin[CHANNELS] = {0, 0, -9000};
+const float channelMax[CHANNELS] = {25.5, 6553.5, 9000};
+
+int failures = 0;
+bool verbose = false;
+float settings[4];
+
+// Same formulas as main.cpp
+double adcread5ToCurrent10(double adcread)
+{
+  return adcread*settings[0];
+}
+
+double adcread10ToVoltage400(double adcread)
+{
+  return adcread*settings[1];
+}
+
+double adcread5ToPower9k(double adcread)
+{
+  return -((adcread*settings[3])-9000.0);
+}
+
+double (*channelConvert[CHANNELS])(double) = {adcread5ToCurrent10, adcread10ToVoltage400,
+                                              adcread5ToPower9k};
+
+void check(bool ok, const char *name)
+{
+  Serial.printf("  %s  %s\n", ok ? "ok  " : "FAIL", name);
+  if(!ok){
+    failures++;
+  }
+}
+
+// Old path: the value constrained in double, sent as a float through
+// DataEncDec, decoded back to tenths
+int32_t oldTenths(int channel, double value)
+{
+  DataEncDec encoder(4);
+  float sent = constrain(value, channelMin[channel], channelMax[channel]);
+  uint8_t *bytes = (uint8_t *)encoder.getBuffer();
+  switch(channel){
+    case 0:
+      encoder.addCurrent(sent);
+      return bytes[0];
+    case 1:
+      encoder.addVoltage(sent);
+      return (bytes[0] << 8) | bytes[1];
+    default:
+      encoder.addPower(sent);
+      return (int32_t)((bytes[0] << 16) | (bytes[1] << 8) | bytes[2]) - 90000;
+  }
+}
+
+// The formulas are affine in the input with one float setting each, so
+// the exact value is a fraction: the setting is M/2^p, the input code/400 V
+void exactFraction(int channel, int code, int64_t &num, int64_t &den)
+{
+  int exponent;
+  float setting = settings[channel == 0 ? 0 : channel == 1 ? 1 : 3];
+  int64_t mantissa = (int64_t)ldexp(frexp(setting, &exponent), 24);
+  den = 40LL << (24 - exponent);  // tenths per volt times 400 codes per volt
+  num = code*mantissa;
+  if(channel == 2){
+    num = 90000*den - num;
+  }
+}
+
+// Correctly rounded half away from zero, then constrained
+int32_t exactTenths(int channel, int code)
+{
+  int64_t num;
+  int64_t den;
+  exactFraction(channel, code, num, den);
+  int64_t rounded = num < 0 ? -((-2*num + den)/(2*den)) : (2*num + den)/(2*den);
+  return constrain(rounded, lround(channelMin[channel]*10), lround(channelMax[channel]*10));
+}
+
+// Distance of the exact value from the nearest half tenth, in tenths
+double tieDistance(int channel, int code)
+{
+  int64_t num;
+  int64_t den;
+  exactFraction(channel, code, num, den);
+  int64_t rest = (num%den + den)%den;
+  return fabs(2.0*rest - den)/(2.0*den);
+}
+
+void testPerCode()
+{
+  Serial.println("per code");
+  long pairs = 0;
+  long differences = 0;
+  double farthest = 0;
+  bool allOneTenth = true;
+  bool allExact = true;
+
+  for(int s = 0; s < 4; s++){
+    memcpy(settings, SETTINGS[s], sizeof(settings));
+    Calibration calibration;
+    for(int c = 0; c < CHANNELS; c++){
+      calibration.set(c, channelConvert[c], channelMin[c], channelMax[c]);
+    }
+    for(int c = 0; c < CHANNELS; c++){
+      for(int code = 0; code < 4096; code++){
+        double value = channelConvert[c](code*ADS8668_LSB);
+        int32_t fixed = calibration.toTenths(c, code);
+        int32_t old = oldTenths(c, value);
+        pairs++;
+        allExact = allExact && fixed == exactTenths(c, code);
+        if(fixed == old){
+          continue;
+        }
+        differences++;
+        allOneTenth = allOneTenth && abs(fixed - old) == 1;
+        farthest = max(farthest, tieDistance(c, code));
+        if(verbose){
+          Serial.printf("    settings %d %-7s code %4d fixed %7d old %7d value %.6f\n",
+                        s, channelNames[c], code, fixed, old, value*10);
+        }
+      }
+    }
+  }
+
+  Serial.printf("    %ld of %ld pairs differ, at most %.2e tenths from a tie\n", differences, pairs, farthest);
+  check(pairs == 4*CHANNELS*4096, "every code of every channel and settings set");
+  check(differences == KNOWN_DIFFERENCES, "differences from the old path are the known ones");
+  check(allOneTenth, "each difference is one tenth");
+  check(farthest < 2e-3, "each difference is within 2e-3 tenths of a tie");
+  check(allExact, "fixed point is the correctly rounded value");
+}
+
+// Statistics of random blocks against the double formulas of the old
+// channelSummary(), within half a tenth of rounding
+void testSummary()
+{
+  Serial.println("summary");
+  srand(1);
+  long outside = 0;
+  long values = 0;
+
+  for(int s = 0; s < 4; s++){
+    memcpy(settings, SETTINGS[s], sizeof(settings));
+    Calibration calibration;
+    for(int c = 0; c < CHANNELS; c++){
+      calibration.set(c, channelConvert[c], channelMin[c], channelMax[c]);
+    }
+    for(int trial = 0; trial < 50; trial++){
+      int n = 1 + rand()%60000;
+      int base = rand()%4096;
+      int spread = 1 + rand()%200;
+      RunningStats stats;
+      stats.reset();
+      double sum = 0;
+      double sumSq = 0;
+      for(int i = 0; i < n; i++){
+        int code = min(4095, base + rand()%spread);
+        stats.add(code);
+        sum += code;
+        sumSq += (double)code*code;
+      }
+      double codeMean = sum/n;
+      double codeVar = max(0.0, sumSq/n - codeMean*codeMean);
+
+      for(int c = 0; c < CHANNELS; c++){
+        double offset = channelConvert[c](0);
+        double gain = channelConvert[c](ADS8668_LSB) - offset;
+        double mean = gain*codeMean + offset;
+        double low = gain*stats.getMin() + offset;
+        double high = gain*stats.getMax() + offset;
+        double std = fabs(gain)*sqrt(codeVar);
+        double rms = sqrt(mean*mean + std*std);
+        double reference[5] = {mean, min(low, high), max(low, high), rms, std};
+
+        int32_t out[5];
+        calibration.summary(c, stats, out);
+        for(int k = 0; k < 5; k++){
+          double r = constrain(reference[k], channelMin[c], channelMax[c])*10;
+          values++;
+          if(fabs(out[k] - r) > 0.5 + 1e-6*fabs(r)){
+            outside++;
+            if(verbose){
+              Serial.printf("    settings %d %-7s stat %d got %d reference %.4f\n",
+                            s, channelNames[c], k, out[k], r);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  Serial.printf("    %ld of %ld values off by more than half a tenth\n", outside, values);
+  check(outside == 0, "summaries round the double statistics");
+
+  Calibration calibration;
+  memcpy(settings, SETTINGS[0], sizeof(settings));
+  calibration.set(2, adcread5ToPower9k, -9000, 9000);
+  RunningStats empty;
+  empty.reset();
+  int32_t out[5];
+  calibration.summary(2, empty, out);
+  check(out[0] == 0 && out[3] == 0 && out[4] == 0, "no samples gives zeros");
+}
+
+int main(int argc, char **argv)
+{
+  verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+
+  testPerCode();
+  testSummary();
+
+  Serial.printf("%d failure(s)\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,276 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for timer-paced ADS8668 sampling with per-minute
+*               statistics
+*****************************************************************************/
+
+#include "acquisition.h"
+#include "transient.h"
+
+Acquisition *Acquisition::instance = NULL;
+
+// ========= Running statistics ============
+void RunningStats::reset()
+{
+  n = 0;
+  sum = 0;
+  sumSq = 0;
+  minCode = 0;
+  maxCode = 0;
+}
+
+void RunningStats::add(uint16_t code)
+{
+  n++;
+  sum += code;
+  sumSq += (uint32_t)code*code;
+
+  if(n == 1 || code < minCode){
+    minCode = code;
+  }
+  if(n == 1 || code > maxCode){
+    maxCode = code;
+  }
+}
+
+void RunningStats::merge(RunningStats &other)
+{
+  if(other.n == 0){
+    return;
+  }
+  if(n == 0){
+    *this = other;
+    return;
+  }
+
+  n += other.n;
+  sum += other.sum;
+  sumSq += other.sumSq;
+  if(other.minCode < minCode){
+    minCode = other.minCode;
+  }
+  if(other.maxCode > maxCode){
+    maxCode = other.maxCode;
+  }
+}
+
+uint32_t RunningStats::count()
+{
+  return n;
+}
+
+int64_t RunningStats::getSum()
+{
+  return sum;
+}
+
+int64_t RunningStats::getSumSq()
+{
+  return sumSq;
+}
+
+uint16_t RunningStats::getMin()
+{
+  return minCode;
+}
+
+uint16_t RunningStats::getMax()
+{
+  return maxCode;
+}
+
+// ========= Init ============
+// Returns the index of the channel in the statistics, a channel added twice
+// keeps its first index
+int Acquisition::addChannel(int adcNum, int adcCH)
+{
+  for(int c = 0; c < nChannels; c++){
+    if(chDevice[c] == adcNum && chChannel[c] == adcCH){
+      return c;
+    }
+  }
+  if(nChannels >= ACQ_MAX_CHANNELS){
+    return -1;
+  }
+  chDevice[nChannels] = adcNum;
+  chChannel[nChannels] = adcCH;
+  return nChannels++;
+}
+
+void Acquisition::begin(ADS8668 *device, SpiBus *spiBus, uint32_t rate)
+{
+  adc = device;
+  bus = spiBus;
+  //Waiting longer than one period would only delay the next tick
+  busTimeout = max((TickType_t)1, (TickType_t)pdMS_TO_TICKS(1000/rate));
+  periodUs = 1000000/rate;
+  instance = this;
+
+  fillBlock = 0;
+  fillCount = 0;
+  readyBlock = -1;
+  missed = 0;
+  overruns = 0;
+  for(int c = 0; c < ACQ_MAX_CHANNELS; c++){
+    stats[c].reset();
+  }
+
+  xTaskCreatePinnedToCore(
+    foldCode,   /* Function to implement the task */
+    "foldData", /* Name of the task */
+    4096,       /* Stack size in words */
+    NULL,       /* Task input parameter */
+    1,          /* Priority of the task */
+    &foldTask,  /* Task handle. */
+    0);         /* Core where the task should run */
+
+  xTaskCreatePinnedToCore(
+    sampleCode,   /* Function to implement the task */
+    "sampleData", /* Name of the task */
+    4096,         /* Stack size in words */
+    NULL,         /* Task input parameter */
+    3,            /* Priority of the task */
+    &sampleTask,  /* Task handle. */
+    1);           /* Core where the task should run */
+
+  //1 MHz tick
+  timer = timerBegin(ACQ_TIMER, 80, true);
+  timerAttachInterrupt(timer, &onTimer, true);
+  timerAlarmWrite(timer, 1000000/rate, true);
+  timerAlarmEnable(timer);
+}
+
+// Every sample is also passed to the transient capture
+void Acquisition::setTransient(Transient *capture)
+{
+  transient = capture;
+}
+
+// Tick jitter and scan time go to the DIAG_JITTER and DIAG_READ stages
+void Acquisition::setTiming(Timing *stageTiming)
+{
+  timing = stageTiming;
+}
+
+// ========= Statistics ============
+// Copies the statistics of the period and starts a new one
+void Acquisition::takeStats(RunningStats *out)
+{
+  portENTER_CRITICAL(&statsMux);
+  for(int c = 0; c < nChannels; c++){
+    out[c] = stats[c];
+    stats[c].reset();
+  }
+  portEXIT_CRITICAL(&statsMux);
+}
+
+uint32_t Acquisition::getMissed()
+{
+  return missed;
+}
+
+uint32_t Acquisition::getOverruns()
+{
+  return overruns;
+}
+
+// ========= Tasks ============
+void IRAM_ATTR Acquisition::onTimer()
+{
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(instance->sampleTask, &woken);
+  if(woken){
+    portYIELD_FROM_ISR();
+  }
+}
+
+void Acquisition::sampleCode(void *parameter)
+{
+  for(;;){
+    uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    if(ticks > 1){
+      instance->missed += ticks - 1;
+    }
+    if(instance->timing != NULL){
+      instance->timing->tick(ticks*instance->periodUs);
+    }
+    instance->sample();
+  }
+}
+
+void Acquisition::foldCode(void *parameter)
+{
+  for(;;){
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    instance->fold(instance->readyBlock);
+    instance->readyBlock = -1;
+  }
+}
+
+void Acquisition::sample()
+{
+  //The tick is skipped if SD or LoRa keep the bus for a whole period
+  if(!bus->take(SPI_CLIENT_ADC, busTimeout)){
+    missed++;
+    return;
+  }
+  int64_t start = Timing::now();
+  adc->scan();
+  bus->give(SPI_CLIENT_ADC);
+  if(timing != NULL){
+    timing->record(DIAG_READ, start);
+  }
+
+  for(int c = 0; c < nChannels; c++){
+    blocks[fillBlock][fillCount][c] = adc->getCode(chDevice[c], chChannel[c]);
+  }
+  if(transient != NULL){
+    transient->add(blocks[fillBlock][fillCount]);
+  }
+  fillCount++;
+
+  if(fillCount == ACQ_BLOCK){
+    fillCount = 0;
+    if(readyBlock >= 0){
+      //Previous block still being folded, this one is dropped
+      overruns++;
+      return;
+    }
+    readyBlock = fillBlock;
+    fillBlock = 1 - fillBlock;
+    xTaskNotifyGive(foldTask);
+  }
+}
+
+// The block is folded outside the lock and merged in, so takeStats() only
+// waits for the merge
+void Acquisition::fold(int block)
+{
+  RunningStats partial[ACQ_MAX_CHANNELS];
+
+  for(int c = 0; c < nChannels; c++){
+    partial[c].reset();
+    for(int s = 0; s < ACQ_BLOCK; s++){
+      partial[c].add(blocks[block][s][c]);
+    }
+  }
+
+  portENTER_CRITICAL(&statsMux);
+  for(int c = 0; c < nChannels; c++){
+    stats[c].merge(partial[c]);
+  }
+  portEXIT_CRITICAL(&statsMux);
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for timer-paced ADS8668 sampling with per-minute
+*               statistics
+*****************************************************************************/
+
+#ifndef ACQUISITION_H
+#define ACQUISITION_H
+
+#include <Arduino.h>
+#include "ads8668.h"
+#include "spibus.h"
+#include "timing.h"
+
+#define ACQ_SAMPLE_RATE   100  // Hz, up to 1000
+#define ACQ_TIMER         1    // hardware timer 0 is the watchdog
+#define ACQ_BLOCK         32   // samples per buffer
+#define ACQ_MAX_CHANNELS  48 // every channel of the 6 ADS8668
+
+class Transient;
+
+// Sum and sum of squares plus min and max, in ADC codes. The 12 bit codes
+// keep the sums exact in 64 bits, so mean and variance need no float math
+// until Calibration::summary().
+class RunningStats
+{
+private:
+  uint32_t n;
+  int64_t sum;
+  int64_t sumSq;
+  uint16_t minCode;
+  uint16_t maxCode;
+
+public:
+  void reset();
+  void add(uint16_t code);
+  void merge(RunningStats &other);
+  uint32_t count();
+  int64_t getSum();
+  int64_t getSumSq();
+  uint16_t getMin();
+  uint16_t getMax();
+};
+
+// Samples the channels at a fixed rate from a hardware timer. Samples go
+// into one of two blocks while the other block is folded into the
+// statistics, so sampling never waits for the math.
+class Acquisition
+{
+private:
+  ADS8668 *adc;
+  SpiBus *bus;
+  TickType_t busTimeout;
+  Transient *transient = NULL;
+  Timing *timing = NULL;
+  uint32_t periodUs;
+  hw_timer_t *timer = NULL;
+  TaskHandle_t sampleTask;
+  TaskHandle_t foldTask;
+  portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+  int nChannels = 0;
+  uint8_t chDevice[ACQ_MAX_CHANNELS];
+  uint8_t chChannel[ACQ_MAX_CHANNELS];
+
+  uint16_t blocks[2][ACQ_BLOCK][ACQ_MAX_CHANNELS];
+  int fillBlock;
+  int fillCount;
+  volatile int readyBlock;
+
+  RunningStats stats[ACQ_MAX_CHANNELS];
+  volatile uint32_t missed;
+  volatile uint32_t overruns;
+
+  static Acquisition *instance;
+
+public:
+  int addChannel(int adcNum, int adcCH);
+  void begin(ADS8668 *device, SpiBus *spiBus, uint32_t rate);
+  void setTransient(Transient *capture);
+  void setTiming(Timing *stageTiming);
+  void takeStats(RunningStats *out);
+  uint32_t getMissed();
+  uint32_t getOverruns();
+
+private:
+  static void IRAM_ATTR onTimer();
+  static void sampleCode(void *parameter);
+  static void foldCode(void *parameter);
+  void sample();
+  void fold(int block);
+};
+
+#endif
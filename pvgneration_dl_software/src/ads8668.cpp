@@ -0,0 +1,158 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for scan the daisy-chained ADS8668 ADCs
+*****************************************************************************/
+
+#include "ads8668.h"
+
+// ========= Init ============
+void ADS8668::init(int cs, int rst, int devices)
+{
+  csPin = cs;
+  rstPin = rst;
+  nDisp = devices;
+  if(nDisp > ADS8668_MAX_DEVICES){
+    nDisp = ADS8668_MAX_DEVICES;
+  }
+
+  digitalWrite(rstPin, LOW);
+  digitalWrite(rstPin, HIGH);
+
+  for(int ch = 0; ch < ADS8668_CHANNELS; ch++){
+    writeRegister(ADS8668_RANGE_CH0 + ch, ADS8668_RANGE_0_10V);
+  }
+
+  for(int i = 0; i < ADS8668_MAX_DEVICES; i++){
+    channelMask[i] = 0;
+    for(int j = 0; j < ADS8668_CHANNELS; j++){
+      codes[i][j] = 0;
+    }
+  }
+  seqLength = 0;
+  scanTime = 0;
+}
+
+// ========= Channel set ============
+void ADS8668::enableChannel(int adcNum, int adcCH)
+{
+  channelMask[adcNum] |= (1 << adcCH);
+}
+
+void ADS8668::disableChannel(int adcNum, int adcCH)
+{
+  channelMask[adcNum] &= ~(1 << adcCH);
+}
+
+// Programs the sequencer with the union of the enabled channels and powers
+// the others down, then arms the first scan
+void ADS8668::applyChannels()
+{
+  uint8_t mask = 0;
+  for(int i = 0; i < nDisp; i++){
+    mask |= channelMask[i];
+  }
+
+  seqLength = 0;
+  for(int ch = 0; ch < ADS8668_CHANNELS; ch++){
+    if(mask & (1 << ch)){
+      sequence[seqLength++] = ch;
+    }
+  }
+
+  writeRegister(ADS8668_AUTO_SEQ_EN, mask);
+  writeRegister(ADS8668_CH_PWR_DN, ~mask);
+
+  SPI.beginTransaction(settings);
+  transferFrame(ADS8668_AUTO_RST);
+  SPI.endTransaction();
+}
+
+// ========= Scan ============
+// One frame per sequenced channel, each frame returns that channel of every
+// device
+void ADS8668::scan()
+{
+  if(seqLength == 0){
+    return;
+  }
+
+  unsigned long start = micros();
+
+  SPI.beginTransaction(settings);
+  for(int k = 0; k < seqLength; k++){
+    transferFrame(k == seqLength-1 ? ADS8668_AUTO_RST : ADS8668_NO_OP);
+
+    int ch = sequence[k];
+    for(int i = 0; i < nDisp; i++){
+      uint8_t *word = &rxFrame[2 + 2*(nDisp-1-i)];
+      codes[i][ch] = (word[0] << 4) | (word[1] >> 4);
+    }
+  }
+  SPI.endTransaction();
+
+  scanTime = micros() - start;
+}
+
+// ========= Get data ============
+uint16_t ADS8668::getCode(int adcNum, int adcCH)
+{
+  return codes[adcNum][adcCH];
+}
+
+double ADS8668::getVoltage(int adcNum, int adcCH)
+{
+  return codes[adcNum][adcCH]*ADS8668_LSB;
+}
+
+int ADS8668::getSequenceLength()
+{
+  return seqLength;
+}
+
+unsigned long ADS8668::getScanTime()
+{
+  return scanTime;
+}
+
+// ========= Aux functions ============
+void ADS8668::writeRegister(uint8_t address, uint8_t value)
+{
+  // Register writes are padded as long as the chain needs to pass the
+  // command to the last device
+  static const uint8_t padding[32*ADS8668_MAX_DEVICES] = {0};
+  uint8_t command[2] = {(uint8_t)((address << 1) | 1), value};
+
+  SPI.beginTransaction(settings);
+  digitalWrite(csPin, LOW);
+  SPI.writeBytes(command, 2);
+  SPI.writeBytes(padding, 32*nDisp);
+  digitalWrite(csPin, HIGH);
+  SPI.endTransaction();
+}
+
+void ADS8668::transferFrame(uint16_t command)
+{
+  int length = 2 + 2*nDisp;
+  txFrame[0] = command >> 8;
+  txFrame[1] = command & 0xFF;
+  for(int i = 2; i < length; i++){
+    txFrame[i] = 0x00;
+  }
+
+  digitalWrite(csPin, LOW);
+  SPI.transferBytes(txFrame, rxFrame, length);
+  digitalWrite(csPin, HIGH);
+}
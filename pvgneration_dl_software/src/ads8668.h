@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for scan the daisy-chained ADS8668 ADCs
+*****************************************************************************/
+
+#ifndef ADS8668_H
+#define ADS8668_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#define ADS8668_CHANNELS    8
+#define ADS8668_MAX_DEVICES 6
+#define ADS8668_LSB         0.0025  // V per code, 0 to 10.24 V range
+
+//Commands
+#define ADS8668_NO_OP    0x0000
+#define ADS8668_AUTO_RST 0xA000
+//Program registers
+#define ADS8668_AUTO_SEQ_EN  0x01
+#define ADS8668_CH_PWR_DN    0x02
+#define ADS8668_RANGE_CH0    0x05
+#define ADS8668_RANGE_0_10V  0x05  // 0 to 2.5 x VREF
+
+// The devices share CS, SCLK and SDI, so every command and register write
+// reaches all of them: the sequence is the union of the enabled channels.
+// Each frame is the 16 bit command followed by 16 bits per device, the last
+// device of the chain first. The sequencer is reset (AUTO_RST) in the last
+// frame of a scan, so the next scan starts at its first channel without an
+// extra frame.
+class ADS8668
+{
+private:
+  SPISettings settings = SPISettings(8000000, MSBFIRST, SPI_MODE0);
+  int csPin;
+  int rstPin;
+  int nDisp;
+
+  uint8_t channelMask[ADS8668_MAX_DEVICES];  // channels read per device
+  uint8_t sequence[ADS8668_CHANNELS];        // scan order
+  int seqLength;
+
+  uint16_t codes[ADS8668_MAX_DEVICES][ADS8668_CHANNELS];  // 12 bit codes
+  uint8_t txFrame[2 + 2*ADS8668_MAX_DEVICES];
+  uint8_t rxFrame[2 + 2*ADS8668_MAX_DEVICES];
+  unsigned long scanTime;
+
+public:
+  void init(int cs, int rst, int devices);
+  void enableChannel(int adcNum, int adcCH);
+  void disableChannel(int adcNum, int adcCH);
+  void applyChannels();
+  void scan();
+  uint16_t getCode(int adcNum, int adcCH);
+  double getVoltage(int adcNum, int adcCH);
+  int getSequenceLength();
+  unsigned long getScanTime();
+
+private:
+  void writeRegister(uint8_t address, uint8_t value);
+  void transferFrame(uint16_t command);
+};
+
+#endif
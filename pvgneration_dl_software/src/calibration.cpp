@@ -0,0 +1,159 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for fixed-point conversion of ADS8668 codes
+*****************************************************************************/
+
+#include "calibration.h"
+
+// ========= Coefficients ============
+// convert takes the ADS8668 input in volts, as the adcread functions do
+void Calibration::set(int channel, double (*convert)(double), float minValue, float maxValue)
+{
+  double zero = convert(0)*10;
+  double perCode = (convert(ADS8668_LSB*4096)*10 - zero)/4096;
+
+  //gain below 2^30 keeps gain*sum and gain*sqrt() in 62 bits, the offset
+  //below 2^45 at the gain scale keeps offset*n (n < 2^17) in 62 bits
+  int shift = CAL_MAX_SHIFT;
+  while(shift > CAL_MIN_SHIFT && (fabs(perCode)*ldexp(1, shift) >= ldexp(1, 30) ||
+                                  fabs(zero)*ldexp(1, shift) >= ldexp(1, 45))){
+    shift--;
+  }
+  int oShift = shift;
+  while(oShift > 0 && fabs(zero)*ldexp(1, oShift) >= ldexp(1, 30)){
+    oShift--;
+  }
+
+  gain[channel] = llround(ldexp(perCode, shift));
+  offset[channel] = lround(ldexp(zero, oShift));
+  gainShift[channel] = shift;
+  offsetShift[channel] = oShift;
+  low[channel] = lround(minValue*10);
+  high[channel] = lround(maxValue*10);
+}
+
+// ========= Conversion ============
+int32_t Calibration::toTenths(int channel, uint16_t code)
+{
+  int64_t value = (int64_t)gain[channel]*code + scaledOffset(channel);
+  return clamp(channel, roundCode(channel, value, code));
+}
+
+// Mean, min, max, RMS and standard deviation in tenths. With x = g*code + o
+// the mean is g*S/n + o and the standard deviation |g|*sqrt(n*Q - S^2)/n,
+// S and Q being the sums of the codes and of their squares.
+void Calibration::summary(int channel, RunningStats &stats, int32_t *out)
+{
+  int64_t n = stats.count();
+  if(n == 0){
+    for(int k = 0; k < 5; k++){
+      out[k] = clamp(channel, 0);
+    }
+    return;
+  }
+
+  int shift = gainShift[channel];
+  int64_t g = gain[channel];
+  int64_t o = scaledOffset(channel);
+  int64_t sum = stats.getSum();
+
+  int64_t meanNum = g*sum + o*n;  // times n
+  int64_t lowValue = g*stats.getMin() + o;
+  int64_t highValue = g*stats.getMax() + o;
+  if(lowValue > highValue){
+    int64_t aux = lowValue;
+    lowValue = highValue;
+    highValue = aux;
+  }
+
+  //sqrt(n*Q - S^2) with as many extra bits as fit below 2^62, a few
+  //samples of a steep channel need them all
+  uint64_t varNum = n*stats.getSumSq() - sum*sum;
+  int bits = 0;
+  while(bits < CAL_ROOT_BITS && varNum < (1ULL << (60 - 2*bits))){
+    bits++;
+  }
+  uint64_t root = isqrt(varNum << (2*bits));
+  int64_t stdNum = (g < 0 ? -g : g)*(int64_t)root;  // times n*2^bits
+
+  //Mean and std in 1/4096 tenths, RMS = sqrt(mean^2 + std^2)
+  int64_t mean12 = roundDiv(meanNum, n << (shift - 12));
+  int64_t std12 = roundDiv(stdNum, (n << bits) << (shift - 12));
+  uint64_t rms12 = isqrt((uint64_t)(mean12*mean12) + (uint64_t)(std12*std12));
+
+  out[0] = clamp(channel, roundDiv(meanNum, n << shift));
+  out[1] = clamp(channel, roundCode(channel, lowValue, g < 0 ? stats.getMax() : stats.getMin()));
+  out[2] = clamp(channel, roundCode(channel, highValue, g < 0 ? stats.getMin() : stats.getMax()));
+  out[3] = clamp(channel, roundDiv(rms12, 4096));
+  out[4] = clamp(channel, roundDiv(std12, 4096));
+}
+
+// ========= Aux functions ============
+int64_t Calibration::scaledOffset(int channel)
+{
+  return (int64_t)offset[channel] << (gainShift[channel] - offsetShift[channel]);
+}
+
+int32_t Calibration::clamp(int channel, int64_t tenths)
+{
+  if(tenths < low[channel]){
+    return low[channel];
+  }
+  if(tenths > high[channel]){
+    return high[channel];
+  }
+  return tenths;
+}
+
+// A value of gain*code + offset carries up to code/2 units of the gain
+// rounding plus half the offset step. That much is added away from zero, so
+// a conversion that lands exactly on a half tenth rounds away from zero like
+// DataEncDec's round() instead of falling to either side of it.
+int64_t Calibration::roundCode(int channel, int64_t value, uint16_t code)
+{
+  int64_t slack = (code + (1LL << (gainShift[channel] - offsetShift[channel])))/2 + 1;
+  return roundDiv(value < 0 ? value - slack : value + slack, 1LL << gainShift[channel]);
+}
+
+// Division rounded half away from zero, den > 0
+int64_t Calibration::roundDiv(int64_t num, int64_t den)
+{
+  if(num < 0){
+    return -((-num + den/2)/den);
+  }
+  return (num + den/2)/den;
+}
+
+uint64_t Calibration::isqrt(uint64_t x)
+{
+  uint64_t root = 0;
+  uint64_t bit = 1ULL << 62;
+
+  while(bit > x){
+    bit >>= 2;
+  }
+  while(bit != 0){
+    if(x >= root + bit){
+      x -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else{
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
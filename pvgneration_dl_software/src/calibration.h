@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for fixed-point conversion of ADS8668 codes
+*****************************************************************************/
+
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <Arduino.h>
+#include "acquisition.h"
+
+#define CAL_MAX_SHIFT  40
+#define CAL_MIN_SHIFT  12
+#define CAL_ROOT_BITS  16  // fraction bits of the std square root
+
+// Results are in tenths of the channel unit, the 0.1 step DataEncDec sends
+// current, voltage and power with, rounded half away from zero like its
+// round(). The coefficients come from the double conversion functions, once
+// per settings change, each scaled by its own power of two to use the full
+// 32 bits. bench/calibration checks every code against the float path.
+class Calibration
+{
+private:
+  int32_t gain[ACQ_MAX_CHANNELS];    // tenths per code, Q(gainShift)
+  int32_t offset[ACQ_MAX_CHANNELS];  // tenths, Q(offsetShift)
+  uint8_t gainShift[ACQ_MAX_CHANNELS];
+  uint8_t offsetShift[ACQ_MAX_CHANNELS];
+  int32_t low[ACQ_MAX_CHANNELS];
+  int32_t high[ACQ_MAX_CHANNELS];
+
+public:
+  void set(int channel, double (*convert)(double), float minValue, float maxValue);
+  int32_t toTenths(int channel, uint16_t code);
+  void summary(int channel, RunningStats &stats, int32_t *out);
+
+private:
+  int64_t scaledOffset(int channel);
+  int32_t clamp(int channel, int64_t tenths);
+  int64_t roundCode(int channel, int64_t value, uint16_t code);
+  static int64_t roundDiv(int64_t num, int64_t den);
+  static uint64_t isqrt(uint64_t x);
+};
+
+#endif
@@ -18,10 +18,12 @@
 
 #include "log.h"
 
-void Log::init()
+void Log::init(SpiBus* spiBus)
 {
 
   decoder = new DataEncDec(0);
+  bus = spiBus;
+  fileLock = xSemaphoreCreateMutex();
 
   try
   {
@@ -107,6 +109,11 @@ void Log::init()
   {
     writeFile(SD, dataPath, "");
   }
+  //Creating the transient events folder
+  if(!fileExists(SD, eventDir))
+  {
+    createDir(SD, eventDir);
+  }
   //Creating settings file or reading
   if(!fileExists(SD, settingsPath))
   {
@@ -126,6 +133,12 @@ void Log::init()
   }
 }
 
+//Save and send durations go to the DIAG_SAVE and DIAG_SEND stages
+void Log::setTiming(Timing* stageTiming)
+{
+  timing = stageTiming;
+}
+
 void Log::setTime(int year, int month, int day, int hour, int min, int sec)
 {
   while (usingRTC){delay(10);}
@@ -204,12 +217,25 @@ float *Log::getSettings(){
   return transducer_settings;
 }
 
+//Changes each time the gateway sends new settings
+uint32_t Log::getSettingsVersion(){
+  return settingsVersion;
+}
+
 bool Log::saveData(String data)
 {
   bool newDay = false;
   String dataString = getTime() + "," + data + "\n";
 
+  int64_t start = Timing::now();
+  xSemaphoreTake(fileLock, portMAX_DELAY);
+  bus->take(SPI_CLIENT_SD);
   appendFile(SD, dataPath, dataString.c_str());
+  bus->give(SPI_CLIENT_SD);
+  xSemaphoreGive(fileLock);
+  if(timing != NULL){
+    timing->record(DIAG_SAVE, start);
+  }
 
   //Return TRUE if is next second is a new day to reset rain counter
   if(now.hour() >= 23 && now.minute() >= 59 && now.second() >= 59)
@@ -223,23 +249,113 @@ bool Log::saveData(String data)
 }
 
 String Log::readData(){
-  return readFileLine(SD, dataPath);
+  bus->take(SPI_CLIENT_SD);
+  String line = readFileLine(SD, dataPath);
+  bus->give(SPI_CLIENT_SD);
+  return line;
 }
 
 void Log::removeSentData(){
+  xSemaphoreTake(fileLock, portMAX_DELAY);
   removeFileLine(SD, dataPath);
+  xSemaphoreGive(fileLock);
   return;
 }
 
-int Log::stationDataSend(long date, float amb_temp, int humi, float irrad, float w_spe, int w_dir, float rain, float pv_temp){
-  DataEncDec encoder(15); // 1 + 4 + 2 + 1 + 2 + 1 + 1 + 1 + 2 = 15
+//Binary event files, one per event named after its date, written in
+//FILE_CHUNK pieces like the data buffer rewrite
+bool Log::saveEvent(uint32_t date, uint8_t* data, size_t len){
+  String path = String(eventDir) + "/" + String(date) + ".bin";
+
+  bus->take(SPI_CLIENT_SD);
+  File file = SD.open(path.c_str(), FILE_WRITE);
+  bus->give(SPI_CLIENT_SD);
+  if(!file){
+    Serial.println("Failed to open event file for writing");
+    return false;
+  }
+
+  size_t written = 0;
+  while(written < len){
+    size_t size = len - written < FILE_CHUNK ? len - written : FILE_CHUNK;
+    bus->take(SPI_CLIENT_SD);
+    size_t done = file.write(data + written, size);
+    bus->give(SPI_CLIENT_SD);
+    if(done != size){
+      break;
+    }
+    written += size;
+  }
+
+  bus->take(SPI_CLIENT_SD);
+  file.close();
+  if(written < len){
+    deleteFile(SD, path.c_str());
+  }
+  bus->give(SPI_CLIENT_SD);
+
+  Serial.println("Event saved: " + path);
+  return written == len;
+}
+
+//Path of an event waiting to be sent, "" if there is none
+String Log::nextEvent(){
+  String path = "";
+
+  bus->take(SPI_CLIENT_SD);
+  File root = SD.open(eventDir);
+  if(root){
+    File file = root.openNextFile();
+    while(file && file.isDirectory()){
+      file = root.openNextFile();
+    }
+    if(file){
+      path = String(file.name());
+      if(!path.startsWith("/")){
+        path = String(eventDir) + "/" + path;
+      }
+      file.close();
+    }
+    root.close();
+  }
+  bus->give(SPI_CLIENT_SD);
+
+  return path;
+}
+
+size_t Log::readEvent(const char* path, uint32_t offset, uint8_t* out, size_t len){
+  size_t done = 0;
+
+  bus->take(SPI_CLIENT_SD);
+  File file = SD.open(path, FILE_READ);
+  if(file){
+    if(file.seek(offset)){
+      done = file.read(out, len);
+    }
+    file.close();
+  }
+  bus->give(SPI_CLIENT_SD);
+
+  return done;
+}
+
+void Log::removeEvent(const char* path){
+  bus->take(SPI_CLIENT_SD);
+  deleteFile(SD, path);
+  bus->give(SPI_CLIENT_SD);
+}
+
+int Log::stationDataSend(long date, float amb_temp, int humi, float irrad, float w_spe, float w_gust, int w_dir, float rain, float pv_temp){
+  DataEncDec encoder(18); // 1 + 4 + 1 + 2 + 1 + 2 + 1 + 1 + 2 + 1 + 2 = 18
   encoder.addHeader(ThisDevice, GATEWAY);
   encoder.addDate(date);
+  encoder.addRecordType(RECORD_WEATHER);
   encoder.addTemp(amb_temp);
   encoder.addHumi(humi);
   encoder.addIrrad(irrad);
   encoder.addWindSpeed(w_spe);
-  encoder.addWindDirection(w_dir);
+  encoder.addWindSpeed(w_gust);
+  encoder.addWindDegrees(w_dir);
   encoder.addRain(rain);
   encoder.addTemp(pv_temp);
 
@@ -259,27 +375,134 @@ int Log::dataloggerDataSend(long date, float curr1, float curr2, float volt1, fl
   return sendPacket(encoder.getBuffer(), encoder.getSize());
 }
 
+// stats holds mean, min, max, RMS and std of current 1 and 2, voltage 1 and 2
+// and power, in that order
+int Log::dataloggerStatsSend(long date, uint16_t samples, float* stats){
+  DataEncDec encoder(53); // 1 + 4 + 1 + 2 + 2*5*1 + 2*5*2 + 5*3 = 53
+  encoder.addHeader(ThisDevice, GATEWAY);
+  encoder.addDate(date);
+  encoder.addRecordType(RECORD_STATS);
+  encoder.addCount(samples);
+  for(int i = 0; i < 10; i++){
+    encoder.addCurrent(stats[i]);
+  }
+  for(int i = 10; i < 20; i++){
+    encoder.addVoltage(stats[i]);
+  }
+  for(int i = 20; i < 25; i++){
+    encoder.addPower(stats[i]);
+  }
+
+  return sendPacket(encoder.getBuffer(), encoder.getSize());
+}
+
+int Log::dataloggerChannelsSend(long date, uint64_t map, uint16_t* codes, uint8_t count){
+  DataEncDec encoder(84); // 1 + 4 + 1 + 6 + 48*12/8 = 84
+  encoder.addHeader(ThisDevice, GATEWAY);
+  encoder.addDate(date);
+  encoder.addRecordType(RECORD_CHANNELS);
+  encoder.addChannelMap(map);
+  encoder.addCodes(codes, count);
+
+  return sendPacket(encoder.getBuffer(), encoder.getSize());
+}
+
+//Timing histograms of the last DIAG_INTERVAL minutes
+int Log::diagnosticsSend(long date, TimingHistogram* stages){
+  DataEncDec encoder(151); // 1 + 4 + 1 + 5*(1 + 4 + 12*2) = 151
+  encoder.addHeader(ThisDevice, GATEWAY);
+  encoder.addDate(date);
+  encoder.addRecordType(RECORD_DIAG);
+  for(int s = 0; s < DIAG_STAGES; s++){
+    encoder.addHistogram(s, stages[s].max, stages[s].buckets);
+  }
+
+  return sendPacket(encoder.getBuffer(), encoder.getSize());
+}
+
+//One chunk of a transient event: rows samples from sample first, codes in
+//channel map order
+int Log::dataloggerEventSend(long date, uint64_t map, uint16_t rate, uint16_t pre, uint16_t post, uint16_t trigger,
+                             uint16_t first, uint16_t rows, uint16_t* codes, uint8_t count){
+  DataEncDec encoder(222); // 1 + 4 + 1 + 6 + 6*2 + 132*12/8 = 222
+  encoder.addHeader(ThisDevice, GATEWAY);
+  encoder.addDate(date);
+  encoder.addRecordType(RECORD_EVENT);
+  encoder.addChannelMap(map);
+  encoder.addCount(rate);
+  encoder.addCount(pre);
+  encoder.addCount(post);
+  encoder.addCount(trigger);
+  encoder.addCount(first);
+  encoder.addCount(rows);
+  encoder.addCodes(codes, count);
+
+  return sendPacket(encoder.getBuffer(), encoder.getSize());
+}
+
 int Log::sendPacket(char* buffer, int len){
+  int64_t start = Timing::now();
+  int acked = transmit(buffer, len);
+  if(timing != NULL){
+    timing->record(DIAG_SEND, start);
+  }
+  return acked;
+}
+
+//The bus is held for each radio access only, not for the time on air or
+//the wait for the ACK
+int Log::transmit(char* buffer, int len){
   lastSendTime = millis();
 
+  bus->take(SPI_CLIENT_LORA);
   LoRa.beginPacket();
-  for(int i = 0; i < len; i++){
-    LoRa.print(buffer[i]);
+  LoRa.write((uint8_t*) buffer, len);
+  LoRa.endPacket(true);
+  bus->give(SPI_CLIENT_LORA);
+
+  while (!txDone())
+  {
+    if((millis() - lastSendTime) > TX_TIMEOUT){
+      return 0;
+    }
+    delay(1);
   }
-  LoRa.endPacket();
 
+  lastSendTime = millis();
   Serial.println("Wating ack");
   while ((millis() - lastSendTime) < INTERVAL)
   {
     if (receive()){
       return 1;
     }
+    delay(1);
   }
 
   return 0;
 }
 
+//Polls and clears the TX done flag, as endPacket() does when it blocks
+bool Log::txDone(){
+  bus->take(SPI_CLIENT_LORA);
+  SPI.beginTransaction(SPISettings(8E6, MSBFIRST, SPI_MODE0));
+  digitalWrite(SS, LOW);
+  SPI.transfer(REG_IRQ_FLAGS & 0x7f);
+  uint8_t flags = SPI.transfer(0x00);
+  digitalWrite(SS, HIGH);
+  if(flags & IRQ_TX_DONE_MASK){
+    digitalWrite(SS, LOW);
+    SPI.transfer(REG_IRQ_FLAGS | 0x80);
+    SPI.transfer(IRQ_TX_DONE_MASK);
+    digitalWrite(SS, HIGH);
+  }
+  SPI.endTransaction();
+  bus->give(SPI_CLIENT_LORA);
+
+  return flags & IRQ_TX_DONE_MASK;
+}
+
 int Log::receive(){
+  bus->take(SPI_CLIENT_LORA);
   int packetSize = LoRa.parsePacket();
    
   if (packetSize > 0){
@@ -290,6 +513,7 @@ int Log::receive(){
       received[cursor] = (char) LoRa.read();
       cursor++;
     }
+    bus->give(SPI_CLIENT_LORA);
 
     if((decoder->getTo(received[0]) == ThisDevice) && decoder->getACK(received[0])){
       DateTime now_update = decoder->getDate(received[1], received[2], received[3], received[4]);
@@ -299,15 +523,20 @@ int Log::receive(){
         transducer_settings[1] = decoder->getVoltage(received[7], received[8]);
         transducer_settings[2] = decoder->getVoltage(received[9], received[10]);
         transducer_settings[3] = decoder->getPower(received[11], received[12], received[13]);
+        settingsVersion++;
         Serial.println(transducer_settings[0]);
         Serial.println(transducer_settings[1]);
+        bus->take(SPI_CLIENT_SD);
         writeFile(SD, settingsPath, (String(transducer_settings[0])+","+String(transducer_settings[1])+
                   ","+String(transducer_settings[2])+ "," +String(transducer_settings[3])+"\n").c_str());
+        bus->give(SPI_CLIENT_SD);
         Serial.println("Settings updated");
       }
       return 1;
     }
+    return 0;
   }
+  bus->give(SPI_CLIENT_LORA);
   return 0;
 }
 
@@ -466,17 +695,25 @@ void Log::deleteFile(fs::FS &fs, const char * path){
   }
 }
 
+//Copies the file without its first line in FILE_CHUNK pieces, releasing
+//the bus between them so the ADC sampling is not held off for the whole
+//file
 void Log::removeFileLine(fs::FS &fs, const char * path){
+  static uint8_t chunk[FILE_CHUNK];
 
+  bus->take(SPI_CLIENT_SD);
   File mainFile = fs.open(path, FILE_READ);
   if(!mainFile){
+      bus->give(SPI_CLIENT_SD);
       Serial.println("Failed to open file for reading");
       return;
   }
 
   File auxFile = fs.open(auxPath, FILE_WRITE);
-  if(!mainFile){
-      Serial.println("Failed to open file for reading");
+  if(!auxFile){
+      mainFile.close();
+      bus->give(SPI_CLIENT_SD);
+      Serial.println("Failed to open file for writing");
       return;
   }
 
@@ -488,17 +725,25 @@ void Log::removeFileLine(fs::FS &fs, const char * path){
         break;
       }
   }
+  bus->give(SPI_CLIENT_SD);
 
-  while(mainFile.available()){
-      aux = (char) mainFile.read();
-      auxFile.print(aux);
+  size_t len = 1;
+  while(len > 0){
+      bus->take(SPI_CLIENT_SD);
+      len = mainFile.read(chunk, FILE_CHUNK);
+      if(len > 0){
+        auxFile.write(chunk, len);
+      }
+      bus->give(SPI_CLIENT_SD);
   }
 
+  bus->take(SPI_CLIENT_SD);
   auxFile.close();
   mainFile.close();
 
   deleteFile(fs, path);
   renameFile(fs, auxPath, path);
+  bus->give(SPI_CLIENT_SD);
 
   return;
 }
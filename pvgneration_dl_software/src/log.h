@@ -22,6 +22,8 @@
 #include <LoRa.h>
 #include "SSD1306.h"
 #include "DataEncDec.h"
+#include "spibus.h"
+#include "timing.h"
 
 // Pin definitions
 #define SDPIN   17   // GPIO17 -- SD - CS 17(satation)
@@ -38,12 +40,18 @@
 #define dataPath "/data_buffer.csv"
 #define auxPath "/aux.csv"
 #define settingsPath "/settings.csv"
+#define eventDir "/events"
 #define dataHeader "DIA,MES,ANO,HORA,MINUTO,SEGUNDO,TEMPERATURA,PRESSAO,UMIDADE,IRRADIANCIA,VELOCIDADE,DIRECAO,CHUVA,PVTEMP,TENSAO,CORRENTE\n"
 #define BAND    915E6  //Radio frequency - 433E6, 868E6, 915E6
 
 #define ThisDevice STATION
 
 #define INTERVAL 500
+#define TX_TIMEOUT 2000
+#define FILE_CHUNK 512  // bytes copied per bus hold
+
+#define REG_IRQ_FLAGS 0x12 //SX127x IRQ flags register
+#define IRQ_TX_DONE_MASK 0x08
 
 class Log
 {
@@ -51,17 +59,22 @@ private:
   //Log Objects
   RTC_DS1307 rtc;
   DataEncDec* decoder;
+  SpiBus* bus;
+  Timing* timing = NULL;
+  SemaphoreHandle_t fileLock; //data buffer rewrite against appends
 
   //Log variables
   DateTime now;
   long lastSendTime = 0;
   boolean usingRTC = false;
   float transducer_settings[4] = {2, 40, 50, 3600};
+  uint32_t settingsVersion = 0;
 
 
   //Log functions
 public:
-  void init();
+  void init(SpiBus* spiBus);
+  void setTiming(Timing* stageTiming);
   void setTime(int year, int month, int day, int hour, int min, int sec);
   String getTime();
   int getYear();
@@ -71,15 +84,27 @@ public:
   int getMin();
   int getHour();
   float *getSettings();
+  uint32_t getSettingsVersion();
   bool saveData(String data);
   String readData();
   void removeSentData();
-  int stationDataSend(long date, float amb_temp, int humi, float irrad, float w_spe, int w_dir, float rain, float pv_temp);
+  bool saveEvent(uint32_t date, uint8_t* data, size_t len);
+  String nextEvent();
+  size_t readEvent(const char* path, uint32_t offset, uint8_t* out, size_t len);
+  void removeEvent(const char* path);
+  int stationDataSend(long date, float amb_temp, int humi, float irrad, float w_spe, float w_gust, int w_dir, float rain, float pv_temp);
   int dataloggerDataSend(long date, float curr1, float curr2, float volt1, float volt2, float power);
+  int dataloggerStatsSend(long date, uint16_t samples, float* stats);
+  int dataloggerChannelsSend(long date, uint64_t map, uint16_t* codes, uint8_t count);
+  int diagnosticsSend(long date, TimingHistogram* stages);
+  int dataloggerEventSend(long date, uint64_t map, uint16_t rate, uint16_t pre, uint16_t post, uint16_t trigger,
+                          uint16_t first, uint16_t rows, uint16_t* codes, uint8_t count);
 
 private:
   int sendPacket(char* buffer, int len);
+  int transmit(char* buffer, int len);
   int receive();
+  bool txDone();
 
   //File functions
   void listDir(fs::FS &fs, const char * dirname, uint8_t levels);
@@ -40,6 +40,11 @@
 // #include "images.h" //ANEEL logo, removed because of license
 #include <SPI.h>
 #include "log.h"
+#include "ads8668.h"
+#include "acquisition.h"
+#include "calibration.h"
+#include "transient.h"
+#include "timing.h"
 
 
 // Pin definitions
@@ -58,33 +63,69 @@
 //Tasks declaration
 TaskHandle_t readData;
 TaskHandle_t sendData;
+TaskHandle_t saveEvent;
 
 //Objects declaration
 SSD1306 display(0x3c, SDA, SCL);
 Log myLog;
 hw_timer_t *timer = NULL;
-float dataAVG[5];
-int sample_num = 0;
 
 //ADS8668 reading
-SPISettings settingsA = SPISettings(8000000, MSBFIRST, SPI_MODE0);
-int nDisp;
-double data[6][8];
+ADS8668 adc;
+Acquisition acquisition;
+RunningStats minuteStats[ACQ_MAX_CHANNELS];
+Calibration calibrations[2]; //a new set is built while the sampling task uses the other
+Calibration *calibration = &calibrations[0];
+uint32_t calibrationVersion;
+Transient transient;
+Timing timing;
+TimingHistogram diagStages[DIAG_STAGES]; //last DIAG_INTERVAL minutes, sent once
+long diagDate;
+volatile bool diagPending = false;
+SpiBus spiBus;
 
 //Variable declaration
 int prevSecond = 0; //verify if is a new second
-boolean usingSPI = false;
 boolean indicativeLED = false;
 
 void ADS8668Init();
 double getADS8668Data(int adcNum, int adcCH);
-void convertAllData();
-double convert2Bytes(byte hiByte, byte loByte);
 double adcread5ToCurrent10(double adcread);
 double adcread10ToVoltage500(double adcread);
 double adcread10ToVoltage400(double adcread);
 double adcread5ToVoltage250(double adcread);
 double adcread5ToPower9k(double adcread);
+void calibrate();
+
+//Logged channels, in record order: current 1 and 2, voltage 1 and 2, power
+const int loggedChannels[5][2] = {{0, 0}, {0, 1}, {2, 4}, {2, 5}, {5, 0}};
+double (*loggedConvert[5])(double) = {adcread5ToCurrent10, adcread5ToCurrent10,
+                                      adcread10ToVoltage400, adcread10ToVoltage500,
+                                      adcread5ToPower9k};
+const float loggedMin[5] = {0, 0, 0, 0, -9000};
+const float loggedMax[5] = {25.5, 25.5, 6553.5, 6553.5, 9000};
+
+//Channel-map mode: the minute mean code of every channel set in the map, bit
+//8*device + channel, is sent raw and calibrated at the gateway. Off by
+//default: every mapped channel is also sequenced and sampled. The logged
+//channels are 0x10000300003ULL, all 48 are 0xFFFFFFFFFFFFULL; set it with
+//-D CHANNEL_MAP=... in build_flags
+#ifndef CHANNEL_MAP
+#define CHANNEL_MAP 0ULL
+#endif
+int mapIndex[ACQ_MAX_CHANNELS]; //statistics index of each mapped channel
+int mapCount = 0;
+
+//Transient capture of the logged channels, levels in the channel unit and
+//NAN to disable: a string voltage falling below 50 V or the power changing
+//1 kW within TR_SLOPE_SPAN samples
+const float triggerBelow[5] = {NAN, NAN, 50, 50, NAN};
+const float triggerAbove[5] = {NAN, NAN, NAN, NAN, NAN};
+const float triggerSlope[5] = {NAN, NAN, NAN, NAN, 1000};
+#define EVENT_CHUNK_CODES 132 //codes per event frame
+String eventPath = "";
+uint16_t eventFirst = 0;
+int sendEventChunk();
 
 //Functions declaration
 //Print logo
@@ -126,7 +167,7 @@ void readDataCode( void * parameter) {
       // String dataString = "";
       // double data[48];
       // int k = 0;
-      // convertAllData();
+      // adc.scan();
       // for(int i = 0; i < 6; i++){
       //   for(int j = 0; j < 8; j++){
       //     double adc_data = getADS8668Data(i, j);
@@ -148,100 +189,179 @@ void readDataCode( void * parameter) {
       //   }
       // }
 
-      //Reading only what I'm using
-
-      while (usingSPI){if(!usingSPI) break; delay(10);}
-      usingSPI = true;
-      convertAllData();
-      usingSPI = false;
-
-      dataAVG[0] += adcread5ToCurrent10(getADS8668Data(0, 0));
-      dataAVG[1] += adcread5ToCurrent10(getADS8668Data(0, 1));
-      dataAVG[2] += adcread10ToVoltage400(getADS8668Data(2, 4));
-      dataAVG[3] += adcread10ToVoltage500(getADS8668Data(2, 5));
-      dataAVG[4] += adcread5ToPower9k(getADS8668Data(5, 0));
-      sample_num++;
-
+      //Sampling runs in the acquisition task, the minute statistics are
+      //saved here
       Serial.print("Reading Data - ");
       Serial.println(second);
-      
+
       if (second == 0 )
       {
-        String data_string = "";
-        if(sample_num > 0){
-          float curr1 = dataAVG[0]/sample_num;
-          if(curr1 < 0){
-            curr1 = 0;
-          }
-          if(curr1 > 25.5){
-            curr1 = 25.5;
-          }
-          data_string += String(curr1) + ",";
-          float curr2 = dataAVG[1]/sample_num;
-          if(curr2 < 0){
-            curr2 = 0;
-          }
-          if(curr2 > 25.5){
-            curr2 = 25.5;
-          }
-          data_string += String(curr2) + ",";
-          float volt1 = dataAVG[2]/sample_num;
-          if(volt1 < 0){
-            volt1 = 0;
-          }
-          if(volt1 > 6553.5){
-            volt1 = 6553.5;
-          }
-          data_string += String(volt1) + ",";
-          float volt2 = dataAVG[3]/sample_num;
-          if(volt2 < 0){
-            volt2 = 0;
-          }
-          if(volt2 > 6553.5){
-            volt2 = 6553.5;
-          }
-          data_string += String(volt2) + ",";
-          float power = dataAVG[4]/sample_num;
-          if(power < -9000){
-            power = -9000;
-          }
-          if(power> 9000){
-            power = 9000;
+        int64_t start = Timing::now();
+        acquisition.takeStats(minuteStats);
+        uint32_t samples = minuteStats[0].count();
+        if(samples > 65535){
+          samples = 65535;
+        }
+        Serial.println("Samples: " + String(samples) + " missed: " + String(acquisition.getMissed()) +
+                       " overruns: " + String(acquisition.getOverruns()) + " events: " + String(transient.getEvents()));
+        spiBus.printStats();
+        spiBus.resetStats();
+        timing.print();
+        if(myLog.getMin() % DIAG_INTERVAL == 0 && !diagPending){
+          timing.take(diagStages);
+          diagDate = myLog.getTime().toInt();
+          diagPending = true;
+        }
+        if(samples == 0){
+          continue;
+        }
+
+        if(myLog.getSettingsVersion() != calibrationVersion){
+          calibrate();
+        }
+
+        //samples, then mean, min, max, RMS and std of each channel
+        String data_string = String(samples);
+        for(int c = 0; c < 5; c++){
+          int32_t summary[5];
+          calibration->summary(c, minuteStats[c], summary);
+          for(int k = 0; k < 5; k++){
+            data_string += "," + String(summary[k]/10.0, 1);
           }
-          data_string += String(power);
-          
-          dataAVG[0] = 0;
-          dataAVG[1] = 0;
-          dataAVG[2] = 0;
-          dataAVG[3] = 0;
-          dataAVG[4] = 0;
-          sample_num = 0;
         }
+        timing.record(DIAG_PROCESS, start);
 
-        while (usingSPI){if(!usingSPI) break; delay(10);}
-        usingSPI = true;
         Serial.println("Saving Data");
         myLog.saveData(data_string);
-        usingSPI = false;
+
+        if(mapCount > 0){
+          String map_string = "CH," + String((uint32_t)(CHANNEL_MAP >> 32), HEX) + "," +
+                              String((uint32_t)CHANNEL_MAP, HEX);
+          for(int m = 0; m < mapCount; m++){
+            RunningStats &stats = minuteStats[mapIndex[m]];
+            map_string += "," + String((uint32_t)((stats.getSum() + stats.count()/2)/stats.count()));
+          }
+          myLog.saveData(map_string);
+        }
 
       }
     }
   }
 }
 
+//Serializes each frozen transient window and stores it on SD
+void saveEventCode( void * parameter) {
+  static uint8_t eventFile[TR_FILE_SIZE];
+  for(;;) {
+    if(!transient.waitEvent()){
+      continue;
+    }
+    //Dated from the trigger timestamp, not from when this task woke up
+    int64_t readAt = Timing::now();
+    uint32_t date = transient.triggerDate(myLog.getTime().toInt(), readAt);
+    size_t len = transient.serialize(eventFile, date);
+    transient.rearm();
+    Serial.println("Transient captured");
+    myLog.saveEvent(date, eventFile, len);
+  }
+}
+
 void sendDataCode( void * parameter) {
   for(;;) {
-    delay(5000);
+    //Event chunks go out back to back once the data buffer is empty
+    delay(eventPath != "" ? 10 : 5000);
+
+    //A single try, diagnostics are not kept on SD
+    if(diagPending){
+      myLog.diagnosticsSend(diagDate, diagStages);
+      diagPending = false;
+    }
 
-    while (usingSPI){delay(10);}
-    usingSPI = true;
     String data_string = myLog.readData();
     Serial.println(data_string);
-    usingSPI = false;
+
+    if(data_string == ""){
+      if(eventPath == ""){
+        eventPath = myLog.nextEvent();
+        eventFirst = 0;
+      }
+      if(eventPath != ""){
+        int sent = sendEventChunk();
+        if(sent < 0){
+          myLog.removeEvent(eventPath.c_str());
+          eventPath = "";
+          Serial.println("Event sent");
+        }
+        else if(!sent){
+          delay(2500);
+        }
+      }
+    }
 
     if(data_string != ""){
       Serial.println("Sending data");
 
+      int fields = 1;
+      for(int i = 0; i < data_string.length(); i++){
+        if(data_string[i] == ',') fields++;
+      }
+
+      if(data_string.indexOf(",CH,") > 0){
+        //Channel-map record: date, CH, map high and low words and the codes
+        int start = data_string.indexOf(",CH,") + 4;
+        long date = data_string.substring(0, start-4).toInt();
+        int end = data_string.indexOf(",", start);
+        uint64_t map = (uint64_t)strtoul(data_string.substring(start, end).c_str(), NULL, 16) << 32;
+        start = end + 1;
+        end = data_string.indexOf(",", start);
+        map |= strtoul(data_string.substring(start, end).c_str(), NULL, 16);
+
+        uint16_t codes[ACQ_MAX_CHANNELS];
+        uint8_t count = 0;
+        while(end > 0 && count < ACQ_MAX_CHANNELS){
+          start = end + 1;
+          end = data_string.indexOf(",", start);
+          codes[count++] = data_string.substring(start, end < 0 ? data_string.length() : end).toInt();
+        }
+
+        int sent = 0;
+        while(!sent){
+          sent = myLog.dataloggerChannelsSend(date, map, codes, count);
+
+          if(sent) delay(10);
+          else delay(2500);
+        }
+
+        myLog.removeSentData();
+        Serial.println("Data sent");
+        continue;
+      }
+
+      if(fields == 27){
+        //Statistics record: date, samples and 5 values per channel
+        float values[26];
+        int start = data_string.indexOf(",") + 1;
+        long date = data_string.substring(0, start-1).toInt();
+        for(int i = 0; i < 26; i++){
+          int end = data_string.indexOf(",", start);
+          if(end < 0) end = data_string.length();
+          values[i] = data_string.substring(start, end).toFloat();
+          start = end + 1;
+        }
+
+        int sent = 0;
+        while(!sent){
+          sent = myLog.dataloggerStatsSend(date, values[0], &values[1]);
+
+          if(sent) delay(10);
+          else delay(2500);
+        }
+
+        myLog.removeSentData();
+        Serial.println("Data sent");
+        continue;
+      }
+
       int delimiter[5];
       delimiter[0] = data_string.indexOf(",");
       delimiter[1] = data_string.indexOf(",", delimiter[0]+1);
@@ -258,19 +378,13 @@ void sendDataCode( void * parameter) {
 
       int sent = 0;
       while(!sent){
-        while (usingSPI){delay(10);}
-        usingSPI = true;
         sent = myLog.dataloggerDataSend(date, curr1, curr2, volt1, volt2, power);
-        usingSPI = false;
 
         if(sent) delay(10);
         else delay(2500);
       }
 
-      while (usingSPI){delay(10);}
-      usingSPI = true;
       myLog.removeSentData();
-      usingSPI = false;
       Serial.println("Data sent");
 
     }
@@ -326,7 +440,9 @@ void setup() {
 
   timerWrite(timer, 0);
 
-  myLog.init();
+  spiBus.begin();
+  myLog.init(&spiBus);
+  myLog.setTiming(&timing);
 
   timerWrite(timer, 0);
 
@@ -337,6 +453,23 @@ void setup() {
   delay(1500);
 
   ADS8668Init();
+  for(int c = 0; c < 5; c++){
+    acquisition.addChannel(loggedChannels[c][0], loggedChannels[c][1]);
+  }
+  for(int bit = 0; bit < 48; bit++){
+    if((CHANNEL_MAP >> bit) & 1){
+      mapIndex[mapCount++] = acquisition.addChannel(bit/8, bit%8);
+    }
+  }
+  calibrate();
+  for(int c = 0; c < 5; c++){
+    transient.addChannel(c, loggedChannels[c][0], loggedChannels[c][1]);
+    transient.setTrigger(c, triggerBelow[c], triggerAbove[c], triggerSlope[c]);
+  }
+  transient.begin(calibration, ACQ_SAMPLE_RATE);
+  acquisition.setTransient(&transient);
+  acquisition.setTiming(&timing);
+  acquisition.begin(&adc, &spiBus, ACQ_SAMPLE_RATE);
 
   Serial.println("ADS8668 initialized");
   display.clear();
@@ -345,12 +478,6 @@ void setup() {
 
   timerWrite(timer, 0);
 
-  dataAVG[0] = 0;
-  dataAVG[1] = 0;
-  dataAVG[2] = 0;
-  dataAVG[3] = 0;
-  dataAVG[4] = 0;
-
   delay(1500);
   Serial.println("Setup success!");
   display.clear();
@@ -379,232 +506,103 @@ void setup() {
     1,  /* Priority of the task */
     &sendData,  /* Task handle. */
     0); /* Core where the task should run */
-}
-
-void loop() {}
 
-void ADS8668Init()
-{
-  nDisp = 6;
-
-  digitalWrite(RSTadc, LOW);
-  digitalWrite(RSTadc, HIGH);
-
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0000101100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-
-  SPI.endTransaction();
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0000110100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-  SPI.endTransaction();
-
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0000111100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-  SPI.endTransaction();
-
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0001000100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-  SPI.endTransaction();
-
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0001001100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-  SPI.endTransaction();
-
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0001010100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-  SPI.endTransaction();
-
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0001011100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-  SPI.endTransaction();
-
-  SPI.beginTransaction(settingsA);
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0b0001100100000101);
-  for(int i = 0; i < (16*nDisp); i++){
-    SPI.transfer(0x00);
-    SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-  SPI.endTransaction();
-
-  for(int i = 0; i < nDisp; i++){
-    data[i][0] = 0;
-    data[i][1] = 0;
-    data[i][2] = 0;
-    data[i][3] = 0;
-    data[i][4] = 0;
-    data[i][5] = 0;
-    data[i][6] = 0;
-    data[i][7] = 0;
-  }
+  xTaskCreatePinnedToCore(
+    saveEventCode, /* Function to implement the task */
+    "saveEvent", /* Name of the task */
+    4096,  /* Stack size in words */
+    NULL,  /* Task input parameter */
+    1,  /* Priority of the task */
+    &saveEvent,  /* Task handle. */
+    0); /* Core where the task should run */
 }
 
-double getADS8668Data(int adcNum, int adcCH)
-{
-  return data[adcNum][adcCH];
-}
+void loop() {}
 
-void convertAllData()
+//Sends the chunk of the event file that starts at eventFirst. Returns 1 if
+//it was acknowledged, 0 if not and -1 once the whole event was sent or the
+//file is not an event.
+int sendEventChunk()
 {
-  byte hiByte[nDisp];
-  byte loByte[nDisp];
-
-  SPI.beginTransaction(settingsA);
-
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xC000); //Write ch0
-  for(int i = nDisp-1; i >= 0; i--){
-    SPI.transfer(0x00); //read trash
-    SPI.transfer(0x00);
+  static uint8_t buffer[TR_HEADER_SIZE + TR_MAX_CHANNELS];
+  static uint16_t codes[EVENT_CHUNK_CODES];
+  static uint8_t raw[EVENT_CHUNK_CODES*2];
+
+  size_t size = myLog.readEvent(eventPath.c_str(), 0, buffer, sizeof(buffer));
+  uint8_t channels = buffer[11];
+  if(size < TR_HEADER_SIZE || memcmp(buffer, "PVEV", 4) != 0 || buffer[4] != TR_VERSION ||
+     channels == 0 || channels > TR_MAX_CHANNELS || size < TR_HEADER_SIZE + channels || buffer[16] >= channels){
+    return -1;
   }
-  digitalWrite(CSadc, HIGH);
 
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xC400); //Write ch1
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch0
-    loByte[i] = SPI.transfer(0x00);
+  long date = ((uint32_t)buffer[5] << 24) | (buffer[6] << 16) | (buffer[7] << 8) | buffer[8];
+  uint16_t rate = (buffer[9] << 8) | buffer[10];
+  uint16_t pre = (buffer[12] << 8) | buffer[13];
+  uint16_t post = (buffer[14] << 8) | buffer[15];
+  uint16_t trigger = (buffer[TR_HEADER_SIZE + buffer[16]] << 8) | buffer[17];
+  uint64_t map = 0;
+  for(int c = 0; c < channels; c++){
+    map |= 1ULL << buffer[TR_HEADER_SIZE + c];
   }
-  digitalWrite(CSadc, HIGH);
 
-  for(int i = 0; i < nDisp; i++){
-    data[i][0] = convert2Bytes(hiByte[i], loByte[i]);
+  uint16_t total = pre + post;
+  if(eventFirst >= total){
+    return -1;
   }
-
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xC800); //Write ch2
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch1
-    loByte[i] = SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-
-  for(int i = 0; i < nDisp; i++){
-    data[i][1] = convert2Bytes(hiByte[i], loByte[i]);
-  }
-
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xCC00); //Write ch3
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch2
-    loByte[i] = SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-
-  for(int i = 0; i < nDisp; i++){
-    data[i][2] = convert2Bytes(hiByte[i], loByte[i]);
+  uint16_t rows = EVENT_CHUNK_CODES/channels;
+  if(rows > total - eventFirst){
+    rows = total - eventFirst;
   }
 
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xD000); //Write ch4
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch3
-    loByte[i] = SPI.transfer(0x00);
+  uint32_t offset = TR_HEADER_SIZE + channels + (uint32_t)eventFirst*channels*2;
+  size_t len = rows*channels*2;
+  if(myLog.readEvent(eventPath.c_str(), offset, raw, len) != len){
+    return -1;
   }
-  digitalWrite(CSadc, HIGH);
-
-  for(int i = 0; i < nDisp; i++){
-    data[i][3] = convert2Bytes(hiByte[i], loByte[i]);
-  }
-
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xD400); //Write ch5
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch4
-    loByte[i] = SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-
-  for(int i = 0; i < nDisp; i++){
-    data[i][4] = convert2Bytes(hiByte[i], loByte[i]);
+  for(int i = 0; i < rows*channels; i++){
+    codes[i] = (raw[2*i] << 8) | raw[2*i+1];
   }
 
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xD800); //Write ch6
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch5
-    loByte[i] = SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
-
-  for(int i = 0; i < nDisp; i++){
-    data[i][5] = convert2Bytes(hiByte[i], loByte[i]);
+  if(!myLog.dataloggerEventSend(date, map, rate, pre, post, trigger, eventFirst, rows, codes, rows*channels)){
+    return 0;
   }
+  eventFirst += rows;
+  return 1;
+}
 
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xDC00); //Write ch7
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch6
-    loByte[i] = SPI.transfer(0x00);
-  }
-  digitalWrite(CSadc, HIGH);
+void ADS8668Init()
+{
+  adc.init(CSadc, RSTadc, 6);
 
-  for(int i = 0; i < nDisp; i++){
-    data[i][6] = convert2Bytes(hiByte[i], loByte[i]);
+  //Only the channels that are logged are sequenced
+  for(int c = 0; c < 5; c++){
+    adc.enableChannel(loggedChannels[c][0], loggedChannels[c][1]);
   }
-
-  digitalWrite(CSadc, LOW);
-  SPI.transfer16(0xC000); //Write ch0
-  for(int i = nDisp-1; i >= 0; i--){
-    hiByte[i] = SPI.transfer(0x00); //read ch7
-    loByte[i] = SPI.transfer(0x00);
+  for(int bit = 0; bit < 48; bit++){
+    if((CHANNEL_MAP >> bit) & 1){
+      adc.enableChannel(bit/8, bit%8);
+    }
   }
-  digitalWrite(CSadc, HIGH);
+  adc.applyChannels();
+}
 
-  for(int i = 0; i < nDisp; i++){
-    data[i][7] = convert2Bytes(hiByte[i], loByte[i]);
-  }
-  SPI.endTransaction();
+double getADS8668Data(int adcNum, int adcCH)
+{
+  return adc.getVoltage(adcNum, adcCH);
 }
 
-double convert2Bytes(byte hiByte, byte loByte)
+//Fixed-point coefficients of the logged channels from the current settings,
+//built in the spare set and swapped in whole, so the transient triggers
+//never see a gain with the shift of the previous one
+void calibrate()
 {
-  int adcRead = (hiByte<<4) + (loByte>>4);
-  double value = adcRead*0.0025;
-  return value;
+  calibrationVersion = myLog.getSettingsVersion();
+  Calibration *next = calibration == &calibrations[0] ? &calibrations[1] : &calibrations[0];
+  for(int c = 0; c < 5; c++){
+    next->set(c, loggedConvert[c], loggedMin[c], loggedMax[c]);
+  }
+  calibration = next;
+  transient.setCalibration(next);
 }
 
 double adcread5ToCurrent10(double adcread)
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for share the SPI bus between SD, LoRa and ADCs
+*****************************************************************************/
+
+#include "spibus.h"
+
+static const char *clientNames[SPI_CLIENTS] = {"ADC", "SD", "LoRa"};
+
+void SpiBus::begin()
+{
+  if(mutex == NULL){
+    mutex = xSemaphoreCreateMutex();
+  }
+  resetStats();
+}
+
+bool SpiBus::take(int client, TickType_t timeout)
+{
+  unsigned long start = micros();
+  bool contended = false;
+
+  if(xSemaphoreTake(mutex, 0) != pdTRUE){
+    contended = true;
+    if(timeout == 0 || xSemaphoreTake(mutex, timeout) != pdTRUE){
+      //not holding the bus, so the counter takes the stats lock instead
+      portENTER_CRITICAL(&statsMux);
+      stats[client].timeouts++;
+      portEXIT_CRITICAL(&statsMux);
+      return false;
+    }
+  }
+
+  unsigned long now = micros();
+  uint32_t wait = now - start;
+  grantedAt = now;
+
+  ClientStats &s = stats[client];
+  s.grants++;
+  if(contended){
+    s.contended++;
+    s.waitUs += wait;
+    if(wait > s.maxWaitUs){
+      s.maxWaitUs = wait;
+    }
+  }
+  return true;
+}
+
+void SpiBus::give(int client)
+{
+  uint32_t hold = micros() - grantedAt;
+  ClientStats &s = stats[client];
+  s.holdUs += hold;
+  if(hold > s.maxHoldUs){
+    s.maxHoldUs = hold;
+  }
+  xSemaphoreGive(mutex);
+}
+
+void SpiBus::printStats()
+{
+  Serial.println("SPI bus  grants contended timeouts  waited ms  wait avg/max us  hold avg/max us");
+  for(int c = 0; c < SPI_CLIENTS; c++){
+    ClientStats &s = stats[c];
+    if(s.grants == 0 && s.timeouts == 0){
+      continue;
+    }
+    uint32_t waitAvg = s.contended > 0 ? s.waitUs/s.contended : 0;
+    uint32_t holdAvg = s.grants > 0 ? s.holdUs/s.grants : 0;
+    Serial.printf("%-7s %7u %9u %8u  %9u  %7u/%-7u  %7u/%-7u\n", clientNames[c],
+                  s.grants, s.contended, s.timeouts, (uint32_t)(s.waitUs/1000),
+                  waitAvg, s.maxWaitUs, holdAvg, s.maxHoldUs);
+  }
+}
+
+void SpiBus::resetStats()
+{
+  portENTER_CRITICAL(&statsMux);
+  for(int c = 0; c < SPI_CLIENTS; c++){
+    stats[c].timeouts = 0;
+  }
+  portEXIT_CRITICAL(&statsMux);
+  for(int c = 0; c < SPI_CLIENTS; c++){
+    stats[c].grants = 0;
+    stats[c].contended = 0;
+    stats[c].waitUs = 0;
+    stats[c].maxWaitUs = 0;
+    stats[c].holdUs = 0;
+    stats[c].maxHoldUs = 0;
+  }
+}
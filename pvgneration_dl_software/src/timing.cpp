@@ -0,0 +1,134 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for timing the acquisition stages of the data loggers
+*****************************************************************************/
+
+#include "timing.h"
+
+static const char *stageNames[DIAG_STAGES] = {"Jitter", "Read", "Process", "Save", "Send"};
+
+// ========= Histogram ============
+void TimingHistogram::record(uint32_t us)
+{
+  int i = 0;
+  while(i < DIAG_BUCKETS - 1 && us > DIAG_BOUNDS[i]){
+    i++;
+  }
+  buckets[i]++;
+  count++;
+  sum += us;
+  if(us > max){
+    max = us;
+  }
+}
+
+void TimingHistogram::reset()
+{
+  for(int i = 0; i < DIAG_BUCKETS; i++){
+    buckets[i] = 0;
+  }
+  count = 0;
+  sum = 0;
+  max = 0;
+}
+
+// Upper bound of the bucket holding the p-th percentile (max for the last one)
+uint32_t TimingHistogram::percentile(uint8_t p)
+{
+  if(count == 0){
+    return 0;
+  }
+  uint32_t target = ((uint64_t)count*p + 99)/100;
+  uint32_t seen = 0;
+  for(int i = 0; i < DIAG_BUCKETS - 1; i++){
+    seen += buckets[i];
+    if(seen >= target){
+      return DIAG_BOUNDS[i] < max ? DIAG_BOUNDS[i] : max;
+    }
+  }
+  return max;
+}
+
+// ========= Stages ============
+Timing::Timing()
+{
+  for(int s = 0; s < DIAG_STAGES; s++){
+    stages[s].reset();
+  }
+}
+
+int64_t Timing::now()
+{
+  return esp_timer_get_time();
+}
+
+// Records how far the time since the previous tick is from the expected
+// interval, early or late
+void Timing::tick(uint32_t expectedUs)
+{
+  int64_t t = now();
+  if(lastTick != 0){
+    int64_t error = t - lastTick - expectedUs;
+    portENTER_CRITICAL(&mux);
+    stages[DIAG_JITTER].record(error < 0 ? -error : error);
+    portEXIT_CRITICAL(&mux);
+  }
+  lastTick = t;
+}
+
+// Records the time since start, taken with now()
+void Timing::record(int stage, int64_t start)
+{
+  uint32_t us = now() - start;
+  portENTER_CRITICAL(&mux);
+  stages[stage].record(us);
+  portEXIT_CRITICAL(&mux);
+}
+
+// Copies the histograms of the period and starts a new one
+void Timing::take(TimingHistogram *out)
+{
+  portENTER_CRITICAL(&mux);
+  for(int s = 0; s < DIAG_STAGES; s++){
+    out[s] = stages[s];
+    stages[s].reset();
+  }
+  portEXIT_CRITICAL(&mux);
+}
+
+void Timing::print()
+{
+  TimingHistogram copy[DIAG_STAGES];
+  portENTER_CRITICAL(&mux);
+  for(int s = 0; s < DIAG_STAGES; s++){
+    copy[s] = stages[s];
+  }
+  portEXIT_CRITICAL(&mux);
+
+  Serial.println("Timing us      n      avg      p50      p99      max  buckets");
+  for(int s = 0; s < DIAG_STAGES; s++){
+    TimingHistogram &h = copy[s];
+    if(h.count == 0){
+      continue;
+    }
+    Serial.printf("%-7s %7u %8u %8u %8u %8u ", stageNames[s], h.count, (uint32_t)(h.sum/h.count),
+                  h.percentile(50), h.percentile(99), h.max);
+    for(int i = 0; i < DIAG_BUCKETS; i++){
+      Serial.printf(" %u", h.buckets[i]);
+    }
+    Serial.println();
+  }
+}
@@ -0,0 +1,214 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for triggered capture of PV transients
+*****************************************************************************/
+
+#include "transient.h"
+
+// ========= Init ============
+// Channels are kept in id order, the order of the channel map the event
+// frames carry. index is the channel index in the acquisition.
+bool Transient::addChannel(int index, int adcNum, int adcCH)
+{
+  if(nChannels >= TR_MAX_CHANNELS){
+    return false;
+  }
+
+  uint8_t id = 8*adcNum + adcCH;
+  int c = nChannels;
+  while(c > 0 && chId[c-1] > id){
+    chIndex[c] = chIndex[c-1];
+    chId[c] = chId[c-1];
+    below[c] = below[c-1];
+    above[c] = above[c-1];
+    slope[c] = slope[c-1];
+    c--;
+  }
+  chIndex[c] = index;
+  chId[c] = id;
+  below[c] = INT32_MIN;
+  above[c] = INT32_MAX;
+  slope[c] = 0;
+  nChannels++;
+  return true;
+}
+
+// Levels in the channel unit, NAN disables a condition
+void Transient::setTrigger(int index, float belowValue, float aboveValue, float slopeValue)
+{
+  for(int c = 0; c < nChannels; c++){
+    if(chIndex[c] == index){
+      below[c] = isnan(belowValue) ? INT32_MIN : lround(belowValue*10);
+      above[c] = isnan(aboveValue) ? INT32_MAX : lround(aboveValue*10);
+      slope[c] = isnan(slopeValue) ? 0 : lround(fabs(slopeValue)*10);
+    }
+  }
+}
+
+void Transient::begin(Calibration *cal, uint32_t sampleRate)
+{
+  calibration = cal;
+  rate = sampleRate;
+  events = 0;
+  for(int c = 0; c < nChannels; c++){
+    active[c] = 0;
+  }
+  rearm();
+}
+
+// Takes effect from the next sample. cal must be fully set, the one it
+// replaces may be rebuilt once this returns.
+void Transient::setCalibration(Calibration *cal)
+{
+  portENTER_CRITICAL(&calMux);
+  calibration = cal;
+  portEXIT_CRITICAL(&calMux);
+}
+
+// ========= Capture ============
+// Runs in the sampling task with the codes of one sample, by acquisition index
+void Transient::add(uint16_t *row)
+{
+  if(frozen){
+    return;
+  }
+
+  //A whole sample is converted with the same coefficients
+  portENTER_CRITICAL(&calMux);
+  Calibration *cal = calibration;
+  portEXIT_CRITICAL(&calMux);
+
+  bool armed = remaining == 0 && filled >= TR_PRE;
+  int slot = filled % TR_SLOPE_SPAN;
+
+  for(int c = 0; c < nChannels; c++){
+    uint16_t code = row[chIndex[c]];
+    int32_t value = cal->toTenths(chIndex[c], code);
+    ring[head][c] = code;
+
+    //Levels fire when they are entered, not while they hold
+    uint8_t now = (value < below[c] ? 1 : 0) | (value > above[c] ? 2 : 0);
+    if(armed){
+      if(now & ~active[c] & 1){
+        trigger(c, TR_BELOW);
+        armed = false;
+      }
+      else if(now & ~active[c] & 2){
+        trigger(c, TR_ABOVE);
+        armed = false;
+      }
+      else if(slope[c] > 0 && filled >= TR_SLOPE_SPAN && abs(value - tenths[slot][c]) >= slope[c]){
+        trigger(c, TR_SLOPE);
+        armed = false;
+      }
+    }
+    active[c] = now;
+    tenths[slot][c] = value;
+  }
+
+  head = (head + 1) % TR_SAMPLES;
+  filled++;
+
+  if(remaining > 0){
+    remaining--;
+    if(remaining == 0){
+      frozen = true;
+      events++;
+      if(waiter != NULL){
+        xTaskNotifyGive(waiter);
+      }
+    }
+  }
+}
+
+void Transient::trigger(int c, uint8_t kind)
+{
+  triggerChannel = c;
+  triggerKind = kind;
+  triggerAt = Timing::now();
+  remaining = TR_POST;
+}
+
+// ========= Event ============
+// Blocks the calling task until a window is frozen
+bool Transient::waitEvent()
+{
+  waiter = xTaskGetCurrentTaskHandle();
+  if(!frozen){
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+  return frozen;
+}
+
+// Date of the trigger sample from a clock date read at nowAt (Timing::now()),
+// the wait for the saving task does not move it
+uint32_t Transient::triggerDate(uint32_t now, int64_t nowAt)
+{
+  return now - (uint32_t)((nowAt - triggerAt + 500000)/1000000);
+}
+
+// Event file of the frozen window, oldest sample first. date is the time of
+// the trigger sample.
+size_t Transient::serialize(uint8_t *out, uint32_t date)
+{
+  size_t cursor = 0;
+  out[cursor++] = 'P';
+  out[cursor++] = 'V';
+  out[cursor++] = 'E';
+  out[cursor++] = 'V';
+  out[cursor++] = TR_VERSION;
+  out[cursor++] = date >> 24;
+  out[cursor++] = date >> 16;
+  out[cursor++] = date >> 8;
+  out[cursor++] = date;
+  out[cursor++] = rate >> 8;
+  out[cursor++] = rate;
+  out[cursor++] = nChannels;
+  out[cursor++] = TR_PRE >> 8;
+  out[cursor++] = TR_PRE & 0xFF;
+  out[cursor++] = TR_POST >> 8;
+  out[cursor++] = TR_POST & 0xFF;
+  out[cursor++] = triggerChannel;
+  out[cursor++] = triggerKind;
+
+  for(int c = 0; c < nChannels; c++){
+    out[cursor++] = chId[c];
+  }
+
+  //The ring is full when frozen, the oldest sample is the next to write
+  for(int i = 0; i < TR_SAMPLES; i++){
+    uint16_t *sample = ring[(head + i) % TR_SAMPLES];
+    for(int c = 0; c < nChannels; c++){
+      out[cursor++] = sample[c] >> 8;
+      out[cursor++] = sample[c];
+    }
+  }
+
+  return cursor;
+}
+
+void Transient::rearm()
+{
+  head = 0;
+  filled = 0;
+  remaining = 0;
+  frozen = false;
+}
+
+uint32_t Transient::getEvents()
+{
+  return events;
+}
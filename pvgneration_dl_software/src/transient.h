@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for triggered capture of PV transients
+*****************************************************************************/
+
+#ifndef TRANSIENT_H
+#define TRANSIENT_H
+
+#include <Arduino.h>
+#include "calibration.h"
+#include "timing.h"
+
+#define TR_PRE           200  // samples kept before the trigger
+#define TR_POST          300  // samples kept from the trigger on
+#define TR_SAMPLES       (TR_PRE + TR_POST)
+#define TR_MAX_CHANNELS  8
+#define TR_SLOPE_SPAN    10   // samples the slope trigger looks back
+
+// Trigger kinds
+#define TR_BELOW  0
+#define TR_ABOVE  1
+#define TR_SLOPE  2
+
+// Event file: "PVEV", version, then big-endian trigger date, sample rate,
+// channel count, pre and post samples, trigger channel and kind, the channel
+// ids (8*device + channel) and the codes, 2 bytes each, sample by sample
+#define TR_VERSION      1
+#define TR_HEADER_SIZE  18
+#define TR_FILE_SIZE    (TR_HEADER_SIZE + TR_MAX_CHANNELS + TR_SAMPLES*TR_MAX_CHANNELS*2)
+
+// Keeps the last TR_SAMPLES samples of the selected channels. A trigger
+// fires on entering a level (below or above) or on a change larger than the
+// slope within TR_SLOPE_SPAN samples; TR_POST samples later the ring is
+// frozen until the event is serialized, then it is armed again.
+class Transient
+{
+private:
+  Calibration *calibration;
+  portMUX_TYPE calMux = portMUX_INITIALIZER_UNLOCKED;  // calibration swaps
+  uint32_t rate;
+
+  int nChannels = 0;
+  uint8_t chIndex[TR_MAX_CHANNELS];  // acquisition and calibration index
+  uint8_t chId[TR_MAX_CHANNELS];     // 8*device + channel
+  int32_t below[TR_MAX_CHANNELS];    // tenths, INT32_MIN disables
+  int32_t above[TR_MAX_CHANNELS];    // tenths, INT32_MAX disables
+  int32_t slope[TR_MAX_CHANNELS];    // tenths, 0 disables
+  uint8_t active[TR_MAX_CHANNELS];   // level conditions met on the last sample
+
+  uint16_t ring[TR_SAMPLES][TR_MAX_CHANNELS];
+  int32_t tenths[TR_SLOPE_SPAN][TR_MAX_CHANNELS];
+  int head;
+  uint32_t filled;
+  int remaining;
+  volatile bool frozen;
+  uint8_t triggerChannel;
+  uint8_t triggerKind;
+  int64_t triggerAt;  // Timing::now() of the trigger sample
+
+  TaskHandle_t waiter = NULL;
+  uint32_t events;
+
+public:
+  bool addChannel(int index, int adcNum, int adcCH);
+  void setTrigger(int index, float belowValue, float aboveValue, float slopeValue);
+  void begin(Calibration *cal, uint32_t sampleRate);
+  void setCalibration(Calibration *cal);
+  void add(uint16_t *row);
+  bool waitEvent();
+  uint32_t triggerDate(uint32_t now, int64_t nowAt);
+  size_t serialize(uint8_t *out, uint32_t date);
+  void rearm();
+  uint32_t getEvents();
+
+private:
+  void trigger(int c, uint8_t kind);
+};
+
+#endif
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Host tests of the AdcStream decimation, type 1 DMA frames
+*               fed with add()
+*****************************************************************************/
+
+// Usage: adcstream_test
+//
+// Exits with 1 if any check fails, so it can gate changes to AdcStream.
+
+#include <Arduino.h>
+#include <vector>
+
+#include "adcstream.h"
+
+int failures = 0;
+
+void check(bool ok, const char *name)
+{
+  Serial.printf("  %s  %s\n", ok ? "ok  " : "FAIL", name);
+  if(!ok){
+    failures++;
+  }
+}
+
+// One type 1 conversion: 2 bytes little-endian, channel in bits 15:12
+void putConversion(std::vector<uint8_t> &frame, uint8_t channel, uint16_t code)
+{
+  uint16_t value = (channel << 12) | (code & 0x0FFF);
+  frame.push_back(value & 0xFF);
+  frame.push_back(value >> 8);
+}
+
+// First code the vane table maps to the sector
+uint16_t sectorCode(uint8_t sector)
+{
+  for(uint16_t code = 0; code < LUT_CODES; code++){
+    if(windSector(code) == sector){
+      return code;
+    }
+  }
+  return 0;
+}
+
+void testTemp()
+{
+  Serial.println("temperature");
+  AdcStream stream;
+  check(stream.begin(), "begin");
+
+  uint32_t code16 = 0;
+  check(!stream.takeTemp(&code16), "nothing before the first frame");
+
+  std::vector<uint8_t> frame;
+  for(int i = 0; i < 256; i++){
+    putConversion(frame, ADC_STREAM_PVTEMP, i%2 ? 2001 : 2000);
+  }
+  stream.add(frame.data(), frame.size());
+  check(stream.takeTemp(&code16) && code16 == 2000*16 + 8, "box filter keeps 4 fractional bits");
+  check(!stream.takeTemp(&code16), "take clears the sum");
+
+  //Two frames, the mean is over both
+  frame.clear();
+  for(int i = 0; i < 100; i++){
+    putConversion(frame, ADC_STREAM_PVTEMP, 1000);
+  }
+  stream.add(frame.data(), frame.size());
+  frame.clear();
+  for(int i = 0; i < 300; i++){
+    putConversion(frame, ADC_STREAM_PVTEMP, 1004);
+  }
+  stream.add(frame.data(), frame.size());
+  check(stream.takeTemp(&code16) && code16 == 1003*16, "frames add up until taken");
+
+  //Other channels and a trailing odd byte are skipped
+  frame.clear();
+  putConversion(frame, 3, 4095);
+  putConversion(frame, ADC_STREAM_PVTEMP, 300);
+  frame.push_back(0xFF);
+  stream.add(frame.data(), frame.size());
+  check(stream.takeTemp(&code16) && code16 == 300*16, "other channels and odd bytes skipped");
+}
+
+void testVane()
+{
+  Serial.println("vane");
+  AdcStream stream;
+  stream.begin();
+
+  uint32_t sectors[8];
+  check(stream.takeVane(sectors) == 0, "no samples before the first frame");
+
+  std::vector<uint8_t> frame;
+  for(int s = 0; s < 8; s++){
+    for(int i = 0; i <= s; i++){
+      putConversion(frame, ADC_STREAM_VANE, sectorCode(s));
+    }
+  }
+  putConversion(frame, ADC_STREAM_VANE, LUT_CODES - 1);  // above the last limit
+  putConversion(frame, ADC_STREAM_PVTEMP, 2000);
+  stream.add(frame.data(), frame.size());
+
+  uint32_t samples = stream.takeVane(sectors);
+  bool counted = true;
+  for(int s = 0; s < 8; s++){
+    counted = counted && sectors[s] == (uint32_t)s + 1;
+  }
+  check(counted, "samples counted per sector");
+  check(samples == 36 + 1, "total includes samples without a sector");
+
+  uint32_t code16;
+  check(stream.takeTemp(&code16) && code16 == 2000*16, "temperature in the same frame apart");
+
+  samples = stream.takeVane(sectors);
+  bool cleared = samples == 0;
+  for(int s = 0; s < 8; s++){
+    cleared = cleared && sectors[s] == 0;
+  }
+  check(cleared, "take clears the counts");
+}
+
+int main()
+{
+  testTemp();
+  testVane();
+
+  Serial.printf("%d failure(s)\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Adafruit ADS1X15 API for building station code on
+*               Linux, conversions read 0 (bench)
+*****************************************************************************/
+
+#ifndef _HOST_ADAFRUIT_ADS1015_H_
+#define _HOST_ADAFRUIT_ADS1015_H_
+
+#include <Arduino.h>
+
+typedef enum {
+  GAIN_TWOTHIRDS,
+  GAIN_ONE,
+  GAIN_TWO,
+  GAIN_FOUR,
+  GAIN_EIGHT,
+  GAIN_SIXTEEN
+} adsGain_t;
+
+class Adafruit_ADS1115 {
+  public:
+    Adafruit_ADS1115(uint8_t = 0x48) {}
+    void begin() {}
+    void setGain(adsGain_t) {}
+    uint16_t readADC_SingleEnded(uint8_t) { return 0; }
+    int16_t readADC_Differential_0_1() { return 0; }
+    int16_t readADC_Differential_2_3() { return 0; }
+};
+
+#endif
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Arduino API for building station code on Linux
+*               (bench)
+*****************************************************************************/
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <chrono>
+#include <thread>
+
+HostSerial Serial;
+TwoWire Wire;
+
+static const std::chrono::steady_clock::time_point hostStart = std::chrono::steady_clock::now();
+static uint16_t analogPins[HOST_PINS];
+static int digitalPins[HOST_PINS];
+
+unsigned long millis(){
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - hostStart).count();
+}
+
+unsigned long micros(){
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - hostStart).count();
+}
+
+void delay(unsigned long ms){
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+int analogRead(uint8_t pin){
+  return pin < HOST_PINS ? analogPins[pin] : 0;
+}
+
+int digitalRead(uint8_t pin){
+  return pin < HOST_PINS ? digitalPins[pin] : LOW;
+}
+
+void hostSetAnalog(uint8_t pin, uint16_t code){
+  if(pin < HOST_PINS){
+    analogPins[pin] = code & 0x0FFF;
+  }
+}
+
+void hostSetDigital(uint8_t pin, int value){
+  if(pin < HOST_PINS){
+    digitalPins[pin] = value;
+  }
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal Arduino API for building station code on Linux
+*               (bench)
+*****************************************************************************/
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define LOW          0
+#define HIGH         1
+#define INPUT        0x01
+#define OUTPUT       0x02
+#define INPUT_PULLUP 0x05
+#define RISING       0x01
+#define FALLING      0x02
+
+#define IRAM_ATTR
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// Pins read what the bench set with hostSetAnalog() and hostSetDigital()
+#define HOST_PINS 40
+int analogRead(uint8_t pin);
+int digitalRead(uint8_t pin);
+void hostSetAnalog(uint8_t pin, uint16_t code);
+void hostSetDigital(uint8_t pin, int value);
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+inline void detachInterrupt(int) {}
+
+// Subset of the Arduino String used by the station
+class String {
+  public:
+    String() {}
+    String(const char *s) : str(s ? s : "") {}
+    String(const std::string &s) : str(s) {}
+    String(char c) : str(1, c) {}
+    String(int value) : str(std::to_string(value)) {}
+    String(unsigned int value) : str(std::to_string(value)) {}
+    String(long value) : str(std::to_string(value)) {}
+    String(unsigned long value) : str(std::to_string(value)) {}
+    String(float value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+    String(double value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+
+    unsigned int length() const { return str.length(); }
+    const char *c_str() const { return str.c_str(); }
+    char operator[](unsigned int i) const { return i < str.length() ? str[i] : 0; }
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t i = str.find(c, from);
+      return i == std::string::npos ? -1 : (int)i;
+    }
+    String substring(unsigned int from) const {
+      return from >= str.length() ? String() : String(str.substr(from));
+    }
+    String substring(unsigned int from, unsigned int to) const {
+      if(from > to) { unsigned int t = from; from = to; to = t; }
+      if(from >= str.length()) return String();
+      return String(str.substr(from, to - from));
+    }
+    long toInt() const { return atol(str.c_str()); }
+    float toFloat() const { return atof(str.c_str()); }
+
+    String &operator+=(const String &s) { str += s.str; return *this; }
+    String &operator+=(const char *s) { str += s; return *this; }
+    String &operator+=(char c) { str += c; return *this; }
+    bool operator==(const String &s) const { return str == s.str; }
+    bool operator==(const char *s) const { return str == s; }
+
+    friend String operator+(const String &a, const String &b) { return String(a.str + b.str); }
+    friend String operator+(const String &a, const char *b) { return String(a.str + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.str); }
+
+  private:
+    std::string str;
+
+    void fromDouble(double value, unsigned int decimals) {
+      char buf[64];
+      snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+      str = buf;
+    }
+};
+
+// Serial goes to stdout
+class HostSerial {
+  public:
+    void begin(unsigned long) {}
+    void print(const String &s) { fputs(s.c_str(), stdout); }
+    void print(const char *s) { fputs(s, stdout); }
+    void println(const String &s) { puts(s.c_str()); }
+    void println(const char *s) { puts(s); }
+    void println() { fputc('\n', stdout); }
+    int printf(const char *format, ...) {
+      va_list args;
+      va_start(args, format);
+      int n = vprintf(format, args);
+      va_end(args);
+      return n;
+    }
+};
+
+extern HostSerial Serial;
+
+#endif
@@ -0,0 +1,30 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Minimal uFire SHT20 API for building station code on Linux
+*               (bench)
+*****************************************************************************/
+
+#ifndef _HOST_UFIRE_SHT20_H_
+#define _HOST_UFIRE_SHT20_H_
+
+#include <Arduino.h>
+
+class uFire_SHT20 {
+  public:
+    bool begin(uint8_t = 0, uint8_t = 0x40) { return true; }
+};
+
+#endif
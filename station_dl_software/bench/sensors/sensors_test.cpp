@@ -0,0 +1,195 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Host tests of the station wind and rain minute, pulses
+*               injected in the PulseCounter stand-ins
+*****************************************************************************/
+
+// Usage: sensors_test
+//
+// Each second injects the anemometer pulses, feeds the vane samples to the
+// AdcStream stand-in and calls readAllData(), as the reading task does on
+// the RTC tick. Exits with 1 if any check fails, so it can gate changes to
+// the wind speed, gust and direction math.
+
+#include <Arduino.h>
+#include <vector>
+
+#include "sensors.h"
+
+#define VANE_SAMPLES 10  // vane conversions per second
+
+// Fields of getAvgData()
+#define FIELD_WIND_SPEED 3
+#define FIELD_WIND_DIR   4
+#define FIELD_RAIN       5
+#define FIELD_WIND_GUST  7
+
+// Vane sectors, clockwise by 45 degrees from N
+#define N  0
+#define NE 1
+#define NO 7
+
+int failures = 0;
+
+void check(bool ok, const char *name)
+{
+  Serial.printf("  %s  %s\n", ok ? "ok  " : "FAIL", name);
+  if(!ok){
+    failures++;
+  }
+}
+
+// First code the vane table maps to the sector
+uint16_t sectorCode(uint8_t sector)
+{
+  for(uint16_t code = 0; code < LUT_CODES; code++){
+    if(windSector(code) == sector){
+      return code;
+    }
+  }
+  return 0;
+}
+
+void second(Sensors &sensors, uint32_t pulses, uint8_t sector)
+{
+  std::vector<uint8_t> frame;
+  for(int i = 0; i < VANE_SAMPLES; i++){
+    uint16_t value = (ADC_STREAM_VANE << 12) | sectorCode(sector);
+    frame.push_back(value & 0xFF);
+    frame.push_back(value >> 8);
+  }
+  sensors.getAdcStream().add(frame.data(), frame.size());
+  sensors.getAnemometer().inject(pulses);
+  sensors.readAllData(0, 0);
+}
+
+double field(const String &data, int index)
+{
+  const char *p = data.c_str();
+  for(int i = 0; i < index && p; i++){
+    p = strchr(p, ',');
+    p = p ? p + 1 : NULL;
+  }
+  return p ? atof(p) : NAN;
+}
+
+bool near(double value, double expected)
+{
+  return fabs(value - expected) <= 0.006;  // String() keeps 2 decimals
+}
+
+void testSpeedAndGust()
+{
+  Serial.println("speed and gust");
+  Sensors sensors;
+  sensors.init();
+
+  //2 pulses a second, a 3 s burst of 6, 9, 6 and a 1 s spike of 12
+  uint32_t total = 0;
+  for(int s = 0; s < 60; s++){
+    uint32_t pulses = s == 20 || s == 22 ? 6 : s == 21 ? 9 : s == 40 ? 12 : 2;
+    second(sensors, pulses, N);
+    total += pulses;
+  }
+  String data = sensors.getAvgData();
+  Serial.printf("    %s\n", data.c_str());
+  check(near(field(data, FIELD_WIND_SPEED), (double)total/60*anemoKmhPerHz), "minute mean of the pulses");
+  check(near(field(data, FIELD_WIND_GUST), 21.0/GUST_SECONDS*anemoKmhPerHz),
+        "gust is the largest 3 s window, not the 1 s spike");
+
+  //The burst is gone, the first window still holds the last 2 s of the
+  //previous minute: 2 + 2 + 1
+  for(int s = 0; s < 60; s++){
+    second(sensors, 1, N);
+  }
+  data = sensors.getAvgData();
+  check(near(field(data, FIELD_WIND_SPEED), anemoKmhPerHz) &&
+        near(field(data, FIELD_WIND_GUST), 5.0/GUST_SECONDS*anemoKmhPerHz),
+        "gust starts over each minute, the window rolls across it");
+}
+
+void testDirection()
+{
+  Serial.println("direction");
+  Sensors sensors;
+  sensors.init();
+
+  //3 s at N for each second at NO, same pulses: about 349 degrees
+  for(int s = 0; s < 60; s++){
+    second(sensors, 4, s%4 == 3 ? NO : N);
+  }
+  String data = sensors.getAvgData();
+  check(field(data, FIELD_WIND_DIR) == 349, "N and NO weighted 3:1 give 349");
+
+  for(int s = 0; s < 60; s++){
+    second(sensors, 4, s%4 == 3 ? NE : N);
+  }
+  data = sensors.getAvgData();
+  check(field(data, FIELD_WIND_DIR) == 11, "N and NE weighted 3:1 give 11");
+
+  //Half the minute at 349 and half at 11: the vector mean is N, the mean of
+  //the angles would be 180
+  for(int s = 0; s < 56; s++){
+    second(sensors, 4, s%4 != 3 ? N : s < 28 ? NO : NE);
+  }
+  for(int s = 0; s < 4; s++){
+    second(sensors, 4, N);
+  }
+  data = sensors.getAvgData();
+  check(field(data, FIELD_WIND_DIR) == 0, "349 and 11 wrap to 0");
+
+  //Pulses weight the vane: a calm NE second does not pull the mean
+  for(int s = 0; s < 60; s++){
+    second(sensors, s < 30 ? 5 : 0, s < 30 ? N : NE);
+  }
+  data = sensors.getAvgData();
+  check(field(data, FIELD_WIND_DIR) == 0, "vane weighted by the wind run");
+
+  //No pulses all minute, the vane alone
+  for(int s = 0; s < 60; s++){
+    second(sensors, 0, NE);
+  }
+  data = sensors.getAvgData();
+  check(field(data, FIELD_WIND_DIR) == 45 && field(data, FIELD_WIND_SPEED) == 0 &&
+        field(data, FIELD_WIND_GUST) == 0, "calm minute takes the vane direction");
+}
+
+void testRain()
+{
+  Serial.println("rain");
+  Sensors sensors;
+  sensors.init();
+
+  sensors.getPluviometer().inject(3);
+  second(sensors, 0, N);
+  String data = sensors.getAvgData();
+  check(near(field(data, FIELD_RAIN), 0.75), "0.25 mm per tip");
+
+  sensors.getPluviometer().inject(2);
+  second(sensors, 0, N);
+  data = sensors.getAvgData();
+  check(near(field(data, FIELD_RAIN), 1.25), "rain adds up over the day");
+}
+
+int main()
+{
+  testSpeedAndGust();
+  testDirection();
+  testRain();
+
+  Serial.printf("%d failure(s)\n", failures);
+  return failures ? 1 : 0;
+}
@@ -98,6 +98,28 @@ uint8_t DataEncDec::addDate(long value){
     return cursor;
 }
 
+uint8_t DataEncDec::addRecordType(uint8_t type){
+    if ((cursor + 1) > maxsize || cursor == 0){
+        return 0;
+    }
+
+    buffer[0] |= EXTENDED_BIT;
+    buffer[cursor++] = type;
+
+    return cursor;
+}
+
+uint8_t DataEncDec::addCount(uint16_t value){
+    if ((cursor + 2) > maxsize){
+        return 0;
+    }
+
+    buffer[cursor++] = value >> 8;
+    buffer[cursor++] = value;
+
+    return cursor;
+}
+
 uint8_t DataEncDec::addTemp(float value){
     if ((cursor + 2) > maxsize){
         return 0;
@@ -167,6 +189,19 @@ uint8_t DataEncDec::addWindDirection(int value){
     return cursor;
 }
 
+uint8_t DataEncDec::addWindDegrees(int value){
+    if ((cursor + 2) > maxsize){
+        return 0;
+    }
+
+    // 0 to 359 degrees precission 1
+    uint16_t data = ((value % 360) + 360) % 360;
+    buffer[cursor++] = data >> 8;
+    buffer[cursor++] = data;
+
+    return cursor;
+}
+
 uint8_t DataEncDec::addRain(float value){
     if ((cursor + 1) > maxsize){
         return 0;
@@ -209,6 +244,60 @@ uint8_t DataEncDec::addPower(float value){
     return cursor;
 }
 
+uint8_t DataEncDec::addChannelMap(uint64_t map){
+    if ((cursor + LPP_MAP_SIZE) > maxsize){
+        return 0;
+    }
+
+    // bit 8*device + channel, device 5 first
+    for (int i = LPP_MAP_SIZE - 1; i >= 0; i--){
+        buffer[cursor++] = map >> (8*i);
+    }
+
+    return cursor;
+}
+
+uint8_t DataEncDec::addCodes(uint16_t* codes, uint8_t count){
+    uint8_t size = (count*3 + 1)/2;
+    if ((cursor + size) > maxsize){
+        return 0;
+    }
+
+    // 12 bit codes, two in three bytes, an odd last code in two
+    for (int i = 0; i < count; i += 2){
+        buffer[cursor++] = codes[i] >> 4;
+        if (i + 1 < count){
+            buffer[cursor++] = ((codes[i] & 0x0F) << 4) | ((codes[i+1] >> 8) & 0x0F);
+            buffer[cursor++] = codes[i+1];
+        }
+        else{
+            buffer[cursor++] = (codes[i] & 0x0F) << 4;
+        }
+    }
+
+    return cursor;
+}
+
+uint8_t DataEncDec::addHistogram(uint8_t id, uint32_t max, uint32_t* buckets){
+    if ((cursor + 5 + 2*DIAG_BUCKETS) > maxsize){
+        return 0;
+    }
+
+    // stage id, max in us and the bucket counts saturated to 16 bits
+    buffer[cursor++] = id;
+    buffer[cursor++] = max >> 24;
+    buffer[cursor++] = max >> 16;
+    buffer[cursor++] = max >> 8;
+    buffer[cursor++] = max;
+    for (int i = 0; i < DIAG_BUCKETS; i++){
+        uint16_t count = buckets[i] > 0xFFFF ? 0xFFFF : buckets[i];
+        buffer[cursor++] = count >> 8;
+        buffer[cursor++] = count;
+    }
+
+    return cursor;
+}
+
 uint8_t DataEncDec::getTo(char header){
     uint8_t to = (header>>6) & 3;
     return to;
@@ -229,6 +318,13 @@ uint8_t DataEncDec::getSettings(char header){
     return settings;
 }
 
+uint8_t DataEncDec::getRecordType(char header, char byte){
+    if (!(header & EXTENDED_BIT)){
+        return RECORD_AVERAGE;
+    }
+    return (uint8_t) byte;
+}
+
 long DataEncDec::getDate(char byte_h, char byte_hm, char byte_lm, char byte_l){
     uint32_t val = (byte_h << 24) | (byte_hm << 16) | (byte_lm << 8) | byte_l;
     long data = val;
@@ -236,6 +332,12 @@ long DataEncDec::getDate(char byte_h, char byte_hm, char byte_lm, char byte_l){
     return data;
 }
 
+uint16_t DataEncDec::getCount(char byte_h, char byte_l){
+    uint16_t val = ((uint8_t) byte_h << 8) | (uint8_t) byte_l;
+
+    return val;
+}
+
 float DataEncDec::getTemp(char byte_h, char byte_l){
     uint16_t val = (byte_h << 8) | byte_l;
     float data = val;
@@ -278,6 +380,12 @@ int DataEncDec::getWindDirection(char byte){
     return data;
 }
 
+int DataEncDec::getWindDegrees(char byte_h, char byte_l){
+    int data = ((uint8_t) byte_h << 8) | (uint8_t) byte_l;
+
+    return data;
+}
+
 float DataEncDec::getRain(char byte){
     float data = byte;
     data = data*0.25;
@@ -302,4 +410,40 @@ float DataEncDec::getPower(char byte_h, char byte_m, char byte_l){
     data = (data-90000.0)*0.1;
 
     return data;
+}
+
+uint64_t DataEncDec::getChannelMap(char* bytes){
+    uint64_t map = 0;
+    for (int i = 0; i < LPP_MAP_SIZE; i++){
+        map = (map << 8) | (uint8_t) bytes[i];
+    }
+
+    return map;
+}
+
+uint16_t DataEncDec::getCode(char* packed, uint16_t index){
+    char* pair = packed + (index/2)*3;
+    uint16_t val;
+    if (index % 2 == 0){
+        val = ((uint8_t) pair[0] << 4) | ((uint8_t) pair[1] >> 4);
+    }
+    else{
+        val = (((uint8_t) pair[1] & 0x0F) << 8) | (uint8_t) pair[2];
+    }
+
+    return val;
+}
+
+uint32_t DataEncDec::getHistogramMax(char* histogram){
+    uint32_t val = ((uint32_t)(uint8_t) histogram[1] << 24) | ((uint8_t) histogram[2] << 16) |
+                   ((uint8_t) histogram[3] << 8) | (uint8_t) histogram[4];
+
+    return val;
+}
+
+uint16_t DataEncDec::getHistogramBucket(char* histogram, uint8_t index){
+    char* count = histogram + 5 + 2*index;
+    uint16_t val = ((uint8_t) count[0] << 8) | (uint8_t) count[1];
+
+    return val;
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for oversampled DMA reads of the station ESP32 ADC
+*****************************************************************************/
+
+#include "adcstream.h"
+
+// ========= Init ============
+bool AdcStream::begin()
+{
+  tempSum = 0;
+  tempCount = 0;
+  vaneCount = 0;
+  for(int s = 0; s < 8; s++){
+    vaneSectors[s] = 0;
+  }
+
+#ifdef ESP_PLATFORM
+  adc_digi_init_config_t init = {};
+  init.max_store_buf_size = 4*ADC_STREAM_FRAME;
+  init.conv_num_each_intr = ADC_STREAM_FRAME/2;
+  init.adc1_chan_mask = BIT(ADC_STREAM_PVTEMP) | BIT(ADC_STREAM_VANE);
+  init.adc2_chan_mask = 0;
+  if(adc_digi_initialize(&init) != ESP_OK){
+    return false;
+  }
+
+  adc_digi_pattern_config_t pattern[2] = {};
+  pattern[0].atten = ADC_ATTEN_DB_11;
+  pattern[0].channel = ADC_STREAM_PVTEMP;
+  pattern[0].unit = 0;
+  pattern[0].bit_width = 12;
+  pattern[1] = pattern[0];
+  pattern[1].channel = ADC_STREAM_VANE;
+
+  adc_digi_configuration_t config = {};
+  config.conv_limit_en = true;  // required by the ESP32 controller
+  config.conv_limit_num = 250;
+  config.pattern_num = 2;
+  config.adc_pattern = pattern;
+  config.sample_freq_hz = ADC_STREAM_RATE;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+  if(adc_digi_controller_configure(&config) != ESP_OK || adc_digi_start() != ESP_OK){
+    adc_digi_deinitialize();
+    return false;
+  }
+
+  xTaskCreatePinnedToCore(
+    streamCode, /* Function to implement the task */
+    "adcStream", /* Name of the task */
+    4096,  /* Stack size in words */
+    this,  /* Task input parameter */
+    2,  /* Priority of the task */
+    &task,  /* Task handle. */
+    0); /* Core where the task should run */
+#endif
+  return true;
+}
+
+#ifdef ESP_PLATFORM
+// Blocks until the DMA has a frame, no CPU is spent between conversions
+void AdcStream::streamCode(void *parameter)
+{
+  AdcStream *stream = (AdcStream*) parameter;
+  uint8_t frame[ADC_STREAM_FRAME];
+  for(;;){
+    uint32_t len = 0;
+    esp_err_t result = adc_digi_read_bytes(frame, ADC_STREAM_FRAME, &len, ADC_MAX_DELAY);
+    if(result == ESP_OK || result == ESP_ERR_INVALID_STATE){  // invalid state: older frames dropped
+      stream->add(frame, len);
+    }
+  }
+}
+#endif
+
+// ========= Decimation ============
+// Type 1 conversions: 2 bytes little-endian, channel in bits 15:12 and the
+// code in bits 11:0
+void AdcStream::add(const uint8_t *bytes, size_t len)
+{
+  uint32_t sum = 0;
+  uint32_t count = 0;
+  uint32_t sectors[8] = {0};
+  uint32_t vane = 0;
+
+  for(size_t i = 0; i + 1 < len; i += 2){
+    uint16_t value = bytes[i] | (bytes[i+1] << 8);
+    uint16_t code = value & 0x0FFF;
+    switch(value >> 12){
+      case ADC_STREAM_PVTEMP:
+        sum += code;
+        count++;
+        break;
+      case ADC_STREAM_VANE:{
+        uint8_t sector = windSector(code);
+        if(sector != LUT_NO_SECTOR){
+          sectors[sector]++;
+        }
+        vane++;
+        break;
+      }
+    }
+  }
+
+  portENTER_CRITICAL(&mux);
+  tempSum += sum;
+  tempCount += count;
+  for(int s = 0; s < 8; s++){
+    vaneSectors[s] += sectors[s];
+  }
+  vaneCount += vane;
+  portEXIT_CRITICAL(&mux);
+}
+
+// Mean PV temperature code since the last call, with 4 fractional bits
+bool AdcStream::takeTemp(uint32_t *code16)
+{
+  portENTER_CRITICAL(&mux);
+  uint64_t sum = tempSum;
+  uint32_t count = tempCount;
+  tempSum = 0;
+  tempCount = 0;
+  portEXIT_CRITICAL(&mux);
+
+  if(count == 0){
+    return false;
+  }
+  *code16 = (sum*16 + count/2)/count;
+  return true;
+}
+
+// Vane samples per sector since the last call, returns all the vane samples
+// including those above the last sector limit
+uint32_t AdcStream::takeVane(uint32_t *sectors)
+{
+  portENTER_CRITICAL(&mux);
+  uint32_t count = vaneCount;
+  for(int s = 0; s < 8; s++){
+    sectors[s] = vaneSectors[s];
+    vaneSectors[s] = 0;
+  }
+  vaneCount = 0;
+  portEXIT_CRITICAL(&mux);
+  return count;
+}
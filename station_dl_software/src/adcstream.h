@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for oversampled DMA reads of the station ESP32 ADC
+*****************************************************************************/
+
+#ifndef ADCSTREAM_H
+#define ADCSTREAM_H
+
+#include <Arduino.h>
+#include "lut.h"
+#ifdef ESP_PLATFORM
+#include "driver/adc.h"
+#elif !defined(portMUX_INITIALIZER_UNLOCKED)
+//Host builds call add() and the take functions from one thread, there is
+//no FreeRTOS to lock against
+typedef int portMUX_TYPE;
+typedef void *TaskHandle_t;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL(mux)
+#endif
+
+#define ADC_STREAM_RATE    20000  // conversions/s of both channels, the ESP32 DMA minimum
+#define ADC_STREAM_FRAME   512    // bytes per DMA read, 256 conversions
+#define ADC_STREAM_PVTEMP  0      // ADC1 channel 0, GPIO36
+#define ADC_STREAM_VANE    4      // ADC1 channel 4, GPIO32
+
+// Samples the PV temperature and wind vane channels continuously with the
+// ADC digital controller, which fills DMA buffers without the CPU. A task
+// woken per buffer decimates them: the temperature codes are summed (box
+// filter, noise down by sqrt(N)) and each vane code is mapped to its sector
+// and counted. The take functions return what was gathered since their
+// previous call. Off the ESP32 (host builds) frames are fed with add().
+class AdcStream
+{
+private:
+  portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+  uint64_t tempSum;
+  uint32_t tempCount;
+  uint32_t vaneSectors[8];
+  uint32_t vaneCount;
+  TaskHandle_t task = NULL;
+
+public:
+  bool begin();
+  void add(const uint8_t *bytes, size_t len);
+  bool takeTemp(uint32_t *code16);
+  uint32_t takeVane(uint32_t *sectors);
+
+private:
+  static void streamCode(void *parameter);
+};
+
+#endif
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for compile time conversion tables of the station ADC
+*****************************************************************************/
+
+#ifndef LUT_H
+#define LUT_H
+
+#include <stdint.h>
+
+#define LUT_CODES    4096  // 12 bits ESP32 ADC
+#define LUT_NO_SECTOR 0xFF
+
+//PV temperature thermistor, in series with SERIESRESISTOR from 3.3 V
+constexpr double BCOEFFICIENT = 3950.0;
+constexpr double THERMISTORNOMINAL = 10000.0;
+constexpr double TEMPERATURENOMINAL = 25.0;
+constexpr double SERIESRESISTOR = 4590.0;
+
+//Wind vane sector upper limits in V, sector 0 is N and 7 is NO
+constexpr double WIND_SECTOR_LIMITS[8] = {2, 1.2, 0.77, 0.57, 0.45, 0.37, 0.29, 0.25};
+
+// ========= Constant expressions ============
+//The tables are built with C++11 constexpr functions, one return each, so
+//they follow the constants above on every build.
+namespace lut
+{
+  constexpr double LN2 = 0.69314718055994530942;
+
+  //ln(m) = 2*atanh(z), z = (m-1)/(m+1) <= 1/3 for m in [1,2]
+  constexpr double atanhSeries(double z2, double term, int n)
+  {
+    return n > 41 ? 0 : term/n + atanhSeries(z2, term*z2, n+2);
+  }
+
+  constexpr double lnReduced(double z)
+  {
+    return 2*atanhSeries(z*z, z, 1);
+  }
+
+  constexpr double ln(double x)
+  {
+    return x > 2 ? ln(x/2) + LN2 : x < 1 ? ln(x*2) - LN2 : lnReduced((x-1)/(x+1));
+  }
+
+  constexpr int32_t roundToInt(double v)
+  {
+    return v >= 0 ? (int32_t)(v + 0.5) : -(int32_t)(-v + 0.5);
+  }
+
+  constexpr int32_t clamp(int32_t v, int32_t low, int32_t high)
+  {
+    return v < low ? low : v > high ? high : v;
+  }
+
+  //Steinhart-Hart B equation, the 3.3 V of the divider cancels out
+  constexpr double kelvin(double rt)
+  {
+    return 1.0/(ln(rt/THERMISTORNOMINAL)/BCOEFFICIENT + 1.0/(TEMPERATURENOMINAL + 273.15));
+  }
+
+  constexpr int16_t thermistorCenti(int code)
+  {
+    return code == 0 ? -4000 : code == LUT_CODES - 1 ? 12500 :
+           clamp(roundToInt((kelvin(SERIESRESISTOR*(LUT_CODES - 1 - code)/code) - 273.15)*100), -4000, 12500);
+  }
+
+  constexpr uint8_t windSector(double voltage, int sector)
+  {
+    return sector < 0 ? LUT_NO_SECTOR :
+           voltage < WIND_SECTOR_LIMITS[sector] && (sector == 7 || voltage >= WIND_SECTOR_LIMITS[sector+1]) ?
+           sector : windSector(voltage, sector - 1);
+  }
+
+  constexpr uint8_t windSectorCode(int code)
+  {
+    return windSector(3.3*code/(LUT_CODES - 1), 7);
+  }
+
+  // ========= Tables ============
+  template<int... I> struct Indices {};
+
+  template<class A, class B> struct Concat;
+  template<int... A, int... B> struct Concat<Indices<A...>, Indices<B...> >
+  {
+    typedef Indices<A..., (int)sizeof...(A) + B...> type;
+  };
+
+  //Log depth, a linear recursion would hit the template depth limit
+  template<int N> struct MakeIndices
+  {
+    typedef typename Concat<typename MakeIndices<N/2>::type, typename MakeIndices<N - N/2>::type>::type type;
+  };
+  template<> struct MakeIndices<0> { typedef Indices<> type; };
+  template<> struct MakeIndices<1> { typedef Indices<0> type; };
+
+  template<class T, T (*F)(int), class S> struct Table;
+  template<class T, T (*F)(int), int... I> struct Table<T, F, Indices<I...> >
+  {
+    static constexpr T values[sizeof...(I)] = {F(I)...};
+  };
+  template<class T, T (*F)(int), int... I>
+  constexpr T Table<T, F, Indices<I...> >::values[sizeof...(I)];
+}
+
+//Indexed by the ADC code, kept in flash
+typedef lut::Table<int16_t, lut::thermistorCenti, lut::MakeIndices<LUT_CODES>::type> ThermistorTable;
+typedef lut::Table<uint8_t, lut::windSectorCode, lut::MakeIndices<LUT_CODES>::type> WindSectorTable;
+
+// ========= Lookups ============
+//PV temperature in centi-degrees, clamped to -40..125 C
+inline int16_t thermistorCenti(uint16_t code)
+{
+  return ThermistorTable::values[code & (LUT_CODES - 1)];
+}
+
+//Same for a code with 4 fractional bits, as given by averaged reads,
+//interpolated between the two entries around it
+inline int16_t thermistorCentiFine(uint32_t code16)
+{
+  uint32_t code = code16 >> 4;
+  if(code >= LUT_CODES - 1){
+    return ThermistorTable::values[LUT_CODES - 1];
+  }
+  int32_t low = ThermistorTable::values[code];
+  int32_t high = ThermistorTable::values[code + 1];
+  return low + (high - low)*(int32_t)(code16 & 0x0F)/16;
+}
+
+//Wind vane sector 0..7, LUT_NO_SECTOR above the last limit
+inline uint8_t windSector(uint16_t code)
+{
+  return WindSectorTable::values[code & (LUT_CODES - 1)];
+}
+
+#endif
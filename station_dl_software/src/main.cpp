@@ -41,6 +41,7 @@
 // #include "images.h" //ANEEL logo, removed because of license
 #include "sensors.h"
 #include "log.h"
+#include "timing.h"
 
 // Pin definitions
 #define SCK     5    // GPIO5  -- SX127x's SCK
@@ -53,6 +54,14 @@
 #define SDA     4    // GPIO4  -- SDA
 #define SCL     15   // GPIO15 -- SCL
 
+//The reading task sleeps between sensor jobs and only reads the RTC from
+//SECOND_GUARD ms before the second it expects, every SECOND_POLL ms
+#define SECOND_GUARD 20
+#define SECOND_POLL  2
+
+//Shortest irradiance period the settings can ask for, in ms
+#define MIN_IRRADIANCE_PERIOD 10
+
 //Tasks declaration
 TaskHandle_t readData;
 TaskHandle_t sendData;
@@ -61,13 +70,19 @@ TaskHandle_t sendData;
 SSD1306 display(0x3c, SDA, SCL);
 Sensors mySensors;
 Log myLog;
+SpiBus spiBus;
+Timing timing;
 hw_timer_t *timer = NULL;
+TimingHistogram diagStages[DIAG_STAGES]; //last DIAG_INTERVAL minutes, sent once
+long diagDate;
+volatile bool diagPending = false;
 
 //Variable declaration
 int prevSecond = 0; //verify if is a new second
+unsigned long secondAt = 0; //millis() when prevSecond started
+uint32_t scheduleVersion = 0; //settings version the sensor periods follow
 // unsigned long data_send = 1; //couter for sent packets
 // unsigned long operating_hours = 0; //counter for device operating hours
-boolean usingSPI = false;
 
 //Functions declaration
 //Print logo
@@ -85,31 +100,86 @@ void IRAM_ATTR resetModule(){
     esp_restart();
 }
 
+//Sensor periods from the settings, 0 restores the firmware default.
+//Called from the reading task, setPeriod talks to the ADS over I2C
+void applySettings()
+{
+  scheduleVersion = myLog.getSettingsVersion();
+  float *settings = myLog.getSettings();
+
+  uint32_t irradiance = settings[2] > 0 ? (uint32_t)settings[2] : IRRADIANCE_PERIOD;
+  if(irradiance < MIN_IRRADIANCE_PERIOD){
+    irradiance = MIN_IRRADIANCE_PERIOD;
+  }
+  uint32_t ambient = settings[3] > 0 ? (uint32_t)(settings[3]*1000) : AMBIENT_PERIOD;
+  uint32_t pvTemp = settings[4] > 0 ? (uint32_t)lround(settings[4]*1000) : PVTEMP_PERIOD;
+
+  mySensors.setPeriod(SENSOR_IRRADIANCE, irradiance);
+  mySensors.setPeriod(SENSOR_PVTEMP, pvTemp);
+  mySensors.setPeriod(SENSOR_AMBIENT, ambient);
+}
+
 // Tasks implementation
 
 void readDataCode( void * parameter) {
+  applySettings();
   for(;;) {
+    if(myLog.getSettingsVersion() != scheduleVersion){
+      applySettings();
+    }
+    uint32_t wait = mySensors.poll();
+
+    //Each RTC read is an I2C transaction, skip them until the second is near
+    uint32_t sinceSecond = millis() - secondAt;
+    uint32_t toSecond = sinceSecond < 1000 - SECOND_GUARD ? 1000 - SECOND_GUARD - sinceSecond : 0;
+    if(toSecond > 0){
+      uint32_t sleep = wait < toSecond ? wait : toSecond;
+      if(sleep > 0){
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep));
+      }
+      continue;
+    }
+
     int second = myLog.getSecond();
-    if (second !=  prevSecond){
+    if (second == prevSecond){
+      uint32_t sleep = wait < SECOND_POLL ? wait : SECOND_POLL;
+      if(sleep > 0){
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep));
+      }
+    }
+    else{
       timerWrite(timer, 0);
 
       digitalWrite(25, HIGH);   // indicative LED
       prevSecond = second;
+      secondAt = millis();
+      timing.tick(1000000);
 
+      int64_t start = Timing::now();
       mySensors.readAllData(myLog.getSettings()[0], myLog.getSettings()[1]);
+      timing.record(DIAG_READ, start);
       Serial.print("Reading Data - ");
       Serial.println(second);
       
       if (second == 0 )
       {
-        while (usingSPI){if(!usingSPI) break; delay(10);}
-        usingSPI = true;
         Serial.println("Saving Data");
-        bool newDay = myLog.saveData(mySensors.getAvgData());
+        start = Timing::now();
+        String data = mySensors.getAvgData();
+        timing.record(DIAG_PROCESS, start);
+        bool newDay = myLog.saveData(data);
         if(newDay){
           mySensors.setPluvCounter0();
         }
-        usingSPI = false;
+        spiBus.printStats();
+        spiBus.resetStats();
+        mySensors.printSchedule();
+        timing.print();
+        if(myLog.getMin() % DIAG_INTERVAL == 0 && !diagPending){
+          timing.take(diagStages);
+          diagDate = myLog.getTime().toInt();
+          diagPending = true;
+        }
       }
 
       digitalWrite(25, LOW);   // indicative LED
@@ -121,11 +191,14 @@ void sendDataCode( void * parameter) {
   for(;;) {
     delay(5000);
 
-    while (usingSPI){delay(10);}
-    usingSPI = true;
+    //A single try, diagnostics are not kept on SD
+    if(diagPending){
+      myLog.diagnosticsSend(diagDate, diagStages);
+      diagPending = false;
+    }
+
     String data = myLog.readData();
     Serial.println(data);
-    usingSPI = false;
 
     if(data != ""){
       Serial.println("Sending data");
@@ -149,22 +222,18 @@ void sendDataCode( void * parameter) {
       int w_dir = data.substring(delimiter[4]+1, delimiter[5]).toInt();
       float rain = data.substring(delimiter[5]+1, delimiter[6]).toFloat();
       float pv_temp = data.substring(delimiter[6]+1, delimiter[7]).toFloat();
+      //Lines saved before the gust was logged have no 9th field
+      float w_gust = delimiter[7] > 0 ? data.substring(delimiter[7]+1, delimiter[8]).toFloat() : w_spe;
 
       int sent = 0;
       while(!sent){
-        while (usingSPI){delay(10);}
-        usingSPI = true;
-        sent = myLog.stationDataSend(date, amb_temp, humi, irrad, w_spe, w_dir, rain, pv_temp);
-        usingSPI = false;
+        sent = myLog.stationDataSend(date, amb_temp, humi, irrad, w_spe, w_gust, w_dir, rain, pv_temp);
 
         if(sent) delay(10);
         else delay(2500);
       }
 
-      while (usingSPI){delay(10);}
-      usingSPI = true;
       myLog.removeSentData();
-      usingSPI = false;
       Serial.println("Data sent");
 
     }
@@ -209,7 +278,9 @@ void setup() {
 
   timerWrite(timer, 0);
 
-  myLog.init();
+  spiBus.begin();
+  myLog.init(&spiBus);
+  myLog.setTiming(&timing);
 
   timerWrite(timer, 0);
 
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for counting anemometer and rain gauge pulses
+*****************************************************************************/
+
+#include "pulsecounter.h"
+
+// ========= Init ============
+bool PulseCounter::begin(int pin, int pcntUnit, bool rising)
+{
+  unit = pcntUnit;
+  last = 0;
+  injected = 0;
+
+#ifdef ESP_PLATFORM
+  pcnt_config_t config = {};
+  config.pulse_gpio_num = pin;
+  config.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+  config.channel = PCNT_CHANNEL_0;
+  config.unit = (pcnt_unit_t) unit;
+  config.pos_mode = rising ? PCNT_COUNT_INC : PCNT_COUNT_DIS;
+  config.neg_mode = rising ? PCNT_COUNT_DIS : PCNT_COUNT_INC;
+  config.lctrl_mode = PCNT_MODE_KEEP;
+  config.hctrl_mode = PCNT_MODE_KEEP;
+  config.counter_h_lim = PULSE_LIMIT;
+  config.counter_l_lim = 0;
+
+  if(pcnt_unit_config(&config) != ESP_OK){
+    return false;
+  }
+  pcnt_set_filter_value(config.unit, PULSE_FILTER);
+  pcnt_filter_enable(config.unit);
+  pcnt_counter_pause(config.unit);
+  pcnt_counter_clear(config.unit);
+  pcnt_counter_resume(config.unit);
+#else
+  (void)pin;
+  (void)rising;
+#endif
+  return true;
+}
+
+// ========= Count ============
+uint32_t PulseCounter::read()
+{
+#ifdef ESP_PLATFORM
+  int16_t count;
+  pcnt_get_counter_value((pcnt_unit_t) unit, &count);
+  uint32_t pulses = (count - last + PULSE_LIMIT) % PULSE_LIMIT;
+  last = count;
+  return pulses;
+#else
+  uint32_t pulses = injected;
+  injected = 0;
+  return pulses;
+#endif
+}
+
+// Host stand-in, the pulses the next read() returns
+void PulseCounter::inject(uint32_t pulses)
+{
+  injected += pulses;
+}
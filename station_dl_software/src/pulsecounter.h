@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for counting anemometer and rain gauge pulses
+*****************************************************************************/
+
+#ifndef PULSECOUNTER_H
+#define PULSECOUNTER_H
+
+#include <Arduino.h>
+#ifdef ESP_PLATFORM
+#include "driver/pcnt.h"
+#endif
+
+#define PULSE_LIMIT   30000  // the PCNT counter returns to 0 here
+#define PULSE_FILTER  1023   // APB cycles, the largest glitch filter (12.8 us)
+
+// Counts the edges of a pin with an ESP32 PCNT unit, no interrupt per
+// pulse. read() gives the pulses since the previous read, it must run
+// before PULSE_LIMIT pulses pile up. Off the ESP32 (host builds) the
+// counter is a stand-in fed with inject().
+class PulseCounter
+{
+private:
+  int unit;
+  int16_t last;
+  uint32_t injected;
+
+public:
+  bool begin(int pin, int pcntUnit, bool rising);
+  uint32_t read();
+  void inject(uint32_t pulses);
+};
+
+#endif
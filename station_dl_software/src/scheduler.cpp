@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for scheduling the station sensor reads
+*****************************************************************************/
+
+#include "scheduler.h"
+
+// ========= Jobs ============
+// Returns the job id, -1 when the table is full
+int Scheduler::add(SchedulerJob job, void *context, uint32_t periodMs)
+{
+  if(nJobs >= SCHED_MAX_JOBS){
+    return -1;
+  }
+  jobs[nJobs].job = job;
+  jobs[nJobs].context = context;
+  jobs[nJobs].period = periodMs;
+  jobs[nJobs].next = millis();
+  jobs[nJobs].runs = 0;
+  jobs[nJobs].missed = 0;
+  return nJobs++;
+}
+
+void Scheduler::setPeriod(int id, uint32_t periodMs)
+{
+  if(id >= 0 && id < nJobs){
+    jobs[id].period = periodMs;
+    jobs[id].next = millis();
+  }
+}
+
+uint32_t Scheduler::getPeriod(int id)
+{
+  return id >= 0 && id < nJobs ? jobs[id].period : 0;
+}
+
+// ========= Run ============
+// Runs every job due at now, the most overdue first, and returns the ms
+// left to the next deadline
+uint32_t Scheduler::run(uint32_t now)
+{
+  for(;;){
+    int due = -1;
+    int32_t late = -1;
+    for(int i = 0; i < nJobs; i++){
+      int32_t l = (int32_t)(now - jobs[i].next);
+      if(l > late){
+        late = l;
+        due = i;
+      }
+    }
+    if(due < 0){
+      break;
+    }
+
+    Job &j = jobs[due];
+    j.job(j.context);
+    j.runs++;
+    now = millis();
+    j.next += j.period;
+    if((int32_t)(now - j.next) > 0){
+      uint32_t behind = (now - j.next)/j.period + 1;
+      j.missed += behind;
+      j.next += behind*j.period;
+    }
+  }
+
+  uint32_t wait = UINT32_MAX;
+  for(int i = 0; i < nJobs; i++){
+    uint32_t left = jobs[i].next - now;
+    if(left < wait){
+      wait = left;
+    }
+  }
+  return wait;
+}
+
+// ========= Stats ============
+void Scheduler::printStats(const char **names)
+{
+  for(int i = 0; i < nJobs; i++){
+    Serial.printf("%-11s %6u ms %6u runs %4u missed\n", names[i], jobs[i].period, jobs[i].runs, jobs[i].missed);
+  }
+}
+
+void Scheduler::resetStats()
+{
+  for(int i = 0; i < nJobs; i++){
+    jobs[i].runs = 0;
+    jobs[i].missed = 0;
+  }
+}
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for scheduling the station sensor reads
+*****************************************************************************/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+#define SCHED_MAX_JOBS 8
+
+typedef void (*SchedulerJob)(void *context);
+
+// Periodic jobs run earliest deadline first from a polling loop. Deadlines
+// advance by whole periods, so rates do not drift with the loop latency; a
+// job that falls a full period behind skips the lost runs and counts them
+// as missed instead of running in a burst.
+class Scheduler
+{
+private:
+  struct Job
+  {
+    SchedulerJob job;
+    void *context;
+    uint32_t period;  // ms
+    uint32_t next;    // millis() deadline
+    uint32_t runs;
+    uint32_t missed;
+  };
+
+  Job jobs[SCHED_MAX_JOBS];
+  int nJobs = 0;
+
+public:
+  int add(SchedulerJob job, void *context, uint32_t periodMs);
+  void setPeriod(int id, uint32_t periodMs);
+  uint32_t getPeriod(int id);
+  uint32_t run(uint32_t now);
+  void printStats(const char **names);
+  void resetStats();
+};
+
+#endif
@@ -18,20 +18,25 @@
 
 #include "sensors.h"
 
-unsigned int Sensors::anemCounter = 0;
-unsigned int Sensors::pluvCounter = 0;
+volatile bool Sensors::adsReady = false;
+
+//Vane sector headings, sector 0 is N and they go clockwise by 45 degrees
+static const float sectorEast[8] = {0, 0.70710678, 1, 0.70710678, 0, -0.70710678, -1, -0.70710678};
+static const float sectorNorth[8] = {1, 0.70710678, 0, -0.70710678, -1, -0.70710678, 0, 0.70710678};
+
+//ADS1115 data rates (SPS) of the config values 0 to 7
+static const uint16_t adsRates[8] = {8, 16, 32, 64, 128, 250, 475, 860};
+static const char *sensorNames[SENSOR_SCHEDULED] = {"Irradiance", "PV temp", "Ambient"};
 
 // ========= Init ============
 void Sensors::init()
 {
-  try
-  {
-    ads1 = Adafruit_ADS1115(adc1Add);
-    ads1.setGain(GAIN_SIXTEEN);
-    ads1.begin();
-  }
-  catch(int e)
-  {
+  //Job ids follow the SENSOR_ order
+  scheduler.add(irradianceJob, this, IRRADIANCE_PERIOD);
+  scheduler.add(PVtempJob, this, PVTEMP_PERIOD);
+  scheduler.add(ambientJob, this, AMBIENT_PERIOD);
+
+  if(!startIradiance()){
     throw "Could not find ADS1117(0x48)!";
   }
 
@@ -69,42 +74,56 @@ void Sensors::init()
 
   pinMode(anemoPin, INPUT_PULLUP);
   pinMode(pluvPin, INPUT_PULLUP);
-  anemCounter = 0;
+  if(!anemometer.begin(anemoPin, anemoUnit, true) || !pluviometer.begin(pluvPin, pluvUnit, false)){
+    throw "Could not start the pulse counters!";
+  }
+  streaming = adcStream.begin();
+  if(!streaming){
+    Serial.println("ADC stream not started, single reads");
+  }
   act_time = 0;
-  pluvCounter = 0;
-  attachInterrupt(digitalPinToInterrupt(anemoPin), addAnemCounter, RISING);
-  attachInterrupt(digitalPinToInterrupt(pluvPin), addPluvCounter, FALLING);
+  windPulses = 0;
+  rainPulses = 0;
+  gustPulses = 0;
+  gustSlot = 0;
+  for(int i = 0; i < GUST_SECONDS; i++){
+    gustWindow[i] = 0;
+  }
+  pinMode(adsRdyPin, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(adsRdyPin), addAdsReady, FALLING);
 
+  shtState = SHT_IDLE;
+  lastRdy = 0;
   readTimes = 0;
+  tempTimes = 0;
+  humidityTimes = 0;
+  irradianceTimes = 0;
+  PVtempTimes = 0;
+  irradianceSum = 0;
   temp = 0;
   pressure = 0;
   humidity = 0;
   irradiance = 0;
   windSpeed = 0;
-  windDirection = new int[8];
-  windDirection[0] = 0;
-  windDirection[1] = 0;
-  windDirection[2] = 0;
-  windDirection[3] = 0;
-  windDirection[4] = 0;
-  windDirection[5] = 0;
-  windDirection[6] = 0;
-  windDirection[7] = 0;
+  windGust = 0;
+  windEast = 0;
+  windNorth = 0;
+  vaneEast = 0;
+  vaneNorth = 0;
   rain = 0;
   PVtemp = 0;
+  PVtempCenti = 0;
   // voltage = 0;
   // current = 0;
 }
 
 // ========= Read all data each second ============
+// Only the pulse counters and the vane, the other sensors run at their own
+// periods from poll()
 void Sensors::readAllData(float currGain, float voltGain)
 {
-  readTemp();
-  readHumidity();
-  readIradiance();
-  readWindDirection();
+  readWind();
   readRain();
-  readPVtemp();
   // readVoltage(voltGain);
   // readCurrent(currGain);
 
@@ -129,27 +148,32 @@ String Sensors::getAvgData(){
     data += getRain();
     data += ",";
     data += getPVtemp();
+    data += ",";
+    data += getWindGust();
     // data += ",";
     // data += getVoltage();
     // data += ",";
     // data += getCurrent();
 
     readTimes = 0;
+    tempTimes = 0;
+    humidityTimes = 0;
+    irradianceTimes = 0;
+    PVtempTimes = 0;
     temp = 0;
     pressure = 0;
     humidity = 0;
     irradiance = 0;
+    irradianceSum = 0;
     windSpeed = 0;
-    windDirection[0] = 0;
-    windDirection[1] = 0;
-    windDirection[2] = 0;
-    windDirection[3] = 0;
-    windDirection[4] = 0;
-    windDirection[5] = 0;
-    windDirection[6] = 0;
-    windDirection[7] = 0;
+    windGust = 0;
+    windEast = 0;
+    windNorth = 0;
+    vaneEast = 0;
+    vaneNorth = 0;
     rain = 0;
     PVtemp = 0;
+    PVtempCenti = 0;
     // voltage = 0;
     // current = 0;
   }
@@ -158,69 +182,249 @@ String Sensors::getAvgData(){
 }
 
 
-// ========= Read sensors data ============
-void Sensors::readTemp()
+// ========= Pipeline ============
+// Called between ticks by the reading task, runs the sensors whose deadline
+// has come and never waits for a conversion. Returns the ms until something
+// is due again, the task can sleep that long.
+uint32_t Sensors::poll()
+{
+  uint32_t wait = scheduler.run(millis());
+  serviceSht();
+  uint32_t sht = shtWait();
+  return sht < wait ? sht : wait;
+}
+
+// Each sensor is averaged over its own samples, so the period changes the
+// number of samples in a minute but not the weight of the minute
+void Sensors::setPeriod(int sensor, uint32_t periodMs)
+{
+  if(sensor < 0 || sensor >= SENSOR_SCHEDULED || periodMs == 0){
+    return;
+  }
+  scheduler.setPeriod(sensor, periodMs);
+  if(sensor == SENSOR_IRRADIANCE){
+    startIradiance();
+  }
+}
+
+void Sensors::printSchedule()
 {
-  // temp += bme.readTemperature();
-  // temp += 0;
-  temp += sht20.temperature();
+  scheduler.printStats(sensorNames);
+  scheduler.resetStats();
+}
 
+void Sensors::irradianceJob(void *sensors)
+{
+  ((Sensors*) sensors)->sampleIradiance();
 }
 
-void Sensors::readHumidity()
+void Sensors::PVtempJob(void *sensors)
 {
-  // humidity += bme.readHumidity();
-  // humidity += 0;
-  humidity += sht20.humidity();
+  ((Sensors*) sensors)->readPVtemp();
+}
+
+void Sensors::ambientJob(void *sensors)
+{
+  ((Sensors*) sensors)->startAmbient();
+}
+
+bool Sensors::startIradiance()
+{
+  uint32_t period = scheduler.getPeriod(SENSOR_IRRADIANCE);
+  uint16_t rate = 7;
+  for(int i = 7; i >= 0; i--){
+    if(adsRates[i]*period >= 1000){
+      rate = i;
+    }
+  }
+
+  //RDY mode: Hi_thresh MSB set and Lo_thresh MSB clear
+  if(!writeRegister(adc1Add, ADS_REG_LO_THRESH, 0x0000) ||
+     !writeRegister(adc1Add, ADS_REG_HI_THRESH, 0x8000) ||
+     !writeRegister(adc1Add, ADS_REG_CONFIG, ADS_CONFIG_IRRADIANCE | (rate << 5))){
+    return false;
+  }
+  //Leave the pointer on the conversion register, reads need no write
+  Wire.beginTransmission(adc1Add);
+  Wire.write(ADS_REG_CONVERSION);
+  return Wire.endTransmission() == 0;
 }
 
 void Sensors::readIradiance()
 {
-  double AIN01 = ads1.readADC_Differential_0_1()*adsGain1;
-  irradiance += AIN01*1000/(1.69/100);
+  if(Wire.requestFrom(adc1Add, 2) != 2){
+    return;
+  }
+  int16_t code = (Wire.read() << 8) | Wire.read();
+  irradianceSum += code;
+  irradianceTimes++;
+}
+
+// Takes the conversion RDY announced, a sample is never counted twice. Without
+// RDY edges (ALERT not wired) the conversion register is read anyway.
+void Sensors::sampleIradiance()
+{
+  if(adsReady){
+    adsReady = false;
+    lastRdy = millis();
+    readIradiance();
+  }
+  else if(millis() - lastRdy > ADS_RDY_TIMEOUT){
+    readIradiance();
+  }
+}
+
+void Sensors::startAmbient()
+{
+  if(shtState == SHT_IDLE && startSht(SHT_TRIGGER_TEMP)){
+    shtState = SHT_TEMP;
+  }
+}
+
+void Sensors::serviceSht()
+{
+  uint16_t raw;
+
+  if(shtState == SHT_TEMP && millis() - shtStart >= SHT_TEMP_TIME){
+    if(readSht(&raw)){
+      temp += -46.85 + 175.72*raw/65536.0;
+      tempTimes++;
+      shtState = startSht(SHT_TRIGGER_HUMI) ? SHT_HUMI : SHT_IDLE;
+    }
+    else if(millis() - shtStart >= 2*SHT_TEMP_TIME){
+      shtState = SHT_IDLE;
+    }
+  }
+  else if(shtState == SHT_HUMI && millis() - shtStart >= SHT_HUMI_TIME){
+    if(readSht(&raw)){
+      humidity += -6.0 + 125.0*raw/65536.0;
+      humidityTimes++;
+      shtState = SHT_IDLE;
+    }
+    else if(millis() - shtStart >= 2*SHT_HUMI_TIME){
+      shtState = SHT_IDLE;
+    }
+  }
+}
+
+// Until the running SHT20 conversion should be done, then the retry pace
+uint32_t Sensors::shtWait()
+{
+  if(shtState == SHT_IDLE){
+    return UINT32_MAX;
+  }
+  uint32_t elapsed = millis() - shtStart;
+  uint32_t conversion = shtState == SHT_TEMP ? SHT_TEMP_TIME : SHT_HUMI_TIME;
+  return elapsed < conversion ? conversion - elapsed : SHT_RETRY;
+}
+
+bool Sensors::startSht(uint8_t command)
+{
+  Wire.beginTransmission(shtAdd);
+  Wire.write(command);
+  shtStart = millis();
+  return Wire.endTransmission() == 0;
 }
 
-void Sensors::readWindDirection()
+//The SHT20 NACKs the read while it is still measuring
+bool Sensors::readSht(uint16_t *raw)
 {
-  unsigned int adcRead;
+  if(Wire.requestFrom(shtAdd, 3) != 3){
+    return false;
+  }
+  uint8_t data[2];
+  data[0] = Wire.read();
+  data[1] = Wire.read();
+  uint8_t checksum = Wire.read();
+
+  uint8_t crc = 0;
+  for(int i = 0; i < 2; i++){
+    crc ^= data[i];
+    for(int bit = 0; bit < 8; bit++){
+      crc = crc & 0x80 ? (crc << 1) ^ 0x31 : crc << 1;
+    }
+  }
+  if(crc != checksum){
+    return false;
+  }
+  *raw = ((data[0] << 8) | data[1]) & 0xFFFC;  // status bits
+  return true;
+}
 
-  adcRead = analogRead(32); // get the current reading from the sensor
+bool Sensors::writeRegister(uint8_t address, uint8_t reg, uint16_t value)
+{
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  Wire.write(value >> 8);
+  Wire.write(value & 0xFF);
+  return Wire.endTransmission() == 0;
+}
 
-  // The following table is ADC readings for the wind direction sensor output, sorted from low to high.
-  // Each threshold is the midpoint between adjacent headings. The output is degrees for that ADC reading.
-  // Note that these are not in compass degree order! See Weather Meters datasheet for more information.
-  // Serial.print("adc: ");Serial.println(adc);
-  float voltage = ((3.3/4095)*adcRead);
+// ========= Read sensors data ============
 
-  if (voltage < 0.25) windDirection[7]++;       //315 - NO
-  else if (voltage < 0.29) windDirection[6]++;  //270 - O
-  else if (voltage < 0.37) windDirection[5]++;  //225 - SO
-  else if (voltage < 0.45) windDirection[4]++;  //180 - S
-  else if (voltage < 0.57) windDirection[3]++;  //135 - SE
-  else if (voltage < 0.77) windDirection[2]++;  //90 - E
-  else if (voltage < 1.2) windDirection[1]++;   //45 - NE
-  else if (voltage < 2) windDirection[0]++;     //0 - N
+// Each second: anemometer pulses for the mean and the gust, and the vane
+// heading weighted by them
+void Sensors::readWind()
+{
+  uint32_t pulses = anemometer.read();
+  windPulses += pulses;
+
+  gustWindow[gustSlot] = pulses;
+  gustSlot = (gustSlot + 1) % GUST_SECONDS;
+  uint32_t window = 0;
+  for(int i = 0; i < GUST_SECONDS; i++){
+    window += gustWindow[i];
+  }
+  if(window > gustPulses){
+    gustPulses = window;
+  }
+
+  // Sector limits are the midpoints between adjacent headings of the vane
+  // output, see WIND_SECTOR_LIMITS and the Weather Meters datasheet. The
+  // streamed samples of the second give the mean vector of the vane.
+  float east = 0;
+  float north = 0;
+  if(streaming){
+    uint32_t sectors[8];
+    uint32_t samples = adcStream.takeVane(sectors);
+    for(int s = 0; s < 8 && samples > 0; s++){
+      east += (float)sectors[s]/samples*sectorEast[s];
+      north += (float)sectors[s]/samples*sectorNorth[s];
+    }
+  }
+  else{
+    uint8_t sector = windSector(analogRead(windDirPin));
+    if(sector != LUT_NO_SECTOR){
+      east = sectorEast[sector];
+      north = sectorNorth[sector];
+    }
+  }
+  windEast += pulses*east;
+  windNorth += pulses*north;
+  vaneEast += east;
+  vaneNorth += north;
 }
 
 void Sensors::readRain()
 {
-  rain = pluvCounter*0.25;
+  rainPulses += pluviometer.read();
+  rain = rainPulses*0.25;
 }
 
+// Streaming, one sample is the box filter of the codes since the last one
 void Sensors::readPVtemp()
 {
-  unsigned int adcRead;
-  adcRead = analogRead(tempPin);
-  float voltage = ((3.3/4095)*adcRead);
-  float Rt = 4590*(3.3-voltage)/voltage;
-  float steinhart;
-  steinhart = Rt / THERMISTORNOMINAL;     // (R/Ro)
-  steinhart = log(steinhart);                  // ln(R/Ro)
-  steinhart /= BCOEFFICIENT;                   // 1/B * ln(R/Ro)
-  steinhart += 1.0 / (TEMPERATURENOMINAL + 273.15); // + (1/To)
-  steinhart = 1.0 / steinhart;                 // Invert
-  steinhart -= 273.15;    
-  PVtemp +=  (steinhart);
+  uint32_t code16;
+  if(streaming){
+    if(!adcStream.takeTemp(&code16)){
+      return;
+    }
+    PVtempCenti += thermistorCentiFine(code16);
+  }
+  else{
+    PVtempCenti += thermistorCenti(analogRead(tempPin));
+  }
+  PVtempTimes++;
 }
 
 void Sensors::readVoltage(float gain)
@@ -253,31 +457,21 @@ void Sensors::readCurrent(float gain)
 
 
 // ========= Aux functions ============
-void Sensors::setAnemCounter0()
-{
-  anemCounter = 0;
-}
-
 void Sensors::setPluvCounter0()
 {
-  pluvCounter = 0;
+  rainPulses = 0;
 }
 
-void Sensors::addAnemCounter()
+void IRAM_ATTR Sensors::addAdsReady()
 {
-  anemCounter++;
-}
-
-void Sensors::addPluvCounter()
-{
-  pluvCounter++;
+  adsReady = true;
 }
 
 
 // ========= Get sensors data ============
 String Sensors::getTemp()
 {
-  temp = temp/readTimes;
+  temp = tempTimes > 0 ? temp/tempTimes : 0;
   if(temp < -40 ){
     temp = -40;
   }
@@ -289,7 +483,7 @@ String Sensors::getTemp()
 
 String Sensors::getHumidity()
 {
-  humidity = humidity/readTimes;
+  humidity = humidityTimes > 0 ? humidity/humidityTimes : 0;
   if(humidity < 0){
     humidity = 0;
   }
@@ -301,7 +495,8 @@ String Sensors::getHumidity()
 
 String Sensors::getIradiance()
 {
-  irradiance = irradiance/readTimes;
+  double AIN01 = irradianceTimes > 0 ? (double)irradianceSum/irradianceTimes*adsGain1 : 0;
+  irradiance = AIN01*1000/(1.69/100);
   if(irradiance < 0.47)
   {
     irradiance = 0.0;
@@ -314,11 +509,9 @@ String Sensors::getIradiance()
 
 String Sensors::getWindSpeed()
 {
-  int RPM = (anemCounter*60)/readTimes;
-  anemCounter = 0;
-  attachInterrupt(digitalPinToInterrupt(anemoPin), addAnemCounter, RISING);
-  windSpeed = (((4 * pi * radius * RPM)/60) / 1000)*3.6; //Km/h
-  
+  windSpeed = (float)windPulses/readTimes*anemoKmhPerHz; //Km/h
+  windPulses = 0;
+
   if(windSpeed < 0){
     windSpeed = 0;
   }
@@ -328,26 +521,34 @@ String Sensors::getWindSpeed()
   return String(windSpeed);
 }
 
+// Largest mean over GUST_SECONDS consecutive seconds of the minute
+String Sensors::getWindGust()
+{
+  windGust = (float)gustPulses/GUST_SECONDS*anemoKmhPerHz; //Km/h
+  gustPulses = 0;
+
+  if(windGust > 255){
+    windGust = 255;
+  }
+  return String(windGust);
+}
+
+// Vector mean, the vane vectors are weighted by the wind run of each second
+// and are used alone in a calm minute
 String Sensors::getWindDirection()
 {
-  int direction = 0;
-  int mostDirection = 0;
-
-  for(int i=0; i<8; i++){
-    if(windDirection[i] > mostDirection){
-      mostDirection = windDirection[i];
-      if(i == 0) direction = 0;
-      if(i == 1) direction = 45;
-      if(i == 2) direction = 90;
-      if(i == 3) direction = 135;
-      if(i == 4) direction = 180;
-      if(i == 5) direction = 225;
-      if(i == 6) direction = 270;
-      if(i == 7) direction = 315;
-    }
+  float east = windEast;
+  float north = windNorth;
+  if(east == 0 && north == 0){
+    east = vaneEast;
+    north = vaneNorth;
   }
 
-  return String(direction);
+  int direction = lroundf(atan2f(east, north)*180/pi);
+  if(direction < 0){
+    direction += 360;
+  }
+  return String(direction % 360);
 }
 
 String Sensors::getRain()
@@ -363,7 +564,7 @@ String Sensors::getRain()
 
 String Sensors::getPVtemp()
 {
-  PVtemp = PVtemp/readTimes;
+  PVtemp = PVtempTimes > 0 ? PVtempCenti/100.0/PVtempTimes : 0;
   if(PVtemp < -40 ){
     PVtemp = -40;
   }
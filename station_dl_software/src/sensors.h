@@ -20,67 +20,136 @@
 #include <Adafruit_Sensor.h>
 #include <Adafruit_ADS1015.h>
 #include "uFire_SHT20.h"
+#include "lut.h"
+#include "pulsecounter.h"
+#include "scheduler.h"
+#include "adcstream.h"
 
 //Sensors Pins
 #define windDirPin  32
 #define pluvPin     33
 #define tempPin     36
 #define anemoPin    35
+#define adsRdyPin   23   // ADS1115(0x48) ALERT/RDY
+#define anemoUnit   0    // PCNT units
+#define pluvUnit    1
 #define adc1Add 0x48
 #define adc2Add 0x49
+#define shtAdd  0x40
 
 
 //Constants
 //ADS1015
 #define adsGain1 0.0000078125
 #define adsGain2 0.0001875
+//Scheduled sensors and their default periods (ms), wind and rain follow
+//the 1 s RTC tick for the gust
+#define SENSOR_IRRADIANCE 0
+#define SENSOR_PVTEMP     1
+#define SENSOR_AMBIENT    2   // SHT20 temperature and humidity
+#define SENSOR_SCHEDULED  3
+#define IRRADIANCE_PERIOD 100
+#define PVTEMP_PERIOD     1000
+#define AMBIENT_PERIOD    10000
+//ADS1115 registers, the irradiance ADC converts AIN0-AIN1 continuously at
+//+-0.256 V, at the lowest data rate that keeps up with the irradiance
+//period, and pulses ALERT/RDY low after each conversion
+#define ADS_REG_CONVERSION 0x00
+#define ADS_REG_CONFIG     0x01
+#define ADS_REG_LO_THRESH  0x02
+#define ADS_REG_HI_THRESH  0x03
+#define ADS_CONFIG_IRRADIANCE 0x0A00  // data rate bits 7:5 clear
+#define ADS_RDY_TIMEOUT    1000       // ms without RDY edges to read anyway
+//SHT20 no hold master measurements, 14 bits temperature and 12 bits humidity
+#define SHT_TRIGGER_TEMP 0xF3
+#define SHT_TRIGGER_HUMI 0xF5
+#define SHT_TEMP_TIME    85  // ms
+#define SHT_HUMI_TIME    29  // ms
+#define SHT_IDLE  0
+#define SHT_TEMP  1
+#define SHT_HUMI  2
+#define SHT_RETRY 5   // ms between reads the SHT20 NACKs
 //Anemo
 #define pi 3.14159265
 #define radius 147
-//Temp
-const double BCOEFFICIENT = 3950.0;
-const double THERMISTORNOMINAL = 10000.0;
-const double TEMPERATURENOMINAL = 25.0;
+#define anemoKmhPerHz ((4 * pi * radius / 1000) * 3.6)
+#define GUST_SECONDS 3
 
 class Sensors
 {
 private:
   //Sensors objects
   uFire_SHT20 sht20;
-  Adafruit_ADS1115 ads1;
   Adafruit_ADS1115 ads2;
 
   //Atributes
   int readTimes;
+  int tempTimes;
+  int humidityTimes;
+  int irradianceTimes;
+  int PVtempTimes;
   float temp;
   float pressure;
   float humidity;
   float irradiance;
+  int64_t irradianceSum;  // ADS1115 codes
   float windSpeed;
-  int* windDirection;
+  float windGust;
   float rain;
   float PVtemp;
+  int32_t PVtempCenti;
   float voltage;
   float current;
 
   //Sensors variables
-  static unsigned int anemCounter; // magnet counter for sensor
-  static unsigned int pluvCounter; // magnet counter for sensor
+  PulseCounter anemometer;
+  PulseCounter pluviometer;
+  AdcStream adcStream;               // PV temperature and vane, when streaming
+  bool streaming;
+  uint32_t windPulses;               // this minute
+  uint32_t rainPulses;               // this day
+  uint32_t gustWindow[GUST_SECONDS]; // pulses of the last seconds
+  uint32_t gustPulses;               // largest window this minute
+  int gustSlot;
+  float windEast;                    // vane vectors weighted by the pulses
+  float windNorth;
+  float vaneEast;                    // unit vane vectors, for calm minutes
+  float vaneNorth;
+  static volatile bool adsReady;     // conversion waiting in the ADS1115
 
   //Sensors aux variables
   int act_time;
+  Scheduler scheduler;
+  unsigned long lastRdy;
+  uint8_t shtState;
+  unsigned long shtStart;
 
   //Sensors aux functions
 public:
   void init();
   void readAllData(float currGain, float voltGain);
+  uint32_t poll();
   String getAvgData();
+  void setPeriod(int sensor, uint32_t periodMs);
+  void printSchedule();
+#ifndef ESP_PLATFORM
+  //Host builds, the stand-ins the bench feeds
+  PulseCounter &getAnemometer() { return anemometer; }
+  PulseCounter &getPluviometer() { return pluviometer; }
+  AdcStream &getAdcStream() { return adcStream; }
+#endif
 
 private:
-  void readTemp();
-  void readHumidity();
+  bool startIradiance();
   void readIradiance();
-  void readWindDirection();
+  void sampleIradiance();
+  void startAmbient();
+  void serviceSht();
+  uint32_t shtWait();
+  bool startSht(uint8_t command);
+  bool readSht(uint16_t *raw);
+  bool writeRegister(uint8_t address, uint8_t reg, uint16_t value);
+  void readWind();
   void readRain();
   void readPVtemp();
   void readVoltage(float gain);
@@ -89,6 +158,7 @@ private:
   String getHumidity();
   String getIradiance();
   String getWindSpeed();
+  String getWindGust();
   String getWindDirection();
   String getRain();
   String getPVtemp();
@@ -97,9 +167,10 @@ private:
 
   //Sensors aux functions
 public:
-  void setAnemCounter0();
   void setPluvCounter0();
 private:
-  static void addAnemCounter();
-  static void addPluvCounter();
+  static void addAdsReady();
+  static void irradianceJob(void *sensors);
+  static void PVtempJob(void *sensors);
+  static void ambientJob(void *sensors);
 };
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for share the SPI bus between SD, LoRa and ADCs
+*****************************************************************************/
+
+#ifndef SPIBUS_H
+#define SPIBUS_H
+
+#include <Arduino.h>
+
+// Bus clients
+#define SPI_CLIENT_ADC   0
+#define SPI_CLIENT_SD    1
+#define SPI_CLIENT_LORA  2
+#define SPI_CLIENTS      3
+
+// FreeRTOS mutex around the shared bus. A mutex (not a binary semaphore)
+// gets priority inheritance: a low priority task holding the bus runs at
+// the priority of the task waiting for it. Callers keep each hold short,
+// one file chunk or one radio operation, so the sampling task never waits
+// more than one of them.
+class SpiBus
+{
+private:
+  SemaphoreHandle_t mutex = NULL;
+  portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;  // timeouts, counted without the bus
+  unsigned long grantedAt = 0;
+
+  struct ClientStats {
+    uint32_t grants;
+    uint32_t contended;  // grants that had to wait
+    uint32_t timeouts;
+    uint64_t waitUs;
+    uint32_t maxWaitUs;
+    uint64_t holdUs;
+    uint32_t maxHoldUs;
+  } stats[SPI_CLIENTS];
+
+public:
+  void begin();
+  bool take(int client, TickType_t timeout = portMAX_DELAY);
+  void give(int client);
+  void printStats();
+  void resetStats();
+};
+
+#endif
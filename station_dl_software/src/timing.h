@@ -0,0 +1,61 @@
+/******************************************************************************
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+******************************************************************************
+* AUTHOR      : Gustavo Costa Gomes de Melo (gustavocosta@ic.ufal.br)
+* CREATE DATE : 10/19/2026
+* PURPOSE     : Code for timing the acquisition stages of the data loggers
+*****************************************************************************/
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <Arduino.h>
+#include "esp_timer.h"
+#include "DataEncDec.h"
+
+#define DIAG_INTERVAL 10  // minutes between diagnostics records
+
+// Fixed-bucket histogram of durations in us, record() is a few compares
+// and increments
+class TimingHistogram
+{
+public:
+  uint32_t buckets[DIAG_BUCKETS];
+  uint32_t count;
+  uint64_t sum;
+  uint32_t max;
+
+  void record(uint32_t us);
+  void reset();
+  uint32_t percentile(uint8_t p);
+};
+
+// One histogram per stage, shared by the tasks that time them. Stages are
+// timed with esp_timer_get_time(), the 1 us clock that runs from boot.
+class Timing
+{
+private:
+  TimingHistogram stages[DIAG_STAGES];
+  portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+  int64_t lastTick = 0;
+
+public:
+  Timing();
+  static int64_t now();
+  void tick(uint32_t expectedUs);
+  void record(int stage, int64_t start);
+  void take(TimingHistogram *out);
+  void print();
+};
+
+#endif